@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "j9avl" for configuration ""
+set_property(TARGET j9avl APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(j9avl PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libj9avl.a"
+  )
+
+list(APPEND _cmake_import_check_targets j9avl )
+list(APPEND _cmake_import_check_files_for_j9avl "${_IMPORT_PREFIX}/lib/libj9avl.a" )
+
+# Import target "omrsig" for configuration ""
+set_property(TARGET omrsig APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(omrsig PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libomrsig.so"
+  IMPORTED_SONAME_NOCONFIG "libomrsig.so"
+  )
+
+list(APPEND _cmake_import_check_targets omrsig )
+list(APPEND _cmake_import_check_files_for_omrsig "${_IMPORT_PREFIX}/lib/libomrsig.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
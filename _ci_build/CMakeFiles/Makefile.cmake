@@ -0,0 +1,233 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/OmrConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CheckSourceTree.cmake"
+  "/root/repo/cmake/config.cmake"
+  "/root/repo/cmake/modules/OmrAssert.cmake"
+  "/root/repo/cmake/modules/OmrDDRSupport.cmake"
+  "/root/repo/cmake/modules/OmrDetectSystemInformation.cmake"
+  "/root/repo/cmake/modules/OmrFindFiles.cmake"
+  "/root/repo/cmake/modules/OmrHookgen.cmake"
+  "/root/repo/cmake/modules/OmrMsvcRuntime.cmake"
+  "/root/repo/cmake/modules/OmrOption.cmake"
+  "/root/repo/cmake/modules/OmrPlatform.cmake"
+  "/root/repo/cmake/modules/OmrSanitizerSupport.cmake"
+  "/root/repo/cmake/modules/OmrTracegen.cmake"
+  "/root/repo/cmake/modules/OmrUtility.cmake"
+  "/root/repo/cmake/modules/platform/arch/x86.cmake"
+  "/root/repo/cmake/modules/platform/os/linux.cmake"
+  "/root/repo/cmake/modules/platform/toolcfg/gnu.cmake"
+  "/root/repo/cmake/modules/platform/toolcfg/verify.cmake"
+  "/root/repo/cmake/versions.cmake"
+  "/root/repo/example/CMakeLists.txt"
+  "/root/repo/example/glue/CMakeLists.txt"
+  "/root/repo/fvtest/CMakeLists.txt"
+  "/root/repo/fvtest/algotest/CMakeLists.txt"
+  "/root/repo/fvtest/algotest/hooksample.hdf"
+  "/root/repo/fvtest/coretest/CMakeLists.txt"
+  "/root/repo/fvtest/gctest/CMakeLists.txt"
+  "/root/repo/fvtest/omrGtestGlue/CMakeLists.txt"
+  "/root/repo/fvtest/porttest/CMakeLists.txt"
+  "/root/repo/fvtest/rastest/CMakeLists.txt"
+  "/root/repo/fvtest/sigtest/CMakeLists.txt"
+  "/root/repo/fvtest/threadextendedtest/CMakeLists.txt"
+  "/root/repo/fvtest/threadtest/CMakeLists.txt"
+  "/root/repo/fvtest/util/CMakeLists.txt"
+  "/root/repo/fvtest/utiltest/CMakeLists.txt"
+  "/root/repo/fvtest/vmtest/CMakeLists.txt"
+  "/root/repo/gc/CMakeLists.txt"
+  "/root/repo/gc/base/omrmmprivate.hdf"
+  "/root/repo/gc/include/omrmm.hdf"
+  "/root/repo/omr/CMakeLists.txt"
+  "/root/repo/omr/startup/CMakeLists.txt"
+  "/root/repo/omrcfg.CMakeTemplate.h"
+  "/root/repo/omrsigcompat/CMakeLists.txt"
+  "/root/repo/omrtrace/CMakeLists.txt"
+  "/root/repo/omrversionstrings.CMakeTemplate.h"
+  "/root/repo/port/CMakeLists.txt"
+  "/root/repo/third_party/CMakeLists.txt"
+  "/root/repo/third_party/pugixml-1.5/CMakeLists.txt"
+  "/root/repo/thread/CMakeLists.txt"
+  "/root/repo/thread/exports.cmake"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/hookgen/CMakeLists.txt"
+  "/root/repo/tools/tracegen/CMakeLists.txt"
+  "/root/repo/tools/tracemerge/CMakeLists.txt"
+  "/root/repo/tools/vgcdecode/CMakeLists.txt"
+  "/root/repo/util/CMakeLists.txt"
+  "/root/repo/util/avl/CMakeLists.txt"
+  "/root/repo/util/hashtable/CMakeLists.txt"
+  "/root/repo/util/hookable/CMakeLists.txt"
+  "/root/repo/util/main_function/CMakeLists.txt"
+  "/root/repo/util/omrutil/CMakeLists.txt"
+  "/root/repo/util/pool/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA/select_compute_arch.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "omrcfg.h"
+  "omrversionstrings.h"
+  "OmrConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/hookgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/tracemerge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/tracegen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/vgcdecode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "example/glue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thread/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "port/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/avl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/hashtable/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/hookable/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/main_function/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/omrutil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/pool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "omr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "omr/startup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/pugixml-1.5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "omrsigcompat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "omrtrace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "gc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/omrGtestGlue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/algotest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/coretest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/porttest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/rastest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/sigtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/threadextendedtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/threadtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/utiltest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/vmtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fvtest/gctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/run_tracegen.dir/DependInfo.cmake"
+  "CMakeFiles/run_tracemerge.dir/DependInfo.cmake"
+  "CMakeFiles/header_check.dir/DependInfo.cmake"
+  "tools/hookgen/CMakeFiles/hookgen.dir/DependInfo.cmake"
+  "tools/tracemerge/CMakeFiles/tracemerge.dir/DependInfo.cmake"
+  "tools/tracegen/CMakeFiles/tracegen.dir/DependInfo.cmake"
+  "tools/tracegen/CMakeFiles/trace.dir/DependInfo.cmake"
+  "tools/vgcdecode/CMakeFiles/vgcdecode.dir/DependInfo.cmake"
+  "example/CMakeFiles/gcexample.dir/DependInfo.cmake"
+  "thread/CMakeFiles/trc_j9thr.dir/DependInfo.cmake"
+  "thread/CMakeFiles/j9thr_obj.dir/DependInfo.cmake"
+  "thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "port/CMakeFiles/trc_omrport.dir/DependInfo.cmake"
+  "port/CMakeFiles/omrport_obj.dir/DependInfo.cmake"
+  "port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "util/avl/CMakeFiles/trc_avl.dir/DependInfo.cmake"
+  "util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "util/hashtable/CMakeFiles/trc_hashtable.dir/DependInfo.cmake"
+  "util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "util/hookable/CMakeFiles/j9hook_obj.dir/DependInfo.cmake"
+  "util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "util/hookable/CMakeFiles/trc_j9hook.dir/DependInfo.cmake"
+  "util/omrutil/CMakeFiles/trc_j9utilcore.dir/DependInfo.cmake"
+  "util/omrutil/CMakeFiles/omrutil_obj.dir/DependInfo.cmake"
+  "util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "util/pool/CMakeFiles/trc_pool.dir/DependInfo.cmake"
+  "util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  "omr/CMakeFiles/trc_omrti.dir/DependInfo.cmake"
+  "omr/CMakeFiles/trc_omrvm.dir/DependInfo.cmake"
+  "omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "third_party/pugixml-1.5/CMakeFiles/pugixml.dir/DependInfo.cmake"
+  "omrsigcompat/CMakeFiles/omrsig.dir/DependInfo.cmake"
+  "omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "gc/CMakeFiles/omrgc_hookgen.dir/DependInfo.cmake"
+  "gc/CMakeFiles/trc_j9mm.dir/DependInfo.cmake"
+  "gc/CMakeFiles/trc_omrmm.dir/DependInfo.cmake"
+  "gc/CMakeFiles/trc_j9vgc.dir/DependInfo.cmake"
+  "gc/CMakeFiles/omrgc_tracegen.dir/DependInfo.cmake"
+  "gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "fvtest/algotest/CMakeFiles/omralgotest.dir/DependInfo.cmake"
+  "fvtest/coretest/CMakeFiles/TestBytes.dir/DependInfo.cmake"
+  "fvtest/coretest/CMakeFiles/TestIntrusiveList.dir/DependInfo.cmake"
+  "fvtest/coretest/CMakeFiles/TestTypeTraits.dir/DependInfo.cmake"
+  "fvtest/porttest/CMakeFiles/omrporttest.dir/DependInfo.cmake"
+  "fvtest/porttest/CMakeFiles/sltestlib.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/trc_omr_test.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/bindthreadagent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/memorycategoriesagent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/traceagent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/traceNotStartedAgent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/cpuLoadAgent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/invalidAgentMissingOnLoad.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/invalidAgentMissingOnUnload.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/invalidAgentReturnError.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/sampleSubscriber.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/subscriberAgent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/subscriberAgentWithJ9thread.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/traceOptionAgent.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/omrrastest.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/omrsubscribertest.dir/DependInfo.cmake"
+  "fvtest/rastest/CMakeFiles/omrtraceoptiontest.dir/DependInfo.cmake"
+  "fvtest/sigtest/CMakeFiles/omrsigtest.dir/DependInfo.cmake"
+  "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/DependInfo.cmake"
+  "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/DependInfo.cmake"
+  "fvtest/utiltest/CMakeFiles/omrutiltest.dir/DependInfo.cmake"
+  "fvtest/vmtest/CMakeFiles/omrvmtest.dir/DependInfo.cmake"
+  "fvtest/gctest/CMakeFiles/omrgctest.dir/DependInfo.cmake"
+  )
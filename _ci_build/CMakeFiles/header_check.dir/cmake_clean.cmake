@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/header_check"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/header_check.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
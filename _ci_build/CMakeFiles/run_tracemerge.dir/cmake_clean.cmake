@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_tracemerge"
+  "tracemerge.stamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run_tracemerge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
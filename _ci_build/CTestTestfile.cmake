@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_ci_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tools")
+subdirs("example")
+subdirs("thread")
+subdirs("port")
+subdirs("util")
+subdirs("omr")
+subdirs("third_party")
+subdirs("omrsigcompat")
+subdirs("omrtrace")
+subdirs("gc")
+subdirs("fvtest")
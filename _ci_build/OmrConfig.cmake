@@ -0,0 +1 @@
+include("${CMAKE_CURRENT_LIST_DIR}/OmrTargets.cmake")
\ No newline at end of file
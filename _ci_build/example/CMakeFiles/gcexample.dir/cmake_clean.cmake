@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gcexample.dir/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/gcexample.dir/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/gcexample.dir/gcmain.cpp.o"
+  "CMakeFiles/gcexample.dir/gcmain.cpp.o.d"
+  "gcexample"
+  "gcexample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gcexample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/example
+# Build directory: /root/repo/_ci_build/example
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(gcexample "/root/repo/_ci_build/example/gcexample")
+set_tests_properties(gcexample PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/example/CMakeLists.txt;53;add_test;/root/repo/example/CMakeLists.txt;0;")
+subdirs("glue")
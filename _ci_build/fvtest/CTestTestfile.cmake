@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest
+# Build directory: /root/repo/_ci_build/fvtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("util")
+subdirs("omrGtestGlue")
+subdirs("algotest")
+subdirs("coretest")
+subdirs("porttest")
+subdirs("rastest")
+subdirs("sigtest")
+subdirs("threadextendedtest")
+subdirs("threadtest")
+subdirs("utiltest")
+subdirs("vmtest")
+subdirs("gctest")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omralgotest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omralgotest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omralgotest.dir/algoTest.cpp.o"
+  "CMakeFiles/omralgotest.dir/algoTest.cpp.o.d"
+  "CMakeFiles/omralgotest.dir/avltest.c.o"
+  "CMakeFiles/omralgotest.dir/avltest.c.o.d"
+  "CMakeFiles/omralgotest.dir/hashtabletest.c.o"
+  "CMakeFiles/omralgotest.dir/hashtabletest.c.o.d"
+  "CMakeFiles/omralgotest.dir/hooktest.c.o"
+  "CMakeFiles/omralgotest.dir/hooktest.c.o.d"
+  "CMakeFiles/omralgotest.dir/main.cpp.o"
+  "CMakeFiles/omralgotest.dir/main.cpp.o.d"
+  "CMakeFiles/omralgotest.dir/pooltest.c.o"
+  "CMakeFiles/omralgotest.dir/pooltest.c.o.d"
+  "hooksample.h"
+  "hooksample_internal.h"
+  "omralgotest"
+  "omralgotest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omralgotest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
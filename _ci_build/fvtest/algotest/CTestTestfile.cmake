@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/algotest
+# Build directory: /root/repo/_ci_build/fvtest/algotest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(algotest "/root/repo/_ci_build/fvtest/algotest/omralgotest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/algotest/omralgotest-results.xml" "-avltest:/root/repo/fvtest/algotest/avltest.lst")
+set_tests_properties(algotest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/algotest/CMakeLists.txt;67;add_test;/root/repo/fvtest/algotest/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TestBytes.dir/TestBytes.cpp.o"
+  "CMakeFiles/TestBytes.dir/TestBytes.cpp.o.d"
+  "CMakeFiles/TestBytes.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/TestBytes.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/TestBytes.dir/main.cpp.o"
+  "CMakeFiles/TestBytes.dir/main.cpp.o.d"
+  "TestBytes"
+  "TestBytes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestBytes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
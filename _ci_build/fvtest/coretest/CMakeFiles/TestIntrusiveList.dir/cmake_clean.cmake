@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TestIntrusiveList.dir/TestIntrusiveList.cpp.o"
+  "CMakeFiles/TestIntrusiveList.dir/TestIntrusiveList.cpp.o.d"
+  "CMakeFiles/TestIntrusiveList.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/TestIntrusiveList.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/TestIntrusiveList.dir/main.cpp.o"
+  "CMakeFiles/TestIntrusiveList.dir/main.cpp.o.d"
+  "TestIntrusiveList"
+  "TestIntrusiveList.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestIntrusiveList.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TestTypeTraits.dir/TestTypeTraits.cpp.o"
+  "CMakeFiles/TestTypeTraits.dir/TestTypeTraits.cpp.o.d"
+  "CMakeFiles/TestTypeTraits.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/TestTypeTraits.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/TestTypeTraits.dir/main.cpp.o"
+  "CMakeFiles/TestTypeTraits.dir/main.cpp.o.d"
+  "TestTypeTraits"
+  "TestTypeTraits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestTypeTraits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
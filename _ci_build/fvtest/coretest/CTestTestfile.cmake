@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/coretest
+# Build directory: /root/repo/_ci_build/fvtest/coretest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(TestBytes "/root/repo/_ci_build/fvtest/coretest/TestBytes" "--gtest_output=xml:/root/repo/_ci_build/fvtest/coretest/TestBytes-results.xml")
+set_tests_properties(TestBytes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/coretest/CMakeLists.txt;34;add_test;/root/repo/fvtest/coretest/CMakeLists.txt;40;omr_add_core_test;/root/repo/fvtest/coretest/CMakeLists.txt;0;")
+add_test(TestIntrusiveList "/root/repo/_ci_build/fvtest/coretest/TestIntrusiveList" "--gtest_output=xml:/root/repo/_ci_build/fvtest/coretest/TestIntrusiveList-results.xml")
+set_tests_properties(TestIntrusiveList PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/coretest/CMakeLists.txt;34;add_test;/root/repo/fvtest/coretest/CMakeLists.txt;41;omr_add_core_test;/root/repo/fvtest/coretest/CMakeLists.txt;0;")
+add_test(TestTypeTraits "/root/repo/_ci_build/fvtest/coretest/TestTypeTraits" "--gtest_output=xml:/root/repo/_ci_build/fvtest/coretest/TestTypeTraits-results.xml")
+set_tests_properties(TestTypeTraits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/coretest/CMakeLists.txt;34;add_test;/root/repo/fvtest/coretest/CMakeLists.txt;42;omr_add_core_test;/root/repo/fvtest/coretest/CMakeLists.txt;0;")
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/fvtest/gctest/GCConfigObjectTable.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/GCConfigObjectTable.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/GCConfigObjectTable.cpp.o.d"
+  "/root/repo/fvtest/gctest/GCConfigTest.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/GCConfigTest.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/GCConfigTest.cpp.o.d"
+  "/root/repo/fvtest/gctest/StartupManagerTestExample.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/StartupManagerTestExample.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/StartupManagerTestExample.cpp.o.d"
+  "/root/repo/fvtest/gctest/TestHeapMapScan.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestHeapMapScan.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestHeapMapScan.cpp.o.d"
+  "/root/repo/fvtest/gctest/TestHeapRegionStateTable.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestHeapRegionStateTable.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestHeapRegionStateTable.cpp.o.d"
+  "/root/repo/fvtest/gctest/TestVerboseBinaryFormat.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestVerboseBinaryFormat.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestVerboseBinaryFormat.cpp.o.d"
+  "/root/repo/fvtest/gctest/TestVerboseGCLogReader.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestVerboseGCLogReader.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/TestVerboseGCLogReader.cpp.o.d"
+  "/root/repo/perftest/gctest/verboseGCLogAnalyzer.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogAnalyzer.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogAnalyzer.cpp.o.d"
+  "/root/repo/perftest/gctest/verboseGCLogReader.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogReader.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogReader.cpp.o.d"
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/gctest/gcTestHelpers.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/gcTestHelpers.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/gcTestHelpers.cpp.o.d"
+  "/root/repo/fvtest/gctest/main.cpp" "fvtest/gctest/CMakeFiles/omrgctest.dir/main.cpp.o" "gcc" "fvtest/gctest/CMakeFiles/omrgctest.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/third_party/pugixml-1.5/CMakeFiles/pugixml.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrgctest.dir/GCConfigObjectTable.cpp.o"
+  "CMakeFiles/omrgctest.dir/GCConfigObjectTable.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/GCConfigTest.cpp.o"
+  "CMakeFiles/omrgctest.dir/GCConfigTest.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/StartupManagerTestExample.cpp.o"
+  "CMakeFiles/omrgctest.dir/StartupManagerTestExample.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/TestHeapMapScan.cpp.o"
+  "CMakeFiles/omrgctest.dir/TestHeapMapScan.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/TestHeapRegionStateTable.cpp.o"
+  "CMakeFiles/omrgctest.dir/TestHeapRegionStateTable.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/TestVerboseBinaryFormat.cpp.o"
+  "CMakeFiles/omrgctest.dir/TestVerboseBinaryFormat.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/TestVerboseGCLogReader.cpp.o"
+  "CMakeFiles/omrgctest.dir/TestVerboseGCLogReader.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogAnalyzer.cpp.o"
+  "CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogAnalyzer.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogReader.cpp.o"
+  "CMakeFiles/omrgctest.dir/__/__/perftest/gctest/verboseGCLogReader.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrgctest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/gcTestHelpers.cpp.o"
+  "CMakeFiles/omrgctest.dir/gcTestHelpers.cpp.o.d"
+  "CMakeFiles/omrgctest.dir/main.cpp.o"
+  "CMakeFiles/omrgctest.dir/main.cpp.o.d"
+  "omrgctest"
+  "omrgctest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrgctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/gctest
+# Build directory: /root/repo/_ci_build/fvtest/gctest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(gctest "/root/repo/_ci_build/fvtest/gctest/omrgctest" "--gtest_filter=gcFunctionalTest*" "--gtest_output=xml:/root/repo/_ci_build/fvtest/gctest/omrgctest-results.xml")
+set_tests_properties(gctest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/fvtest/gctest/CMakeLists.txt;83;add_test;/root/repo/fvtest/gctest/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrGtest.dir/omrGtest.cpp.o"
+  "CMakeFiles/omrGtest.dir/omrGtest.cpp.o.d"
+  "libomrGtest.a"
+  "libomrGtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrGtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
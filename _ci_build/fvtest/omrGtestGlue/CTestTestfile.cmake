@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/omrGtestGlue
+# Build directory: /root/repo/_ci_build/fvtest/omrGtestGlue
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
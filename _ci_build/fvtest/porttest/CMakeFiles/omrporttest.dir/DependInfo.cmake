@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/porttest/fileTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/fileTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/fileTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/heapTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/heapTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/heapTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/main.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/main.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/main.cpp.o.d"
+  "/root/repo/fvtest/porttest/memTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/memTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/memTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrdumpTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrdumpTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrdumpTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrerrorTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrerrorTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrerrorTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrfileTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrfileTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrfileTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrfilestreamTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrfilestreamTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrfilestreamTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrheapTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrheapTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrheapTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrintrospectTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrintrospectTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrintrospectTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrmemTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrmemTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrmemTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrmmapTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrmmapTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrmmapTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrportTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrportTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrportTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrsignalExtendedTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrsignalExtendedTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrsignalExtendedTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrsignalTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrsignalTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrsignalTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrslTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrslTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrslTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrstrTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrstrTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrstrTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrtimeTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrtimeTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrtimeTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrttyExtendedTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrttyExtendedTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrttyExtendedTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrttyTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrttyTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrttyTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/omrvmemTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrvmemTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/omrvmemTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/si.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/si.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/si.cpp.o.d"
+  "/root/repo/fvtest/porttest/si_numcpusTest.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/si_numcpusTest.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/si_numcpusTest.cpp.o.d"
+  "/root/repo/fvtest/porttest/testHelpers.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/testHelpers.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/testHelpers.cpp.o.d"
+  "/root/repo/fvtest/porttest/testProcessHelpers.cpp" "fvtest/porttest/CMakeFiles/omrporttest.dir/testProcessHelpers.cpp.o" "gcc" "fvtest/porttest/CMakeFiles/omrporttest.dir/testProcessHelpers.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrporttest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrporttest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/fileTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/fileTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/heapTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/heapTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/main.cpp.o"
+  "CMakeFiles/omrporttest.dir/main.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/memTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/memTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrdumpTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrdumpTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrerrorTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrerrorTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrfileTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrfileTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrfilestreamTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrfilestreamTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrheapTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrheapTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrintrospectTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrintrospectTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrmemTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrmemTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrmmapTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrmmapTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrportTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrportTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrsignalExtendedTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrsignalExtendedTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrsignalTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrsignalTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrslTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrslTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrstrTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrstrTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrtimeTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrtimeTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrttyExtendedTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrttyExtendedTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrttyTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrttyTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/omrvmemTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/omrvmemTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/si.cpp.o"
+  "CMakeFiles/omrporttest.dir/si.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/si_numcpusTest.cpp.o"
+  "CMakeFiles/omrporttest.dir/si_numcpusTest.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/testHelpers.cpp.o"
+  "CMakeFiles/omrporttest.dir/testHelpers.cpp.o.d"
+  "CMakeFiles/omrporttest.dir/testProcessHelpers.cpp.o"
+  "CMakeFiles/omrporttest.dir/testProcessHelpers.cpp.o.d"
+  "omrporttest"
+  "omrporttest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrporttest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sltestlib.dir/sltestlib/sltest.c.o"
+  "CMakeFiles/sltestlib.dir/sltestlib/sltest.c.o.d"
+  "libsltestlib.pdb"
+  "libsltestlib.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sltestlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/porttest
+# Build directory: /root/repo/_ci_build/fvtest/porttest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(porttest "/root/repo/_ci_build/fvtest/porttest/omrporttest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/porttest/omrporttest-results.xml")
+set_tests_properties(porttest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/porttest/CMakeLists.txt;116;add_test;/root/repo/fvtest/porttest/CMakeLists.txt;0;")
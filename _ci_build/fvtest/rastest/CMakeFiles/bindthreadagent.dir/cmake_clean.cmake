@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bindthreadagent.dir/bindthreadagent.c.o"
+  "CMakeFiles/bindthreadagent.dir/bindthreadagent.c.o.d"
+  "libbindthreadagent.pdb"
+  "libbindthreadagent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bindthreadagent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpuLoadAgent.dir/cpuLoadAgent.c.o"
+  "CMakeFiles/cpuLoadAgent.dir/cpuLoadAgent.c.o.d"
+  "libcpuLoadAgent.pdb"
+  "libcpuLoadAgent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpuLoadAgent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/invalidAgentMissingOnLoad.dir/invalidAgentMissingOnLoad.c.o"
+  "CMakeFiles/invalidAgentMissingOnLoad.dir/invalidAgentMissingOnLoad.c.o.d"
+  "libinvalidAgentMissingOnLoad.pdb"
+  "libinvalidAgentMissingOnLoad.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/invalidAgentMissingOnLoad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/invalidAgentMissingOnUnload.dir/invalidAgentMissingOnUnload.c.o"
+  "CMakeFiles/invalidAgentMissingOnUnload.dir/invalidAgentMissingOnUnload.c.o.d"
+  "libinvalidAgentMissingOnUnload.pdb"
+  "libinvalidAgentMissingOnUnload.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/invalidAgentMissingOnUnload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/invalidAgentReturnError.dir/invalidAgentReturnError.c.o"
+  "CMakeFiles/invalidAgentReturnError.dir/invalidAgentReturnError.c.o.d"
+  "libinvalidAgentReturnError.pdb"
+  "libinvalidAgentReturnError.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/invalidAgentReturnError.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
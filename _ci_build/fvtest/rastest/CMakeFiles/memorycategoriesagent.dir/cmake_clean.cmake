@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memorycategoriesagent.dir/memorycategoriesagent.c.o"
+  "CMakeFiles/memorycategoriesagent.dir/memorycategoriesagent.c.o.d"
+  "libmemorycategoriesagent.pdb"
+  "libmemorycategoriesagent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memorycategoriesagent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
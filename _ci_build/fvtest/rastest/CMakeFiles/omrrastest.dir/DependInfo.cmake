@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_ci_build/fvtest/rastest/ut_omr_test.c" "fvtest/rastest/CMakeFiles/omrrastest.dir/ut_omr_test.c.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/ut_omr_test.c.o.d"
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/rastest/agentNegativeTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/agentNegativeTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/agentNegativeTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/agentTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/agentTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/agentTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/main.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/main.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/main.cpp.o.d"
+  "/root/repo/fvtest/rastest/memoryCategoriesTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/memoryCategoriesTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/memoryCategoriesTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/methodDictionaryTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/methodDictionaryTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/methodDictionaryTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/rasTestHelpers.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/rasTestHelpers.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/rasTestHelpers.cpp.o.d"
+  "/root/repo/fvtest/rastest/traceLifecycleTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceLifecycleTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceLifecycleTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/traceLogTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceLogTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceLogTest.cpp.o.d"
+  "/root/repo/fvtest/rastest/traceRecordHelpers.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceRecordHelpers.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceRecordHelpers.cpp.o.d"
+  "/root/repo/fvtest/rastest/traceTest.cpp" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceTest.cpp.o" "gcc" "fvtest/rastest/CMakeFiles/omrrastest.dir/traceTest.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/fvtest/rastest/ut_omr_test.h" "/root/repo/_ci_build/fvtest/rastest/ut_omr_test.c"
+  "/root/repo/_ci_build/fvtest/rastest/ut_omr_test.pdat" "/root/repo/_ci_build/fvtest/rastest/ut_omr_test.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,36 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrrastest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrrastest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/agentNegativeTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/agentNegativeTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/agentTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/agentTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/main.cpp.o"
+  "CMakeFiles/omrrastest.dir/main.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/memoryCategoriesTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/memoryCategoriesTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/methodDictionaryTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/methodDictionaryTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/rasTestHelpers.cpp.o"
+  "CMakeFiles/omrrastest.dir/rasTestHelpers.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/traceLifecycleTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/traceLifecycleTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/traceLogTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/traceLogTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/traceRecordHelpers.cpp.o"
+  "CMakeFiles/omrrastest.dir/traceRecordHelpers.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/traceTest.cpp.o"
+  "CMakeFiles/omrrastest.dir/traceTest.cpp.o.d"
+  "CMakeFiles/omrrastest.dir/ut_omr_test.c.o"
+  "CMakeFiles/omrrastest.dir/ut_omr_test.c.o.d"
+  "omrrastest"
+  "omrrastest.pdb"
+  "ut_omr_test.c"
+  "ut_omr_test.h"
+  "ut_omr_test.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrrastest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
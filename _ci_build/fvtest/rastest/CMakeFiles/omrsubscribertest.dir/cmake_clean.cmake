@@ -0,0 +1,24 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrsubscribertest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrsubscribertest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrsubscribertest.dir/main.cpp.o"
+  "CMakeFiles/omrsubscribertest.dir/main.cpp.o.d"
+  "CMakeFiles/omrsubscribertest.dir/rasTestHelpers.cpp.o"
+  "CMakeFiles/omrsubscribertest.dir/rasTestHelpers.cpp.o.d"
+  "CMakeFiles/omrsubscribertest.dir/subscriberForkTest.cpp.o"
+  "CMakeFiles/omrsubscribertest.dir/subscriberForkTest.cpp.o.d"
+  "CMakeFiles/omrsubscribertest.dir/subscriberTest.cpp.o"
+  "CMakeFiles/omrsubscribertest.dir/subscriberTest.cpp.o.d"
+  "CMakeFiles/omrsubscribertest.dir/ut_omr_test.c.o"
+  "CMakeFiles/omrsubscribertest.dir/ut_omr_test.c.o.d"
+  "omrsubscribertest"
+  "omrsubscribertest.pdb"
+  "ut_omr_test.c"
+  "ut_omr_test.h"
+  "ut_omr_test.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrsubscribertest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
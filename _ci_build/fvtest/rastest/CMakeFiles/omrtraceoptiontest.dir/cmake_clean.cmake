@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrtraceoptiontest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrtraceoptiontest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrtraceoptiontest.dir/main.cpp.o"
+  "CMakeFiles/omrtraceoptiontest.dir/main.cpp.o.d"
+  "CMakeFiles/omrtraceoptiontest.dir/rasTestHelpers.cpp.o"
+  "CMakeFiles/omrtraceoptiontest.dir/rasTestHelpers.cpp.o.d"
+  "CMakeFiles/omrtraceoptiontest.dir/traceOptionTest.cpp.o"
+  "CMakeFiles/omrtraceoptiontest.dir/traceOptionTest.cpp.o.d"
+  "CMakeFiles/omrtraceoptiontest.dir/ut_omr_test.c.o"
+  "CMakeFiles/omrtraceoptiontest.dir/ut_omr_test.c.o.d"
+  "omrtraceoptiontest"
+  "omrtraceoptiontest.pdb"
+  "ut_omr_test.c"
+  "ut_omr_test.h"
+  "ut_omr_test.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrtraceoptiontest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sampleSubscriber.dir/sampleSubscriber.c.o"
+  "CMakeFiles/sampleSubscriber.dir/sampleSubscriber.c.o.d"
+  "libsampleSubscriber.pdb"
+  "libsampleSubscriber.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sampleSubscriber.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
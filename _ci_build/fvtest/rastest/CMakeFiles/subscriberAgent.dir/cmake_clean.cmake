@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscriberAgent.dir/subscriberAgent.c.o"
+  "CMakeFiles/subscriberAgent.dir/subscriberAgent.c.o.d"
+  "libsubscriberAgent.pdb"
+  "libsubscriberAgent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/subscriberAgent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/subscriberAgentWithJ9thread.dir/subscriberAgentWithJ9thread.c.o"
+  "CMakeFiles/subscriberAgentWithJ9thread.dir/subscriberAgentWithJ9thread.c.o.d"
+  "libsubscriberAgentWithJ9thread.pdb"
+  "libsubscriberAgentWithJ9thread.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/subscriberAgentWithJ9thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
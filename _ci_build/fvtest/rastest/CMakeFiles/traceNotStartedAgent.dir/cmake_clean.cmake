@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceNotStartedAgent.dir/traceNotStartedAgent.c.o"
+  "CMakeFiles/traceNotStartedAgent.dir/traceNotStartedAgent.c.o.d"
+  "libtraceNotStartedAgent.pdb"
+  "libtraceNotStartedAgent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/traceNotStartedAgent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceOptionAgent.dir/traceOptionAgent.c.o"
+  "CMakeFiles/traceOptionAgent.dir/traceOptionAgent.c.o.d"
+  "libtraceOptionAgent.pdb"
+  "libtraceOptionAgent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/traceOptionAgent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
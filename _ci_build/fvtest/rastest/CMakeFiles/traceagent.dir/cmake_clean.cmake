@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceagent.dir/traceagent.c.o"
+  "CMakeFiles/traceagent.dir/traceagent.c.o.d"
+  "libtraceagent.pdb"
+  "libtraceagent.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/traceagent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_omr_test"
+  "ut_omr_test.c"
+  "ut_omr_test.h"
+  "ut_omr_test.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_omr_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
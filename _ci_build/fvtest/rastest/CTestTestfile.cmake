@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/rastest
+# Build directory: /root/repo/_ci_build/fvtest/rastest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rastest "/root/repo/_ci_build/fvtest/rastest/omrrastest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/rastest/omrrastest-results.xml")
+set_tests_properties(rastest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/rastest/CMakeLists.txt;241;add_test;/root/repo/fvtest/rastest/CMakeLists.txt;0;")
+add_test(subscribertest "/root/repo/_ci_build/fvtest/rastest/omrsubscribertest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/rastest/omrsubscribertest-results.xml")
+set_tests_properties(subscribertest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/rastest/CMakeLists.txt;242;add_test;/root/repo/fvtest/rastest/CMakeLists.txt;0;")
+add_test(traceoptiontest "/root/repo/_ci_build/fvtest/rastest/omrtraceoptiontest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/rastest/omrtraceoptiontest-results.xml")
+set_tests_properties(traceoptiontest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/rastest/CMakeLists.txt;243;add_test;/root/repo/fvtest/rastest/CMakeLists.txt;0;")
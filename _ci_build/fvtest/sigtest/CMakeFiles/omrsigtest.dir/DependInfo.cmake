@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/sigtest/main.cpp" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/main.cpp.o" "gcc" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/main.cpp.o.d"
+  "/root/repo/fvtest/sigtest/sigTest.cpp" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/sigTest.cpp.o" "gcc" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/sigTest.cpp.o.d"
+  "/root/repo/fvtest/sigtest/sigTestHelpers.cpp" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/sigTestHelpers.cpp.o" "gcc" "fvtest/sigtest/CMakeFiles/omrsigtest.dir/sigTestHelpers.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrsigcompat/CMakeFiles/omrsig.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
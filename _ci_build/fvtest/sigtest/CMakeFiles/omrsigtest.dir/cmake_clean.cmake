@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrsigtest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrsigtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrsigtest.dir/main.cpp.o"
+  "CMakeFiles/omrsigtest.dir/main.cpp.o.d"
+  "CMakeFiles/omrsigtest.dir/sigTest.cpp.o"
+  "CMakeFiles/omrsigtest.dir/sigTest.cpp.o.d"
+  "CMakeFiles/omrsigtest.dir/sigTestHelpers.cpp.o"
+  "CMakeFiles/omrsigtest.dir/sigTestHelpers.cpp.o.d"
+  "omrsigtest"
+  "omrsigtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrsigtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/sigtest
+# Build directory: /root/repo/_ci_build/fvtest/sigtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sigtest "/root/repo/_ci_build/fvtest/sigtest/omrsigtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/sigtest/omrsigtest-results.xml")
+set_tests_properties(sigtest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/sigtest/CMakeLists.txt;90;add_test;/root/repo/fvtest/sigtest/CMakeLists.txt;0;")
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/threadextendedtest/processTimeTest.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/processTimeTest.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/processTimeTest.cpp.o.d"
+  "/root/repo/fvtest/threadextendedtest/threadCpuTimeTest.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadCpuTimeTest.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadCpuTimeTest.cpp.o.d"
+  "/root/repo/fvtest/threadextendedtest/threadExtendedTestHelpers.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestHelpers.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestHelpers.cpp.o.d"
+  "/root/repo/fvtest/threadextendedtest/threadExtendedTestMain.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestMain.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestMain.cpp.o.d"
+  "/root/repo/fvtest/threadextendedtest/timeBaseTest.cpp" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/timeBaseTest.cpp.o" "gcc" "fvtest/threadextendedtest/CMakeFiles/omrthreadextendedtest.dir/timeBaseTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
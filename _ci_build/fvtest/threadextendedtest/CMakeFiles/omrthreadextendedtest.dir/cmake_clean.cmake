@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrthreadextendedtest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrthreadextendedtest.dir/processTimeTest.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/processTimeTest.cpp.o.d"
+  "CMakeFiles/omrthreadextendedtest.dir/threadCpuTimeTest.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/threadCpuTimeTest.cpp.o.d"
+  "CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestHelpers.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestHelpers.cpp.o.d"
+  "CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestMain.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/threadExtendedTestMain.cpp.o.d"
+  "CMakeFiles/omrthreadextendedtest.dir/timeBaseTest.cpp.o"
+  "CMakeFiles/omrthreadextendedtest.dir/timeBaseTest.cpp.o.d"
+  "omrthreadextendedtest"
+  "omrthreadextendedtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrthreadextendedtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/threadextendedtest
+# Build directory: /root/repo/_ci_build/fvtest/threadextendedtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(threadextendedtest "/root/repo/_ci_build/fvtest/threadextendedtest/omrthreadextendedtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/threadextendedtest/omrthreadextendedtest-results.xml")
+set_tests_properties(threadextendedtest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/threadextendedtest/CMakeLists.txt;46;add_test;/root/repo/fvtest/threadextendedtest/CMakeLists.txt;0;")
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/fvtest/threadtest/CEnterExit.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CEnterExit.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CEnterExit.cpp.o.d"
+  "/root/repo/fvtest/threadtest/CMonitor.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CMonitor.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CMonitor.cpp.o.d"
+  "/root/repo/fvtest/threadtest/CThread.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CThread.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/CThread.cpp.o.d"
+  "/root/repo/util/main_function/main_function.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/__/__/util/main_function/main_function.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "/root/repo/fvtest/threadtest/abortTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/abortTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/abortTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/createTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/createTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/createTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/joinTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/joinTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/joinTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/keyDestructorTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/keyDestructorTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/keyDestructorTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/lockedMonitorCountTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/lockedMonitorCountTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/lockedMonitorCountTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/main.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/main.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/main.cpp.o.d"
+  "/root/repo/fvtest/threadtest/ospriority.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/ospriority.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/ospriority.cpp.o.d"
+  "/root/repo/fvtest/threadtest/priorityInterruptTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/priorityInterruptTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/priorityInterruptTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/rwMutexTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/rwMutexTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/rwMutexTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/sanityTest.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/sanityTest.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/sanityTest.cpp.o.d"
+  "/root/repo/fvtest/threadtest/sanityTestHelper.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/sanityTestHelper.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/sanityTestHelper.cpp.o.d"
+  "/root/repo/fvtest/threadtest/threadTestHelp.cpp" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/threadTestHelp.cpp.o" "gcc" "fvtest/threadtest/CMakeFiles/omrthreadtest.dir/threadTestHelp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/fvtest/util/CMakeFiles/omrtestutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/startup/CMakeFiles/omrvmstartup.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/fvtest/omrGtestGlue/CMakeFiles/omrGtest.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omrtrace/CMakeFiles/omrtrace.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/gc/CMakeFiles/omrgc.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrthreadtest.dir/CEnterExit.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/CEnterExit.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/CMonitor.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/CMonitor.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/CThread.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/CThread.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/abortTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/abortTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/createTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/createTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/joinTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/joinTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/keyDestructorTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/keyDestructorTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/lockedMonitorCountTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/lockedMonitorCountTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/main.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/main.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/ospriority.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/ospriority.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/priorityInterruptTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/priorityInterruptTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/rwMutexTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/rwMutexTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/sanityTest.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/sanityTest.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/sanityTestHelper.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/sanityTestHelper.cpp.o.d"
+  "CMakeFiles/omrthreadtest.dir/threadTestHelp.cpp.o"
+  "CMakeFiles/omrthreadtest.dir/threadTestHelp.cpp.o.d"
+  "omrthreadtest"
+  "omrthreadtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrthreadtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/threadtest
+# Build directory: /root/repo/_ci_build/fvtest/threadtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(threadtest "/root/repo/_ci_build/fvtest/threadtest/omrthreadtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/threadtest/omrthreadtest-results.xml")
+set_tests_properties(threadtest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/threadtest/CMakeLists.txt;82;add_test;/root/repo/fvtest/threadtest/CMakeLists.txt;0;")
+add_test(threadSetAttrThreadWeightTest "/root/repo/_ci_build/fvtest/threadtest/omrthreadtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/threadtest/omrthreadtest-results.xml" "--gtest_also_run_disabled_tests" "--gtest_filter=ThreadCreateTest.DISABLED_SetAttrThreadWeight")
+set_tests_properties(threadSetAttrThreadWeightTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/threadtest/CMakeLists.txt;83;add_test;/root/repo/fvtest/threadtest/CMakeLists.txt;0;")
+add_test(threadRealtimeTest "/root/repo/_ci_build/fvtest/threadtest/omrthreadtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/threadtest/omrthreadtest-results.xml" "--gtest_filter=ThreadCreateTest.*" "-realtime")
+set_tests_properties(threadRealtimeTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/threadtest/CMakeLists.txt;85;add_test;/root/repo/fvtest/threadtest/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrtestutil.dir/printerrorhelper.cpp.o"
+  "CMakeFiles/omrtestutil.dir/printerrorhelper.cpp.o.d"
+  "CMakeFiles/omrtestutil.dir/testvmhelper.cpp.o"
+  "CMakeFiles/omrtestutil.dir/testvmhelper.cpp.o.d"
+  "libomrtestutil.a"
+  "libomrtestutil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrtestutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
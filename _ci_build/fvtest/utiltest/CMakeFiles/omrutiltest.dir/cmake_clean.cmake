@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrutiltest.dir/main.cpp.o"
+  "CMakeFiles/omrutiltest.dir/main.cpp.o.d"
+  "omrutiltest"
+  "omrutiltest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrutiltest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
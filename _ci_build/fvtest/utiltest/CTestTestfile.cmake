@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/utiltest
+# Build directory: /root/repo/_ci_build/fvtest/utiltest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(utiltest "/root/repo/_ci_build/fvtest/utiltest/omrutiltest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/utiltest/omrutiltest-results.xml")
+set_tests_properties(utiltest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/utiltest/CMakeLists.txt;43;add_test;/root/repo/fvtest/utiltest/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrvmtest.dir/__/__/util/main_function/main_function.cpp.o"
+  "CMakeFiles/omrvmtest.dir/__/__/util/main_function/main_function.cpp.o.d"
+  "CMakeFiles/omrvmtest.dir/main.cpp.o"
+  "CMakeFiles/omrvmtest.dir/main.cpp.o.d"
+  "CMakeFiles/omrvmtest.dir/vmForkTest.cpp.o"
+  "CMakeFiles/omrvmtest.dir/vmForkTest.cpp.o.d"
+  "omrvmtest"
+  "omrvmtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrvmtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fvtest/vmtest
+# Build directory: /root/repo/_ci_build/fvtest/vmtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(vmtest "/root/repo/_ci_build/fvtest/vmtest/omrvmtest" "--gtest_output=xml:/root/repo/_ci_build/fvtest/vmtest/omrvmtest-results.xml")
+set_tests_properties(vmtest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fvtest/vmtest/CMakeLists.txt;43;add_test;/root/repo/fvtest/vmtest/CMakeLists.txt;0;")
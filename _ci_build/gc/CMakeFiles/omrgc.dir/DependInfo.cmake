@@ -0,0 +1,254 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/glue/CollectorLanguageInterfaceImpl.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/CollectorLanguageInterfaceImpl.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/CollectorLanguageInterfaceImpl.cpp.o.d"
+  "/root/repo/example/glue/CompactDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/CompactDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/CompactDelegate.cpp.o.d"
+  "/root/repo/example/glue/CompactSchemeFixupObject.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/CompactSchemeFixupObject.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/CompactSchemeFixupObject.cpp.o.d"
+  "/root/repo/example/glue/ConcurrentMarkingDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/ConcurrentMarkingDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/ConcurrentMarkingDelegate.cpp.o.d"
+  "/root/repo/example/glue/EnvironmentDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/EnvironmentDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/EnvironmentDelegate.cpp.o.d"
+  "/root/repo/example/glue/FrequentObjectsStats.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/FrequentObjectsStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/FrequentObjectsStats.cpp.o.d"
+  "/root/repo/example/glue/GlobalCollectorDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/GlobalCollectorDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/GlobalCollectorDelegate.cpp.o.d"
+  "/root/repo/example/glue/MarkingDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/MarkingDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/MarkingDelegate.cpp.o.d"
+  "/root/repo/example/glue/ObjectIterator.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/ObjectIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/ObjectIterator.cpp.o.d"
+  "/root/repo/example/glue/ObjectModelDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/ObjectModelDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/ObjectModelDelegate.cpp.o.d"
+  "/root/repo/example/glue/ScavengerDelegate.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/ScavengerDelegate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/ScavengerDelegate.cpp.o.d"
+  "/root/repo/example/glue/StartupManagerImpl.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/StartupManagerImpl.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/StartupManagerImpl.cpp.o.d"
+  "/root/repo/example/glue/VerboseManagerImpl.cpp" "gc/CMakeFiles/omrgc.dir/__/example/glue/VerboseManagerImpl.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/__/example/glue/VerboseManagerImpl.cpp.o.d"
+  "/root/repo/gc/base/AddressOrderedListPopulator.cpp" "gc/CMakeFiles/omrgc.dir/base/AddressOrderedListPopulator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/AddressOrderedListPopulator.cpp.o.d"
+  "/root/repo/gc/base/AllocationContext.cpp" "gc/CMakeFiles/omrgc.dir/base/AllocationContext.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/AllocationContext.cpp.o.d"
+  "/root/repo/gc/base/AllocationInterfaceGeneric.cpp" "gc/CMakeFiles/omrgc.dir/base/AllocationInterfaceGeneric.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/AllocationInterfaceGeneric.cpp.o.d"
+  "/root/repo/gc/base/BaseVirtual.cpp" "gc/CMakeFiles/omrgc.dir/base/BaseVirtual.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/BaseVirtual.cpp.o.d"
+  "/root/repo/gc/base/BumpAllocatedListPopulator.cpp" "gc/CMakeFiles/omrgc.dir/base/BumpAllocatedListPopulator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/BumpAllocatedListPopulator.cpp.o.d"
+  "/root/repo/gc/base/CardTable.cpp" "gc/CMakeFiles/omrgc.dir/base/CardTable.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/CardTable.cpp.o.d"
+  "/root/repo/gc/base/Collector.cpp" "gc/CMakeFiles/omrgc.dir/base/Collector.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Collector.cpp.o.d"
+  "/root/repo/gc/base/Configuration.cpp" "gc/CMakeFiles/omrgc.dir/base/Configuration.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Configuration.cpp.o.d"
+  "/root/repo/gc/base/Dispatcher.cpp" "gc/CMakeFiles/omrgc.dir/base/Dispatcher.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Dispatcher.cpp.o.d"
+  "/root/repo/gc/base/EmptyListPopulator.cpp" "gc/CMakeFiles/omrgc.dir/base/EmptyListPopulator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/EmptyListPopulator.cpp.o.d"
+  "/root/repo/gc/base/EnvironmentBase.cpp" "gc/CMakeFiles/omrgc.dir/base/EnvironmentBase.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/EnvironmentBase.cpp.o.d"
+  "/root/repo/gc/base/Forge.cpp" "gc/CMakeFiles/omrgc.dir/base/Forge.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Forge.cpp.o.d"
+  "/root/repo/gc/base/GCCode.cpp" "gc/CMakeFiles/omrgc.dir/base/GCCode.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/GCCode.cpp.o.d"
+  "/root/repo/gc/base/GCExtensionsBase.cpp" "gc/CMakeFiles/omrgc.dir/base/GCExtensionsBase.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/GCExtensionsBase.cpp.o.d"
+  "/root/repo/gc/base/GlobalAllocationManager.cpp" "gc/CMakeFiles/omrgc.dir/base/GlobalAllocationManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/GlobalAllocationManager.cpp.o.d"
+  "/root/repo/gc/base/GlobalCollector.cpp" "gc/CMakeFiles/omrgc.dir/base/GlobalCollector.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/GlobalCollector.cpp.o.d"
+  "/root/repo/gc/base/Heap.cpp" "gc/CMakeFiles/omrgc.dir/base/Heap.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Heap.cpp.o.d"
+  "/root/repo/gc/base/HeapMap.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapMap.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapMap.cpp.o.d"
+  "/root/repo/gc/base/HeapMapIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapMapIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapMapIterator.cpp.o.d"
+  "/root/repo/gc/base/HeapMapScan.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapMapScan.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapMapScan.cpp.o.d"
+  "/root/repo/gc/base/HeapMemorySubSpaceIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapMemorySubSpaceIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapMemorySubSpaceIterator.cpp.o.d"
+  "/root/repo/gc/base/HeapRegionDescriptor.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapRegionDescriptor.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapRegionDescriptor.cpp.o.d"
+  "/root/repo/gc/base/HeapRegionIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapRegionIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapRegionIterator.cpp.o.d"
+  "/root/repo/gc/base/HeapRegionManager.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapRegionManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapRegionManager.cpp.o.d"
+  "/root/repo/gc/base/HeapRegionManagerTarok.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapRegionManagerTarok.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapRegionManagerTarok.cpp.o.d"
+  "/root/repo/gc/base/HeapSplit.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapSplit.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapSplit.cpp.o.d"
+  "/root/repo/gc/base/HeapVirtualMemory.cpp" "gc/CMakeFiles/omrgc.dir/base/HeapVirtualMemory.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HeapVirtualMemory.cpp.o.d"
+  "/root/repo/gc/base/HugePageManager.cpp" "gc/CMakeFiles/omrgc.dir/base/HugePageManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/HugePageManager.cpp.o.d"
+  "/root/repo/gc/base/LightweightNonReentrantLock.cpp" "gc/CMakeFiles/omrgc.dir/base/LightweightNonReentrantLock.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/LightweightNonReentrantLock.cpp.o.d"
+  "/root/repo/gc/base/LightweightNonReentrantReaderWriterLock.cpp" "gc/CMakeFiles/omrgc.dir/base/LightweightNonReentrantReaderWriterLock.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/LightweightNonReentrantReaderWriterLock.cpp.o.d"
+  "/root/repo/gc/base/MarkMap.cpp" "gc/CMakeFiles/omrgc.dir/base/MarkMap.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MarkMap.cpp.o.d"
+  "/root/repo/gc/base/MarkMapSegmentChunkIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/MarkMapSegmentChunkIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MarkMapSegmentChunkIterator.cpp.o.d"
+  "/root/repo/gc/base/MarkedObjectPopulator.cpp" "gc/CMakeFiles/omrgc.dir/base/MarkedObjectPopulator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MarkedObjectPopulator.cpp.o.d"
+  "/root/repo/gc/base/MarkingScheme.cpp" "gc/CMakeFiles/omrgc.dir/base/MarkingScheme.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MarkingScheme.cpp.o.d"
+  "/root/repo/gc/base/MasterGCThread.cpp" "gc/CMakeFiles/omrgc.dir/base/MasterGCThread.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MasterGCThread.cpp.o.d"
+  "/root/repo/gc/base/Math.cpp" "gc/CMakeFiles/omrgc.dir/base/Math.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Math.cpp.o.d"
+  "/root/repo/gc/base/MemoryManager.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryManager.cpp.o.d"
+  "/root/repo/gc/base/MemoryPool.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPool.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPool.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolAddressOrderedList.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedList.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolAddressOrderedListBase.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedListBase.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedListBase.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolBumpPointer.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolBumpPointer.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolBumpPointer.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolHybrid.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolHybrid.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolHybrid.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolLargeObjects.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolLargeObjects.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolLargeObjects.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolSplitAddressOrderedList.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedList.cpp.o.d"
+  "/root/repo/gc/base/MemoryPoolSplitAddressOrderedListBase.cpp" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedListBase.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedListBase.cpp.o.d"
+  "/root/repo/gc/base/MemorySpace.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySpace.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySpace.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpace.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpace.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpace.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceChildIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceChildIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceChildIterator.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceFlat.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceFlat.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceFlat.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceGenerational.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceGenerational.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceGenerational.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceGeneric.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceGeneric.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceGeneric.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpacePoolIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpacePoolIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpacePoolIterator.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceRegionIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceRegionIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceRegionIterator.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceSemiSpace.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceSemiSpace.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceSemiSpace.cpp.o.d"
+  "/root/repo/gc/base/MemorySubSpaceUniSpace.cpp" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceUniSpace.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/MemorySubSpaceUniSpace.cpp.o.d"
+  "/root/repo/gc/base/ModronAssertions.cpp" "gc/CMakeFiles/omrgc.dir/base/ModronAssertions.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ModronAssertions.cpp.o.d"
+  "/root/repo/gc/base/NUMAManager.cpp" "gc/CMakeFiles/omrgc.dir/base/NUMAManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/NUMAManager.cpp.o.d"
+  "/root/repo/gc/base/NonVirtualMemory.cpp" "gc/CMakeFiles/omrgc.dir/base/NonVirtualMemory.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/NonVirtualMemory.cpp.o.d"
+  "/root/repo/gc/base/OMRVMInterface.cpp" "gc/CMakeFiles/omrgc.dir/base/OMRVMInterface.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/OMRVMInterface.cpp.o.d"
+  "/root/repo/gc/base/OMRVMThreadInterface.cpp" "gc/CMakeFiles/omrgc.dir/base/OMRVMThreadInterface.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/OMRVMThreadInterface.cpp.o.d"
+  "/root/repo/gc/base/ObjectAllocationInterface.cpp" "gc/CMakeFiles/omrgc.dir/base/ObjectAllocationInterface.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ObjectAllocationInterface.cpp.o.d"
+  "/root/repo/gc/base/ObjectHeapBufferedIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/ObjectHeapBufferedIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ObjectHeapBufferedIterator.cpp.o.d"
+  "/root/repo/gc/base/ObjectHeapIteratorAddressOrderedList.cpp" "gc/CMakeFiles/omrgc.dir/base/ObjectHeapIteratorAddressOrderedList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ObjectHeapIteratorAddressOrderedList.cpp.o.d"
+  "/root/repo/gc/base/Packet.cpp" "gc/CMakeFiles/omrgc.dir/base/Packet.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Packet.cpp.o.d"
+  "/root/repo/gc/base/PacketList.cpp" "gc/CMakeFiles/omrgc.dir/base/PacketList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PacketList.cpp.o.d"
+  "/root/repo/gc/base/ParallelDispatcher.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelDispatcher.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelDispatcher.cpp.o.d"
+  "/root/repo/gc/base/ParallelHeapWalker.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelHeapWalker.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelHeapWalker.cpp.o.d"
+  "/root/repo/gc/base/ParallelMarkTask.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelMarkTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelMarkTask.cpp.o.d"
+  "/root/repo/gc/base/ParallelObjectHeapIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelObjectHeapIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelObjectHeapIterator.cpp.o.d"
+  "/root/repo/gc/base/ParallelRootScanner.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelRootScanner.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelRootScanner.cpp.o.d"
+  "/root/repo/gc/base/ParallelTask.cpp" "gc/CMakeFiles/omrgc.dir/base/ParallelTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ParallelTask.cpp.o.d"
+  "/root/repo/gc/base/PhysicalArena.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalArena.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalArena.cpp.o.d"
+  "/root/repo/gc/base/PhysicalArenaRegionBased.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalArenaRegionBased.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalArenaRegionBased.cpp.o.d"
+  "/root/repo/gc/base/PhysicalArenaVirtualMemory.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalArenaVirtualMemory.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalArenaVirtualMemory.cpp.o.d"
+  "/root/repo/gc/base/PhysicalSubArena.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArena.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArena.cpp.o.d"
+  "/root/repo/gc/base/PhysicalSubArenaRegionBased.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaRegionBased.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaRegionBased.cpp.o.d"
+  "/root/repo/gc/base/PhysicalSubArenaVirtualMemory.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemory.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemory.cpp.o.d"
+  "/root/repo/gc/base/PhysicalSubArenaVirtualMemoryFlat.cpp" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemoryFlat.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemoryFlat.cpp.o.d"
+  "/root/repo/gc/base/ReferenceChainWalkerMarkMap.cpp" "gc/CMakeFiles/omrgc.dir/base/ReferenceChainWalkerMarkMap.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/ReferenceChainWalkerMarkMap.cpp.o.d"
+  "/root/repo/gc/base/RegionPool.cpp" "gc/CMakeFiles/omrgc.dir/base/RegionPool.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/RegionPool.cpp.o.d"
+  "/root/repo/gc/base/RegionPoolGeneric.cpp" "gc/CMakeFiles/omrgc.dir/base/RegionPoolGeneric.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/RegionPoolGeneric.cpp.o.d"
+  "/root/repo/gc/base/StartupManager.cpp" "gc/CMakeFiles/omrgc.dir/base/StartupManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/StartupManager.cpp.o.d"
+  "/root/repo/gc/base/SweepHeapSectioning.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepHeapSectioning.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepHeapSectioning.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolManager.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManager.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolManagerAddressOrderedList.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedList.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolManagerAddressOrderedListBase.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedListBase.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedListBase.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolManagerHybrid.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerHybrid.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerHybrid.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolManagerSplitAddressOrderedList.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerSplitAddressOrderedList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolManagerSplitAddressOrderedList.cpp.o.d"
+  "/root/repo/gc/base/SweepPoolState.cpp" "gc/CMakeFiles/omrgc.dir/base/SweepPoolState.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/SweepPoolState.cpp.o.d"
+  "/root/repo/gc/base/TLHAllocationInterface.cpp" "gc/CMakeFiles/omrgc.dir/base/TLHAllocationInterface.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/TLHAllocationInterface.cpp.o.d"
+  "/root/repo/gc/base/TLHAllocationSupport.cpp" "gc/CMakeFiles/omrgc.dir/base/TLHAllocationSupport.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/TLHAllocationSupport.cpp.o.d"
+  "/root/repo/gc/base/TLHSizeClassCache.cpp" "gc/CMakeFiles/omrgc.dir/base/TLHSizeClassCache.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/TLHSizeClassCache.cpp.o.d"
+  "/root/repo/gc/base/Task.cpp" "gc/CMakeFiles/omrgc.dir/base/Task.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/Task.cpp.o.d"
+  "/root/repo/gc/base/VirtualMemory.cpp" "gc/CMakeFiles/omrgc.dir/base/VirtualMemory.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/VirtualMemory.cpp.o.d"
+  "/root/repo/gc/base/WorkPacketOverflow.cpp" "gc/CMakeFiles/omrgc.dir/base/WorkPacketOverflow.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/WorkPacketOverflow.cpp.o.d"
+  "/root/repo/gc/base/WorkPackets.cpp" "gc/CMakeFiles/omrgc.dir/base/WorkPackets.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/WorkPackets.cpp.o.d"
+  "/root/repo/gc/base/WorkStack.cpp" "gc/CMakeFiles/omrgc.dir/base/WorkStack.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/WorkStack.cpp.o.d"
+  "/root/repo/gc/base/gcspinlock.cpp" "gc/CMakeFiles/omrgc.dir/base/gcspinlock.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/gcspinlock.cpp.o.d"
+  "/root/repo/gc/base/gcutils.cpp" "gc/CMakeFiles/omrgc.dir/base/gcutils.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/gcutils.cpp.o.d"
+  "/root/repo/gc/base/modronapicore.cpp" "gc/CMakeFiles/omrgc.dir/base/modronapicore.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/modronapicore.cpp.o.d"
+  "/root/repo/gc/base/segregated/AllocationContextSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/AllocationContextSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/AllocationContextSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/ConfigurationSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/ConfigurationSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/ConfigurationSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/GlobalAllocationManagerSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/GlobalAllocationManagerSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/GlobalAllocationManagerSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/HeapRegionDescriptorSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/HeapRegionDescriptorSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/HeapRegionDescriptorSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/LockingFreeHeapRegionList.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/LockingFreeHeapRegionList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/LockingFreeHeapRegionList.cpp.o.d"
+  "/root/repo/gc/base/segregated/LockingHeapRegionQueue.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/LockingHeapRegionQueue.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/LockingHeapRegionQueue.cpp.o.d"
+  "/root/repo/gc/base/segregated/MemoryPoolAggregatedCellList.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/MemoryPoolAggregatedCellList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/MemoryPoolAggregatedCellList.cpp.o.d"
+  "/root/repo/gc/base/segregated/MemoryPoolSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/MemoryPoolSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/MemoryPoolSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/MemorySubSpaceSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/MemorySubSpaceSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/MemorySubSpaceSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/ObjectHeapIteratorSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/ObjectHeapIteratorSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/ObjectHeapIteratorSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/OverflowSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/OverflowSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/OverflowSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/RegionPoolSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/RegionPoolSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/RegionPoolSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedAllocationInterface.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationInterface.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationInterface.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedAllocationTracker.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationTracker.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationTracker.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedGC.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedGC.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedGC.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedListPopulator.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedListPopulator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedListPopulator.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedMarkingScheme.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedMarkingScheme.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedMarkingScheme.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedMinorMarkTask.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedMinorMarkTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedMinorMarkTask.cpp.o.d"
+  "/root/repo/gc/base/segregated/SegregatedSweepTask.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedSweepTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SegregatedSweepTask.cpp.o.d"
+  "/root/repo/gc/base/segregated/SizeClasses.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SizeClasses.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SizeClasses.cpp.o.d"
+  "/root/repo/gc/base/segregated/SweepSchemeSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/SweepSchemeSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/SweepSchemeSegregated.cpp.o.d"
+  "/root/repo/gc/base/segregated/WorkPacketsSegregated.cpp" "gc/CMakeFiles/omrgc.dir/base/segregated/WorkPacketsSegregated.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/segregated/WorkPacketsSegregated.cpp.o.d"
+  "/root/repo/gc/base/standard/CompactFixHeapForWalkTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/CompactFixHeapForWalkTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/CompactFixHeapForWalkTask.cpp.o.d"
+  "/root/repo/gc/base/standard/CompactScheme.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/CompactScheme.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/CompactScheme.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentCardTable.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTable.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTable.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentCardTableForWC.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTableForWC.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTableForWC.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentClearNewMarkBitsTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentClearNewMarkBitsTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentClearNewMarkBitsTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentCompleteTracingTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCompleteTracingTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentCompleteTracingTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentFinalCleanCardsTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentFinalCleanCardsTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentFinalCleanCardsTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentGC.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGC.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGC.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentGCIncrementalUpdate.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGCIncrementalUpdate.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGCIncrementalUpdate.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentGCSATB.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGCSATB.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentGCSATB.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentOverflow.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentOverflow.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentOverflow.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentPrepareCardTableTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentPrepareCardTableTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentPrepareCardTableTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentSafepointCallback.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentSafepointCallback.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentSafepointCallback.cpp.o.d"
+  "/root/repo/gc/base/standard/ConcurrentScanRememberedSetTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentScanRememberedSetTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConcurrentScanRememberedSetTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ConfigurationFlat.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationFlat.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationFlat.cpp.o.d"
+  "/root/repo/gc/base/standard/ConfigurationGenerational.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationGenerational.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationGenerational.cpp.o.d"
+  "/root/repo/gc/base/standard/ConfigurationStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ConfigurationStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/CopyScanCacheChunk.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunk.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunk.cpp.o.d"
+  "/root/repo/gc/base/standard/CopyScanCacheChunkInHeap.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunkInHeap.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunkInHeap.cpp.o.d"
+  "/root/repo/gc/base/standard/CopyScanCacheList.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheList.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/CopyScanCacheList.cpp.o.d"
+  "/root/repo/gc/base/standard/EnvironmentStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/EnvironmentStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/EnvironmentStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/FreePageReleaser.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/FreePageReleaser.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/FreePageReleaser.cpp.o.d"
+  "/root/repo/gc/base/standard/HeapMemoryPoolIterator.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/HeapMemoryPoolIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/HeapMemoryPoolIterator.cpp.o.d"
+  "/root/repo/gc/base/standard/HeapRegionDescriptorStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/HeapRegionDescriptorStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/HeapRegionDescriptorStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/HeapRegionManagerStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/HeapRegionManagerStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/HeapRegionManagerStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/HeapWalker.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/HeapWalker.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/HeapWalker.cpp.o.d"
+  "/root/repo/gc/base/standard/OverflowStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/OverflowStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/OverflowStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/ParallelCompactTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelCompactTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelCompactTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ParallelGlobalGC.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelGlobalGC.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelGlobalGC.cpp.o.d"
+  "/root/repo/gc/base/standard/ParallelScavengeTask.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelScavengeTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelScavengeTask.cpp.o.d"
+  "/root/repo/gc/base/standard/ParallelSweepScheme.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelSweepScheme.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ParallelSweepScheme.cpp.o.d"
+  "/root/repo/gc/base/standard/PhysicalSubArenaVirtualMemorySemiSpace.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/PhysicalSubArenaVirtualMemorySemiSpace.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/PhysicalSubArenaVirtualMemorySemiSpace.cpp.o.d"
+  "/root/repo/gc/base/standard/RSOverflow.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/RSOverflow.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/RSOverflow.cpp.o.d"
+  "/root/repo/gc/base/standard/RememberedSetSATB.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/RememberedSetSATB.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/RememberedSetSATB.cpp.o.d"
+  "/root/repo/gc/base/standard/Scavenger.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/Scavenger.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/Scavenger.cpp.o.d"
+  "/root/repo/gc/base/standard/ScavengerNUMAChunkLists.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ScavengerNUMAChunkLists.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ScavengerNUMAChunkLists.cpp.o.d"
+  "/root/repo/gc/base/standard/ScavengerTenureAdvisor.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/ScavengerTenureAdvisor.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/ScavengerTenureAdvisor.cpp.o.d"
+  "/root/repo/gc/base/standard/SweepHeapSectioningSegmented.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/SweepHeapSectioningSegmented.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/SweepHeapSectioningSegmented.cpp.o.d"
+  "/root/repo/gc/base/standard/WorkPacketsConcurrent.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsConcurrent.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsConcurrent.cpp.o.d"
+  "/root/repo/gc/base/standard/WorkPacketsSATB.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsSATB.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsSATB.cpp.o.d"
+  "/root/repo/gc/base/standard/WorkPacketsStandard.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsStandard.cpp.o.d"
+  "/root/repo/gc/base/standard/WorkPacketsStealing.cpp" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsStealing.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/standard/WorkPacketsStealing.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/BalancedCopyForwardTask.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedCopyForwardTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedCopyForwardTask.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/BalancedGC.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedGC.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedGC.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/BalancedSweepTask.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedSweepTask.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/BalancedSweepTask.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/ConfigurationBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/ConfigurationBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/ConfigurationBalanced.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/HeapRegionDescriptorBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionDescriptorBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionDescriptorBalanced.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/HeapRegionStateTable.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionStateTable.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionStateTable.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/MemoryPoolBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/MemoryPoolBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/MemoryPoolBalanced.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/MemorySubSpaceBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/MemorySubSpaceBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/MemorySubSpaceBalanced.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/ObjectRememberedSet.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/ObjectRememberedSet.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/ObjectRememberedSet.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/OverflowBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/OverflowBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/OverflowBalanced.cpp.o.d"
+  "/root/repo/gc/base/vlhgc/WorkPacketsBalanced.cpp" "gc/CMakeFiles/omrgc.dir/base/vlhgc/WorkPacketsBalanced.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/base/vlhgc/WorkPacketsBalanced.cpp.o.d"
+  "/root/repo/gc/startup/mminitcore.cpp" "gc/CMakeFiles/omrgc.dir/startup/mminitcore.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/startup/mminitcore.cpp.o.d"
+  "/root/repo/gc/startup/omrgcalloc.cpp" "gc/CMakeFiles/omrgc.dir/startup/omrgcalloc.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/startup/omrgcalloc.cpp.o.d"
+  "/root/repo/gc/startup/omrgcstartup.cpp" "gc/CMakeFiles/omrgc.dir/startup/omrgcstartup.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/startup/omrgcstartup.cpp.o.d"
+  "/root/repo/gc/stats/AllocationSamplingStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/AllocationSamplingStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/AllocationSamplingStats.cpp.o.d"
+  "/root/repo/gc/stats/AllocationStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/AllocationStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/AllocationStats.cpp.o.d"
+  "/root/repo/gc/stats/CardCleaningStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/CardCleaningStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/CardCleaningStats.cpp.o.d"
+  "/root/repo/gc/stats/ClassUnloadStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/ClassUnloadStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/ClassUnloadStats.cpp.o.d"
+  "/root/repo/gc/stats/CompactStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/CompactStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/CompactStats.cpp.o.d"
+  "/root/repo/gc/stats/ConcurrentGCStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/ConcurrentGCStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/ConcurrentGCStats.cpp.o.d"
+  "/root/repo/gc/stats/FreeEntrySizeClassStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/FreeEntrySizeClassStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/FreeEntrySizeClassStats.cpp.o.d"
+  "/root/repo/gc/stats/HeapResizeStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/HeapResizeStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/HeapResizeStats.cpp.o.d"
+  "/root/repo/gc/stats/LargeObjectAllocateStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/LargeObjectAllocateStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/LargeObjectAllocateStats.cpp.o.d"
+  "/root/repo/gc/stats/MarkStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/MarkStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/MarkStats.cpp.o.d"
+  "/root/repo/gc/stats/MetronomeStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/MetronomeStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/MetronomeStats.cpp.o.d"
+  "/root/repo/gc/stats/RootScannerStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/RootScannerStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/RootScannerStats.cpp.o.d"
+  "/root/repo/gc/stats/ScavengerCopyScanRatio.cpp" "gc/CMakeFiles/omrgc.dir/stats/ScavengerCopyScanRatio.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/ScavengerCopyScanRatio.cpp.o.d"
+  "/root/repo/gc/stats/ScavengerStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/ScavengerStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/ScavengerStats.cpp.o.d"
+  "/root/repo/gc/stats/SweepStats.cpp" "gc/CMakeFiles/omrgc.dir/stats/SweepStats.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/stats/SweepStats.cpp.o.d"
+  "/root/repo/gc/structs/ForwardedHeader.cpp" "gc/CMakeFiles/omrgc.dir/structs/ForwardedHeader.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/ForwardedHeader.cpp.o.d"
+  "/root/repo/gc/structs/HashTableIterator.cpp" "gc/CMakeFiles/omrgc.dir/structs/HashTableIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/HashTableIterator.cpp.o.d"
+  "/root/repo/gc/structs/OMRVMThreadListIterator.cpp" "gc/CMakeFiles/omrgc.dir/structs/OMRVMThreadListIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/OMRVMThreadListIterator.cpp.o.d"
+  "/root/repo/gc/structs/PoolIterator.cpp" "gc/CMakeFiles/omrgc.dir/structs/PoolIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/PoolIterator.cpp.o.d"
+  "/root/repo/gc/structs/SublistFragment.cpp" "gc/CMakeFiles/omrgc.dir/structs/SublistFragment.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/SublistFragment.cpp.o.d"
+  "/root/repo/gc/structs/SublistIterator.cpp" "gc/CMakeFiles/omrgc.dir/structs/SublistIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/SublistIterator.cpp.o.d"
+  "/root/repo/gc/structs/SublistPool.cpp" "gc/CMakeFiles/omrgc.dir/structs/SublistPool.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/SublistPool.cpp.o.d"
+  "/root/repo/gc/structs/SublistPuddle.cpp" "gc/CMakeFiles/omrgc.dir/structs/SublistPuddle.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/SublistPuddle.cpp.o.d"
+  "/root/repo/gc/structs/SublistSlotIterator.cpp" "gc/CMakeFiles/omrgc.dir/structs/SublistSlotIterator.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/structs/SublistSlotIterator.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseBuffer.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseBuffer.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseBuffer.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseHandlerOutput.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseHandlerOutput.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseHandlerOutput.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseManager.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseManager.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseManager.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseRingBuffer.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseRingBuffer.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseRingBuffer.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriter.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriter.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriter.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterChain.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterChain.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterChain.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterFileLogging.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLogging.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLogging.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterFileLoggingAsynchronous.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingAsynchronous.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingAsynchronous.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterFileLoggingBuffered.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingBuffered.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingBuffered.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterFileLoggingSynchronous.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingSynchronous.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingSynchronous.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterHook.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterHook.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterHook.cpp.o.d"
+  "/root/repo/gc/verbose/VerboseWriterStreamOutput.cpp" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterStreamOutput.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/VerboseWriterStreamOutput.cpp.o.d"
+  "/root/repo/gc/verbose/handler_standard/VerboseHandlerOutputStandard.cpp" "gc/CMakeFiles/omrgc.dir/verbose/handler_standard/VerboseHandlerOutputStandard.cpp.o" "gcc" "gc/CMakeFiles/omrgc.dir/verbose/handler_standard/VerboseHandlerOutputStandard.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/omr/CMakeFiles/omrcore.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/port/CMakeFiles/omrport.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hookable/CMakeFiles/j9hookstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,465 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrgc.dir/__/example/glue/CollectorLanguageInterfaceImpl.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/CollectorLanguageInterfaceImpl.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/CompactDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/CompactDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/CompactSchemeFixupObject.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/CompactSchemeFixupObject.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/ConcurrentMarkingDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/ConcurrentMarkingDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/EnvironmentDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/EnvironmentDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/FrequentObjectsStats.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/FrequentObjectsStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/GlobalCollectorDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/GlobalCollectorDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/MarkingDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/MarkingDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/ObjectIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/ObjectIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/ObjectModelDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/ObjectModelDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/ScavengerDelegate.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/ScavengerDelegate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/StartupManagerImpl.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/StartupManagerImpl.cpp.o.d"
+  "CMakeFiles/omrgc.dir/__/example/glue/VerboseManagerImpl.cpp.o"
+  "CMakeFiles/omrgc.dir/__/example/glue/VerboseManagerImpl.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/AddressOrderedListPopulator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/AddressOrderedListPopulator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/AllocationContext.cpp.o"
+  "CMakeFiles/omrgc.dir/base/AllocationContext.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/AllocationInterfaceGeneric.cpp.o"
+  "CMakeFiles/omrgc.dir/base/AllocationInterfaceGeneric.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/BaseVirtual.cpp.o"
+  "CMakeFiles/omrgc.dir/base/BaseVirtual.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/BumpAllocatedListPopulator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/BumpAllocatedListPopulator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/CardTable.cpp.o"
+  "CMakeFiles/omrgc.dir/base/CardTable.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Collector.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Collector.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Configuration.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Configuration.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Dispatcher.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Dispatcher.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/EmptyListPopulator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/EmptyListPopulator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/EnvironmentBase.cpp.o"
+  "CMakeFiles/omrgc.dir/base/EnvironmentBase.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Forge.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Forge.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/GCCode.cpp.o"
+  "CMakeFiles/omrgc.dir/base/GCCode.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/GCExtensionsBase.cpp.o"
+  "CMakeFiles/omrgc.dir/base/GCExtensionsBase.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/GlobalAllocationManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/GlobalAllocationManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/GlobalCollector.cpp.o"
+  "CMakeFiles/omrgc.dir/base/GlobalCollector.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Heap.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Heap.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapMap.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapMap.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapMapIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapMapIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapMapScan.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapMapScan.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapMemorySubSpaceIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapMemorySubSpaceIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapRegionDescriptor.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapRegionDescriptor.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapRegionIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapRegionIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapRegionManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapRegionManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapRegionManagerTarok.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapRegionManagerTarok.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapSplit.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapSplit.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HeapVirtualMemory.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HeapVirtualMemory.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/HugePageManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/HugePageManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/LightweightNonReentrantLock.cpp.o"
+  "CMakeFiles/omrgc.dir/base/LightweightNonReentrantLock.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/LightweightNonReentrantReaderWriterLock.cpp.o"
+  "CMakeFiles/omrgc.dir/base/LightweightNonReentrantReaderWriterLock.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MarkMap.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MarkMap.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MarkMapSegmentChunkIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MarkMapSegmentChunkIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MarkedObjectPopulator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MarkedObjectPopulator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MarkingScheme.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MarkingScheme.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MasterGCThread.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MasterGCThread.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Math.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Math.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPool.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPool.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedListBase.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolAddressOrderedListBase.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolBumpPointer.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolBumpPointer.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolHybrid.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolHybrid.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolLargeObjects.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolLargeObjects.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedListBase.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemoryPoolSplitAddressOrderedListBase.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySpace.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySpace.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpace.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpace.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceChildIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceChildIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceFlat.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceFlat.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceGenerational.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceGenerational.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceGeneric.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceGeneric.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpacePoolIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpacePoolIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceRegionIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceRegionIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceSemiSpace.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceSemiSpace.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceUniSpace.cpp.o"
+  "CMakeFiles/omrgc.dir/base/MemorySubSpaceUniSpace.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ModronAssertions.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ModronAssertions.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/NUMAManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/NUMAManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/NonVirtualMemory.cpp.o"
+  "CMakeFiles/omrgc.dir/base/NonVirtualMemory.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/OMRVMInterface.cpp.o"
+  "CMakeFiles/omrgc.dir/base/OMRVMInterface.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/OMRVMThreadInterface.cpp.o"
+  "CMakeFiles/omrgc.dir/base/OMRVMThreadInterface.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ObjectAllocationInterface.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ObjectAllocationInterface.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ObjectHeapBufferedIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ObjectHeapBufferedIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ObjectHeapIteratorAddressOrderedList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ObjectHeapIteratorAddressOrderedList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Packet.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Packet.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PacketList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PacketList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelDispatcher.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelDispatcher.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelHeapWalker.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelHeapWalker.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelMarkTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelMarkTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelObjectHeapIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelObjectHeapIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelRootScanner.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelRootScanner.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ParallelTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ParallelTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalArena.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalArena.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalArenaRegionBased.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalArenaRegionBased.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalArenaVirtualMemory.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalArenaVirtualMemory.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArena.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArena.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaRegionBased.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaRegionBased.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemory.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemory.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemoryFlat.cpp.o"
+  "CMakeFiles/omrgc.dir/base/PhysicalSubArenaVirtualMemoryFlat.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/ReferenceChainWalkerMarkMap.cpp.o"
+  "CMakeFiles/omrgc.dir/base/ReferenceChainWalkerMarkMap.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/RegionPool.cpp.o"
+  "CMakeFiles/omrgc.dir/base/RegionPool.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/RegionPoolGeneric.cpp.o"
+  "CMakeFiles/omrgc.dir/base/RegionPoolGeneric.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/StartupManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/StartupManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepHeapSectioning.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepHeapSectioning.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManager.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedListBase.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerAddressOrderedListBase.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerHybrid.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerHybrid.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerSplitAddressOrderedList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolManagerSplitAddressOrderedList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/SweepPoolState.cpp.o"
+  "CMakeFiles/omrgc.dir/base/SweepPoolState.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/TLHAllocationInterface.cpp.o"
+  "CMakeFiles/omrgc.dir/base/TLHAllocationInterface.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/TLHAllocationSupport.cpp.o"
+  "CMakeFiles/omrgc.dir/base/TLHAllocationSupport.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/TLHSizeClassCache.cpp.o"
+  "CMakeFiles/omrgc.dir/base/TLHSizeClassCache.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/Task.cpp.o"
+  "CMakeFiles/omrgc.dir/base/Task.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/VirtualMemory.cpp.o"
+  "CMakeFiles/omrgc.dir/base/VirtualMemory.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/WorkPacketOverflow.cpp.o"
+  "CMakeFiles/omrgc.dir/base/WorkPacketOverflow.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/WorkPackets.cpp.o"
+  "CMakeFiles/omrgc.dir/base/WorkPackets.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/WorkStack.cpp.o"
+  "CMakeFiles/omrgc.dir/base/WorkStack.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/gcspinlock.cpp.o"
+  "CMakeFiles/omrgc.dir/base/gcspinlock.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/gcutils.cpp.o"
+  "CMakeFiles/omrgc.dir/base/gcutils.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/modronapicore.cpp.o"
+  "CMakeFiles/omrgc.dir/base/modronapicore.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/AllocationContextSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/AllocationContextSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/ConfigurationSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/ConfigurationSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/GlobalAllocationManagerSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/GlobalAllocationManagerSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/HeapRegionDescriptorSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/HeapRegionDescriptorSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/LockingFreeHeapRegionList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/LockingFreeHeapRegionList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/LockingHeapRegionQueue.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/LockingHeapRegionQueue.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/MemoryPoolAggregatedCellList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/MemoryPoolAggregatedCellList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/MemoryPoolSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/MemoryPoolSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/MemorySubSpaceSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/MemorySubSpaceSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/ObjectHeapIteratorSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/ObjectHeapIteratorSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/OverflowSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/OverflowSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/RegionPoolSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/RegionPoolSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationInterface.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationInterface.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationTracker.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedAllocationTracker.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedGC.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedGC.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedListPopulator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedListPopulator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedMarkingScheme.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedMarkingScheme.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedMinorMarkTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedMinorMarkTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedSweepTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SegregatedSweepTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SizeClasses.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SizeClasses.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/SweepSchemeSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/SweepSchemeSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/segregated/WorkPacketsSegregated.cpp.o"
+  "CMakeFiles/omrgc.dir/base/segregated/WorkPacketsSegregated.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/CompactFixHeapForWalkTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/CompactFixHeapForWalkTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/CompactScheme.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/CompactScheme.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTable.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTable.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTableForWC.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCardTableForWC.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentClearNewMarkBitsTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentClearNewMarkBitsTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCompleteTracingTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentCompleteTracingTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentFinalCleanCardsTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentFinalCleanCardsTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGC.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGC.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGCIncrementalUpdate.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGCIncrementalUpdate.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGCSATB.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentGCSATB.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentOverflow.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentOverflow.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentPrepareCardTableTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentPrepareCardTableTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentSafepointCallback.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentSafepointCallback.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentScanRememberedSetTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConcurrentScanRememberedSetTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationFlat.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationFlat.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationGenerational.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationGenerational.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ConfigurationStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunk.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunk.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunkInHeap.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheChunkInHeap.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheList.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/CopyScanCacheList.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/EnvironmentStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/EnvironmentStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/FreePageReleaser.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/FreePageReleaser.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/HeapMemoryPoolIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/HeapMemoryPoolIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/HeapRegionDescriptorStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/HeapRegionDescriptorStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/HeapRegionManagerStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/HeapRegionManagerStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/HeapWalker.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/HeapWalker.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/OverflowStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/OverflowStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelCompactTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelCompactTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelGlobalGC.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelGlobalGC.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelScavengeTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelScavengeTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelSweepScheme.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ParallelSweepScheme.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/PhysicalSubArenaVirtualMemorySemiSpace.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/PhysicalSubArenaVirtualMemorySemiSpace.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/RSOverflow.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/RSOverflow.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/RememberedSetSATB.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/RememberedSetSATB.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/Scavenger.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/Scavenger.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ScavengerNUMAChunkLists.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ScavengerNUMAChunkLists.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/ScavengerTenureAdvisor.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/ScavengerTenureAdvisor.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/SweepHeapSectioningSegmented.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/SweepHeapSectioningSegmented.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsConcurrent.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsConcurrent.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsSATB.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsSATB.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsStandard.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsStealing.cpp.o"
+  "CMakeFiles/omrgc.dir/base/standard/WorkPacketsStealing.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedCopyForwardTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedCopyForwardTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedGC.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedGC.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedSweepTask.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/BalancedSweepTask.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/ConfigurationBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/ConfigurationBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionDescriptorBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionDescriptorBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionStateTable.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/HeapRegionStateTable.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/MemoryPoolBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/MemoryPoolBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/MemorySubSpaceBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/MemorySubSpaceBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/ObjectRememberedSet.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/ObjectRememberedSet.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/OverflowBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/OverflowBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/base/vlhgc/WorkPacketsBalanced.cpp.o"
+  "CMakeFiles/omrgc.dir/base/vlhgc/WorkPacketsBalanced.cpp.o.d"
+  "CMakeFiles/omrgc.dir/startup/mminitcore.cpp.o"
+  "CMakeFiles/omrgc.dir/startup/mminitcore.cpp.o.d"
+  "CMakeFiles/omrgc.dir/startup/omrgcalloc.cpp.o"
+  "CMakeFiles/omrgc.dir/startup/omrgcalloc.cpp.o.d"
+  "CMakeFiles/omrgc.dir/startup/omrgcstartup.cpp.o"
+  "CMakeFiles/omrgc.dir/startup/omrgcstartup.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/AllocationSamplingStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/AllocationSamplingStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/AllocationStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/AllocationStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/CardCleaningStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/CardCleaningStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/ClassUnloadStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/ClassUnloadStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/CompactStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/CompactStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/ConcurrentGCStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/ConcurrentGCStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/FreeEntrySizeClassStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/FreeEntrySizeClassStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/HeapResizeStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/HeapResizeStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/LargeObjectAllocateStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/LargeObjectAllocateStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/MarkStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/MarkStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/MetronomeStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/MetronomeStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/RootScannerStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/RootScannerStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/ScavengerCopyScanRatio.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/ScavengerCopyScanRatio.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/ScavengerStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/ScavengerStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/stats/SweepStats.cpp.o"
+  "CMakeFiles/omrgc.dir/stats/SweepStats.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/ForwardedHeader.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/ForwardedHeader.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/HashTableIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/HashTableIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/OMRVMThreadListIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/OMRVMThreadListIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/PoolIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/PoolIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/SublistFragment.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/SublistFragment.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/SublistIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/SublistIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/SublistPool.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/SublistPool.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/SublistPuddle.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/SublistPuddle.cpp.o.d"
+  "CMakeFiles/omrgc.dir/structs/SublistSlotIterator.cpp.o"
+  "CMakeFiles/omrgc.dir/structs/SublistSlotIterator.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseBuffer.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseBuffer.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseHandlerOutput.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseHandlerOutput.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseManager.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseManager.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseRingBuffer.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseRingBuffer.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriter.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriter.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterChain.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterChain.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLogging.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLogging.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingAsynchronous.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingAsynchronous.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingBuffered.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingBuffered.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingSynchronous.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterFileLoggingSynchronous.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterHook.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterHook.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterStreamOutput.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/VerboseWriterStreamOutput.cpp.o.d"
+  "CMakeFiles/omrgc.dir/verbose/handler_standard/VerboseHandlerOutputStandard.cpp.o"
+  "CMakeFiles/omrgc.dir/verbose/handler_standard/VerboseHandlerOutputStandard.cpp.o.d"
+  "libomrgc.a"
+  "libomrgc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrgc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
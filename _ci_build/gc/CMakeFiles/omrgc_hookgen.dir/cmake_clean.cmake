@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../mmomrhook.h"
+  "CMakeFiles/omrgc_hookgen"
+  "mmomrhook_internal.h"
+  "mmprivatehook.h"
+  "mmprivatehook_internal.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/omrgc_hookgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
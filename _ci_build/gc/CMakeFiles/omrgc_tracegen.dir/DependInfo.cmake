@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_ci_build/gc/ut_j9mm.c" "gc/CMakeFiles/omrgc_tracegen.dir/ut_j9mm.c.o" "gcc" "gc/CMakeFiles/omrgc_tracegen.dir/ut_j9mm.c.o.d"
+  "/root/repo/_ci_build/gc/ut_j9vgc.c" "gc/CMakeFiles/omrgc_tracegen.dir/ut_j9vgc.c.o" "gcc" "gc/CMakeFiles/omrgc_tracegen.dir/ut_j9vgc.c.o.d"
+  "/root/repo/_ci_build/gc/ut_omrmm.c" "gc/CMakeFiles/omrgc_tracegen.dir/ut_omrmm.c.o" "gcc" "gc/CMakeFiles/omrgc_tracegen.dir/ut_omrmm.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/gc/ut_j9mm.h" "/root/repo/_ci_build/gc/ut_j9mm.c"
+  "/root/repo/_ci_build/gc/ut_j9mm.pdat" "/root/repo/_ci_build/gc/ut_j9mm.c"
+  "/root/repo/_ci_build/gc/ut_j9vgc.h" "/root/repo/_ci_build/gc/ut_j9vgc.c"
+  "/root/repo/_ci_build/gc/ut_j9vgc.pdat" "/root/repo/_ci_build/gc/ut_j9vgc.c"
+  "/root/repo/_ci_build/gc/ut_omrmm.h" "/root/repo/_ci_build/gc/ut_omrmm.c"
+  "/root/repo/_ci_build/gc/ut_omrmm.pdat" "/root/repo/_ci_build/gc/ut_omrmm.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrgc_tracegen.dir/ut_j9mm.c.o"
+  "CMakeFiles/omrgc_tracegen.dir/ut_j9mm.c.o.d"
+  "CMakeFiles/omrgc_tracegen.dir/ut_j9vgc.c.o"
+  "CMakeFiles/omrgc_tracegen.dir/ut_j9vgc.c.o.d"
+  "CMakeFiles/omrgc_tracegen.dir/ut_omrmm.c.o"
+  "CMakeFiles/omrgc_tracegen.dir/ut_omrmm.c.o.d"
+  "ut_j9mm.c"
+  "ut_j9mm.h"
+  "ut_j9mm.pdat"
+  "ut_j9vgc.c"
+  "ut_j9vgc.h"
+  "ut_j9vgc.pdat"
+  "ut_omrmm.c"
+  "ut_omrmm.h"
+  "ut_omrmm.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/omrgc_tracegen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
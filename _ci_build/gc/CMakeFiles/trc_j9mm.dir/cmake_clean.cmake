@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_j9mm"
+  "ut_j9mm.c"
+  "ut_j9mm.h"
+  "ut_j9mm.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_j9mm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_j9vgc"
+  "ut_j9vgc.c"
+  "ut_j9vgc.h"
+  "ut_j9vgc.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_j9vgc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_omrmm"
+  "ut_omrmm.c"
+  "ut_omrmm.h"
+  "ut_omrmm.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_omrmm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/glue/LanguageVMGlue.c" "omr/CMakeFiles/omrcore.dir/__/example/glue/LanguageVMGlue.c.o" "gcc" "omr/CMakeFiles/omrcore.dir/__/example/glue/LanguageVMGlue.c.o.d"
+  "/root/repo/example/glue/Profiling.c" "omr/CMakeFiles/omrcore.dir/__/example/glue/Profiling.c.o" "gcc" "omr/CMakeFiles/omrcore.dir/__/example/glue/Profiling.c.o.d"
+  "/root/repo/_ci_build/omr/ut_omrti.c" "omr/CMakeFiles/omrcore.dir/ut_omrti.c.o" "gcc" "omr/CMakeFiles/omrcore.dir/ut_omrti.c.o.d"
+  "/root/repo/_ci_build/omr/ut_omrvm.c" "omr/CMakeFiles/omrcore.dir/ut_omrvm.c.o" "gcc" "omr/CMakeFiles/omrcore.dir/ut_omrvm.c.o.d"
+  "/root/repo/omr/OMR_Agent.cpp" "omr/CMakeFiles/omrcore.dir/OMR_Agent.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_Agent.cpp.o.d"
+  "/root/repo/omr/OMR_MethodDictionary.cpp" "omr/CMakeFiles/omrcore.dir/OMR_MethodDictionary.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_MethodDictionary.cpp.o.d"
+  "/root/repo/omr/OMR_Profiler.cpp" "omr/CMakeFiles/omrcore.dir/OMR_Profiler.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_Profiler.cpp.o.d"
+  "/root/repo/omr/OMR_Runtime.cpp" "omr/CMakeFiles/omrcore.dir/OMR_Runtime.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_Runtime.cpp.o.d"
+  "/root/repo/omr/OMR_TI.cpp" "omr/CMakeFiles/omrcore.dir/OMR_TI.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_TI.cpp.o.d"
+  "/root/repo/omr/OMR_TIMemorySize.cpp" "omr/CMakeFiles/omrcore.dir/OMR_TIMemorySize.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_TIMemorySize.cpp.o.d"
+  "/root/repo/omr/OMR_VM.cpp" "omr/CMakeFiles/omrcore.dir/OMR_VM.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_VM.cpp.o.d"
+  "/root/repo/omr/OMR_VMThread.cpp" "omr/CMakeFiles/omrcore.dir/OMR_VMThread.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/OMR_VMThread.cpp.o.d"
+  "/root/repo/example/glue/omrExampleVM.cpp" "omr/CMakeFiles/omrcore.dir/__/example/glue/omrExampleVM.cpp.o" "gcc" "omr/CMakeFiles/omrcore.dir/__/example/glue/omrExampleVM.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/omr/ut_omrti.h" "/root/repo/_ci_build/omr/ut_omrti.c"
+  "/root/repo/_ci_build/omr/ut_omrti.pdat" "/root/repo/_ci_build/omr/ut_omrti.c"
+  "/root/repo/_ci_build/omr/ut_omrvm.h" "/root/repo/_ci_build/omr/ut_omrvm.c"
+  "/root/repo/_ci_build/omr/ut_omrvm.pdat" "/root/repo/_ci_build/omr/ut_omrvm.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrcore.dir/OMR_Agent.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_Agent.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_MethodDictionary.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_MethodDictionary.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_Profiler.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_Profiler.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_Runtime.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_Runtime.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_TI.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_TI.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_TIMemorySize.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_TIMemorySize.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_VM.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_VM.cpp.o.d"
+  "CMakeFiles/omrcore.dir/OMR_VMThread.cpp.o"
+  "CMakeFiles/omrcore.dir/OMR_VMThread.cpp.o.d"
+  "CMakeFiles/omrcore.dir/__/example/glue/LanguageVMGlue.c.o"
+  "CMakeFiles/omrcore.dir/__/example/glue/LanguageVMGlue.c.o.d"
+  "CMakeFiles/omrcore.dir/__/example/glue/Profiling.c.o"
+  "CMakeFiles/omrcore.dir/__/example/glue/Profiling.c.o.d"
+  "CMakeFiles/omrcore.dir/__/example/glue/omrExampleVM.cpp.o"
+  "CMakeFiles/omrcore.dir/__/example/glue/omrExampleVM.cpp.o.d"
+  "CMakeFiles/omrcore.dir/ut_omrti.c.o"
+  "CMakeFiles/omrcore.dir/ut_omrti.c.o.d"
+  "CMakeFiles/omrcore.dir/ut_omrvm.c.o"
+  "CMakeFiles/omrcore.dir/ut_omrvm.c.o.d"
+  "libomrcore.a"
+  "libomrcore.pdb"
+  "ut_omrti.c"
+  "ut_omrti.h"
+  "ut_omrti.pdat"
+  "ut_omrvm.c"
+  "ut_omrvm.h"
+  "ut_omrvm.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrcore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
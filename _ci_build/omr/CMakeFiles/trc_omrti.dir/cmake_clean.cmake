@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_omrti"
+  "ut_omrti.c"
+  "ut_omrti.h"
+  "ut_omrti.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_omrti.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
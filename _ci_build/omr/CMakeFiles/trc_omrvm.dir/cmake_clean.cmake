@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_omrvm"
+  "ut_omrvm.c"
+  "ut_omrvm.h"
+  "ut_omrvm.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_omrvm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrvmstartup.dir/omrrasinit.c.o"
+  "CMakeFiles/omrvmstartup.dir/omrrasinit.c.o.d"
+  "CMakeFiles/omrvmstartup.dir/omrtrcinit.c.o"
+  "CMakeFiles/omrvmstartup.dir/omrtrcinit.c.o.d"
+  "CMakeFiles/omrvmstartup.dir/omrvmstartup.cpp.o"
+  "CMakeFiles/omrvmstartup.dir/omrvmstartup.cpp.o.d"
+  "libomrvmstartup.a"
+  "libomrvmstartup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrvmstartup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrsig.dir/omrsig.cpp.o"
+  "CMakeFiles/omrsig.dir/omrsig.cpp.o.d"
+  "libomrsig.pdb"
+  "libomrsig.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrsig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/omrtrace/omrtraceapi.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceapi.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceapi.cpp.o.d"
+  "/root/repo/omrtrace/omrtracecomponent.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracecomponent.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracecomponent.cpp.o.d"
+  "/root/repo/omrtrace/omrtraceformatter.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceformatter.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceformatter.cpp.o.d"
+  "/root/repo/omrtrace/omrtracelog.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracelog.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracelog.cpp.o.d"
+  "/root/repo/omrtrace/omrtracemain.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracemain.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracemain.cpp.o.d"
+  "/root/repo/omrtrace/omrtracemisc.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracemisc.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracemisc.cpp.o.d"
+  "/root/repo/omrtrace/omrtraceoptions.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceoptions.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtraceoptions.cpp.o.d"
+  "/root/repo/omrtrace/omrtracepublish.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracepublish.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracepublish.cpp.o.d"
+  "/root/repo/omrtrace/omrtracewrappers.cpp" "omrtrace/CMakeFiles/omrtrace.dir/omrtracewrappers.cpp.o" "gcc" "omrtrace/CMakeFiles/omrtrace.dir/omrtracewrappers.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/thread/CMakeFiles/j9thrstatic.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/hashtable/CMakeFiles/j9hashtable.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
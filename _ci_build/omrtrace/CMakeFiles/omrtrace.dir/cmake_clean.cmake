@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrtrace.dir/omrtraceapi.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtraceapi.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracecomponent.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracecomponent.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtraceformatter.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtraceformatter.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracelog.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracelog.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracemain.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracemain.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracemisc.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracemisc.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtraceoptions.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtraceoptions.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracepublish.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracepublish.cpp.o.d"
+  "CMakeFiles/omrtrace.dir/omrtracewrappers.cpp.o"
+  "CMakeFiles/omrtrace.dir/omrtracewrappers.cpp.o.d"
+  "libomrtrace.a"
+  "libomrtrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omrtrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
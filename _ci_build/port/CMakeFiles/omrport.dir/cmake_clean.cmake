@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libomrport.a"
+  "libomrport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/omrport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
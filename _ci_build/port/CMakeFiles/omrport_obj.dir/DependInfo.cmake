@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/port/common/j9nls.c" "port/CMakeFiles/omrport_obj.dir/common/j9nls.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/j9nls.c.o.d"
+  "/root/repo/port/common/omrerror.c" "port/CMakeFiles/omrport_obj.dir/common/omrerror.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrerror.c.o.d"
+  "/root/repo/port/common/omrexit.c" "port/CMakeFiles/omrport_obj.dir/common/omrexit.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrexit.c.o.d"
+  "/root/repo/port/common/omrfile_blockingasync.c" "port/CMakeFiles/omrport_obj.dir/common/omrfile_blockingasync.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrfile_blockingasync.c.o.d"
+  "/root/repo/port/common/omrfilestream.c" "port/CMakeFiles/omrport_obj.dir/common/omrfilestream.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrfilestream.c.o.d"
+  "/root/repo/port/common/omrfilestreamtext.c" "port/CMakeFiles/omrport_obj.dir/common/omrfilestreamtext.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrfilestreamtext.c.o.d"
+  "/root/repo/port/common/omrgetasid.c" "port/CMakeFiles/omrport_obj.dir/common/omrgetasid.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrgetasid.c.o.d"
+  "/root/repo/port/common/omrgetjobid.c" "port/CMakeFiles/omrport_obj.dir/common/omrgetjobid.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrgetjobid.c.o.d"
+  "/root/repo/port/common/omrgetjobname.c" "port/CMakeFiles/omrport_obj.dir/common/omrgetjobname.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrgetjobname.c.o.d"
+  "/root/repo/port/common/omrheap.c" "port/CMakeFiles/omrport_obj.dir/common/omrheap.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrheap.c.o.d"
+  "/root/repo/port/common/omrintrospect_common.c" "port/CMakeFiles/omrport_obj.dir/common/omrintrospect_common.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrintrospect_common.c.o.d"
+  "/root/repo/port/common/omrmem32helpers.c" "port/CMakeFiles/omrport_obj.dir/common/omrmem32helpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrmem32helpers.c.o.d"
+  "/root/repo/port/common/omrmemcategories.c" "port/CMakeFiles/omrport_obj.dir/common/omrmemcategories.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrmemcategories.c.o.d"
+  "/root/repo/port/common/omrmemtag.c" "port/CMakeFiles/omrport_obj.dir/common/omrmemtag.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrmemtag.c.o.d"
+  "/root/repo/port/common/omrmemtag_checks.c" "port/CMakeFiles/omrport_obj.dir/common/omrmemtag_checks.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrmemtag_checks.c.o.d"
+  "/root/repo/port/common/omrosbacktrace.c" "port/CMakeFiles/omrport_obj.dir/common/omrosbacktrace.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrosbacktrace.c.o.d"
+  "/root/repo/port/common/omrport.c" "port/CMakeFiles/omrport_obj.dir/common/omrport.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrport.c.o.d"
+  "/root/repo/port/common/omrportcontrol.c" "port/CMakeFiles/omrport_obj.dir/common/omrportcontrol.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrportcontrol.c.o.d"
+  "/root/repo/port/common/omrstr.c" "port/CMakeFiles/omrport_obj.dir/common/omrstr.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrstr.c.o.d"
+  "/root/repo/port/common/omrtlshelpers.c" "port/CMakeFiles/omrport_obj.dir/common/omrtlshelpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/common/omrtlshelpers.c.o.d"
+  "/root/repo/port/linux/omrosbacktrace_impl.c" "port/CMakeFiles/omrport_obj.dir/linux/omrosbacktrace_impl.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/linux/omrosbacktrace_impl.c.o.d"
+  "/root/repo/port/linux/omrosdump_helpers.c" "port/CMakeFiles/omrport_obj.dir/linux/omrosdump_helpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/linux/omrosdump_helpers.c.o.d"
+  "/root/repo/port/linux/omrvmem.c" "port/CMakeFiles/omrport_obj.dir/linux/omrvmem.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/linux/omrvmem.c.o.d"
+  "/root/repo/port/linuxamd64/omrsignal_context.c" "port/CMakeFiles/omrport_obj.dir/linuxamd64/omrsignal_context.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/linuxamd64/omrsignal_context.c.o.d"
+  "/root/repo/port/unix/j9nlshelpers.c" "port/CMakeFiles/omrport_obj.dir/unix/j9nlshelpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/j9nlshelpers.c.o.d"
+  "/root/repo/port/unix/omrcpu.c" "port/CMakeFiles/omrport_obj.dir/unix/omrcpu.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrcpu.c.o.d"
+  "/root/repo/port/unix/omrerrorhelpers.c" "port/CMakeFiles/omrport_obj.dir/unix/omrerrorhelpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrerrorhelpers.c.o.d"
+  "/root/repo/port/unix/omrfile.c" "port/CMakeFiles/omrport_obj.dir/unix/omrfile.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrfile.c.o.d"
+  "/root/repo/port/unix/omrfiletext.c" "port/CMakeFiles/omrport_obj.dir/unix/omrfiletext.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrfiletext.c.o.d"
+  "/root/repo/port/unix/omriconvhelpers.c" "port/CMakeFiles/omrport_obj.dir/unix/omriconvhelpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omriconvhelpers.c.o.d"
+  "/root/repo/port/unix/omrintrospect.c" "port/CMakeFiles/omrport_obj.dir/unix/omrintrospect.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrintrospect.c.o.d"
+  "/root/repo/port/unix/omrmem.c" "port/CMakeFiles/omrport_obj.dir/unix/omrmem.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrmem.c.o.d"
+  "/root/repo/port/unix/omrmmap.c" "port/CMakeFiles/omrport_obj.dir/unix/omrmmap.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrmmap.c.o.d"
+  "/root/repo/port/unix/omrosdump.c" "port/CMakeFiles/omrport_obj.dir/unix/omrosdump.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrosdump.c.o.d"
+  "/root/repo/port/unix/omrportptb.c" "port/CMakeFiles/omrport_obj.dir/unix/omrportptb.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrportptb.c.o.d"
+  "/root/repo/port/unix/omrsignal.c" "port/CMakeFiles/omrport_obj.dir/unix/omrsignal.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrsignal.c.o.d"
+  "/root/repo/port/unix/omrsl.c" "port/CMakeFiles/omrport_obj.dir/unix/omrsl.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrsl.c.o.d"
+  "/root/repo/port/unix/omrsysinfo.c" "port/CMakeFiles/omrport_obj.dir/unix/omrsysinfo.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrsysinfo.c.o.d"
+  "/root/repo/port/unix/omrsyslog.c" "port/CMakeFiles/omrport_obj.dir/unix/omrsyslog.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrsyslog.c.o.d"
+  "/root/repo/port/unix/omrtime.c" "port/CMakeFiles/omrport_obj.dir/unix/omrtime.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrtime.c.o.d"
+  "/root/repo/port/unix/omrtty.c" "port/CMakeFiles/omrport_obj.dir/unix/omrtty.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/omrtty.c.o.d"
+  "/root/repo/port/unix/protect_helpers.c" "port/CMakeFiles/omrport_obj.dir/unix/protect_helpers.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/unix/protect_helpers.c.o.d"
+  "/root/repo/_ci_build/port/ut_omrport.c" "port/CMakeFiles/omrport_obj.dir/ut_omrport.c.o" "gcc" "port/CMakeFiles/omrport_obj.dir/ut_omrport.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/port/ut_omrport.h" "/root/repo/_ci_build/port/ut_omrport.c"
+  "/root/repo/_ci_build/port/ut_omrport.pdat" "/root/repo/_ci_build/port/ut_omrport.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
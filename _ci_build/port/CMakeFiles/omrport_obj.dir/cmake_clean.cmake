@@ -0,0 +1,96 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrport_obj.dir/common/j9nls.c.o"
+  "CMakeFiles/omrport_obj.dir/common/j9nls.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrerror.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrerror.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrexit.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrexit.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrfile_blockingasync.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrfile_blockingasync.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrfilestream.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrfilestream.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrfilestreamtext.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrfilestreamtext.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrgetasid.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrgetasid.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrgetjobid.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrgetjobid.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrgetjobname.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrgetjobname.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrheap.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrheap.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrintrospect_common.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrintrospect_common.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrmem32helpers.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrmem32helpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrmemcategories.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrmemcategories.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrmemtag.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrmemtag.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrmemtag_checks.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrmemtag_checks.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrosbacktrace.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrosbacktrace.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrport.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrport.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrportcontrol.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrportcontrol.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrstr.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrstr.c.o.d"
+  "CMakeFiles/omrport_obj.dir/common/omrtlshelpers.c.o"
+  "CMakeFiles/omrport_obj.dir/common/omrtlshelpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/linux/omrosbacktrace_impl.c.o"
+  "CMakeFiles/omrport_obj.dir/linux/omrosbacktrace_impl.c.o.d"
+  "CMakeFiles/omrport_obj.dir/linux/omrosdump_helpers.c.o"
+  "CMakeFiles/omrport_obj.dir/linux/omrosdump_helpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/linux/omrvmem.c.o"
+  "CMakeFiles/omrport_obj.dir/linux/omrvmem.c.o.d"
+  "CMakeFiles/omrport_obj.dir/linuxamd64/omrsignal_context.c.o"
+  "CMakeFiles/omrport_obj.dir/linuxamd64/omrsignal_context.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/j9nlshelpers.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/j9nlshelpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrcpu.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrcpu.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrerrorhelpers.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrerrorhelpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrfile.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrfile.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrfiletext.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrfiletext.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omriconvhelpers.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omriconvhelpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrintrospect.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrintrospect.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrmem.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrmem.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrmmap.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrmmap.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrosdump.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrosdump.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrportptb.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrportptb.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrsignal.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrsignal.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrsl.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrsl.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrsysinfo.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrsysinfo.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrsyslog.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrsyslog.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrtime.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrtime.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/omrtty.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/omrtty.c.o.d"
+  "CMakeFiles/omrport_obj.dir/unix/protect_helpers.c.o"
+  "CMakeFiles/omrport_obj.dir/unix/protect_helpers.c.o.d"
+  "CMakeFiles/omrport_obj.dir/ut_omrport.c.o"
+  "CMakeFiles/omrport_obj.dir/ut_omrport.c.o.d"
+  "ut_omrport.c"
+  "ut_omrport.h"
+  "ut_omrport.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/omrport_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
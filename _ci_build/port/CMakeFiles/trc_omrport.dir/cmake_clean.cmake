@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_omrport"
+  "ut_omrport.c"
+  "ut_omrport.h"
+  "ut_omrport.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_omrport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
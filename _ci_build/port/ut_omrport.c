@@ -0,0 +1,351 @@
+/* File generated by tracegen, do not edit */
+#include "ut_omrport.h"
+
+
+
+#define UT_TRACE_VERSION 8
+UtTraceVersionInfo omrport_UtTraceVersionInfo = {UT_TRACE_VERSION};
+#if defined(UT_TRACE_ENABLED_IN_BUILD)
+unsigned char omrport_UtActive[786] = { 
+	1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0};
+
+unsigned char omrport_UtLevels[786] = { 
+	1,1,1,3,1,1,3,3,3,3,3,1,3,3,1,3,5,1,1,1,5,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,1,3,3,3,3,4,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,5,5,5,5,5,5,5,1,5,5,5,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,1,1,1,1,5,5,5,5,3,3,3,3,1,1,1,
+	1,1,1,3,1,1,1,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,1,1,1,1,
+	1,10,10,10,10,1,10,10,10,10,10,10,10,10,10,10,10,1,1,1,1,1,10,10,10,5,10,10,10,10,
+	1,1,1,10,10,10,10,10,10,10,1,10,10,1,10,10,1,1,1,1,5,5,1,5,3,3,3,3,1,1,
+	1,1,1,5,1,1,1,6,1,1,1,5,1,1,10,10,1,1,1,1,5,10,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,
+	10,1,1,1,1,1,2,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,10,10,10,10,10,10,10,1,10,10,10,
+	10,5,3,3,5,5,5,5,5,5,5,10,1,1,1,1,1,1,1,5,5,5,1,5,5,1,1,1,1,5,
+	5,5,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,1,1,5,5,5,1,1,1,1,5,
+	5,5,3,1,1,3,5,5,1,5,5,5,1,1,1,1,10,10,1,10,1,1,1,1,1,1,1,1,1,3,
+	1,1,3,3,1,1,1,5,1,5,1,5,5,1,5,5,1,1,1,1,5,5,1,5,1,1,1,5,5,1,
+	1,1,5,5,1,1,1,1,1,5,5,5,1,1,1,5,5,5,5,5,1,5,1,5,5,1,1,1,5,5,
+	5,5,5,1,1,1,1,1,1,5,5,3,1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,5,1,5,
+	5,1,1,4,1,1,1,5,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,3,3,
+	1,1,5,1,1,5,5,5,5,1,1,1,3,1,1,3,1,1,1,1,1,1,1,3,3,2,3,3,3,3,
+	3,3,3,3,1,2,1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,3,3,3,3,3,1,1,3,3,
+	1,1,1,1,1,1};
+
+
+int32_t omrport_tpids19[] = {
+
+	674,680,684,688,692,698,703,705,709,713	};
+
+UtGroupDetails omrport_group19 = {
+	(char *)"j9filestrean",
+	10,
+	omrport_tpids19,
+	NULL};
+int32_t omrport_tpids18[] = {
+
+	673,675,676,677,678,679,681,682,683,685,686,687,689,690,691,693,694,695,696,697,699,700,701,702,704,706,707,708,710,711,
+	712,714,715	};
+
+UtGroupDetails omrport_group18 = {
+	(char *)"omrfilestream",
+	33,
+	omrport_tpids18,
+	&omrport_group19};
+int32_t omrport_tpids17[] = {
+
+	659,660,661	};
+
+UtGroupDetails omrport_group17 = {
+	(char *)"j9sysinfo",
+	3,
+	omrport_tpids17,
+	&omrport_group18};
+int32_t omrport_tpids16[] = {
+
+	657	};
+
+UtGroupDetails omrport_group16 = {
+	(char *)"nlsmessage",
+	1,
+	omrport_tpids16,
+	&omrport_group17};
+int32_t omrport_tpids15[] = {
+
+	656	};
+
+UtGroupDetails omrport_group15 = {
+	(char *)"syslog",
+	1,
+	omrport_tpids15,
+	&omrport_group16};
+int32_t omrport_tpids14[] = {
+
+	560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,576,577,578,579,580,581,582,583,584,585,586,587,588,589,
+	590,591,592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,
+	620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,640,641,642,643,644,645,646,647,648,649,
+	650,651,652,653,654,655,662,667,668,669,670,671,672,725,726,727,728,729,730,731,732,733,734,735,741,742,743,744,745,746,
+	747,748,749,750,751,752,753,754,755,756,757,773,774,776,777,783,784	};
+
+UtGroupDetails omrport_group14 = {
+	(char *)"sysinfo",
+	137,
+	omrport_tpids14,
+	&omrport_group15};
+int32_t omrport_tpids13[] = {
+
+	469,470,471,472,473,474,475,476,477,478,479,480	};
+
+UtGroupDetails omrport_group13 = {
+	(char *)"sl",
+	12,
+	omrport_tpids13,
+	&omrport_group14};
+int32_t omrport_tpids12[] = {
+
+	426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+	456,457,458,459,460,461,462,463,464,465,466,467,468,758,759,760,761,762,763,764,765,766,767,768,769,770,771,772,775,778,
+	779,780,781,782,785	};
+
+UtGroupDetails omrport_group12 = {
+	(char *)"signal",
+	65,
+	omrport_tpids12,
+	&omrport_group13};
+int32_t omrport_tpids11[] = {
+
+	382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,
+	412,413,414,415,416,417,418,419,420,421,422,423,424,425,724	};
+
+UtGroupDetails omrport_group11 = {
+	(char *)"mmap",
+	45,
+	omrport_tpids11,
+	&omrport_group12};
+int32_t omrport_tpids10[] = {
+
+	322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,
+	353,360,361,362,363,364,365,366,368,369,370,371,372,373,374,375,376,377,378,379,380,381,481,482,483,484,485,486,487,488,
+	489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,
+	519,520,521,522,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,
+	550,551,552,553,554,555,556,557,558,559,716,717,718,719,720,721,722,723	};
+
+UtGroupDetails omrport_group10 = {
+	(char *)"mem",
+	138,
+	omrport_tpids10,
+	&omrport_group11};
+int32_t omrport_tpids9[] = {
+
+	298,299,302,305,306,320,760,762,785	};
+
+UtGroupDetails omrport_group9 = {
+	(char *)"Exit-Exception",
+	9,
+	omrport_tpids9,
+	&omrport_group10};
+int32_t omrport_tpids8[] = {
+
+	297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321	};
+
+UtGroupDetails omrport_group8 = {
+	(char *)"heap",
+	25,
+	omrport_tpids8,
+	&omrport_group9};
+int32_t omrport_tpids7[] = {
+
+	214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,
+	244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,
+	274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296	};
+
+UtGroupDetails omrport_group7 = {
+	(char *)"file",
+	83,
+	omrport_tpids7,
+	&omrport_group8};
+int32_t omrport_tpids6[] = {
+
+	2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+	32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,
+	62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,
+	92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,
+	122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,
+	152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,
+	182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,
+	212,213,664,665,666	};
+
+UtGroupDetails omrport_group6 = {
+	(char *)"cuda",
+	215,
+	omrport_tpids6,
+	&omrport_group7};
+int32_t omrport_tpids5[] = {
+
+	0,1,352,354,355,356,357,359,367	};
+
+UtGroupDetails omrport_group5 = {
+	(char *)"Assertion",
+	9,
+	omrport_tpids5,
+	&omrport_group6};
+
+UtGroupDetails omrport_group4 = {
+	(char *)"Debug",
+	0,
+	NULL,
+	&omrport_group5};
+int32_t omrport_tpids3[] = {
+
+	4,11,14,17,18,42,43,44,45,46,47,139,174,255,256,257,258,261,262,267,268,269,270,271,272,274,275,276,296,317,
+	318,330,331,332,340,343,358,360,361,362,364,368,369,370,371,372,373,376,377,378,379,414,418,421,422,423,424,425,467,482,
+	491,494,495,496,497,502,505,506,507,508,512,513,514,515,516,517,518,519,520,521,522,523,530,542,543,544,545,548,552,553,
+	554,555,558,563,564,567,568,570,571,574,575,576,578,580,583,586,587,588,589,592,594,595,596,599,600,601,604,605,606,607,
+	608,612,613,614,620,622,625,626,627,633,634,635,636,637,638,642,643,644,645,646,647,649,650,651,653,654,655,656,661,662,
+	664,665,666,668,669,670,675,676,677,678,681,682,685,686,689,690,693,694,695,696,700,701,706,707,710,711,714,715,718,719,
+	720,721,723,729,730,731,733,734,736,737,738,739,740,741,742,754,767,770,773,774,775,776,780,781,782,783,784	};
+
+UtGroupDetails omrport_group3 = {
+	(char *)"Exception",
+	207,
+	omrport_tpids3,
+	&omrport_group4};
+int32_t omrport_tpids2[] = {
+
+	3,19,52,55,64,67,70,73,76,79,82,85,98,101,106,115,124,136,140,152,155,158,161,164,169,175,178,181,186,189,
+	198,201,244,247,250,253,263,264,265,266,311,312,313,314,315,336,337,338,339,344,345,350,351,363,365,380,381,384,386,388,
+	394,395,397,402,405,411,416,419,420,427,432,433,435,437,438,439,441,442,443,444,445,446,447,448,449,450,451,452,453,460,
+	463,465,466,468,476,480,483,498,500,501,510,511,525,527,528,531,535,536,537,538,540,541,546,547,549,550,551,556,565,566,
+	569,572,573,579,593,615,639,640,641,657,658,659,660,663,671,699,716,732,735,743,745,755,756,758,761,763,764,765,777	};
+
+UtGroupDetails omrport_group2 = {
+	(char *)"Event",
+	149,
+	omrport_tpids2,
+	&omrport_group3};
+int32_t omrport_tpids1[] = {
+
+	5,7,9,12,15,20,22,24,26,28,30,32,34,36,38,40,48,50,53,56,58,60,62,65,68,71,74,77,80,83,
+	86,88,90,92,94,96,99,102,104,107,109,111,113,116,118,120,122,125,127,129,131,132,134,137,141,143,145,147,148,149,
+	150,153,156,159,162,165,167,170,172,176,179,182,184,187,190,192,194,196,199,202,204,206,208,210,215,217,219,221,222,223,
+	225,226,227,228,230,232,234,236,238,240,242,245,248,251,254,260,277,279,281,282,283,285,286,290,291,293,294,295,300,303,
+	307,309,316,321,322,324,325,327,329,335,342,347,349,366,375,383,385,387,389,391,392,393,396,398,399,401,403,404,407,408,
+	410,412,413,417,428,429,430,431,436,440,455,457,458,470,472,473,474,477,478,479,484,486,488,490,493,503,509,526,533,539,
+	559,561,562,581,584,590,597,602,609,611,617,619,623,628,630,632,652,672,674,680,684,688,692,698,703,705,709,713,722,724,
+	726,728,746,748,750,752,757,766,769,772,779	};
+
+UtGroupDetails omrport_group1 = {
+	(char *)"Exit",
+	221,
+	omrport_tpids1,
+	&omrport_group2};
+int32_t omrport_tpids0[] = {
+
+	2,6,8,10,13,16,21,23,25,27,29,31,33,35,37,39,41,49,51,54,57,59,61,63,66,69,72,75,78,81,
+	84,87,89,91,93,95,97,100,103,105,108,110,112,114,117,119,121,123,126,128,130,133,135,138,142,144,146,151,154,157,
+	160,163,166,168,171,173,177,180,183,185,188,191,193,195,197,200,203,205,207,209,211,212,213,214,216,218,220,224,229,231,
+	233,235,237,239,241,243,246,249,252,259,273,278,280,284,287,288,289,292,297,301,304,308,310,319,323,326,328,333,334,341,
+	346,348,353,374,382,390,400,406,409,415,426,434,454,456,459,461,462,464,469,471,475,481,485,487,489,492,499,504,524,529,
+	532,534,557,560,577,582,585,591,598,603,610,616,618,621,624,629,631,648,667,673,679,683,687,691,697,702,704,708,712,717,
+	725,727,744,747,749,751,753,759,768,771,778	};
+
+UtGroupDetails omrport_group0 = {
+	(char *)"Entry",
+	191,
+	omrport_tpids0,
+	&omrport_group1};
+UtModuleInfo omrport_UtModuleInfo = {(char*) "omrport", 7, 786, 0, omrport_UtActive , NULL, NULL, &omrport_UtTraceVersionInfo, (char*) "OMRTraceFormat.dat", omrport_UtLevels, &omrport_group0, NULL, NULL, 0, 0};
+
+#else
+unsigned char omrport_UtActive[1];
+UtModuleInfo omrport_UtModuleInfo = {(char*) "omrport", 7, 0, 0, NULL, NULL, NULL, &omrport_UtTraceVersionInfo, (char*) "OMRTraceFormat.dat", NULL, NULL, NULL, NULL, 0, 0};
+
+#endif /* defined(UT_TRACE_ENABLED_IN_BUILD) */
+/* function to register with trace engine and configure current module */
+int32_t
+registeromrportWithTrace(UtInterface *utIntf, UtModuleInfo * containerModule)
+{
+	I_32 rc = 0;
+
+#if defined(UT_TRACE_ENABLED_IN_BUILD)
+
+	omrport_UtModuleInfo.containerModule = containerModule;
+
+	if( utIntf == NULL ) {
+		rc = -1;
+	}
+
+	if (rc == 0) {
+		utIntf->module->TraceInit(NULL, &omrport_UtModuleInfo);
+	}
+
+	if (rc == 0) {
+		extern int32_t registerj9utilcoreWithTrace(UtInterface *utIntf, UtModuleInfo* containerModule);
+
+		rc = registerj9utilcoreWithTrace(utIntf, &omrport_UtModuleInfo);
+	}
+
+#else
+	/* trace not present in build - NOOP */
+#endif /* defined(UT_TRACE_ENABLED_IN_BUILD) */
+	return rc;
+}
+
+/* function to deregister with trace engine and configure current module */
+int32_t
+deregisteromrportWithTrace(UtInterface *utIntf)
+{
+	I_32 rc = 0;
+
+#if defined(UT_TRACE_ENABLED_IN_BUILD)
+	if( utIntf == NULL ) {
+		rc = -1;
+	}
+
+	if (rc == 0) {
+		utIntf->module->TraceTerm(NULL, &omrport_UtModuleInfo);
+	}
+
+	if (rc == 0) {
+		extern int32_t deregisterj9utilcoreWithTrace(UtInterface *utIntf);
+
+		rc = deregisterj9utilcoreWithTrace(utIntf);
+	}
+#else
+	/* trace not present in build - NOOP */
+#endif /* defined(UT_TRACE_ENABLED_IN_BUILD) */
+	return rc;
+}
+/* End of generated file */
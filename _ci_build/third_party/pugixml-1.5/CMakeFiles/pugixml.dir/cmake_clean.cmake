@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pugixml.dir/pugixml.cpp.o"
+  "CMakeFiles/pugixml.dir/pugixml.cpp.o.d"
+  "libpugixml.a"
+  "libpugixml.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pugixml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
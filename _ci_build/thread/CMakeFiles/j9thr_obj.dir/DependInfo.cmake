@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thread/common/j9sem.c" "thread/CMakeFiles/j9thr_obj.dir/common/j9sem.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/j9sem.c.o.d"
+  "/root/repo/thread/common/omrthread.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthread.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthread.c.o.d"
+  "/root/repo/thread/common/omrthreaderror.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreaderror.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreaderror.c.o.d"
+  "/root/repo/thread/common/omrthreadinspect.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadinspect.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadinspect.c.o.d"
+  "/root/repo/thread/common/omrthreadjlm.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadjlm.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadjlm.c.o.d"
+  "/root/repo/thread/common/omrthreadpriority.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadpriority.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadpriority.c.o.d"
+  "/root/repo/thread/common/omrthreadtls.c" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadtls.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadtls.c.o.d"
+  "/root/repo/thread/common/rwmutex.c" "thread/CMakeFiles/j9thr_obj.dir/common/rwmutex.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/rwmutex.c.o.d"
+  "/root/repo/thread/common/thrprof.c" "thread/CMakeFiles/j9thr_obj.dir/common/thrprof.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/thrprof.c.o.d"
+  "/root/repo/thread/linux/omrthreadnuma.c" "thread/CMakeFiles/j9thr_obj.dir/linux/omrthreadnuma.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/linux/omrthreadnuma.c.o.d"
+  "/root/repo/thread/linux/priority.c" "thread/CMakeFiles/j9thr_obj.dir/linux/priority.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/linux/priority.c.o.d"
+  "/root/repo/thread/unix/omrthreadattr.c" "thread/CMakeFiles/j9thr_obj.dir/unix/omrthreadattr.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/omrthreadattr.c.o.d"
+  "/root/repo/thread/unix/omrthreaddebug.c" "thread/CMakeFiles/j9thr_obj.dir/unix/omrthreaddebug.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/omrthreaddebug.c.o.d"
+  "/root/repo/thread/unix/rasthrsup.c" "thread/CMakeFiles/j9thr_obj.dir/unix/rasthrsup.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/rasthrsup.c.o.d"
+  "/root/repo/thread/unix/thrcreate.c" "thread/CMakeFiles/j9thr_obj.dir/unix/thrcreate.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/thrcreate.c.o.d"
+  "/root/repo/thread/unix/thrdsup.c" "thread/CMakeFiles/j9thr_obj.dir/unix/thrdsup.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/thrdsup.c.o.d"
+  "/root/repo/thread/unix/unixpriority.c" "thread/CMakeFiles/j9thr_obj.dir/unix/unixpriority.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/unix/unixpriority.c.o.d"
+  "/root/repo/_ci_build/thread/ut_j9thr.c" "thread/CMakeFiles/j9thr_obj.dir/ut_j9thr.c.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/ut_j9thr.c.o.d"
+  "/root/repo/thread/common/omrthreadmem.cpp" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadmem.cpp.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/omrthreadmem.cpp.o.d"
+  "/root/repo/thread/common/threadhelpers.cpp" "thread/CMakeFiles/j9thr_obj.dir/common/threadhelpers.cpp.o" "gcc" "thread/CMakeFiles/j9thr_obj.dir/common/threadhelpers.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/thread/ut_j9thr.h" "/root/repo/_ci_build/thread/ut_j9thr.c"
+  "/root/repo/_ci_build/thread/ut_j9thr.pdat" "/root/repo/_ci_build/thread/ut_j9thr.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
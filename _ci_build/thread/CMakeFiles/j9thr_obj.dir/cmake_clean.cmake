@@ -0,0 +1,50 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/j9thr_obj.dir/common/j9sem.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/j9sem.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthread.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthread.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreaderror.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreaderror.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadinspect.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadinspect.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadjlm.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadjlm.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadmem.cpp.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadmem.cpp.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadpriority.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadpriority.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadtls.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/omrthreadtls.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/rwmutex.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/rwmutex.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/threadhelpers.cpp.o"
+  "CMakeFiles/j9thr_obj.dir/common/threadhelpers.cpp.o.d"
+  "CMakeFiles/j9thr_obj.dir/common/thrprof.c.o"
+  "CMakeFiles/j9thr_obj.dir/common/thrprof.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/linux/omrthreadnuma.c.o"
+  "CMakeFiles/j9thr_obj.dir/linux/omrthreadnuma.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/linux/priority.c.o"
+  "CMakeFiles/j9thr_obj.dir/linux/priority.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/omrthreadattr.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/omrthreadattr.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/omrthreaddebug.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/omrthreaddebug.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/rasthrsup.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/rasthrsup.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/thrcreate.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/thrcreate.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/thrdsup.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/thrdsup.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/unix/unixpriority.c.o"
+  "CMakeFiles/j9thr_obj.dir/unix/unixpriority.c.o.d"
+  "CMakeFiles/j9thr_obj.dir/ut_j9thr.c.o"
+  "CMakeFiles/j9thr_obj.dir/ut_j9thr.c.o.d"
+  "ut_j9thr.c"
+  "ut_j9thr.h"
+  "ut_j9thr.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/j9thr_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libj9thrstatic.a"
+  "libj9thrstatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/j9thrstatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_j9thr"
+  "ut_j9thr.c"
+  "ut_j9thr.h"
+  "ut_j9thr.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_j9thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
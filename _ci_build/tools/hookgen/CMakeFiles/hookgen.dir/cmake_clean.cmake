@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hookgen.dir/HookGen.cpp.o"
+  "CMakeFiles/hookgen.dir/HookGen.cpp.o.d"
+  "CMakeFiles/hookgen.dir/main.cpp.o"
+  "CMakeFiles/hookgen.dir/main.cpp.o.d"
+  "hookgen"
+  "hookgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hookgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/tracegen/ArgParser.cpp" "tools/tracegen/CMakeFiles/trace.dir/ArgParser.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/ArgParser.cpp.o.d"
+  "/root/repo/tools/tracegen/CFileWriter.cpp" "tools/tracegen/CMakeFiles/trace.dir/CFileWriter.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/CFileWriter.cpp.o.d"
+  "/root/repo/tools/tracegen/DATFileWriter.cpp" "tools/tracegen/CMakeFiles/trace.dir/DATFileWriter.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/DATFileWriter.cpp.o.d"
+  "/root/repo/tools/tracegen/FileReader.cpp" "tools/tracegen/CMakeFiles/trace.dir/FileReader.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/FileReader.cpp.o.d"
+  "/root/repo/tools/tracegen/FileUtils.cpp" "tools/tracegen/CMakeFiles/trace.dir/FileUtils.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/FileUtils.cpp.o.d"
+  "/root/repo/tools/tracegen/Port.cpp" "tools/tracegen/CMakeFiles/trace.dir/Port.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/Port.cpp.o.d"
+  "/root/repo/tools/tracegen/StringUtils.cpp" "tools/tracegen/CMakeFiles/trace.dir/StringUtils.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/StringUtils.cpp.o.d"
+  "/root/repo/tools/tracegen/TDFParser.cpp" "tools/tracegen/CMakeFiles/trace.dir/TDFParser.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/TDFParser.cpp.o.d"
+  "/root/repo/tools/tracegen/TraceGen.cpp" "tools/tracegen/CMakeFiles/trace.dir/TraceGen.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/TraceGen.cpp.o.d"
+  "/root/repo/tools/tracegen/TraceHeaderWriter.cpp" "tools/tracegen/CMakeFiles/trace.dir/TraceHeaderWriter.cpp.o" "gcc" "tools/tracegen/CMakeFiles/trace.dir/TraceHeaderWriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
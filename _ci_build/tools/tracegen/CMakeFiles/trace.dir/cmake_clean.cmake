@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trace.dir/ArgParser.cpp.o"
+  "CMakeFiles/trace.dir/ArgParser.cpp.o.d"
+  "CMakeFiles/trace.dir/CFileWriter.cpp.o"
+  "CMakeFiles/trace.dir/CFileWriter.cpp.o.d"
+  "CMakeFiles/trace.dir/DATFileWriter.cpp.o"
+  "CMakeFiles/trace.dir/DATFileWriter.cpp.o.d"
+  "CMakeFiles/trace.dir/FileReader.cpp.o"
+  "CMakeFiles/trace.dir/FileReader.cpp.o.d"
+  "CMakeFiles/trace.dir/FileUtils.cpp.o"
+  "CMakeFiles/trace.dir/FileUtils.cpp.o.d"
+  "CMakeFiles/trace.dir/Port.cpp.o"
+  "CMakeFiles/trace.dir/Port.cpp.o.d"
+  "CMakeFiles/trace.dir/StringUtils.cpp.o"
+  "CMakeFiles/trace.dir/StringUtils.cpp.o.d"
+  "CMakeFiles/trace.dir/TDFParser.cpp.o"
+  "CMakeFiles/trace.dir/TDFParser.cpp.o.d"
+  "CMakeFiles/trace.dir/TraceGen.cpp.o"
+  "CMakeFiles/trace.dir/TraceGen.cpp.o.d"
+  "CMakeFiles/trace.dir/TraceHeaderWriter.cpp.o"
+  "CMakeFiles/trace.dir/TraceHeaderWriter.cpp.o.d"
+  "libtrace.a"
+  "libtrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
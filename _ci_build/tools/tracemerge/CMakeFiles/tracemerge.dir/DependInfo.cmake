@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/tracemerge/DATMerge.cpp" "tools/tracemerge/CMakeFiles/tracemerge.dir/DATMerge.cpp.o" "gcc" "tools/tracemerge/CMakeFiles/tracemerge.dir/DATMerge.cpp.o.d"
+  "/root/repo/tools/tracemerge/main.cpp" "tools/tracemerge/CMakeFiles/tracemerge.dir/main.cpp.o" "gcc" "tools/tracemerge/CMakeFiles/tracemerge.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/tools/tracegen/CMakeFiles/trace.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
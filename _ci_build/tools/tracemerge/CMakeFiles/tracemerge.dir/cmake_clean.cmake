@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tracemerge.dir/DATMerge.cpp.o"
+  "CMakeFiles/tracemerge.dir/DATMerge.cpp.o.d"
+  "CMakeFiles/tracemerge.dir/main.cpp.o"
+  "CMakeFiles/tracemerge.dir/main.cpp.o.d"
+  "tracemerge"
+  "tracemerge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tracemerge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vgcdecode.dir/main.cpp.o"
+  "CMakeFiles/vgcdecode.dir/main.cpp.o.d"
+  "vgcdecode"
+  "vgcdecode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vgcdecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/util
+# Build directory: /root/repo/_ci_build/util
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("avl")
+subdirs("hashtable")
+subdirs("hookable")
+subdirs("main_function")
+subdirs("omrutil")
+subdirs("pool")
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/avl/avlsup.c" "util/avl/CMakeFiles/j9avl.dir/avlsup.c.o" "gcc" "util/avl/CMakeFiles/j9avl.dir/avlsup.c.o.d"
+  "/root/repo/_ci_build/util/avl/ut_avl.c" "util/avl/CMakeFiles/j9avl.dir/ut_avl.c.o" "gcc" "util/avl/CMakeFiles/j9avl.dir/ut_avl.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/util/avl/ut_avl.h" "/root/repo/_ci_build/util/avl/ut_avl.c"
+  "/root/repo/_ci_build/util/avl/ut_avl.pdat" "/root/repo/_ci_build/util/avl/ut_avl.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/j9avl.dir/avlsup.c.o"
+  "CMakeFiles/j9avl.dir/avlsup.c.o.d"
+  "CMakeFiles/j9avl.dir/ut_avl.c.o"
+  "CMakeFiles/j9avl.dir/ut_avl.c.o.d"
+  "libj9avl.a"
+  "libj9avl.pdb"
+  "ut_avl.c"
+  "ut_avl.h"
+  "ut_avl.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/j9avl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
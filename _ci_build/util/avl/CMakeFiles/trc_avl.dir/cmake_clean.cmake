@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_avl"
+  "ut_avl.c"
+  "ut_avl.h"
+  "ut_avl.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_avl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
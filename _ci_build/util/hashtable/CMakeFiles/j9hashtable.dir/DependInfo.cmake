@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/hashtable/hash.c" "util/hashtable/CMakeFiles/j9hashtable.dir/hash.c.o" "gcc" "util/hashtable/CMakeFiles/j9hashtable.dir/hash.c.o.d"
+  "/root/repo/util/hashtable/hashtable.c" "util/hashtable/CMakeFiles/j9hashtable.dir/hashtable.c.o" "gcc" "util/hashtable/CMakeFiles/j9hashtable.dir/hashtable.c.o.d"
+  "/root/repo/_ci_build/util/hashtable/ut_hashtable.c" "util/hashtable/CMakeFiles/j9hashtable.dir/ut_hashtable.c.o" "gcc" "util/hashtable/CMakeFiles/j9hashtable.dir/ut_hashtable.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/util/hashtable/ut_hashtable.h" "/root/repo/_ci_build/util/hashtable/ut_hashtable.c"
+  "/root/repo/_ci_build/util/hashtable/ut_hashtable.pdat" "/root/repo/_ci_build/util/hashtable/ut_hashtable.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ci_build/util/avl/CMakeFiles/j9avl.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/pool/CMakeFiles/j9pool.dir/DependInfo.cmake"
+  "/root/repo/_ci_build/util/omrutil/CMakeFiles/omrutil.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/j9hashtable.dir/hash.c.o"
+  "CMakeFiles/j9hashtable.dir/hash.c.o.d"
+  "CMakeFiles/j9hashtable.dir/hashtable.c.o"
+  "CMakeFiles/j9hashtable.dir/hashtable.c.o.d"
+  "CMakeFiles/j9hashtable.dir/ut_hashtable.c.o"
+  "CMakeFiles/j9hashtable.dir/ut_hashtable.c.o.d"
+  "libj9hashtable.a"
+  "libj9hashtable.pdb"
+  "ut_hashtable.c"
+  "ut_hashtable.h"
+  "ut_hashtable.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/j9hashtable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_hashtable"
+  "ut_hashtable.c"
+  "ut_hashtable.h"
+  "ut_hashtable.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_hashtable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_ci_build/util/hookable/ut_j9hook.c" "util/hookable/CMakeFiles/j9hook_obj.dir/ut_j9hook.c.o" "gcc" "util/hookable/CMakeFiles/j9hook_obj.dir/ut_j9hook.c.o.d"
+  "/root/repo/util/hookable/hookable.cpp" "util/hookable/CMakeFiles/j9hook_obj.dir/hookable.cpp.o" "gcc" "util/hookable/CMakeFiles/j9hook_obj.dir/hookable.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/util/hookable/ut_j9hook.h" "/root/repo/_ci_build/util/hookable/ut_j9hook.c"
+  "/root/repo/_ci_build/util/hookable/ut_j9hook.pdat" "/root/repo/_ci_build/util/hookable/ut_j9hook.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
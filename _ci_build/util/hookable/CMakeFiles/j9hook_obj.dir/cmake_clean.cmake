@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/j9hook_obj.dir/hookable.cpp.o"
+  "CMakeFiles/j9hook_obj.dir/hookable.cpp.o.d"
+  "CMakeFiles/j9hook_obj.dir/ut_j9hook.c.o"
+  "CMakeFiles/j9hook_obj.dir/ut_j9hook.c.o.d"
+  "ut_j9hook.c"
+  "ut_j9hook.h"
+  "ut_j9hook.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/j9hook_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libj9hookstatic.a"
+  "libj9hookstatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/j9hookstatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
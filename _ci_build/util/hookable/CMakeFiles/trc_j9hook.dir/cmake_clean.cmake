@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_j9hook"
+  "ut_j9hook.c"
+  "ut_j9hook.h"
+  "ut_j9hook.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_j9hook.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
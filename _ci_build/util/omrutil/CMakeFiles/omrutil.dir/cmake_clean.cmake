@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libomrutil.a"
+  "libomrutil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
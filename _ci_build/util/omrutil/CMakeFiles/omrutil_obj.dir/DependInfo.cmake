@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/glue/UtilGlue.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/__/__/example/glue/UtilGlue.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/__/__/example/glue/UtilGlue.c.o.d"
+  "/root/repo/util/omrutil/argscan.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/argscan.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/argscan.c.o.d"
+  "/root/repo/util/omrutil/detectVMDirectory.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/detectVMDirectory.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/detectVMDirectory.c.o.d"
+  "/root/repo/util/omrutil/gettimebase.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/gettimebase.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/gettimebase.c.o.d"
+  "/root/repo/util/omrutil/j9memclr.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/j9memclr.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/j9memclr.c.o.d"
+  "/root/repo/util/omrutil/poolForPort.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/poolForPort.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/poolForPort.c.o.d"
+  "/root/repo/util/omrutil/primeNumberHelper.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/primeNumberHelper.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/primeNumberHelper.c.o.d"
+  "/root/repo/util/omrutil/ranking.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/ranking.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/ranking.c.o.d"
+  "/root/repo/util/omrutil/spacesaving.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/spacesaving.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/spacesaving.c.o.d"
+  "/root/repo/util/omrutil/stricmp.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/stricmp.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/stricmp.c.o.d"
+  "/root/repo/util/omrutil/threadhelp.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/threadhelp.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/threadhelp.c.o.d"
+  "/root/repo/util/omrutil/thrname_core.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/thrname_core.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/thrname_core.c.o.d"
+  "/root/repo/_ci_build/util/omrutil/ut_j9utilcore.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/ut_j9utilcore.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/ut_j9utilcore.c.o.d"
+  "/root/repo/util/omrutil/utf8decode.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/utf8decode.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/utf8decode.c.o.d"
+  "/root/repo/util/omrutil/utf8encode.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/utf8encode.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/utf8encode.c.o.d"
+  "/root/repo/util/omrutil/xlphelp.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/xlphelp.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/xlphelp.c.o.d"
+  "/root/repo/util/omrutil/xml.c" "util/omrutil/CMakeFiles/omrutil_obj.dir/xml.c.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/xml.c.o.d"
+  "/root/repo/util/omrutil/AtomicFunctions.cpp" "util/omrutil/CMakeFiles/omrutil_obj.dir/AtomicFunctions.cpp.o" "gcc" "util/omrutil/CMakeFiles/omrutil_obj.dir/AtomicFunctions.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/util/omrutil/ut_j9utilcore.h" "/root/repo/_ci_build/util/omrutil/ut_j9utilcore.c"
+  "/root/repo/_ci_build/util/omrutil/ut_j9utilcore.pdat" "/root/repo/_ci_build/util/omrutil/ut_j9utilcore.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
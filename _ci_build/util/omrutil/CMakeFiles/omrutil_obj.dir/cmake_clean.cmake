@@ -0,0 +1,46 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omrutil_obj.dir/AtomicFunctions.cpp.o"
+  "CMakeFiles/omrutil_obj.dir/AtomicFunctions.cpp.o.d"
+  "CMakeFiles/omrutil_obj.dir/__/__/example/glue/UtilGlue.c.o"
+  "CMakeFiles/omrutil_obj.dir/__/__/example/glue/UtilGlue.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/argscan.c.o"
+  "CMakeFiles/omrutil_obj.dir/argscan.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/detectVMDirectory.c.o"
+  "CMakeFiles/omrutil_obj.dir/detectVMDirectory.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/gettimebase.c.o"
+  "CMakeFiles/omrutil_obj.dir/gettimebase.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/j9memclr.c.o"
+  "CMakeFiles/omrutil_obj.dir/j9memclr.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/poolForPort.c.o"
+  "CMakeFiles/omrutil_obj.dir/poolForPort.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/primeNumberHelper.c.o"
+  "CMakeFiles/omrutil_obj.dir/primeNumberHelper.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/ranking.c.o"
+  "CMakeFiles/omrutil_obj.dir/ranking.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/spacesaving.c.o"
+  "CMakeFiles/omrutil_obj.dir/spacesaving.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/stricmp.c.o"
+  "CMakeFiles/omrutil_obj.dir/stricmp.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/threadhelp.c.o"
+  "CMakeFiles/omrutil_obj.dir/threadhelp.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/thrname_core.c.o"
+  "CMakeFiles/omrutil_obj.dir/thrname_core.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/ut_j9utilcore.c.o"
+  "CMakeFiles/omrutil_obj.dir/ut_j9utilcore.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/utf8decode.c.o"
+  "CMakeFiles/omrutil_obj.dir/utf8decode.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/utf8encode.c.o"
+  "CMakeFiles/omrutil_obj.dir/utf8encode.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/xlphelp.c.o"
+  "CMakeFiles/omrutil_obj.dir/xlphelp.c.o.d"
+  "CMakeFiles/omrutil_obj.dir/xml.c.o"
+  "CMakeFiles/omrutil_obj.dir/xml.c.o.d"
+  "ut_j9utilcore.c"
+  "ut_j9utilcore.h"
+  "ut_j9utilcore.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/omrutil_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
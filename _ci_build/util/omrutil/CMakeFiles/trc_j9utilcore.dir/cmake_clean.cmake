@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_j9utilcore"
+  "ut_j9utilcore.c"
+  "ut_j9utilcore.h"
+  "ut_j9utilcore.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_j9utilcore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
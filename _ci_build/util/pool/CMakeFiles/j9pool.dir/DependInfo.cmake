@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/util/pool/pool.c" "util/pool/CMakeFiles/j9pool.dir/pool.c.o" "gcc" "util/pool/CMakeFiles/j9pool.dir/pool.c.o.d"
+  "/root/repo/util/pool/pool_cap.c" "util/pool/CMakeFiles/j9pool.dir/pool_cap.c.o" "gcc" "util/pool/CMakeFiles/j9pool.dir/pool_cap.c.o.d"
+  "/root/repo/_ci_build/util/pool/ut_pool.c" "util/pool/CMakeFiles/j9pool.dir/ut_pool.c.o" "gcc" "util/pool/CMakeFiles/j9pool.dir/ut_pool.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ci_build/util/pool/ut_pool.h" "/root/repo/_ci_build/util/pool/ut_pool.c"
+  "/root/repo/_ci_build/util/pool/ut_pool.pdat" "/root/repo/_ci_build/util/pool/ut_pool.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
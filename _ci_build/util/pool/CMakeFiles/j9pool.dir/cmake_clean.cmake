@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/j9pool.dir/pool.c.o"
+  "CMakeFiles/j9pool.dir/pool.c.o.d"
+  "CMakeFiles/j9pool.dir/pool_cap.c.o"
+  "CMakeFiles/j9pool.dir/pool_cap.c.o.d"
+  "CMakeFiles/j9pool.dir/ut_pool.c.o"
+  "CMakeFiles/j9pool.dir/ut_pool.c.o.d"
+  "libj9pool.a"
+  "libj9pool.pdb"
+  "ut_pool.c"
+  "ut_pool.h"
+  "ut_pool.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/j9pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trc_pool"
+  "ut_pool.c"
+  "ut_pool.h"
+  "ut_pool.pdat"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/trc_pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
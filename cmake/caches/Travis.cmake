@@ -24,6 +24,7 @@ set(OMR_DDR ON CACHE BOOL "")
 set(OMR_TEST_COMPILER ON CACHE BOOL "")
 set(OMR_JITBUILDER ON CACHE BOOL "")
 
+set(OMR_GC_MODRON_COMPACTION ON CACHE BOOL "")
 set(OMR_GC_SEGREGATED_HEAP ON CACHE BOOL "")
 set(OMR_GC_MODRON_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_MODRON_CONCURRENT_MARK ON CACHE BOOL "")
@@ -134,7 +134,9 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
 	{
-		return NULL;
+		/* the example uses the default size classes, which MM_SizeClasses fills in when the heap is created */
+		static OMR_SizeClasses sizeClasses;
+		return &sizeClasses;
 	}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef COPYFORWARDROOTSCANNER_HPP_
+#define COPYFORWARDROOTSCANNER_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+#include "omrExampleVM.hpp"
+#include "omrhashtable.h"
+
+#include "BalancedGC.hpp"
+#include "EnvironmentBase.hpp"
+#include "ForwardedHeader.hpp"
+#include "ParallelRootScanner.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_CopyForwardRootScanner : public MM_ParallelRootScanner
+{
+	/*
+	 * Member data and types
+	 */
+private:
+	MM_BalancedGC *_collector;
+
+protected:
+public:
+
+	/*
+	 * Member functions
+	 */
+private:
+protected:
+	virtual void
+	doThread(MM_EnvironmentBase *env, OMR_VMThread *walkThread)
+	{
+		if (NULL != walkThread->_savedObject1) {
+			_collector->copyForwardObjectSlot(env, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
+		}
+		if (NULL != walkThread->_savedObject2) {
+			_collector->copyForwardObjectSlot(env, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
+		}
+	}
+
+	virtual void
+	doHashTableEntry(MM_EnvironmentBase *env, RootScannerEntity entity, void *entry)
+	{
+		RootEntry *rootEntry = (RootEntry *)entry;
+		if (NULL != rootEntry->rootPtr) {
+			_collector->copyForwardObjectSlot(env, (volatile omrobjectptr_t *) &rootEntry->rootPtr);
+		}
+	}
+
+public:
+	MM_CopyForwardRootScanner(MM_EnvironmentBase *env, MM_BalancedGC *collector)
+		: MM_ParallelRootScanner(env)
+		, _collector(collector)
+	{
+		_typeId = __FUNCTION__;
+	};
+
+	void
+	scanRoots(MM_EnvironmentBase *env)
+	{
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		scanHashTable(env, omrVM->rootTable, RootScannerEntity_JNIGlobalReferences);
+		scanThreads(env);
+	}
+
+	void scanClearable(MM_EnvironmentBase *env)
+	{
+		OMRPORT_ACCESS_FROM_OMRVM(env->getOmrVM());
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		if (NULL != omrVM->objectTable) {
+			if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+				J9HashTableState state;
+				ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+				while (NULL != objectEntry) {
+					if (_collector->isObjectInCollectionSet(objectEntry->objPtr)) {
+						MM_ForwardedHeader fwdHeader(objectEntry->objPtr);
+						if (fwdHeader.isForwardedPointer()) {
+							/* an object left in place by a failed evacuation is forwarded to itself */
+							objectEntry->objPtr = fwdHeader.getNonStrictForwardedObject();
+						} else {
+							omrmem_free_memory((void *)objectEntry->name);
+							objectEntry->name = NULL;
+							hashTableDoRemove(&state);
+						}
+					}
+					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
+		}
+	}
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+#endif /* COPYFORWARDROOTSCANNER_HPP_ */
@@ -163,6 +163,19 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Identify the allocation site of an allocation sampled by the allocation sampling profiler (see
+	 * MM_GCExtensionsBase::allocationSamplingEnabled). This is called by the allocating thread before the
+	 * object is initialized. The site is an opaque key, eg a method and bytecode index, used to rank the
+	 * sampled allocations (see MM_AllocationSamplingStats).
+	 *
+	 * This example has no language call stack, so allocations are attributed to their size.
+	 *
+	 * @param sizeInBytes Size of the sampled allocation
+	 * @return the allocation site
+	 */
+	void *getAllocationSite(uintptr_t sizeInBytes) { return (void *)sizeInBytes; }
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
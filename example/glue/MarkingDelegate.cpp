@@ -23,33 +23,17 @@
 #include "omrhashtable.h"
 
 #include "EnvironmentBase.hpp"
+#include "MarkingRootScanner.hpp"
 #include "MarkingScheme.hpp"
 #include "omrExampleVM.hpp"
-#include "OMRVMThreadListIterator.hpp"
 
 #include "MarkingDelegate.hpp"
 
 void
 MM_MarkingDelegate::scanRoots(MM_EnvironmentBase *env)
 {
-	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
-	J9HashTableState state;
-	RootEntry *rEntry = NULL;
-	rEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
-	while (rEntry != NULL) {
-		_markingScheme->markObject(env, rEntry->rootPtr);
-		rEntry = (RootEntry *)hashTableNextDo(&state);
-	}
-	OMR_VMThread *walkThread;
-	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-	while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
-		if (NULL != walkThread->_savedObject1) {
-			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject1);
-		}
-		if (NULL != walkThread->_savedObject2) {
-			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject2);
-		}
-	}
+	MM_MarkingRootScanner rootScanner(env, _markingScheme);
+	rootScanner.scanRoots(env);
 }
 
 void
@@ -152,6 +152,8 @@ public:
 	 *
 	 * For each root object identified, MM_MarkingScheme::scanObject() must be called via _markingScheme.
 	 *
+	 * Roots are split into units of work shared by all threads of the marking task (see MM_ParallelRootScanner).
+	 *
 	 * @param env The environment for the calling thread
 	 */
 	void scanRoots(MM_EnvironmentBase *env);
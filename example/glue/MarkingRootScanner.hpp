@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef MARKINGROOTSCANNER_HPP_
+#define MARKINGROOTSCANNER_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+#include "omrExampleVM.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "MarkingScheme.hpp"
+#include "ParallelRootScanner.hpp"
+
+class MM_MarkingRootScanner : public MM_ParallelRootScanner
+{
+	/*
+	 * Member data and types
+	 */
+private:
+	MM_MarkingScheme *_markingScheme;
+
+protected:
+public:
+
+	/*
+	 * Member functions
+	 */
+private:
+protected:
+	virtual void
+	doThread(MM_EnvironmentBase *env, OMR_VMThread *walkThread)
+	{
+		if (NULL != walkThread->_savedObject1) {
+			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject1);
+		}
+		if (NULL != walkThread->_savedObject2) {
+			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject2);
+		}
+	}
+
+	virtual void
+	doHashTableEntry(MM_EnvironmentBase *env, RootScannerEntity entity, void *entry)
+	{
+		_markingScheme->markObject(env, ((RootEntry *)entry)->rootPtr);
+	}
+
+public:
+	MM_MarkingRootScanner(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+		: MM_ParallelRootScanner(env)
+		, _markingScheme(markingScheme)
+	{
+		_typeId = __FUNCTION__;
+	};
+
+	void
+	scanRoots(MM_EnvironmentBase *env)
+	{
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		scanHashTable(env, omrVM->rootTable, RootScannerEntity_JNIGlobalReferences);
+		scanThreads(env);
+	}
+};
+
+#endif /* MARKINGROOTSCANNER_HPP_ */
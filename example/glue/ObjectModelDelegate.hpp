@@ -183,12 +183,13 @@ public:
 	}
 
 	/**
-	 * The following methods (defined(OMR_GC_MODRON_SCAVENGER)) are required if generational GC is
- 	 * configured for the build (--enable-OMR_GC_MODRON_SCAVENGER in configure_includes/configure_*.mk).
+	 * The following methods (defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)) are required if
+ 	 * generational or balanced GC is configured for the build (--enable-OMR_GC_MODRON_SCAVENGER or
+ 	 * --enable-OMR_GC_VLHGC in configure_includes/configure_*.mk).
  	 * They typically involve a MM_ForwardedHeader object, and allow information about the forwarded
  	 * object to be obtained.
 	 */
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	/**
 	 * Returns TRUE if the object referred to by the forwarded header is indexable.
 	 *
@@ -242,7 +243,7 @@ public:
 	 * @param[out] hotFieldAlignmentDescriptor pointer to hot field alignment descriptor for class (or NULL)
 	 */
 	void calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *objectReserveSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor);
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
 	 * Constructor receives a copy of OMR's object flags mask, normalized to low order byte.
@@ -27,15 +27,15 @@
 #include "omrExampleVM.hpp"
 #include "omrhashtable.h"
 
-#include "Base.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
+#include "ParallelRootScanner.hpp"
 #include "Scavenger.hpp"
 #include "SublistFragment.hpp"
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
-class MM_ScavengerRootScanner : public MM_Base
+class MM_ScavengerRootScanner : public MM_ParallelRootScanner
 {
 	/*
 	 * Member data and types
@@ -51,18 +51,43 @@ public:
 	 */
 private:
 protected:
+	virtual void
+	doThread(MM_EnvironmentBase *env, OMR_VMThread *walkThread)
+	{
+		MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
+		if (NULL != walkThread->_savedObject1) {
+			_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
+		}
+		if (NULL != walkThread->_savedObject2) {
+			_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
+		}
+	}
+
+	virtual void
+	doHashTableEntry(MM_EnvironmentBase *env, RootScannerEntity entity, void *entry)
+	{
+		RootEntry *rootEntry = (RootEntry *)entry;
+		if (NULL != rootEntry->rootPtr) {
+			_scavenger->copyObjectSlot(MM_EnvironmentStandard::getEnvironment(env), (volatile omrobjectptr_t *) &rootEntry->rootPtr);
+		}
+	}
+
 public:
 	MM_ScavengerRootScanner(MM_EnvironmentBase *env, MM_Scavenger *scavenger)
-		: MM_Base()
+		: MM_ParallelRootScanner(env)
 		, _scavenger(scavenger)
 	{
+		_typeId = __FUNCTION__;
 	};
 
 	void
 	scavengeRememberedSet(MM_EnvironmentStandard *env)
 	{
 		MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		/* remembered set puddles are already shared between the threads by the scavenger */
+		reportScanningStarted(env, RootScannerEntity_ScavengeRememberedSet);
 		_scavenger->scavengeRememberedSet(env);
+		reportScanningEnded(env);
 	}
 
 	void
@@ -75,30 +100,8 @@ public:
 	scanRoots(MM_EnvironmentBase *env)
 	{
 		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
-		if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
-			J9HashTableState state;
-			MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
-			if (NULL != omrVM->rootTable) {
-				RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
-				while (NULL != rootEntry) {
-					if (NULL != rootEntry->rootPtr) {
-						_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &rootEntry->rootPtr);
-					}
-					rootEntry = (RootEntry *)hashTableNextDo(&state);
-				}
-			}
-			OMR_VMThread *walkThread;
-			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-			while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
-				if (NULL != walkThread->_savedObject1) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
-				}
-				if (NULL != walkThread->_savedObject2) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
-				}
-			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
-		}
+		scanHashTable(env, omrVM->rootTable, RootScannerEntity_JNIGlobalReferences);
+		scanThreads(env);
 	}
 
 	void rescanThreadSlots(MM_EnvironmentStandard *env) { }
@@ -124,8 +127,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
@@ -27,6 +27,9 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 #include "ConfigurationSegregated.hpp"
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+#include "ConfigurationBalanced.hpp"
+#endif /* defined(OMR_GC_VLHGC) */
 #include "ConfigurationFlat.hpp"
 #include "MarkingScheme.hpp"
 #include "VerboseManagerImpl.hpp"
@@ -37,6 +40,10 @@
 #define OMR_SEGREGATEDHEAP "-Xgcpolicy:segregated"
 #define OMR_SEGREGATEDHEAP_LENGTH 21
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+#define OMR_BALANCED "-Xgcpolicy:balanced"
+#define OMR_BALANCED_LENGTH 19
+#endif /* defined(OMR_GC_VLHGC) */
 
 bool
 MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *option)
@@ -53,6 +60,12 @@ MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *optio
 			result = true;
 		}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+		if (0 == strncmp(option, OMR_BALANCED, OMR_BALANCED_LENGTH)) {
+			_useBalancedGC = true;
+			result = true;
+		}
+#endif /* defined(OMR_GC_VLHGC) */
 	}
 
 	return result;
@@ -88,6 +101,11 @@ MM_StartupManagerImpl::createConfiguration(MM_EnvironmentBase *env)
 		return MM_ConfigurationSegregated::newInstance(env);
 	} else
 #endif /* OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_VLHGC)
+	if (_useBalancedGC) {
+		return MM_ConfigurationBalanced::newInstance(env);
+	} else
+#endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (ext->scavengerEnabled) {
 		return MM_ConfigurationGenerational::newInstance(env);
@@ -41,6 +41,9 @@ protected:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	bool _useSegregatedGC;
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+	bool _useBalancedGC;
+#endif /* defined(OMR_GC_VLHGC) */
 public:
 	static const uintptr_t defaultMinimumHeapSize = (uintptr_t) 1*1024*1024;
 	static const uintptr_t defaultMaximumHeapSize = (uintptr_t) 2*1024*1024;
@@ -65,6 +68,9 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, _useSegregatedGC(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+		, _useBalancedGC(false)
+#endif /* defined(OMR_GC_VLHGC) */
 	{
 	}
 };
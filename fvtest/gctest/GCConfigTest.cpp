@@ -19,14 +19,22 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AllocationSamplingStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "MemoryPoolSplitAddressOrderedList.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
 #include "SlotObject.hpp"
+#include "StandardReadBarrier.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
 
@@ -43,21 +51,82 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_asyncverbose_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_markprefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_splitfreelist_threads_config.xml"
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+                        , "fvtest/gctest/configuration/global_GC_allocsampling_config.xml"
+#endif
+                        , "fvtest/gctest/configuration/global_GC_releasefreepages_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_partialcompact_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_compactsliding_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_sizeclass_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_splitfreelist_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_hugepages_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_heapwalk_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_tenurecopycost_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_tenurefixed_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rootscan_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptivethreads_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptivethreads_target_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_splitfreelist_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_generational_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_lazysweep_config.xml"
+#endif
+#if defined(OMR_GC_VLHGC)
+                        , "fvtest/gctest/configuration/balanced_GC_config.xml"
+                        , "fvtest/gctest/configuration/balanced_GC_rememberedset_config.xml"
 #endif
                         };
 
+const char *benchmarkTests[] = {"perftest/gctest/configuration/benchmark_optavgpause_deepList_config.xml"
+								, "perftest/gctest/configuration/benchmark_optavgpause_wideTree_config.xml"
+								, "perftest/gctest/configuration/benchmark_optavgpause_largeArray_config.xml"
+								, "perftest/gctest/configuration/benchmark_optavgpause_mutation_config.xml"
+								, "perftest/gctest/configuration/benchmark_optavgpause_wideTree_markPrefetch_config.xml"
+								, "perftest/gctest/configuration/benchmark_optavgpause_mutation_markPrefetch_config.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/benchmark_gencon_deepList_config.xml"
+								, "perftest/gctest/configuration/benchmark_gencon_wideTree_config.xml"
+								, "perftest/gctest/configuration/benchmark_gencon_largeArray_config.xml"
+								, "perftest/gctest/configuration/benchmark_gencon_mutation_config.xml"
+								, "perftest/gctest/configuration/benchmark_gencon_readBarrier_config.xml"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/benchmark_segregated_deepList_config.xml"
+								, "perftest/gctest/configuration/benchmark_segregated_wideTree_config.xml"
+								, "perftest/gctest/configuration/benchmark_segregated_largeArray_config.xml"
+								, "perftest/gctest/configuration/benchmark_segregated_mutation_config.xml"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+								};
+
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/scavenger_breadthFirst_baseline_GC_config.xml"
+								, "perftest/gctest/configuration/scavenger_breadthFirst_prefetch_GC_config.xml"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -953,6 +1022,436 @@ done:
 	return rt;
 }
 
+/**
+ * Object count and address sum of a heap walk, used to check that two walks reported the same objects.
+ */
+struct HeapWalkSummary {
+	volatile uintptr_t objectCount;
+	volatile uintptr_t addressSum;
+};
+
+static void
+heapWalkSummarizeObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkSummary *summary = (HeapWalkSummary *)userData;
+	summary->objectCount += 1;
+	summary->addressSum += (uintptr_t)object;
+}
+
+static void
+heapWalkSummarizeBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t count, void *userData)
+{
+	HeapWalkSummary *summary = (HeapWalkSummary *)userData;
+	uintptr_t addressSum = 0;
+	for (uintptr_t i = 0; i < count; i++) {
+		addressSum += (uintptr_t)objects[i];
+	}
+	MM_AtomicOperations::add(&summary->objectCount, count);
+	MM_AtomicOperations::add(&summary->addressSum, addressSum);
+}
+
+int32_t
+GCConfigTest::verifyHeapWalk(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	MM_ParallelHeapWalker *heapWalker = globalCollector->getParallelHeapWalker();
+	MM_ParallelHeapWalkState *state = NULL;
+	MM_ParallelHeapWalker::WalkResult result = MM_ParallelHeapWalker::walkIncomplete;
+	HeapWalkSummary serialSummary = {0, 0};
+	HeapWalkSummary batchedSummary = {0, 0};
+	HeapWalkSummary incrementalSummary = {0, 0};
+
+	const char *incrementBudgetStr = node.attribute("incrementBudget").value();
+	if (0 == strcmp(incrementBudgetStr, "")) {
+		/* incrementBudget (in microseconds) defaults to 100 */
+		incrementBudgetStr = "100";
+	}
+	uint64_t incrementBudget = (uint64_t)atoi(incrementBudgetStr);
+
+	heapWalker->allObjectsDo(env, heapWalkSummarizeObject, &serialSummary, 0, false, false);
+
+	if (!heapWalker->allObjectsDoBatched(env, heapWalkSummarizeBatch, &batchedSummary, 0, true)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to start batched heap walk.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	state = heapWalker->startIncrementalWalk(env, heapWalkSummarizeBatch, &incrementalSummary, 0, true);
+	if (NULL == state) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to start incremental heap walk.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	do {
+		/* every increment must walk at least one chunk, however small the budget */
+		uintptr_t chunksClaimed = state->getChunksClaimed();
+		result = heapWalker->walkIncrement(env, state, incrementBudget);
+		if ((MM_ParallelHeapWalker::walkInvalidated != result) && (state->getChunksClaimed() <= chunksClaimed) && (chunksClaimed < state->getChunkCount())) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk increment %zu made no progress (%zu of %zu chunks walked).\n", __FILE__, __LINE__, state->getIncrementCount(), chunksClaimed, state->getChunkCount());
+			state->kill(env);
+			goto done;
+		}
+	} while (MM_ParallelHeapWalker::walkIncomplete == result);
+	gcTestEnv->log("Incremental heap walk of %zu chunks took %zu increments of %llu us.\n", state->getChunkCount(), state->getIncrementCount(), incrementBudget);
+	state->kill(env);
+	if (MM_ParallelHeapWalker::walkComplete != result) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Incremental heap walk was invalidated.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	gcTestEnv->log("Heap walk found %zu objects (batched %zu, incremental %zu).\n", serialSummary.objectCount, batchedSummary.objectCount, incrementalSummary.objectCount);
+	if ((serialSummary.objectCount != batchedSummary.objectCount) || (serialSummary.addressSum != batchedSummary.addressSum)
+		|| (serialSummary.objectCount != incrementalSummary.objectCount) || (serialSummary.addressSum != incrementalSummary.addressSum)
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walks do not match the serial heap walk.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+/**
+ * State shared by the threads of a threadedAllocation operation.
+ */
+struct ThreadedAllocation {
+	OMR_VM *omrVM;
+	uintptr_t objectCount; /**< objects each thread allocates */
+	uintptr_t objectSize;
+	omrthread_monitor_t monitor;
+	uintptr_t threadsRunning;
+	uintptr_t threadsAllocating; /**< threads which have not finished allocating yet */
+	uintptr_t objectsAllocated;
+};
+
+static int J9THREAD_PROC
+threadedAllocationMain(void *arg)
+{
+	ThreadedAllocation *allocation = (ThreadedAllocation *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+	uintptr_t objectsAllocated = 0;
+
+	if (OMR_ERROR_NONE == OMR_Thread_Init(allocation->omrVM, NULL, &omrVMThread, "GCConfigTest allocation thread")) {
+		MM_EnvironmentBase *threadEnv = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		for (uintptr_t i = 0; i < allocation->objectCount; i++) {
+			/* the example VM cannot stop these threads for a collection, so they allocate without ever collecting */
+			uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+			MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+					MM_ObjectAllocationModel(threadEnv, allocation->objectSize, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			if (NULL == OMR_GC_AllocateObject(omrVMThread, noGc)) {
+				break;
+			}
+			objectsAllocated += 1;
+		}
+	}
+
+	/* environment ids are reused once a thread detaches, so stay attached until every thread has allocated */
+	omrthread_monitor_enter(allocation->monitor);
+	allocation->objectsAllocated += objectsAllocated;
+	allocation->threadsAllocating -= 1;
+	omrthread_monitor_notify_all(allocation->monitor);
+	while (0 != allocation->threadsAllocating) {
+		omrthread_monitor_wait(allocation->monitor);
+	}
+	omrthread_monitor_exit(allocation->monitor);
+
+	if (NULL != omrVMThread) {
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(allocation->monitor);
+	allocation->threadsRunning -= 1;
+	omrthread_monitor_notify_all(allocation->monitor);
+	omrthread_monitor_exit(allocation->monitor);
+	return 0;
+}
+
+int32_t
+GCConfigTest::performThreadedAllocation(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	uintptr_t threadCount = (uintptr_t)node.attribute("threads").as_int(1);
+	int32_t numOfFields = node.attribute(xs.numOfFields).as_int(1);
+	ThreadedAllocation allocation;
+	allocation.omrVM = exampleVM->_omrVM;
+	allocation.objectCount = (uintptr_t)node.attribute("objects").as_int(1);
+	allocation.objectSize = numOfFields * sizeof(fomrobject_t) + sizeof(uintptr_t);
+	allocation.monitor = NULL;
+	allocation.threadsRunning = 0;
+	allocation.threadsAllocating = threadCount;
+	allocation.objectsAllocated = 0;
+
+	if (0 != omrthread_monitor_init_with_name(&allocation.monitor, 0, "GCConfigTest::threadedAllocation")) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create the allocation thread monitor.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	/* all threads allocate garbage at the same time, each from its own environment */
+	omrthread_monitor_enter(allocation.monitor);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, threadedAllocationMain, &allocation)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to start allocation thread %zu.\n", __FILE__, __LINE__, i);
+			/* release the threads already started */
+			allocation.threadsAllocating -= (threadCount - i);
+			omrthread_monitor_notify_all(allocation.monitor);
+			break;
+		}
+		allocation.threadsRunning += 1;
+	}
+	while (0 != allocation.threadsRunning) {
+		omrthread_monitor_wait(allocation.monitor);
+	}
+	omrthread_monitor_exit(allocation.monitor);
+	omrthread_monitor_destroy(allocation.monitor);
+	OMRGCTEST_CHECK_RT(rt);
+
+	gcTestEnv->log("%zu threads allocated %zu objects of %zu bytes.\n", threadCount, allocation.objectsAllocated, allocation.objectSize);
+	if (allocation.objectsAllocated != (threadCount * allocation.objectCount)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation threads ran out of memory after %zu of %zu objects.\n", __FILE__, __LINE__, allocation.objectsAllocated, threadCount * allocation.objectCount);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifySplitFreeList(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemorySubSpace *tenureSubSpace = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+	MM_MemoryPool *memoryPool = tenureSubSpace->getMemoryPool(extensions->heap->getHeapBase());
+	uintptr_t expectedLists = (uintptr_t)node.attribute("lists").as_int(1);
+	uintptr_t lists = 0;
+
+	if ((NULL == memoryPool) || (0 != strcmp(memoryPool->getBaseVirtualTypeId(), "MM_MemoryPoolSplitAddressOrderedList"))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The tenure memory pool does not use split free lists.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	lists = ((MM_MemoryPoolSplitAddressOrderedList *)memoryPool)->getFreeListCount();
+	gcTestEnv->log("Free memory is split across %zu lists.\n", lists);
+	if (expectedLists != lists) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Free memory is split across %zu lists, expected %zu.\n", __FILE__, __LINE__, lists, expectedLists);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyMarkedReferents(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Collector *globalCollector = extensions->getGlobalCollector();
+	const char *targetStr = node.attribute("target").value();
+	char targetName[MAX_NAME_LENGTH];
+	ObjectEntry *targetEntry = NULL;
+	uintptr_t referentCount = 0;
+	uintptr_t targetSize = 0;
+	fomrobject_t *firstSlot = NULL;
+	fomrobject_t *endSlot = NULL;
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	omrstr_printf(targetName, MAX_NAME_LENGTH, "%s_%d_%d", targetStr, 0, 0);
+	targetEntry = find(targetName);
+	if (NULL == targetEntry) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find target %s in hash table.\n", __FILE__, __LINE__, targetName);
+		goto done;
+	}
+
+	/* the slots past the children of the target hold the objects stored by a mutation (see performMutation()) */
+	targetSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(targetEntry->objPtr);
+	firstSlot = (fomrobject_t *)targetEntry->objPtr + 1 + targetEntry->numOfRef;
+	endSlot = (fomrobject_t *)((uint8_t *)targetEntry->objPtr + targetSize);
+	for (fomrobject_t *slot = firstSlot; slot < endSlot; slot++) {
+		GC_SlotObject slotObject(exampleVM->_omrVM, slot);
+		omrobjectptr_t referent = slotObject.readReferenceFromSlot();
+		if (NULL != referent) {
+			referentCount += 1;
+			if (!globalCollector->isMarked(referent)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p referenced from %s was not marked by the last collection.\n", __FILE__, __LINE__, referent, targetName);
+				goto done;
+			}
+		}
+	}
+	gcTestEnv->log("All %zu objects referenced from the free slots of %s are marked.\n", referentCount, targetName);
+	if (0 == referentCount) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No object is referenced from the free slots of %s.\n", __FILE__, __LINE__, targetName);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyLiveReferents(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	const char *targetStr = node.attribute("target").value();
+	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
+	int32_t rate = node.attribute("rate").as_int(1);
+	char targetName[MAX_NAME_LENGTH];
+	char referentPrefix[MAX_NAME_LENGTH];
+	uintptr_t referentPrefixLength = 0;
+	ObjectEntry *targetEntry = NULL;
+	uintptr_t referentCount = 0;
+	uintptr_t targetSize = 0;
+	fomrobject_t *firstSlot = NULL;
+	fomrobject_t *endSlot = NULL;
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+	if ((0 == strcmp(namePrefixStr, "")) || (0 == strcmp(targetStr, "")) || (0 >= rate)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify target, namePrefix and rate of the mutation for liveReferents.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	omrstr_printf(targetName, MAX_NAME_LENGTH, "%s_%d_%d", targetStr, 0, 0);
+	targetEntry = find(targetName);
+	if (NULL == targetEntry) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find target %s in hash table.\n", __FILE__, __LINE__, targetName);
+		goto done;
+	}
+	referentPrefixLength = omrstr_printf(referentPrefix, MAX_NAME_LENGTH, "%s_", namePrefixStr);
+
+	/* the object table only holds its objects weakly: a collection which lost a reference from the target (such as a
+	 * remembered set entry) frees the referent and drops its entry, leaving the slot of the target dangling. As the freed
+	 * memory is soon reused by objects of the same size, the referent of each slot must also be the object the mutation
+	 * stored there last: the n-th store of the mutation (named <namePrefix>_<n / rate>_<n % rate>) went to slot n modulo
+	 * the free slot count (see performMutation()).
+	 */
+	targetSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(targetEntry->objPtr);
+	firstSlot = (fomrobject_t *)targetEntry->objPtr + 1 + targetEntry->numOfRef;
+	endSlot = (fomrobject_t *)((uint8_t *)targetEntry->objPtr + targetSize);
+	for (fomrobject_t *slot = firstSlot; slot < endSlot; slot++) {
+		GC_SlotObject slotObject(exampleVM->_omrVM, slot);
+		omrobjectptr_t referent = slotObject.readReferenceFromSlot();
+		if (NULL != referent) {
+			ObjectEntry *referentEntry = NULL;
+			J9HashTableState state;
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+			while ((NULL == referentEntry) && (NULL != objectEntry)) {
+				if (referent == objectEntry->objPtr) {
+					referentEntry = objectEntry;
+				}
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+			if (NULL == referentEntry) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p referenced from %s is not a live object of the object table.\n", __FILE__, __LINE__, referent, targetName);
+				goto done;
+			}
+			int32_t iteration = -1;
+			int32_t nthInIteration = -1;
+			bool stored = (0 == strncmp(referentEntry->name, referentPrefix, referentPrefixLength))
+				&& (2 == sscanf(referentEntry->name + referentPrefixLength, "%d_%d", &iteration, &nthInIteration));
+			if (stored) {
+				uintptr_t store = ((uintptr_t)iteration * (uintptr_t)rate) + (uintptr_t)nthInIteration;
+				stored = ((uintptr_t)(slot - firstSlot) == (store % (uintptr_t)(endSlot - firstSlot)));
+			}
+			if (!stored) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %s at %p referenced from slot %zu of %s was not stored there: its referent was lost.\n", __FILE__, __LINE__, referentEntry->name, referent, (uintptr_t)(slot - firstSlot), targetName);
+				goto done;
+			}
+			referentCount += 1;
+		}
+	}
+	gcTestEnv->log("All %zu objects referenced from the free slots of %s are live.\n", referentCount, targetName);
+	if (0 == referentCount) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No object is referenced from the free slots of %s.\n", __FILE__, __LINE__, targetName);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyAllocationSampling(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	void *sites[16];
+	uintptr_t sampledBytes[16];
+	uintptr_t siteCount = OMR_GC_GetAllocationSamplingSites(exampleVM->_omrVMThread, sites, sampledBytes, 16);
+
+	gcTestEnv->log("Allocation sampling ranked %zu sites.\n", siteCount);
+	if (0 == siteCount) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No allocation site was sampled.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	for (uintptr_t i = 0; i < siteCount; i++) {
+		gcTestEnv->log("  site %p: %zu bytes\n", sites[i], sampledBytes[i]);
+		if ((0 == sampledBytes[i]) || ((0 < i) && (sampledBytes[i] > sampledBytes[i - 1]))) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sites are not ranked by sampled bytes.\n", __FILE__, __LINE__);
+			goto done;
+		}
+	}
+
+	/* the objects of the hot site make up most of the allocated bytes, so they must rank first */
+	if (!node.attribute(xs.numOfFields).empty()) {
+		uintptr_t size = node.attribute(xs.numOfFields).as_int(1) * sizeof(fomrobject_t) + sizeof(uintptr_t);
+		void *hotSite = env->getAllocationSite(size);
+		if (hotSite != sites[0]) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation site %p of the objects of %zu bytes is not ranked first.\n", __FILE__, __LINE__, hotSite, size);
+			goto done;
+		}
+	}
+
+	{
+		/* the sampler records at most one sample per TLH refill or allocation made outside a TLH, and no more than
+		 * the intervals drawn in the allocated bytes: twice the mean number of intervals bounds the sampling overhead
+		 */
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		MM_AllocationSamplingStats *samplingStats = extensions->allocationSamplingStats;
+		uintptr_t maxSampleCount = ((2 * samplingStats->_allocatedBytes) / extensions->allocationSamplingInterval) + 1;
+		gcTestEnv->log("Allocation sampling recorded %zu samples standing for %zu of %zu allocated bytes in %llu us.\n",
+				samplingStats->_sampleCount, samplingStats->_sampledBytes, samplingStats->_allocatedBytes,
+				omrtime_hires_delta(0, samplingStats->_sampleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+		if (samplingStats->_sampleCount > maxSampleCount) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sampling recorded %zu samples, more than %zu for %zu allocated bytes.\n",
+					__FILE__, __LINE__, samplingStats->_sampleCount, maxSampleCount, samplingStats->_allocatedBytes);
+			goto done;
+		}
+		/* the samples stand for the allocated bytes: a biased sampler would be off by much more than 2x */
+		if ((samplingStats->_sampledBytes < (samplingStats->_allocatedBytes / 2)) || (samplingStats->_sampledBytes > (samplingStats->_allocatedBytes * 2))) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation samples stand for %zu bytes, %zu bytes were allocated.\n",
+					__FILE__, __LINE__, samplingStats->_sampledBytes, samplingStats->_allocatedBytes);
+			goto done;
+		}
+	}
+
+done:
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -965,16 +1464,220 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 				gcCodeStr = "0";
 			}
 			uint32_t gcCode = (uint32_t)atoi(gcCodeStr);
-			gcTestEnv->log("Invoking gc system collect with gcCode %d...\n", gcCode);
-			rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, gcCode);
-			if (OMR_ERROR_NONE != rt) {
-				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
-				goto done;
+			/* repeat (number of collections) defaults to 1 */
+			int32_t repeat = node.attribute("repeat").as_int(1);
+			for (int32_t i = 0; i < repeat; i++) {
+				gcTestEnv->log("Invoking gc system collect with gcCode %d...\n", gcCode);
+				rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, gcCode);
+				if (OMR_ERROR_NONE != rt) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+					goto done;
+				}
+				OMRGCTEST_CHECK_RT(rt);
+				verboseManager->getWriterChain()->endOfCycle(env);
 			}
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			gcTestEnv->log("Verifying parallel heap walks...\n");
+			rt = verifyHeapWalk(node);
 			OMRGCTEST_CHECK_RT(rt);
-			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "threadedAllocation")) {
+			gcTestEnv->log("Allocating from several threads...\n");
+			rt = performThreadedAllocation(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "splitFreeList")) {
+			gcTestEnv->log("Verifying the free list split...\n");
+			rt = verifySplitFreeList(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "markedReferents")) {
+			gcTestEnv->log("Verifying the referents of the mutation target are marked...\n");
+			rt = verifyMarkedReferents(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "liveReferents")) {
+			gcTestEnv->log("Verifying the referents of the mutation target are live...\n");
+			rt = verifyLiveReferents(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationSampling")) {
+			gcTestEnv->log("Verifying allocation sampling...\n");
+			rt = verifyAllocationSampling(node);
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::performMutation(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 1;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
+	const char *targetStr = node.attribute("target").value();
+	int32_t iterations = node.attribute("iterations").as_int(1);
+	int32_t rate = node.attribute("rate").as_int(1);
+	int32_t numOfFields = node.attribute(xs.numOfFields).as_int(1);
+	uintptr_t size = numOfFields * sizeof(fomrobject_t) + sizeof(uintptr_t);
+	uintptr_t nextSlot = 0;
+	char targetName[MAX_NAME_LENGTH];
+	ObjectEntry *targetEntry = NULL;
+
+	if ((0 == strcmp(namePrefixStr, "")) || (0 == strcmp(targetStr, ""))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify namePrefix and target for mutation.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	/* new objects are stored in the free slots of the first object of the target (the slots holding its children are left alone) */
+	omrstr_printf(targetName, MAX_NAME_LENGTH, "%s_%d_%d", targetStr, 0, 0);
+	targetEntry = find(targetName);
+	if (NULL == targetEntry) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find mutation target %s in hash table.\n", __FILE__, __LINE__, targetName);
+		goto done;
+	}
+
+	gcTestEnv->log("Mutating %s: %d iterations of %d reference stores...\n", targetName, iterations, rate);
+	for (int32_t i = 0; i < iterations; i++) {
+		for (int32_t j = 0; j < rate; j++) {
+			ObjectEntry *childEntry = createObject(namePrefixStr, GARBAGE_TOP, i, j, size);
+			if (NULL == childEntry) {
+				goto done;
+			}
+			/* the allocation may have collected and moved the target */
+			targetEntry = find(targetName);
+			if (NULL == targetEntry) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find mutation target %s in hash table.\n", __FILE__, __LINE__, targetName);
+				goto done;
+			}
+			uintptr_t targetSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(targetEntry->objPtr);
+			fomrobject_t *firstSlot = (fomrobject_t *)targetEntry->objPtr + 1 + targetEntry->numOfRef;
+			fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)targetEntry->objPtr + targetSize);
+			if (firstSlot >= endSlot) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: mutation target %s has no free slots.\n", __FILE__, __LINE__, targetName);
+				goto done;
+			}
+			/* overwriting a slot turns its previous referent into garbage */
+			fomrobject_t *slot = firstSlot + (nextSlot % (endSlot - firstSlot));
+			standardWriteBarrierStore(exampleVM->_omrVMThread, targetEntry->objPtr, slot, childEntry->objPtr);
+			nextSlot += 1;
+		}
+	}
+	rt = 0;
+
+done:
+	return rt;
+}
+
+/* read barrier timing buckets */
+enum {
+	READ_BARRIER_BASELINE = 0, /* plain loads */
+	READ_BARRIER_IDLE, /* barriered loads while no concurrent scavenge is in progress */
+	READ_BARRIER_CONCURRENT, /* barriered loads while a concurrent scavenge is in progress */
+	READ_BARRIER_BUCKETS
+};
+
+static double
+readBarrierNanosPerSlot(OMRPortLibrary *portLib, uint64_t ticks, uint64_t slots)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	return (0 == slots) ? 0.0 : ((double)ticks * 1000000000.0) / ((double)omrtime_hires_frequency() * (double)slots);
+}
+
+int32_t
+GCConfigTest::performReadBarrier(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 1;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = exampleVM->_omrVMThread;
+	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
+	const char *targetStr = node.attribute("target").value();
+	const char *modeStr = node.attribute("mode").value();
+	int32_t iterations = node.attribute("iterations").as_int(1);
+	int32_t rate = node.attribute("rate").as_int(1);
+	int32_t numOfFields = node.attribute(xs.numOfFields).as_int(1);
+	uintptr_t size = numOfFields * sizeof(fomrobject_t) + sizeof(uintptr_t);
+	bool batch = (0 == strcmp(modeStr, "batch"));
+	uint64_t ticks[READ_BARRIER_BUCKETS] = {0, 0, 0};
+	uint64_t slots[READ_BARRIER_BUCKETS] = {0, 0, 0};
+	uintptr_t checksum = 0;
+	char targetName[MAX_NAME_LENGTH];
+	ObjectEntry *targetEntry = NULL;
+
+	if ((0 == strcmp(namePrefixStr, "")) || (0 == strcmp(targetStr, ""))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify namePrefix and target for readBarrier.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if (!batch && (0 != strcmp(modeStr, "slot")) && (0 != strcmp(modeStr, ""))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: unrecognized readBarrier mode (expected slot or batch): %s\n", __FILE__, __LINE__, modeStr);
+		goto done;
+	}
+
+	/* the slots of the first object of the target are loaded through the barrier, interleaved with allocations driving scavenges */
+	omrstr_printf(targetName, MAX_NAME_LENGTH, "%s_%d_%d", targetStr, 0, 0);
+	gcTestEnv->log("Reading %s (%s barrier): %d iterations, %d allocations per iteration...\n", targetName, batch ? "batch" : "slot", iterations, rate);
+	for (int32_t i = 0; i < iterations; i++) {
+		for (int32_t j = 0; j < rate; j++) {
+			if (NULL == createObject(namePrefixStr, GARBAGE_TOP, i, j, size)) {
+				goto done;
+			}
 		}
+		/* the allocations may have collected and moved the target */
+		targetEntry = find(targetName);
+		if (NULL == targetEntry) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find readBarrier target %s in hash table.\n", __FILE__, __LINE__, targetName);
+			goto done;
+		}
+		uintptr_t targetSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(targetEntry->objPtr);
+		fomrobject_t *firstSlot = (fomrobject_t *)targetEntry->objPtr + 1;
+		fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)targetEntry->objPtr + targetSize);
+		uintptr_t slotCount = endSlot - firstSlot;
+
+		uint64_t startTicks = omrtime_hires_clock();
+		for (fomrobject_t *slot = firstSlot; slot < endSlot; slot++) {
+			GC_SlotObject slotObject(exampleVM->_omrVM, slot);
+			checksum += (uintptr_t)slotObject.readReferenceFromSlot();
+		}
+		ticks[READ_BARRIER_BASELINE] += omrtime_hires_clock() - startTicks;
+		slots[READ_BARRIER_BASELINE] += slotCount;
+
+		/* a concurrent scavenge may complete during the pass, in which case the pass is charged to the concurrent bucket */
+		uintptr_t bucket = extensions->isConcurrentScavengerInProgress() ? READ_BARRIER_CONCURRENT : READ_BARRIER_IDLE;
+		startTicks = omrtime_hires_clock();
+		if (batch) {
+			standardReadBarrierBatch(omrVMThread, firstSlot, slotCount);
+			for (fomrobject_t *slot = firstSlot; slot < endSlot; slot++) {
+				GC_SlotObject slotObject(exampleVM->_omrVM, slot);
+				checksum += (uintptr_t)slotObject.readReferenceFromSlot();
+			}
+		} else {
+			for (fomrobject_t *slot = firstSlot; slot < endSlot; slot++) {
+				checksum += (uintptr_t)standardReadBarrierLoad(omrVMThread, slot);
+			}
+		}
+		ticks[bucket] += omrtime_hires_clock() - startTicks;
+		slots[bucket] += slotCount;
 	}
+
+	{
+		double baseline = readBarrierNanosPerSlot(gcTestEnv->portLib, ticks[READ_BARRIER_BASELINE], slots[READ_BARRIER_BASELINE]);
+		double idle = readBarrierNanosPerSlot(gcTestEnv->portLib, ticks[READ_BARRIER_IDLE], slots[READ_BARRIER_IDLE]);
+		double concurrent = readBarrierNanosPerSlot(gcTestEnv->portLib, ticks[READ_BARRIER_CONCURRENT], slots[READ_BARRIER_CONCURRENT]);
+		gcTestEnv->log("Unbarriered loads: %llu slots, %.2f ns/slot\n", slots[READ_BARRIER_BASELINE], baseline);
+		gcTestEnv->log("Barriered loads outside of concurrent scavenge: %llu slots, %.2f ns/slot (slowdown %.2fx)\n",
+				slots[READ_BARRIER_IDLE], idle, (0.0 == baseline) ? 0.0 : idle / baseline);
+		if (!extensions->isConcurrentScavengerEnabled()) {
+			gcTestEnv->log("Barriered loads during concurrent scavenge: N/A (concurrent scavenge is not enabled)\n");
+		} else if (0 == slots[READ_BARRIER_CONCURRENT]) {
+			gcTestEnv->log("Barriered loads during concurrent scavenge: N/A (no pass ran during a concurrent scavenge)\n");
+		} else {
+			gcTestEnv->log("Barriered loads during concurrent scavenge: %llu slots, %.2f ns/slot (slowdown %.2fx)\n",
+					slots[READ_BARRIER_CONCURRENT], concurrent, (0.0 == baseline) ? 0.0 : concurrent / baseline);
+		}
+		/* keeps the loads live */
+		gcTestEnv->log(LEVEL_VERBOSE, "Read barrier checksum 0x%llx\n", (uint64_t)checksum);
+	}
+	rt = 0;
+
 done:
 	return rt;
 }
@@ -1044,6 +1747,8 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			/* asynchronous writers may still hold output */
+			verboseManager->getWriterChain()->waitForPendingOutput(env);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
@@ -1052,7 +1757,17 @@ TEST_P(GCConfigTest, test)
 			rt = triggerOperation(configChild.first_child());
 			ASSERT_EQ(0, rt) << "Failed to perform gc operation.";
 		} else if (0 == strcmp(configChild.name(), "mutation")) {
-			/*TODO*/
+			gcTestEnv->log("\n++++++++++++++++++++++++++++Mutation++++++++++++++++++++++++++++\n");
+			int64_t startTime = omrtime_current_time_millis();
+			rt = performMutation(configChild);
+			ASSERT_EQ(0, rt) << "Failed to perform mutation.";
+			gcTestEnv->log("Time elapsed in mutation: %lld ms\n", (omrtime_current_time_millis() - startTime));
+		} else if (0 == strcmp(configChild.name(), "readBarrier")) {
+			gcTestEnv->log("\n++++++++++++++++++++++++++Read Barrier++++++++++++++++++++++++++\n");
+			int64_t startTime = omrtime_current_time_millis();
+			rt = performReadBarrier(configChild);
+			ASSERT_EQ(0, rt) << "Failed to perform read barrier benchmark.";
+			gcTestEnv->log("Time elapsed in read barrier: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else {
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
@@ -1064,3 +1779,6 @@ INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
 
 INSTANTIATE_TEST_CASE_P(perfTest,GCConfigTest,
         ::testing::ValuesIn(perfTests));
+
+INSTANTIATE_TEST_CASE_P(perfBenchmark,GCConfigTest,
+        ::testing::ValuesIn(benchmarkTests));
@@ -109,7 +109,15 @@ protected:
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
+	int32_t verifyHeapWalk(pugi::xml_node node);
+	int32_t verifyAllocationSampling(pugi::xml_node node);
+	int32_t verifySplitFreeList(pugi::xml_node node);
+	int32_t verifyMarkedReferents(pugi::xml_node node);
+	int32_t verifyLiveReferents(pugi::xml_node node);
+	int32_t performThreadedAllocation(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t performMutation(pugi::xml_node node);
+	int32_t performReadBarrier(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -82,8 +82,11 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +94,20 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "balanced")) {
+#if defined(OMR_GC_VLHGC)
+						_useBalancedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=balanced ignored, requires OMR_GC_VLHGC (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_VLHGC) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated, balanced or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,12 +116,124 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavenger = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentCardTableSummary")) {
+					extensions->concurrentCardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "hierarchical")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized scavenger scan ordering (expected breadthFirst or hierarchical): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchWindowSize")) {
+					extensions->scavengerPrefetchWindowSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNUMAAware")) {
+					extensions->scavengerNUMAAware = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaGCThreadAffinity")) {
+					extensions->numaGCThreadAffinity = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scvTenureAge")) {
+					/* a fixed tenure threshold replaces the default strategies */
+					extensions->scvTenureFixedTenureAge = atoi(attr.value());
+					extensions->scvTenureStrategyFixed = true;
+					extensions->scvTenureStrategyAdaptive = false;
+					extensions->scvTenureStrategyLookback = false;
+					extensions->scvTenureStrategyHistory = false;
+				} else if (0 == strcmp(attr.name(), "scvTenureStrategyCopyCost")) {
+					extensions->scvTenureStrategyCopyCost = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scvTenureCopyCostPrematureTenureWeight")) {
+					extensions->scvTenureCopyCostPrematureTenureWeight = atof(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedGenerational")) {
+					extensions->segregatedGenerational = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedMinorCollectionsPerMajor")) {
+					extensions->segregatedMinorCollectionsPerMajor = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedLazySweep")) {
+					extensions->segregatedLazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "compactGC")) {
+					/* compact when the collector triggers it (as -Xcompactgc) */
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->nocompactOnSystemGC = 0;
+					}
+				} else if (0 == strcmp(attr.name(), "partialCompactMoveBudget")) {
+					extensions->partialCompactMoveBudget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "compactSlidingWindows")) {
+					extensions->compactSlidingWindows = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_VLHGC)
+				} else if (0 == strcmp(attr.name(), "tarokTargetMaxPauseTime")) {
+					extensions->tarokTargetMaxPauseTime = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tarokEnableDynamicCollectionSetSelection")) {
+					extensions->tarokEnableDynamicCollectionSetSelection = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_VLHGC) */
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workPacketStealing")) {
+					extensions->workPacketStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rootScannerStatsEnabled")) {
+					extensions->rootScannerStatsEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingTargetTime")) {
+					extensions->adaptiveGCThreadingTargetTime = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "allocationSamplingEnabled")) {
+					extensions->allocationSamplingEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "allocationSamplingMaxSites")) {
+					extensions->allocationSamplingMaxSites = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "hugePagePolicy")) {
+					if (!MM_HugePageManager::parsePolicy(attr.value(), &extensions->hugePagePolicy)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized huge page policy (expected off, transparent or explicit): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "hugePageSize")) {
+					extensions->hugePageSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "hugePageUsageSampleInterval")) {
+					extensions->hugePageUsageSampleInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "releaseFreePagesAfterGlobalGC")) {
+					extensions->releaseFreePagesAfterGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "releaseFreePagesGranuleSize")) {
+					extensions->releaseFreePagesGranuleSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "releaseFreePagesMaximumPerGC")) {
+					extensions->releaseFreePagesMaximumPerGC = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "splitFreeListSplitAmount")) {
+					extensions->splitFreeListSplitAmount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "splitFreeListSplitAmountMaximum")) {
+					extensions->splitFreeListSplitAmountMaximum = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "asynchronousLogging")) {
+					extensions->asynchronousLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asynchronousLoggingBufferSize")) {
+					extensions->asynchronousLoggingBufferSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tlhSizeClassCache")) {
+					extensions->tlhSizeClassCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapMapScan.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_HEAP_MAP_SLOTS 256
+
+static uintptr_t *
+referenceFindFirstSlot(uintptr_t *slotBase, uintptr_t *slotTop, bool empty)
+{
+	while ((slotBase < slotTop) && (empty != (0 == *slotBase))) {
+		slotBase += 1;
+	}
+	return slotBase;
+}
+
+/**
+ * Check every kernel the processor supports against a slot by slot search, for all start offsets and
+ * lengths over a map holding a single isolated non-empty (or empty) slot at varying positions.
+ */
+static void
+checkKernel(MM_HeapMapScan::Kernel kernel)
+{
+	uintptr_t map[TEST_HEAP_MAP_SLOTS];
+
+	if (kernel != MM_HeapMapScan::selectKernel(kernel)) {
+		/* not supported by this processor */
+		return;
+	}
+
+	for (uintptr_t pattern = 0; pattern < 2; pattern++) {
+		bool sparse = (0 == pattern);
+		for (uintptr_t position = 0; position <= 96; position += 7) {
+			for (uintptr_t i = 0; i < TEST_HEAP_MAP_SLOTS; i++) {
+				map[i] = sparse ? 0 : (((uintptr_t)1) << (i % (sizeof(uintptr_t) * 8)));
+			}
+			if (position < TEST_HEAP_MAP_SLOTS) {
+				map[position] = sparse ? (((uintptr_t)1) << (position % (sizeof(uintptr_t) * 8))) : 0;
+			}
+			for (uintptr_t base = 0; base < 20; base++) {
+				for (uintptr_t top = base; top <= 120; top++) {
+					ASSERT_EQ(referenceFindFirstSlot(map + base, map + top, false), MM_HeapMapScan::findFirstNonEmptySlot(map + base, map + top))
+						<< "kernel " << kernel << " base " << base << " top " << top << " position " << position;
+					ASSERT_EQ(referenceFindFirstSlot(map + base, map + top, true), MM_HeapMapScan::findFirstEmptySlot(map + base, map + top))
+						<< "kernel " << kernel << " base " << base << " top " << top << " position " << position;
+				}
+			}
+		}
+	}
+}
+
+TEST(TestHeapMapScan, Kernels)
+{
+	MM_HeapMapScan::Kernel selectedKernel = MM_HeapMapScan::getKernel();
+
+	checkKernel(MM_HeapMapScan::kernelScalar);
+	checkKernel(MM_HeapMapScan::kernelSSE42);
+	checkKernel(MM_HeapMapScan::kernelAVX2);
+
+	MM_HeapMapScan::selectKernel(selectedKernel);
+}
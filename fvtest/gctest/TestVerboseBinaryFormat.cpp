@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <stdio.h>
+#include <string>
+
+#include <gtest/gtest.h>
+
+static void
+appendText(void *userData, const char *text, uintptr_t length)
+{
+	((std::string *)userData)->append(text, length);
+}
+
+static uintptr_t
+formatText(void *userData, char *buffer, uintptr_t length, const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t result = omrstr_vprintf(buffer, length, format, args);
+	va_end(args);
+
+	return result;
+}
+
+static uintptr_t
+encode(uint8_t *buffer, uintptr_t capacity, const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t result = MM_VerboseBinaryFormat::encodeArguments(format, args, buffer, capacity);
+	va_end(args);
+
+	return result;
+}
+
+/**
+ * Encode the arguments of a line, decode them again and compare the result with formatting the line directly.
+ */
+static void
+checkRoundTrip(const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	uint8_t encoded[512];
+	char expected[512];
+	std::string decoded;
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t encodedSize = MM_VerboseBinaryFormat::encodeArguments(format, args, encoded, sizeof(encoded));
+	va_end(args);
+	ASSERT_NE(VERBOSE_BINARY_ENCODING_FAILED, encodedSize) << format;
+
+	va_start(args, format);
+	omrstr_vprintf(expected, sizeof(expected), format, args);
+	va_end(args);
+
+	/* records are padded, trailing bytes must be ignored */
+	memset(encoded + encodedSize, 0, 8);
+	ASSERT_TRUE(MM_VerboseBinaryFormat::decodeLine(format, encoded, encodedSize + 8, sizeof(uintptr_t), appendText, formatText, &decoded)) << format;
+	ASSERT_STREQ(expected, decoded.c_str()) << format;
+}
+
+TEST(TestVerboseBinaryFormat, RoundTrip)
+{
+	checkRoundTrip("<gc-start id=\"%zu\" type=\"%s\" contextid=\"%zu\" timestamp=\"%s\">", (size_t)99, "global", (size_t)98, "2026-01-01T00:00:00.000");
+	checkRoundTrip("durationms=\"%llu.%03.3llu\" percent=\"%zu%%\"", (unsigned long long)4, (unsigned long long)7, (size_t)33);
+	checkRoundTrip("lastid=\"%p\" lastname=\"%s\"", (void *)0x1234, (const char *)NULL);
+	checkRoundTrip("[%d] [%i] [%u] [%x] [%X] [%4zx] [%03zu]", -5, 17, 4000000000U, 255U, 255U, (size_t)0xab, (size_t)7);
+	checkRoundTrip("[%*d] [%-*s] [%.*s]", 6, -42, 8, "left", 3, "truncated");
+	checkRoundTrip("[%c] [%-6s] [%6s] [%lld]", 'x', "ab", "cd", (long long)-1234567890123LL);
+	checkRoundTrip("[%.3f] [%e] [%g]", 3.14159, 0.000125, 2.5);
+	checkRoundTrip("no conversions");
+	checkRoundTrip("");
+}
+
+TEST(TestVerboseBinaryFormat, LongConversions)
+{
+	const char *format = "[%ld] [%lu] [%lx]";
+	long signedValue = (long)-1;
+	unsigned long unsignedValue = 4000000000UL;
+	unsigned long hexValue = 0xfedcba98UL;
+	if (8 == sizeof(long)) {
+		/* values which need more than 32 bits must not be truncated */
+		signedValue = (long)(-(1LL << 40) - 3);
+		unsignedValue = (unsigned long)((1ULL << 32) + 5);
+		hexValue = (unsigned long)0x123456789abcULL;
+	}
+	uint8_t encoded[64];
+	char expected[64];
+	std::string decoded;
+
+	uintptr_t encodedSize = encode(encoded, sizeof(encoded), format, signedValue, unsignedValue, hexValue);
+	ASSERT_NE(VERBOSE_BINARY_ENCODING_FAILED, encodedSize);
+	ASSERT_TRUE(MM_VerboseBinaryFormat::decodeLine(format, encoded, encodedSize, sizeof(uintptr_t), appendText, formatText, &decoded));
+
+	/* omrstr_vprintf reads %ld as 32 bits, so compare with the C library */
+	snprintf(expected, sizeof(expected), format, signedValue, unsignedValue, hexValue);
+	ASSERT_STREQ(expected, decoded.c_str());
+}
+
+TEST(TestVerboseBinaryFormat, Unsupported)
+{
+	uint8_t encoded[64];
+
+	/* wide strings and positional arguments must be formatted by the caller */
+	ASSERT_EQ(VERBOSE_BINARY_ENCODING_FAILED, encode(encoded, sizeof(encoded), "%ls", L"wide"));
+	ASSERT_EQ(VERBOSE_BINARY_ENCODING_FAILED, encode(encoded, sizeof(encoded), "%1$s", "positional"));
+	/* arguments which do not fit */
+	ASSERT_EQ(VERBOSE_BINARY_ENCODING_FAILED, encode(encoded, sizeof(encoded), "%s", "a string which is much longer than the sixty four bytes of the buffer"));
+	ASSERT_EQ(VERBOSE_BINARY_ENCODING_FAILED, encode(encoded, 12, "%zu %zu", (size_t)1, (size_t)2));
+	ASSERT_EQ((uintptr_t)16, encode(encoded, 16, "%zu %zu", (size_t)1, (size_t)2));
+}
+
+TEST(TestVerboseBinaryFormat, TruncatedArguments)
+{
+	uint8_t encoded[64];
+	std::string decoded;
+
+	uintptr_t encodedSize = encode(encoded, sizeof(encoded), "%zu %s", (size_t)1, "two");
+	ASSERT_NE(VERBOSE_BINARY_ENCODING_FAILED, encodedSize);
+	ASSERT_FALSE(MM_VerboseBinaryFormat::decodeLine("%zu %s", encoded, encodedSize - 1, sizeof(uintptr_t), appendText, formatText, &decoded));
+	decoded.clear();
+	ASSERT_FALSE(MM_VerboseBinaryFormat::decodeLine("%zu %s", encoded, 4, sizeof(uintptr_t), appendText, formatText, &decoded));
+}
@@ -0,0 +1,369 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "verboseGCLogAnalyzer.hpp"
+#include "verboseGCLogReader.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+/**
+ * Records the elements reported by the reader as "<name attribute=value></name>".
+ */
+class RecordingHandler : public VerboseGCLogHandler {
+public:
+	std::string events;
+	uintptr_t elementCount;
+
+	virtual void
+	startElement(const char *name, const VerboseGCLogAttribute *attributes, uintptr_t attributeCount)
+	{
+		elementCount += 1;
+		if (events.size() < 1024) {
+			events += "<";
+			events += name;
+			for (uintptr_t i = 0; i < attributeCount; i++) {
+				events += " ";
+				events += attributes[i].name;
+				events += "=";
+				events += attributes[i].value;
+			}
+			events += ">";
+		}
+	}
+
+	virtual void
+	endElement(const char *name)
+	{
+		if (events.size() < 1024) {
+			events += "</";
+			events += name;
+			events += ">";
+		}
+	}
+
+	RecordingHandler()
+		: VerboseGCLogHandler()
+		, elementCount(0)
+	{
+	}
+};
+
+static void
+writeFile(const char *fileName, const std::string &content)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd) << fileName;
+	ASSERT_EQ((intptr_t)content.size(), omrfile_write(fd, content.c_str(), (intptr_t)content.size())) << fileName;
+	omrfile_close(fd);
+}
+
+static std::string
+readFile(const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	std::string content;
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 != fd) {
+		int64_t length = omrfile_flength(fd);
+		if (0 < length) {
+			content.resize((size_t)length);
+			if (length != omrfile_read(fd, &content[0], (intptr_t)length)) {
+				content.clear();
+			}
+		}
+		omrfile_close(fd);
+	}
+	return content;
+}
+
+static VerboseGCLogReadResult
+parseText(const std::string &content, RecordingHandler *handler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *fileName = "TestVerboseGCLogReader.xml";
+	VerboseGCLogReader reader(gcTestEnv->getPortLibrary());
+
+	writeFile(fileName, content);
+	VerboseGCLogReadResult result = reader.parseFile(fileName, handler);
+	omrfile_unlink(fileName);
+	return result;
+}
+
+/**
+ * A global collection in the form written by the standard verbose handler.
+ */
+static std::string
+globalCycle(const char *timestamp, double pauseMs, unsigned long long allocatedBytes)
+{
+	char cycle[2048];
+	snprintf(cycle, sizeof(cycle),
+		"<exclusive-start id=\"1\" timestamp=\"%s\" intervalms=\"10.000\">\n"
+		"  <response-info timems=\"0.010\" idlems=\"0.010\" threads=\"0\" lastid=\"0000000000000000\" lastname=\"main\" />\n"
+		"</exclusive-start>\n"
+		"<cycle-start id=\"2\" type=\"global\" contextid=\"0\" timestamp=\"%s\" intervalms=\"100.000\" />\n"
+		"<gc-start id=\"3\" type=\"global\" contextid=\"2\" timestamp=\"%s\">\n"
+		"  <mem-info id=\"4\" free=\"2097152\" total=\"4194304\" percent=\"50\">\n"
+		"    <mem type=\"tenure\" free=\"2097152\" total=\"4194304\" percent=\"50\" />\n"
+		"  </mem-info>\n"
+		"</gc-start>\n"
+		"<allocation-stats totalBytes=\"%llu\" >\n"
+		"  <allocated-bytes non-tlh=\"0\" tlh=\"%llu\" />\n"
+		"</allocation-stats>\n"
+		"<gc-op id=\"5\" type=\"mark\" timems=\"2.000\" contextid=\"2\" timestamp=\"%s\">\n"
+		"  <trace-info objectcount=\"10\" scancount=\"10\" scanbytes=\"2097152\" />\n"
+		"</gc-op>\n"
+		"<gc-op id=\"6\" type=\"sweep\" timems=\"1.000\" contextid=\"2\" timestamp=\"%s\" />\n"
+		"<gc-end id=\"7\" type=\"global\" contextid=\"2\" durationms=\"3.000\" usertimems=\"3.000\" systemtimems=\"0.000\" timestamp=\"%s\" activeThreads=\"1\">\n"
+		"  <mem-info id=\"8\" free=\"3145728\" total=\"4194304\" percent=\"75\" />\n"
+		"</gc-end>\n"
+		"<cycle-end id=\"9\" type=\"global\" contextid=\"2\" timestamp=\"%s\" />\n"
+		"<exclusive-end id=\"10\" timestamp=\"%s\" durationms=\"%.3f\" />\n\n",
+		timestamp, timestamp, timestamp, allocatedBytes, allocatedBytes, timestamp, timestamp, timestamp, timestamp, timestamp, pauseMs);
+	return cycle;
+}
+
+static const char *logHeader = "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"test\">\n\n";
+
+/**
+ * Analyze a rotated log set of two files, the second of which was not written completely.
+ */
+static void
+analyzeRotatedLogs(VerboseGCLogAnalysis *analysis)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	std::vector<std::string> files;
+	files.push_back("TestVerboseGCLogReader.001.xml");
+	files.push_back("TestVerboseGCLogReader.002.xml");
+
+	std::string log = logHeader;
+	log += globalCycle("2026-01-01T00:00:00.100", 1.0, 1048576);
+	log += globalCycle("2026-01-01T00:00:00.200", 3.0, 2097152);
+	log += "</verbosegc>\n";
+	writeFile(files[0].c_str(), log);
+
+	log = logHeader;
+	log += globalCycle("2026-01-01T00:00:00.300", 2.0, 3145728);
+	log += "<exclusive-start id=\"1\" timestamp=\"2026-01-01T00:00:00.400\" interv";
+	writeFile(files[1].c_str(), log);
+
+	ASSERT_TRUE(analysis->analyzeFiles(gcTestEnv->getPortLibrary(), &files, 2));
+
+	for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it) {
+		omrfile_unlink(it->c_str());
+	}
+}
+
+static std::string
+writeSummary(VerboseGCLogAnalysis *analysis, const char *format)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *fileName = "TestVerboseGCLogReader.report";
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	EXPECT_NE(-1, fd);
+	if (-1 == fd) {
+		return "";
+	}
+	analysis->writeSummary(gcTestEnv->getPortLibrary(), fd, format);
+	omrfile_close(fd);
+	std::string report = readFile(fileName);
+	omrfile_unlink(fileName);
+	return report;
+}
+
+TEST(TestVerboseGCLogReader, Parse)
+{
+	RecordingHandler handler;
+	const char *log =
+		"<?xml version=\"1.0\" ?>\n"
+		"<!-- a comment with <markup> in it -->\n"
+		"<verbosegc version=\"test\">\n"
+		"<gc-op type='mark' name=\"a &lt; b &amp;&amp; c &gt; d\" timems = \"1.5\">character data\n"
+		"  <trace-info scanbytes=\"10\"/>\n"
+		"</gc-op>\n"
+		"</verbosegc>\n";
+
+	ASSERT_EQ(VERBOSEGCLOG_READ_COMPLETE, parseText(log, &handler));
+	ASSERT_STREQ("<verbosegc version=test><gc-op type=mark name=a < b && c > d timems=1.5><trace-info scanbytes=10></trace-info></gc-op></verbosegc>", handler.events.c_str());
+}
+
+TEST(TestVerboseGCLogReader, ReadBoundaries)
+{
+	RecordingHandler handler;
+	std::string log = "<verbosegc>\n";
+	uintptr_t elements = 0;
+	/* tags which span the reads, and a tag which is larger than the read size */
+	while (log.size() < (3 * VERBOSEGCLOG_READ_SIZE)) {
+		log += "<exclusive-end id=\"10\" timestamp=\"2026-01-01T00:00:00.000\" durationms=\"1.000\" />\n";
+		elements += 1;
+		if (1000 == elements) {
+			log += "<warning details=\"";
+			log.append(VERBOSEGCLOG_READ_SIZE + 1, 'x');
+			log += "\" />\n";
+			elements += 1;
+		}
+	}
+	log += "</verbosegc>\n";
+
+	ASSERT_EQ(VERBOSEGCLOG_READ_COMPLETE, parseText(log, &handler));
+	ASSERT_EQ(elements + 1, handler.elementCount);
+}
+
+TEST(TestVerboseGCLogReader, TruncatedRecord)
+{
+	/* the elements before the partial tag are reported */
+	RecordingHandler handler;
+	ASSERT_EQ(VERBOSEGCLOG_READ_TRUNCATED, parseText("<verbosegc>\n<a x=\"1\" />\n<gc-end id=\"7\" type=\"glo", &handler));
+	ASSERT_STREQ("<verbosegc><a x=1></a>", handler.events.c_str());
+
+	/* a partial comment */
+	RecordingHandler commentHandler;
+	ASSERT_EQ(VERBOSEGCLOG_READ_TRUNCATED, parseText("<verbosegc>\n<a />\n<!-- <b/> -", &commentHandler));
+	ASSERT_STREQ("<verbosegc><a></a>", commentHandler.events.c_str());
+
+	/* complete tags, but elements which were not ended */
+	RecordingHandler elementHandler;
+	ASSERT_EQ(VERBOSEGCLOG_READ_TRUNCATED, parseText("<verbosegc>\n<gc-op type=\"mark\">\n<trace-info />\n", &elementHandler));
+	ASSERT_STREQ("<verbosegc><gc-op type=mark><trace-info></trace-info>", elementHandler.events.c_str());
+}
+
+TEST(TestVerboseGCLogReader, Malformed)
+{
+	RecordingHandler handler;
+	VerboseGCLogReader reader(gcTestEnv->getPortLibrary());
+
+	ASSERT_EQ(VERBOSEGCLOG_READ_FAILED, parseText("<verbosegc>\n<a b></a>\n</verbosegc>\n", &handler));
+	ASSERT_EQ(VERBOSEGCLOG_READ_FAILED, parseText("<verbosegc>\n<a b=c />\n</verbosegc>\n", &handler));
+	ASSERT_EQ(VERBOSEGCLOG_READ_FAILED, parseText("<verbosegc />\n</verbosegc>\n", &handler));
+	ASSERT_EQ(VERBOSEGCLOG_READ_FAILED, reader.parseFile("TestVerboseGCLogReader.missing.xml", &handler));
+}
+
+TEST(TestVerboseGCLogAnalyzer, RotatedLogs)
+{
+	VerboseGCLogAnalysis analysis;
+	analyzeRotatedLogs(&analysis);
+
+	ASSERT_EQ((uintptr_t)2, analysis.fileCount);
+	ASSERT_EQ((uintptr_t)1, analysis.incompleteFileCount);
+
+	/* the data of the files is merged in rotation order */
+	ASSERT_EQ((size_t)3, analysis.pauses.size());
+	ASSERT_EQ(1.0, analysis.pauses[0]);
+	ASSERT_EQ(3.0, analysis.pauses[1]);
+	ASSERT_EQ(2.0, analysis.pauses[2]);
+	ASSERT_EQ((size_t)1, analysis.collections.size());
+	ASSERT_EQ((size_t)3, analysis.collections["global"].size());
+	ASSERT_EQ((size_t)2, analysis.phases.size());
+	ASSERT_EQ((size_t)3, analysis.phases["mark"].size());
+	ASSERT_EQ((size_t)3, analysis.phases["sweep"].size());
+
+	/* 2MB scanned in 2ms, and the 4MB heap swept in 1ms */
+	ASSERT_EQ((size_t)3, analysis.throughput["mark"].rates.size());
+	ASSERT_DOUBLE_EQ(1000.0, analysis.throughput["mark"].rates[0]);
+	ASSERT_DOUBLE_EQ(4000.0, analysis.throughput["sweep"].rates[2]);
+	ASSERT_DOUBLE_EQ(3.0 * 4194304, analysis.throughput["sweep"].bytes);
+
+	ASSERT_EQ((size_t)3, analysis.allocations.size());
+	for (uintptr_t i = 0; i < analysis.allocations.size(); i++) {
+		ASSERT_EQ((i + 1) * 1048576, analysis.allocations[i].allocatedBytes);
+		ASSERT_EQ(100.0, analysis.allocations[i].intervalMs);
+	}
+	ASSERT_STREQ("2026-01-01T00:00:00.300", analysis.allocations[2].timestamp.c_str());
+}
+
+TEST(TestVerboseGCLogAnalyzer, CsvReport)
+{
+	VerboseGCLogAnalysis analysis;
+	analyzeRotatedLogs(&analysis);
+
+	std::string report = writeSummary(&analysis, "csv");
+	ASSERT_STREQ(
+		"metric,type,unit,count,total,mean,p50,p99,p999,max\n"
+		"pause,all,ms,3,6.000,2.000,2.000,3.000,3.000,3.000\n"
+		"collection,global,ms,3,9.000,3.000,3.000,3.000,3.000,3.000\n"
+		"phase,mark,ms,3,6.000,2.000,2.000,2.000,2.000,2.000\n"
+		"phase,sweep,ms,3,3.000,1.000,1.000,1.000,1.000,1.000\n"
+		"throughput,mark,MB/s,3,1000.000,1000.000,1000.000,1000.000,1000.000,1000.000\n"
+		"throughput,sweep,MB/s,3,4000.000,4000.000,4000.000,4000.000,4000.000,4000.000\n",
+		report.c_str());
+}
+
+TEST(TestVerboseGCLogAnalyzer, JsonReport)
+{
+	VerboseGCLogAnalysis analysis;
+	analyzeRotatedLogs(&analysis);
+
+	std::string report = writeSummary(&analysis, "json");
+	ASSERT_STREQ(
+		"{\"files\": 2, \"incompleteFiles\": 1,\n"
+		" \"pause\": {\"all\": {\"unit\": \"ms\", \"count\": 3, \"total\": 6.000, \"mean\": 2.000, \"p50\": 2.000, \"p99\": 3.000, \"p999\": 3.000, \"max\": 3.000}},\n"
+		" \"collections\": {\"global\": {\"unit\": \"ms\", \"count\": 3, \"total\": 9.000, \"mean\": 3.000, \"p50\": 3.000, \"p99\": 3.000, \"p999\": 3.000, \"max\": 3.000}},\n"
+		" \"phases\": {\"mark\": {\"unit\": \"ms\", \"count\": 3, \"total\": 6.000, \"mean\": 2.000, \"p50\": 2.000, \"p99\": 2.000, \"p999\": 2.000, \"max\": 2.000}, "
+		"\"sweep\": {\"unit\": \"ms\", \"count\": 3, \"total\": 3.000, \"mean\": 1.000, \"p50\": 1.000, \"p99\": 1.000, \"p999\": 1.000, \"max\": 1.000}},\n"
+		" \"throughput\": {\"mark\": {\"unit\": \"MB/s\", \"count\": 3, \"total\": 1000.000, \"mean\": 1000.000, \"p50\": 1000.000, \"p99\": 1000.000, \"p999\": 1000.000, \"max\": 1000.000}, "
+		"\"sweep\": {\"unit\": \"MB/s\", \"count\": 3, \"total\": 4000.000, \"mean\": 4000.000, \"p50\": 4000.000, \"p99\": 4000.000, \"p999\": 4000.000, \"max\": 4000.000}}}\n",
+		report.c_str());
+}
+
+TEST(TestVerboseGCLogAnalyzer, TextReport)
+{
+	VerboseGCLogAnalysis analysis;
+	analyzeRotatedLogs(&analysis);
+	char line[256];
+
+	std::string report = writeSummary(&analysis, "text");
+	ASSERT_EQ((size_t)0, report.find("Results for 2 verbose GC file(s) (times in ms)\n1 file(s) ended within a record")) << report;
+	snprintf(line, sizeof(line), "%-10s %-20s %10d %12.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n", "Pause", "all", 3, 6.0, 2.0, 2.0, 3.0, 3.0, 3.0);
+	ASSERT_NE(std::string::npos, report.find(line)) << report;
+	snprintf(line, sizeof(line), "%-10s %-20s %10d %12.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n", "Phase", "sweep", 3, 4000.0, 4000.0, 4000.0, 4000.0, 4000.0, 4000.0);
+	ASSERT_NE(std::string::npos, report.find(line)) << report;
+}
+
+TEST(TestVerboseGCLogAnalyzer, AllocationSeries)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	VerboseGCLogAnalysis analysis;
+	analyzeRotatedLogs(&analysis);
+
+	const char *fileName = "TestVerboseGCLogReader.series";
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	analysis.writeAllocations(gcTestEnv->getPortLibrary(), fd, "csv");
+	omrfile_close(fd);
+	std::string series = readFile(fileName);
+	omrfile_unlink(fileName);
+
+	/* 1MB allocated in the 100ms since the previous collection is 10MB/s */
+	ASSERT_STREQ(
+		"timestamp,interval_ms,allocated_bytes,rate_mb_per_s\n"
+		"2026-01-01T00:00:00.100,100.000,1048576,10.000\n"
+		"2026-01-01T00:00:00.200,100.000,2097152,20.000\n"
+		"2026-01-01T00:00:00.300,100.000,3145728,30.000\n",
+		series.c_str());
+}
@@ -30,6 +30,7 @@
  * @note port library virtual memory management operations are not optional in the port library table.
  *
  */
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -4210,6 +4211,93 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_EQ(0u, size) << "value updated when query invalid";
 }
 
+#if defined(LINUX)
+/**
+ * Find the VmFlags of the mapping containing address in /proc/self/smaps.
+ * @return TRUE if the flags were found
+ */
+static BOOLEAN
+getMappingFlags(void *address, char *flags, size_t flagsSize)
+{
+	BOOLEAN result = FALSE;
+	BOOLEAN inMapping = FALSE;
+	char line[512];
+	FILE *smaps = fopen("/proc/self/smaps", "r");
+
+	if (NULL != smaps) {
+		while (!result && (NULL != fgets(line, sizeof(line), smaps))) {
+			unsigned long base = 0;
+			unsigned long top = 0;
+			if (2 == sscanf(line, "%lx-%lx ", &base, &top)) {
+				inMapping = ((uintptr_t)address >= base) && ((uintptr_t)address < top);
+			} else if (inMapping && (0 == strncmp(line, "VmFlags:", 8))) {
+				strncpy(flags, line + 8, flagsSize - 1);
+				flags[flagsSize - 1] = '\0';
+				result = TRUE;
+			}
+		}
+		fclose(smaps);
+	}
+
+	return result;
+}
+
+/**
+ * Verify that OMRPORT_VMEM_NO_ADVISE_HUGEPAGE keeps a reservation from being advised for transparent huge pages,
+ * while other reservations still are (when the kernel only backs advised memory with transparent huge pages).
+ */
+TEST(PortVmemTest, vmem_testReserveMemoryExNoAdviseHugepage)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testReserveMemoryExNoAdviseHugepage";
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	BOOLEAN madviseOnly = FALSE;
+	char enabled[128];
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	FILE *thpEnabled = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+	if (NULL != thpEnabled) {
+		madviseOnly = (NULL != fgets(enabled, sizeof(enabled), thpEnabled)) && (NULL != strstr(enabled, "[madvise]"));
+		fclose(thpEnabled);
+	}
+
+	for (uintptr_t i = 0; i < 2; i++) {
+		BOOLEAN advise = (0 == i);
+		J9PortVmemIdentifier vmemID;
+		J9PortVmemParams params;
+		char flags[256];
+
+		omrvmem_vmem_params_init(&params);
+		params.byteAmount = 2 * D2M;
+		params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+		params.pageSize = pageSizes[0];
+		params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+		if (!advise) {
+			params.options |= OMRPORT_VMEM_NO_ADVISE_HUGEPAGE;
+		}
+
+		void *memPtr = omrvmem_reserve_memory_ex(&vmemID, &params);
+		if (NULL == memPtr) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_reserve_memory_ex returned NULL\n");
+			break;
+		}
+
+		if (!getMappingFlags(memPtr, flags, sizeof(flags))) {
+			portTestEnv->log("VmFlags are not reported, not checking the advice\n");
+		} else if (!advise) {
+			EXPECT_TRUE(NULL == strstr(flags, " hg")) << "a reservation with OMRPORT_VMEM_NO_ADVISE_HUGEPAGE was advised: " << flags;
+		} else if (madviseOnly) {
+			EXPECT_TRUE(NULL != strstr(flags, " hg")) << "a reservation was not advised: " << flags;
+		}
+
+		omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(LINUX) */
+
 /**
  * Sanity test of function to obtain available physical memory.
  */
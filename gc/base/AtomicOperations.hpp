@@ -57,6 +57,16 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * If the CPU supports it, emit an instruction to prefetch the cache line containing
+	 * the given address in anticipation of a read.
+	 */
+	MMINLINE_DEBUG static void
+	prefetch(const void *address)
+	{
+		VM_AtomicSupport::prefetch(address);
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
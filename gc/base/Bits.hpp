@@ -221,6 +221,16 @@ public:
 		return J9BITS_BITS_IN_SLOT - 1 - result;
 	}
 #endif /* defined(OMR_OS_WINDOWS) && !defined(OMR_ENV_DATA64) */
+
+	/**
+	 * Clear all but the most significant bit set to one in the input word.
+	 * @note If the input is 0, the result is undefined.
+	 * @return the highest power of two not greater than the input.
+	 */
+	MMINLINE static uintptr_t highestSetBit(uintptr_t input)
+	{
+		return ((uintptr_t)1) << (J9BITS_BITS_IN_SLOT - 1 - trailingZeroes(input));
+	}
 };
 
 #endif /*BITS_HPP_*/
@@ -29,6 +29,7 @@
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScan.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
@@ -47,12 +48,14 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	
 	/* Instantiate the Virtual Memory object for the card table */
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired)) {
+	uintptr_t alignment = extensions->_hugePageManager.getReservationAlignment(extensions->heapAlignment);
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, alignment, cardTableSizeRequired)) {
 		_cardTableStart = (Card *)(memoryManager->getHeapBase(&_cardTableMemoryHandle));
 		/* Initialize _heapbase; we will reset _heapAlloc in heapAddRange()/heapRemoveRange() as heap changes */
 		_heapBase = (void *)heap->getHeapBase();
 		_heapAlloc = (void *)heap->getHeapTop();
 		_cardTableVirtualStart = (Card *) ((uintptr_t)_cardTableStart - (((uintptr_t)getHeapBase()) >> CARD_SIZE_SHIFT));
+		extensions->_hugePageManager.registerMemory(MM_HugePageManager::STRUCTURE_CARD_TABLE, &_cardTableMemoryHandle);
 		initialized = true;
 	}
 
@@ -70,7 +73,27 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
+	extensions->_hugePageManager.unregisterMemory(MM_HugePageManager::STRUCTURE_CARD_TABLE, &_cardTableMemoryHandle);
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryBits) {
+		extensions->getForge()->free(_summaryBits);
+		_summaryBits = NULL;
+	}
+}
+
+bool
+MM_CardTable::initializeSummary(MM_EnvironmentBase *env, uintptr_t cardTableSize)
+{
+	uintptr_t summaryBitCount = MM_Math::roundToCeiling(CARD_TABLE_SUMMARY_CARDS_PER_BIT, cardTableSize / sizeof(Card)) / CARD_TABLE_SUMMARY_CARDS_PER_BIT;
+	uintptr_t summarySize = (MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, summaryBitCount) / J9BITS_BITS_IN_SLOT) * sizeof(uintptr_t);
+
+	_summaryBits = (uintptr_t *)env->getForge()->allocate(summarySize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _summaryBits) {
+		return false;
+	}
+	memset(_summaryBits, 0, summarySize);
+	return true;
 }
 
 uintptr_t
@@ -256,6 +279,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			setSummaryBitForCard(card);
 		}
 	}
 }
@@ -270,6 +294,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			setSummaryBitForCard(card);
 		}
 	}
 }
@@ -305,14 +330,15 @@ MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, C
 	Card *endCard = high;
 	uintptr_t cardsCleaned = 0;
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
+		thisCard = findFirstNonCleanCard(env, thisCard, endCard);
+		if (thisCard < endCard) {
 			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
 			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
 			
 			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
 			cardsCleaned += 1;
+			thisCard += 1;
 		}
-		thisCard += 1;
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
 }
@@ -369,6 +395,102 @@ MM_CardTable::cleanCardsInRegion(MM_EnvironmentBase *env, MM_CardCleaner *cardCl
 	env->popVMstate(oldVMState);
 }
 
+Card *
+MM_CardTable::findFirstNonCleanCardInLeaf(Card *card, Card *topCard)
+{
+	/* CARD_CLEAN is 0, so a slot of cards is all clean exactly when it is 0 */
+	while ((card < topCard) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+
+	uintptr_t *slotTop = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+	if ((uintptr_t *)card < slotTop) {
+		card = (Card *)MM_HeapMapScan::findFirstNonEmptySlot((uintptr_t *)card, slotTop);
+	}
+
+	while ((card < topCard) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
+
+Card *
+MM_CardTable::clearSummaryBit(uintptr_t bitIndex)
+{
+	volatile uintptr_t *slot = &_summaryBits[bitIndex / J9BITS_BITS_IN_SLOT];
+	uintptr_t bit = (uintptr_t)1 << (bitIndex % J9BITS_BITS_IN_SLOT);
+	uintptr_t oldValue = *slot;
+	while (0 != (oldValue & bit)) {
+		uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue & ~bit);
+		if (value == oldValue) {
+			break;
+		}
+		oldValue = value;
+	}
+
+	/* A card dirtied after the cache line was scanned but before the bit was cleared did not set the bit again
+	 * (see setSummaryBitForCard()), so scan the cache line once more now that the bit is clear.
+	 */
+	MM_AtomicOperations::readWriteBarrier();
+	Card *base = getSummaryBitBase(bitIndex);
+	Card *top = base + CARD_TABLE_SUMMARY_CARDS_PER_BIT;
+	Card *card = findFirstNonCleanCardInLeaf(base, top);
+	if (card < top) {
+		setSummaryBit(bitIndex);
+	}
+	return card;
+}
+
+Card *
+MM_CardTable::findFirstNonCleanCard(MM_EnvironmentBase *env, Card *card, Card *topCard)
+{
+	if (NULL == _summaryBits) {
+		return findFirstNonCleanCardInLeaf(card, topCard);
+	}
+
+	while (card < topCard) {
+		uintptr_t bitIndex = getSummaryBitIndex(card);
+		uintptr_t slotIndex = bitIndex / J9BITS_BITS_IN_SLOT;
+		/* summary bits of this and the following cache lines in the current summary slot */
+		uintptr_t bits = _summaryBits[slotIndex] & (((uintptr_t)-1) << (bitIndex % J9BITS_BITS_IN_SLOT));
+
+		if (0 == bits) {
+			/* nothing left to look at in this summary slot, skip the empty slots which follow it */
+			uintptr_t *summaryTop = &_summaryBits[(getSummaryBitIndex(topCard - 1) / J9BITS_BITS_IN_SLOT) + 1];
+			uintptr_t *nextSlot = MM_HeapMapScan::findFirstNonEmptySlot(&_summaryBits[slotIndex + 1], summaryTop);
+			card = OMR_MIN(getSummaryBitBase((uintptr_t)(nextSlot - _summaryBits) * J9BITS_BITS_IN_SLOT), topCard);
+			continue;
+		}
+
+		uintptr_t nextBitIndex = (slotIndex * J9BITS_BITS_IN_SLOT) + MM_Bits::leadingZeroes(bits);
+		if (nextBitIndex != bitIndex) {
+			/* the cache lines up to the next one with its summary bit set are all clean */
+			card = OMR_MIN(getSummaryBitBase(nextBitIndex), topCard);
+			continue;
+		}
+
+		Card *base = getSummaryBitBase(bitIndex);
+		Card *top = base + CARD_TABLE_SUMMARY_CARDS_PER_BIT;
+		Card *scanTop = OMR_MIN(top, topCard);
+		Card *found = findFirstNonCleanCardInLeaf(card, scanTop);
+		if (found < scanTop) {
+			return found;
+		}
+		if ((base == card) && (top == scanTop)) {
+			/* the whole cache line is clean */
+			found = clearSummaryBit(bitIndex);
+			if (found < top) {
+				return found;
+			}
+		}
+		card = scanTop;
+	}
+	return topCard;
+}
+
 uintptr_t
 MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* heapTop)
 {
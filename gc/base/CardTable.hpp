@@ -33,7 +33,9 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
+#include "Bits.hpp"
 #include "MemoryManager.hpp"
 
 class MM_EnvironmentBase;
@@ -41,6 +43,9 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/* Number of cards (one cache line of the card table) described by a single bit of the card table summary */
+#define CARD_TABLE_SUMMARY_CARDS_PER_BIT 64
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -62,6 +67,7 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	uintptr_t *_summaryBits; /**< one bit per CARD_TABLE_SUMMARY_CARDS_PER_BIT cards, clear only if all of those cards are clean (NULL if no summary is kept) */
 
 
 public:
@@ -84,6 +90,27 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return true if the card table keeps a summary of the cards which may not be clean
+	 */
+	MMINLINE bool isSummaryEnabled() { return NULL != _summaryBits; }
+
+	/**
+	 * Record in the summary that the given card may no longer be clean. Must be called after every store which
+	 * changes a clean card to any other value (the store must precede the call).
+	 * @param[in] card The card which was stored to
+	 * @note Write barriers which store to the card table inline must call this as well, if the summary is enabled
+	 */
+	MMINLINE void
+	setSummaryBitForCard(Card *card)
+	{
+		if (NULL != _summaryBits) {
+			/* the card store must be visible before the summary bit is read, see clearSummaryBit() */
+			MM_AtomicOperations::readWriteBarrier();
+			setSummaryBit(getSummaryBitIndex(card));
+		}
+	}
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -170,6 +197,17 @@ public:
 	 */
 	void cleanCardsInRegion(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, MM_HeapRegionDescriptor *region);
 
+	/**
+	 * Find the first card which is not clean in the given range. If the summary is enabled, cache lines of cards
+	 * whose summary bit is clear are skipped without being read, and the summary bits of cache lines found to be
+	 * clean are cleared. The remaining cards are scanned a vector at a time.
+	 * @param[in] env The thread scanning the card table
+	 * @param[in] card First card of the range
+	 * @param[in] topCard End (exclusive) of the range
+	 * @return The first card in [card, topCard) which is not CARD_CLEAN, or topCard if all of them are clean
+	 */
+	Card *findFirstNonCleanCard(MM_EnvironmentBase *env, Card *card, Card *topCard);
+
 	/**
 	 * Calculate card table size
 	 *
@@ -245,6 +283,14 @@ protected:
 	 */
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Allocate the (initially empty) summary of the card table.
+	 * @param env[in] The master GC thread
+	 * @param cardTableSize[in] The size, in bytes, of the card table to be summarized
+	 * @return true if the summary was allocated
+	 */
+	bool initializeSummary(MM_EnvironmentBase *env, uintptr_t cardTableSize);
 	
 	/**
 	 * Commits the card table range between lowCard and highCard:  [lowCard, highCard)
@@ -268,12 +314,44 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _summaryBits(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 private:
 	void cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high);
+
+	/**
+	 * Find the first card which is not clean in [card, topCard) by reading every card (a vector at a time).
+	 */
+	static Card *findFirstNonCleanCardInLeaf(Card *card, Card *topCard);
+
+	/**
+	 * Clear the summary bit of a cache line of cards which was found to be clean. Cards dirtied while the bit
+	 * was being cleared are found by scanning the cache line again.
+	 * @return The first card of the cache line which is not clean (its summary bit is set again), or the top of the cache line
+	 */
+	Card *clearSummaryBit(uintptr_t bitIndex);
+
+	MMINLINE uintptr_t getSummaryBitIndex(Card *card) { return (uintptr_t)(card - _cardTableStart) / CARD_TABLE_SUMMARY_CARDS_PER_BIT; }
+
+	MMINLINE Card *getSummaryBitBase(uintptr_t bitIndex) { return _cardTableStart + (bitIndex * CARD_TABLE_SUMMARY_CARDS_PER_BIT); }
+
+	MMINLINE void
+	setSummaryBit(uintptr_t bitIndex)
+	{
+		volatile uintptr_t *slot = &_summaryBits[bitIndex / J9BITS_BITS_IN_SLOT];
+		uintptr_t bit = (uintptr_t)1 << (bitIndex % J9BITS_BITS_IN_SLOT);
+		uintptr_t oldValue = *slot;
+		while (0 == (oldValue & bit)) {
+			uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue | bit);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+	}
 };
 
 #endif /* CARDTABLE_HPP_ */
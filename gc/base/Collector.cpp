@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "AllocateDescription.hpp"
+#include "AllocationSamplingStats.hpp"
 #include "Collector.hpp"
 #include "GCExtensionsBase.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -229,6 +230,24 @@ MM_Collector::preCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace, M
 		}
 	}
 
+	/* Merge the allocation samples of all threads */
+	if (extensions->allocationSamplingEnabled) {
+		if (NULL == extensions->allocationSamplingStats) {
+			extensions->allocationSamplingStats = MM_AllocationSamplingStats::newInstance(env, extensions->allocationSamplingMaxSites);
+		}
+		if (NULL != extensions->allocationSamplingStats) {
+			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+			OMR_VMThread *omrVMThread = NULL;
+			while (NULL != (omrVMThread = threadListIterator.nextOMRVMThread())) {
+				MM_AllocationSamplingStats *allocationSamplingStats = MM_EnvironmentBase::getEnvironment(omrVMThread)->_objectAllocationInterface->getAllocationSamplingStats();
+				if (NULL != allocationSamplingStats) {
+					extensions->allocationSamplingStats->merge(allocationSamplingStats);
+					allocationSamplingStats->clear();
+				}
+			}
+		}
+	}
+
 	_bytesRequested = (allocDescription ? allocDescription->getBytesRequested() : 0);
 
 	internalPreCollect(env, subSpace, allocDescription, gcCode);
@@ -36,6 +36,7 @@
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapMapScan.hpp"
 #include "HeapRegionManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
@@ -62,7 +63,8 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 {
 	bool result = false;
 
-	if (initializeRegionSize(env) && initializeArrayletLeafSize(env)) {
+	/* the huge page policy selects the page sizes and must be applied before the region size is chosen */
+	if (env->getExtensions()->_hugePageManager.applyPolicy(env) && initializeRegionSize(env) && initializeArrayletLeafSize(env)) {
 		if (_delegate.initialize(env, _writeBarrierType, _allocationType)) {
 			MM_GCExtensionsBase* extensions = env->getExtensions();
 			/* excessivegc is enabled by default */
@@ -72,6 +74,7 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 			if (initializeNUMAManager(env)) {
 				initializeGCThreadCount(env);
 				initializeGCParameters(env);
+				MM_HeapMapScan::initialize(extensions);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
 			}
@@ -390,6 +393,12 @@ MM_Configuration::initializeRegionSize(MM_EnvironmentBase* env)
 	if (0 == regionSize) {
 		regionSize = _defaultRegionSize;
 	}
+#if defined(OMR_GC_VLHGC)
+	if (extensions->isVLHGC() && extensions->_hugePageManager.isAlignmentRequired()) {
+		/* regions are committed and decommitted one at a time, so each must cover whole huge pages */
+		regionSize = OMR_MAX(regionSize, extensions->_hugePageManager.getHugePageSize());
+	}
+#endif /* defined(OMR_GC_VLHGC) */
 
 	uintptr_t shift = calculatePowerOfTwoShift(env, regionSize);
 	if (0 == shift) {
@@ -32,6 +32,9 @@
 #include "CardCleaningStats.hpp"
 #include "CycleState.hpp"
 #include "CompactStats.hpp"
+#if defined(OMR_GC_VLHGC)
+#include "CopyForwardStatsCore.hpp"
+#endif /* defined(OMR_GC_VLHGC) */
 #include "EnvironmentDelegate.hpp"
 #include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
@@ -147,6 +150,8 @@ public:
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
+	uintptr_t _allocationSamplingBytesRemaining; /**< Bytes left to allocate before the next allocation sample (see MM_GCExtensionsBase::allocationSamplingEnabled) */
+	uint64_t _allocationSamplingSeed; /**< State of the pseudo random generator of allocation sampling intervals */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -174,6 +179,9 @@ public:
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	MM_ScavengerStats _scavengerStats;
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+#if defined(OMR_GC_VLHGC)
+	MM_CopyForwardStatsCore _copyForwardStats; /**< Per thread stats of the balanced collector copy-forward */
+#endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _concurrentScavengerSwitchCount; /**< local counter of cycle start and cycle end transitions */
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
@@ -400,6 +408,13 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Identify the allocation site of an allocation sampled by the allocation sampling profiler.
+	 * @param sizeInBytes Size of the sampled allocation
+	 * @return the language defined allocation site
+	 */
+	void *getAllocationSite(uintptr_t sizeInBytes) { return _delegate.getAllocationSite(sizeInBytes); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -646,6 +661,8 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytesRemaining(0)
+		,_allocationSamplingSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -698,6 +715,8 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytesRemaining(0)
+		,_allocationSamplingSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -28,6 +28,7 @@
 #include "omrmemcategories.h"
 #include "modronbase.h"
 
+#include "AllocationSamplingStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -236,6 +237,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	mixedObjectModel.tearDown(this);
 	indexableObjectModel.tearDown(this);
 
+	if (NULL != allocationSamplingStats) {
+		allocationSamplingStats->kill(env);
+		allocationSamplingStats = NULL;
+	}
+
 	if (NULL != collectorLanguageInterface) {
 		collectorLanguageInterface->kill(env);
 		collectorLanguageInterface = NULL;
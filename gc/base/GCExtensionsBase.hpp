@@ -37,6 +37,7 @@
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HugePageManager.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -47,6 +48,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSamplingStats;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -261,6 +263,10 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	MM_HugePageManager::HugePagePolicy hugePagePolicy; /**< how the heap, card table and mark map are backed by huge pages (see MM_HugePageManager) */
+	uintptr_t hugePageSize; /**< size in bytes of the huge pages hugePagePolicy applies to */
+	uintptr_t hugePageUsageSampleInterval; /**< number of cycles between samples of the huge page backing reported at cycle end (0 to sample it only once) */
+	MM_HugePageManager _hugePageManager; /**< applies hugePagePolicy and reports the resulting huge page backing */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -292,6 +298,10 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	bool allocationSamplingEnabled; /**< if true, sample allocations at TLH refills on a randomized byte interval and rank the sampled allocation sites */
+	uintptr_t allocationSamplingInterval; /**< mean number of bytes a thread allocates between two allocation samples */
+	uint32_t allocationSamplingMaxSites; /**< number of allocation sites accurately ranked by the allocation sampling profiler */
+	MM_AllocationSamplingStats *allocationSamplingStats; /**< allocation samples of all threads, merged at the start of each collection */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -320,6 +330,9 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	bool tlhSizeClassCache; /**< if true, allocations too large for the TLH are served from per thread size class caches */
+	uintptr_t tlhSizeClassCacheMaximumSize; /**< largest allocation served from the size class caches */
+	uintptr_t tlhSizeClassCacheBatchCount; /**< number of objects of the largest size of a class a size class cache refill makes room for */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 
@@ -329,6 +342,7 @@ public:
 
 	const char* gcModeString;
 	uintptr_t splitFreeListSplitAmount;
+	uintptr_t splitFreeListSplitAmountMaximum; /**< split amount a split free list pool may grow to as more threads allocate from it (0 keeps splitFreeListSplitAmount fixed) */
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
 
@@ -375,11 +389,13 @@ public:
 	bool useGCStartupHints; /**< Enabled/disable usage of heap sizing startup hints from Shared Cache */
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
+	bool workPacketStealing; /**< if true, stop-the-world marking distributes work packets over per-thread work-stealing deques instead of the shared packet lists (ignored if concurrent mark is enabled) */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDepth; /**< number of objects popped from the work stack and prefetched ahead of scanning in MM_MarkingScheme::completeScan(), zero (default) or one disables prefetching */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -434,6 +450,8 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< if true, the dispatcher chooses the thread count and work unit size of each parallel task from its estimated work */
+	uintptr_t adaptiveGCThreadingTargetTime; /**< the duration (in microseconds) adaptive GC threading aims for each parallel task to complete in */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -451,6 +469,9 @@ public:
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
+	bool scvTenureStrategyCopyCost; /**< Flag for enabling the Copy Cost scavenger tenure strategy (replaces the other strategies once it has sampled a scavenge, and sizes survivor space). */
+	double scvTenureCopyCostPrematureTenureWeight; /**< Cost of a byte tenured before it dies, relative to a byte copied, for the Copy Cost scavenger tenure strategy. */
+	double scvTenureCopyCostHistoryWeight; /**< Weight (from 0.0 to 1.0) of the history against the last scavenge in the survival rates of the Copy Cost scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -469,6 +490,9 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	uintptr_t scavengerPrefetchWindowSize; /**< number of pending slots whose referents are prefetched ahead of copy-forward when scanning objects, zero (default) or one disables prefetching */
+	bool scavengerNUMAAware; /**< if true, scavenger copy caches are carved from memory striped to the copying thread's NUMA node (requires numaGCThreadAffinity, ignored for concurrent scavenger or with fewer than two affinity leaders) */
+	bool scavengerWorkStealing; /**< if true, scan caches are distributed over per-thread work-stealing deques instead of the shared scan cache list (ignored for concurrent scavenger) */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -525,6 +549,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t partialCompactMoveBudget; /**< Target time in microseconds for moving objects during a partial compaction, 0 to always compact the whole heap. Only the move phase is bounded, fixup still walks the whole heap */
+	bool compactSlidingWindows; /**< Compute forwarding addresses with a prefix sum over per-block live bytes and slide every window in parallel, instead of evacuating sub areas */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -541,6 +567,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool concurrentCardTableSummary; /**< if true, the concurrent card table keeps a summary bit per cache line of cards so card cleaning can skip clean ranges */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -619,6 +646,9 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedGenerational; /**< if true, the segregated collector runs minor collections which only reclaim objects allocated since the previous collection */
+	uintptr_t segregatedMinorCollectionsPerMajor; /**< maximum number of consecutive minor collections before a full collection is forced (generational segregated only) */
+	bool segregatedLazySweep; /**< if true, small regions are left unswept after marking and are swept on demand by allocating threads, the GC threads sweep the rest at the start of the next collection */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -655,6 +685,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asynchronousLogging; /**< Enabled by -Xgc:asynchronousLogging. Record verbose:gc lines in a ring buffer and write them to the file from a background thread */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging. Like asynchronousLogging, but write the file in the binary format read by vgcdecode */
+	uintptr_t asynchronousLoggingBufferSize; /**< size in bytes of the ring buffer used by asynchronous verbose:gc logging */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -688,6 +721,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaGCThreadAffinity; /**< if true, GC threads (and the master thread, for the duration of each task) are bound to the NUMA affinity leader owning their block of slave IDs (see MM_NUMAManager::getAffinityLeaderIndexForGCThread) */
 
 	bool padToPageSize;
 	
@@ -723,6 +757,7 @@ public:
 	bool tarokTgcEnableRememberedSetDuplicateDetection; /** (TGC USE ONLY!) True if we want to enable duplicate card stats reported by TGC for RSCL */
 	bool tarokPGCShouldCopyForward; /**< True if we want to allow PGC increments to reclaim memory using copy-forward (default is true) */
 	bool tarokPGCShouldMarkCompact; /**< True if we want to allow PGC increments to reclaim memory using compact (default is true) and require a corresponding mark operation */
+	uintptr_t tarokTargetMaxPauseTime; /**< The soft pause time goal, in milliseconds, used to size the collection set of a partial collection */
 	MM_InterRegionRememberedSet* interRegionRememberedSet; /**< The remembered set abstraction to be used to track inter-region references found while processing this cycle */
 	bool tarokEnableStableRegionDetection; /**< Enable overflowing RSCSLs for stable regions */
 	double tarokDefragmentEmptinessThreshold; /**< Emptiness (freeAndDarkMatter/regionSize) for a region to be considered as a target for defragmentation (used for stable region detection and region de-fragmentation selection) */
@@ -789,6 +824,10 @@ public:
 	bool trackMutatorThreadCategory; /**< Whether we should switch thread categories for mutators doing GC work */
 
 	uintptr_t darkMatterSampleRate;/**< the weight of darkMatterSample for standard gc, default:32, if the weight = 0, disable darkMatterSampling */
+	bool vectorHeapMapScan; /**< if true, runs of empty or non-empty mark map slots are searched with SIMD kernels when the processor supports them */
+	bool releaseFreePagesAfterGlobalGC; /**< Enables decommitting tenure memory that stayed free over a whole global GC cycle at the end of each global GC, default is false */
+	uintptr_t releaseFreePagesGranuleSize; /**< Size of the heap granules tracked for releasing free pages after global GC (rounded up to the heap page size), default is 1MB */
+	uintptr_t releaseFreePagesMaximumPerGC; /**< Maximum number of bytes decommitted at the end of a single global GC, 0 for no limit, default is 64MB */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	uintptr_t idleMinimumFree;   /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
@@ -1358,6 +1397,10 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, hugePagePolicy(MM_HugePageManager::HUGE_PAGE_POLICY_DEFAULT)
+		, hugePageSize((uintptr_t)2 * 1024 * 1024)
+		, hugePageUsageSampleInterval(16)
+		, _hugePageManager()
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1381,6 +1424,10 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSamplingEnabled(false)
+		, allocationSamplingInterval(512 * 1024)
+		, allocationSamplingMaxSites(16)
+		, allocationSamplingStats(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1402,6 +1449,9 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhSizeClassCache(false)
+		, tlhSizeClassCacheMaximumSize(16384)
+		, tlhSizeClassCacheBatchCount(4)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
 		, allocationStats()
@@ -1409,6 +1459,7 @@ public:
 		, vmThreadAllocatedMost(NULL)
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
+		, splitFreeListSplitAmountMaximum(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
 		, largeObjectArea(false)
@@ -1443,10 +1494,12 @@ public:
 		, heapSizeStartupHintWeightNewValue((float)0.8)	
 		, useGCStartupHints(true)	
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
+		, workPacketStealing(false)
 		, packetListSplit(0)
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDepth(0)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1491,6 +1544,8 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingTargetTime(2000)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
@@ -1504,6 +1559,9 @@ public:
 		, scvTenureStrategyAdaptive(true)
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
+		, scvTenureStrategyCopyCost(false)
+		, scvTenureCopyCostPrematureTenureWeight(2.0)
+		, scvTenureCopyCostHistoryWeight(0.5)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1522,6 +1580,9 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, scavengerPrefetchWindowSize(0)
+		, scavengerNUMAAware(false)
+		, scavengerWorkStealing(false)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1566,6 +1627,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, partialCompactMoveBudget(0)
+		, compactSlidingWindows(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1580,6 +1643,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, concurrentCardTableSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1637,6 +1701,9 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedGenerational(false)
+		, segregatedMinorCollectionsPerMajor(8)
+		, segregatedLazySweep(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1664,6 +1731,9 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asynchronousLogging(false)
+		, binaryLogging(false)
+		, asynchronousLoggingBufferSize(1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1682,6 +1752,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaGCThreadAffinity(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
@@ -1714,6 +1785,7 @@ public:
 		, tarokTgcEnableRememberedSetDuplicateDetection(false)
 		, tarokPGCShouldCopyForward(true)
 		, tarokPGCShouldMarkCompact(false)
+		, tarokTargetMaxPauseTime(200)
 		, interRegionRememberedSet(NULL)
 		, tarokEnableStableRegionDetection(true)
 		, tarokDefragmentEmptinessThreshold(0.0)
@@ -1760,6 +1832,10 @@ public:
 		, referenceChainWalkerMarkMap(NULL)
 		, trackMutatorThreadCategory(false)
 		, darkMatterSampleRate(32)
+		, vectorHeapMapScan(true)
+		, releaseFreePagesAfterGlobalGC(false)
+		, releaseFreePagesGranuleSize(1024 * 1024)
+		, releaseFreePagesMaximumPerGC(64 * 1024 * 1024)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleMinimumFree(0)
 		, gcOnIdle(false)
@@ -58,7 +58,8 @@ MM_HeapMap::initialize(MM_EnvironmentBase *env)
 	uintptr_t heapMapSizeRequired = getMaximumHeapMapSize(env);
 	
 	MM_MemoryManager *memoryManager = _extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_heapMapMemoryHandle, _extensions->heapAlignment, heapMapSizeRequired)) {
+	uintptr_t alignment = _extensions->_hugePageManager.getReservationAlignment(_extensions->heapAlignment);
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_heapMapMemoryHandle, alignment, heapMapSizeRequired)) {
 		_heapMapBits = (uintptr_t *)memoryManager->getHeapBase(&_heapMapMemoryHandle);
 		_heapBase = _extensions->heap->getHeapBase();
 		_heapMapBaseDelta = (uintptr_t)_heapBase;
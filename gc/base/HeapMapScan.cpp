@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapMapScan.hpp"
+
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#define HEAP_MAP_SCAN_X86_KERNELS
+#include <immintrin.h>
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+/* Number of bytes of mark map examined per step by the vector kernels (two vectors for AVX2, four for SSE) */
+#define HEAP_MAP_SCAN_BLOCK_BYTES 64
+#define HEAP_MAP_SCAN_BLOCK_SLOTS (HEAP_MAP_SCAN_BLOCK_BYTES / sizeof(uintptr_t))
+
+static uintptr_t *
+findFirstNonEmptySlotScalar(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	while ((slotBase < slotTop) && (0 == *slotBase)) {
+		slotBase += 1;
+	}
+	return slotBase;
+}
+
+static uintptr_t *
+findFirstEmptySlotScalar(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	while ((slotBase < slotTop) && (0 != *slotBase)) {
+		slotBase += 1;
+	}
+	return slotBase;
+}
+
+#if defined(HEAP_MAP_SCAN_X86_KERNELS)
+/* The vector kernels skip whole blocks which do not contain the slot searched for, and leave
+ * the exact position within the block (and the tail of the range) to the scalar kernel.
+ */
+
+__attribute__((target("sse4.2")))
+static uintptr_t *
+findFirstNonEmptySlotSSE42(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	while ((uintptr_t)(slotTop - slotBase) >= HEAP_MAP_SCAN_BLOCK_SLOTS) {
+		const __m128i *block = (const __m128i *)slotBase;
+		__m128i bits = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(block), _mm_loadu_si128(block + 1)),
+				_mm_or_si128(_mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)));
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		slotBase += HEAP_MAP_SCAN_BLOCK_SLOTS;
+	}
+	return findFirstNonEmptySlotScalar(slotBase, slotTop);
+}
+
+__attribute__((target("sse4.2")))
+static uintptr_t *
+findFirstEmptySlotSSE42(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	const __m128i zero = _mm_setzero_si128();
+	while ((uintptr_t)(slotTop - slotBase) >= HEAP_MAP_SCAN_BLOCK_SLOTS) {
+		const __m128i *block = (const __m128i *)slotBase;
+#if defined(OMR_ENV_DATA64)
+		__m128i empty = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi64(_mm_loadu_si128(block), zero), _mm_cmpeq_epi64(_mm_loadu_si128(block + 1), zero)),
+				_mm_or_si128(_mm_cmpeq_epi64(_mm_loadu_si128(block + 2), zero), _mm_cmpeq_epi64(_mm_loadu_si128(block + 3), zero)));
+#else /* OMR_ENV_DATA64 */
+		__m128i empty = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block), zero), _mm_cmpeq_epi32(_mm_loadu_si128(block + 1), zero)),
+				_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(block + 2), zero), _mm_cmpeq_epi32(_mm_loadu_si128(block + 3), zero)));
+#endif /* OMR_ENV_DATA64 */
+		if (!_mm_testz_si128(empty, empty)) {
+			break;
+		}
+		slotBase += HEAP_MAP_SCAN_BLOCK_SLOTS;
+	}
+	return findFirstEmptySlotScalar(slotBase, slotTop);
+}
+
+__attribute__((target("avx2")))
+static uintptr_t *
+findFirstNonEmptySlotAVX2(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	while ((uintptr_t)(slotTop - slotBase) >= HEAP_MAP_SCAN_BLOCK_SLOTS) {
+		const __m256i *block = (const __m256i *)slotBase;
+		__m256i bits = _mm256_or_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1));
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		slotBase += HEAP_MAP_SCAN_BLOCK_SLOTS;
+	}
+	return findFirstNonEmptySlotScalar(slotBase, slotTop);
+}
+
+__attribute__((target("avx2")))
+static uintptr_t *
+findFirstEmptySlotAVX2(uintptr_t *slotBase, uintptr_t *slotTop)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	while ((uintptr_t)(slotTop - slotBase) >= HEAP_MAP_SCAN_BLOCK_SLOTS) {
+		const __m256i *block = (const __m256i *)slotBase;
+#if defined(OMR_ENV_DATA64)
+		__m256i empty = _mm256_or_si256(_mm256_cmpeq_epi64(_mm256_loadu_si256(block), zero), _mm256_cmpeq_epi64(_mm256_loadu_si256(block + 1), zero));
+#else /* OMR_ENV_DATA64 */
+		__m256i empty = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256(block), zero), _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 1), zero));
+#endif /* OMR_ENV_DATA64 */
+		if (!_mm256_testz_si256(empty, empty)) {
+			break;
+		}
+		slotBase += HEAP_MAP_SCAN_BLOCK_SLOTS;
+	}
+	return findFirstEmptySlotScalar(slotBase, slotTop);
+}
+#endif /* HEAP_MAP_SCAN_X86_KERNELS */
+
+MM_HeapMapScan::FindSlotFunction MM_HeapMapScan::_findFirstNonEmptySlot = findFirstNonEmptySlotScalar;
+MM_HeapMapScan::FindSlotFunction MM_HeapMapScan::_findFirstEmptySlot = findFirstEmptySlotScalar;
+MM_HeapMapScan::Kernel MM_HeapMapScan::_kernel = MM_HeapMapScan::kernelScalar;
+
+void
+MM_HeapMapScan::initialize(MM_GCExtensionsBase *extensions)
+{
+	selectKernel(extensions->vectorHeapMapScan ? kernelAVX2 : kernelScalar);
+}
+
+MM_HeapMapScan::Kernel
+MM_HeapMapScan::selectKernel(Kernel kernel)
+{
+#if defined(HEAP_MAP_SCAN_X86_KERNELS)
+	/* the processor (and OS, for the AVX state) support is queried from the compiler runtime */
+	__builtin_cpu_init();
+	if ((kernelAVX2 == kernel) && !__builtin_cpu_supports("avx2")) {
+		kernel = kernelSSE42;
+	}
+	if ((kernelSSE42 == kernel) && !__builtin_cpu_supports("sse4.2")) {
+		kernel = kernelScalar;
+	}
+
+	switch (kernel) {
+	case kernelAVX2:
+		_findFirstNonEmptySlot = findFirstNonEmptySlotAVX2;
+		_findFirstEmptySlot = findFirstEmptySlotAVX2;
+		break;
+	case kernelSSE42:
+		_findFirstNonEmptySlot = findFirstNonEmptySlotSSE42;
+		_findFirstEmptySlot = findFirstEmptySlotSSE42;
+		break;
+	default:
+		_findFirstNonEmptySlot = findFirstNonEmptySlotScalar;
+		_findFirstEmptySlot = findFirstEmptySlotScalar;
+		break;
+	}
+#else /* HEAP_MAP_SCAN_X86_KERNELS */
+	kernel = kernelScalar;
+#endif /* HEAP_MAP_SCAN_X86_KERNELS */
+
+	_kernel = kernel;
+	return kernel;
+}
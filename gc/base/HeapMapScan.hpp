@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_GCExtensionsBase;
+
+/* Number of slots checked inline before a run search is handed to the (vector) kernel */
+#define HEAP_MAP_SCAN_INLINE_SLOTS 4
+
+/**
+ * Kernels searching runs of empty (all bits clear) or non-empty mark map slots.
+ *
+ * The kernels look at a whole vector of slots per step. The best implementation supported by the
+ * processor (AVX2, SSE4.2 or scalar) is selected once at startup by initialize(); all implementations
+ * return identical results.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScan
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef uintptr_t *(*FindSlotFunction)(uintptr_t *slotBase, uintptr_t *slotTop);
+
+	/**
+	 * Processor specific kernel implementation
+	 */
+	enum Kernel {
+		kernelScalar = 0,
+		kernelSSE42,
+		kernelAVX2
+	};
+
+private:
+	static FindSlotFunction _findFirstNonEmptySlot; /**< kernel used for the non-inline part of findFirstNonEmptySlot() */
+	static FindSlotFunction _findFirstEmptySlot; /**< kernel used for the non-inline part of findFirstEmptySlot() */
+	static Kernel _kernel; /**< kernel currently selected */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Select the kernels for the current processor.
+	 * @param[in] extensions kernels other than the scalar one are only used if vectorHeapMapScan is set
+	 */
+	static void initialize(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Select a specific kernel, falling back to the scalar kernel if the processor does not support it.
+	 * @return the kernel selected
+	 */
+	static Kernel selectKernel(Kernel kernel);
+
+	MMINLINE static Kernel getKernel() { return _kernel; }
+
+	/**
+	 * Find the first slot with at least one bit set.
+	 * @param[in] slotBase first mark map slot to check
+	 * @param[in] slotTop end (exclusive) of the range to check
+	 * @return the first non-empty slot in [slotBase, slotTop), or slotTop if all are empty
+	 */
+	MMINLINE static uintptr_t *
+	findFirstNonEmptySlot(uintptr_t *slotBase, uintptr_t *slotTop)
+	{
+		/* most runs are short, so do not pay for a call before looking at the first few slots */
+		uintptr_t *inlineTop = (uintptr_t *)OMR_MIN((uintptr_t)slotTop, (uintptr_t)(slotBase + HEAP_MAP_SCAN_INLINE_SLOTS));
+		for (; slotBase < inlineTop; slotBase++) {
+			if (0 != *slotBase) {
+				return slotBase;
+			}
+		}
+		return (slotBase < slotTop) ? _findFirstNonEmptySlot(slotBase, slotTop) : slotTop;
+	}
+
+	/**
+	 * Find the first slot with no bit set.
+	 * @param[in] slotBase first mark map slot to check
+	 * @param[in] slotTop end (exclusive) of the range to check
+	 * @return the first empty slot in [slotBase, slotTop), or slotTop if none is empty
+	 */
+	MMINLINE static uintptr_t *
+	findFirstEmptySlot(uintptr_t *slotBase, uintptr_t *slotTop)
+	{
+		uintptr_t *inlineTop = (uintptr_t *)OMR_MIN((uintptr_t)slotTop, (uintptr_t)(slotBase + HEAP_MAP_SCAN_INLINE_SLOTS));
+		for (; slotBase < inlineTop; slotBase++) {
+			if (0 == *slotBase) {
+				return slotBase;
+			}
+		}
+		return (slotBase < slotTop) ? _findFirstEmptySlot(slotBase, slotTop) : slotTop;
+	}
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
@@ -80,6 +80,7 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* we need to ensure that we allocate the heap with region alignment since the region table requires that */
 	MM_HeapRegionManager* manager = getHeapRegionManager();
 	effectiveHeapAlignment = MM_Math::roundToCeiling(manager->getRegionSize(), effectiveHeapAlignment);
+	effectiveHeapAlignment = extensions->_hugePageManager.getReservationAlignment(effectiveHeapAlignment);
 
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 	bool created = false;
@@ -127,6 +128,8 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* The memory returned might be less than we asked for -- get the actual size */
 	_maximumMemorySize = memoryManager->getMaximumSize(&_vmemHandle);
 
+	extensions->_hugePageManager.registerMemory(MM_HugePageManager::STRUCTURE_HEAP, &_vmemHandle);
+
 	return true;
 }
 
@@ -140,6 +143,7 @@ MM_HeapVirtualMemory::tearDown(MM_EnvironmentBase* env)
 		manager->destroyRegionTable(env);
 	}
 
+	env->getExtensions()->_hugePageManager.unregisterMemory(MM_HugePageManager::STRUCTURE_HEAP, &_vmemHandle);
 	memoryManager->destroyVirtualMemoryForHeap(env, &_vmemHandle);
 
 	MM_Heap::tearDown(env);
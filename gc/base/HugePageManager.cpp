@@ -0,0 +1,383 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "HugePageManager.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "MemoryHandle.hpp"
+#include "MemoryManager.hpp"
+#include "ModronAssertions.h"
+
+#if defined(LINUX)
+#define HUGE_PAGE_MANAGER_MAPPINGS_FILE "/proc/self/smaps"
+#define HUGE_PAGE_MANAGER_READ_BUFFER_SIZE 4096
+
+/**
+ * Resident and huge page backed bytes of one mapping of /proc/self/smaps.
+ */
+struct MM_HugePageManager::MappingInfo {
+	uintptr_t base;
+	uintptr_t top;
+	uintptr_t residentBytes;
+	uintptr_t hugePageBytes;
+};
+
+/**
+ * Parse a number in the given base from the start of string, stopping at the first character that is not a digit.
+ */
+static uintptr_t
+parseNumber(const char *string, uintptr_t base, const char **end)
+{
+	uintptr_t result = 0;
+	const char *cursor = string;
+
+	for (;; cursor++) {
+		char c = *cursor;
+		uintptr_t digit = 0;
+		if (('0' <= c) && (c <= '9')) {
+			digit = (uintptr_t)(c - '0');
+		} else if ((16 == base) && ('a' <= c) && (c <= 'f')) {
+			digit = (uintptr_t)(c - 'a') + 10;
+		} else {
+			break;
+		}
+		result = (result * base) + digit;
+	}
+	*end = cursor;
+
+	return result;
+}
+
+/**
+ * Parse the value (in kB) of an smaps field line of the form "Name:   123 kB", returning it in bytes.
+ */
+static uintptr_t
+parseFieldBytes(const char *line)
+{
+	const char *cursor = strchr(line, ':');
+	uintptr_t result = 0;
+
+	if (NULL != cursor) {
+		cursor += 1;
+		while (' ' == *cursor) {
+			cursor += 1;
+		}
+		result = parseNumber(cursor, 10, &cursor) * 1024;
+	}
+
+	return result;
+}
+#endif /* defined(LINUX) */
+
+bool
+MM_HugePageManager::parsePolicy(const char *name, HugePagePolicy *policy)
+{
+	bool result = true;
+
+	if (0 == strcmp(name, "off")) {
+		*policy = HUGE_PAGE_POLICY_OFF;
+	} else if (0 == strcmp(name, "transparent")) {
+		*policy = HUGE_PAGE_POLICY_TRANSPARENT;
+	} else if (0 == strcmp(name, "explicit")) {
+		*policy = HUGE_PAGE_POLICY_EXPLICIT;
+	} else if (0 == strcmp(name, "default")) {
+		*policy = HUGE_PAGE_POLICY_DEFAULT;
+	} else {
+		result = false;
+	}
+
+	return result;
+}
+
+const char *
+MM_HugePageManager::getPolicyName(HugePagePolicy policy)
+{
+	switch (policy) {
+	case HUGE_PAGE_POLICY_OFF:
+		return "off";
+	case HUGE_PAGE_POLICY_TRANSPARENT:
+		return "transparent";
+	case HUGE_PAGE_POLICY_EXPLICIT:
+		return "explicit";
+	case HUGE_PAGE_POLICY_DEFAULT:
+	default:
+		return "default";
+	}
+}
+
+const char *
+MM_HugePageManager::getStructureName(Structure structure)
+{
+	switch (structure) {
+	case STRUCTURE_HEAP:
+		return "heap";
+	case STRUCTURE_CARD_TABLE:
+		return "card-table";
+	case STRUCTURE_MARK_MAP:
+		return "mark-map";
+	default:
+		return "unknown";
+	}
+}
+
+bool
+MM_HugePageManager::applyPolicy(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	uintptr_t *pageFlags = omrvmem_supported_page_flags();
+	bool result = true;
+
+	_effectivePolicy = extensions->hugePagePolicy;
+	_hugePageSize = extensions->hugePageSize;
+
+	switch (_effectivePolicy) {
+	case HUGE_PAGE_POLICY_DEFAULT:
+		break;
+	case HUGE_PAGE_POLICY_OFF:
+		extensions->requestedPageSize = pageSizes[0];
+		extensions->requestedPageFlags = pageFlags[0];
+		extensions->gcmetadataPageSize = pageSizes[0];
+		extensions->gcmetadataPageFlags = pageFlags[0];
+		/* The GC reservations are not advised for transparent huge pages (see getReservationOptions()). Memory
+		 * can still end up in transparent huge pages if the kernel applies them to all mappings. */
+		break;
+	case HUGE_PAGE_POLICY_TRANSPARENT:
+	case HUGE_PAGE_POLICY_EXPLICIT:
+		if ((0 == _hugePageSize) || (0 != (_hugePageSize & (_hugePageSize - 1))) || (_hugePageSize <= pageSizes[0])) {
+			result = false;
+			break;
+		}
+
+		if (HUGE_PAGE_POLICY_EXPLICIT == _effectivePolicy) {
+			uintptr_t index = 0;
+			while ((0 != pageSizes[index]) && (_hugePageSize != pageSizes[index])) {
+				index += 1;
+			}
+			if (0 != pageSizes[index]) {
+				extensions->requestedPageSize = pageSizes[index];
+				extensions->requestedPageFlags = pageFlags[index];
+				extensions->gcmetadataPageSize = pageSizes[index];
+				extensions->gcmetadataPageFlags = pageFlags[index];
+			} else {
+				/* no explicit pages of this size are configured, let the kernel back what it can */
+				_effectivePolicy = HUGE_PAGE_POLICY_TRANSPARENT;
+			}
+		}
+
+		if (HUGE_PAGE_POLICY_TRANSPARENT == _effectivePolicy) {
+			extensions->requestedPageSize = pageSizes[0];
+			extensions->requestedPageFlags = pageFlags[0];
+			extensions->gcmetadataPageSize = pageSizes[0];
+			extensions->gcmetadataPageFlags = pageFlags[0];
+		}
+		break;
+	default:
+		Assert_MM_unreachable();
+		break;
+	}
+
+	return result;
+}
+
+void
+MM_HugePageManager::registerMemory(Structure structure, MM_MemoryHandle *handle)
+{
+	Assert_MM_true(structure < STRUCTURE_COUNT);
+
+	for (uintptr_t i = 0; i < HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE; i++) {
+		if (NULL == _handles[structure][i]) {
+			_handles[structure][i] = handle;
+			break;
+		}
+	}
+}
+
+void
+MM_HugePageManager::unregisterMemory(Structure structure, MM_MemoryHandle *handle)
+{
+	Assert_MM_true(structure < STRUCTURE_COUNT);
+
+	for (uintptr_t i = 0; i < HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE; i++) {
+		if (handle == _handles[structure][i]) {
+			_handles[structure][i] = NULL;
+		}
+	}
+}
+
+void
+MM_HugePageManager::collectUsage(MM_EnvironmentBase *env, Usage usage[STRUCTURE_COUNT])
+{
+	MM_MemoryManager *memoryManager = env->getExtensions()->memoryManager;
+
+	for (uintptr_t structure = 0; structure < STRUCTURE_COUNT; structure++) {
+		usage[structure].reservedBytes = 0;
+		usage[structure].residentBytes = 0;
+		usage[structure].hugePageBytes = 0;
+		usage[structure].pageSize = 0;
+		for (uintptr_t i = 0; i < HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE; i++) {
+			MM_MemoryHandle *handle = _handles[structure][i];
+			if ((NULL != handle) && (NULL != memoryManager->getHeapBase(handle))) {
+				usage[structure].reservedBytes += memoryManager->getMaximumSize(handle);
+				usage[structure].pageSize = memoryManager->getPageSize(handle);
+			}
+		}
+	}
+
+	if (!collectMappingUsage(env, usage)) {
+		for (uintptr_t structure = 0; structure < STRUCTURE_COUNT; structure++) {
+			usage[structure].residentBytes = usage[structure].reservedBytes;
+			if ((0 != _hugePageSize) && (usage[structure].pageSize >= _hugePageSize)) {
+				usage[structure].hugePageBytes = usage[structure].reservedBytes;
+			}
+		}
+	}
+}
+
+void
+MM_HugePageManager::sampleUsage(MM_EnvironmentBase *env)
+{
+	uintptr_t sampleInterval = env->getExtensions()->hugePageUsageSampleInterval;
+
+	if (_usageSampled) {
+		_cyclesSinceSample += 1;
+	}
+	if (!_usageSampled || ((0 != sampleInterval) && (_cyclesSinceSample >= sampleInterval))) {
+		collectUsage(env, _sampledUsage);
+		_usageSampled = true;
+		_cyclesSinceSample = 0;
+	}
+}
+
+#if defined(LINUX)
+void
+MM_HugePageManager::attributeMapping(MM_EnvironmentBase *env, MappingInfo *mapping, Usage usage[STRUCTURE_COUNT])
+{
+	MM_MemoryManager *memoryManager = env->getExtensions()->memoryManager;
+
+	if (mapping->top > mapping->base) {
+		for (uintptr_t structure = 0; structure < STRUCTURE_COUNT; structure++) {
+			for (uintptr_t i = 0; i < HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE; i++) {
+				MM_MemoryHandle *handle = _handles[structure][i];
+				if ((NULL != handle) && (NULL != memoryManager->getHeapBase(handle))) {
+					uintptr_t base = OMR_MAX(mapping->base, (uintptr_t)memoryManager->getHeapBase(handle));
+					uintptr_t top = OMR_MIN(mapping->top, (uintptr_t)memoryManager->getHeapTop(handle));
+					if (top > base) {
+						double fraction = (double)(top - base) / (double)(mapping->top - mapping->base);
+						usage[structure].residentBytes += (uintptr_t)((double)mapping->residentBytes * fraction);
+						usage[structure].hugePageBytes += (uintptr_t)((double)mapping->hugePageBytes * fraction);
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_HugePageManager::parseMappingLine(MM_EnvironmentBase *env, const char *line, MappingInfo *mapping, Usage usage[STRUCTURE_COUNT])
+{
+	const char *firstSpace = strchr(line, ' ');
+
+	if ((NULL != firstSpace) && (firstSpace > line) && (':' != firstSpace[-1])) {
+		/* a mapping header "base-top perms offset device inode path" ends the previous mapping */
+		attributeMapping(env, mapping, usage);
+		const char *cursor = line;
+		mapping->base = parseNumber(cursor, 16, &cursor);
+		mapping->top = ('-' == *cursor) ? parseNumber(cursor + 1, 16, &cursor) : mapping->base;
+		mapping->residentBytes = 0;
+		mapping->hugePageBytes = 0;
+	} else if (0 == strncmp(line, "Rss:", 4)) {
+		mapping->residentBytes += parseFieldBytes(line);
+	} else if (0 == strncmp(line, "AnonHugePages:", 14)) {
+		mapping->hugePageBytes += parseFieldBytes(line);
+	} else if ((0 == strncmp(line, "Shared_Hugetlb:", 15)) || (0 == strncmp(line, "Private_Hugetlb:", 16))) {
+		/* hugetlbfs pages are not included in Rss */
+		uintptr_t bytes = parseFieldBytes(line);
+		mapping->residentBytes += bytes;
+		mapping->hugePageBytes += bytes;
+	}
+}
+#endif /* defined(LINUX) */
+
+bool
+MM_HugePageManager::collectMappingUsage(MM_EnvironmentBase *env, Usage usage[STRUCTURE_COUNT])
+{
+	bool result = false;
+#if defined(LINUX)
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	intptr_t fd = omrfile_open(HUGE_PAGE_MANAGER_MAPPINGS_FILE, EsOpenRead, 0);
+
+	if (-1 != fd) {
+		char buffer[HUGE_PAGE_MANAGER_READ_BUFFER_SIZE + 1];
+		uintptr_t bufferUsed = 0;
+		bool skipToEndOfLine = false;
+		MappingInfo mapping = { 0, 0, 0, 0 };
+		intptr_t bytesRead = 0;
+
+		while (0 < (bytesRead = omrfile_read(fd, buffer + bufferUsed, HUGE_PAGE_MANAGER_READ_BUFFER_SIZE - bufferUsed))) {
+			char *line = buffer;
+			char *bufferTop = buffer + bufferUsed + bytesRead;
+			char *lineEnd = NULL;
+
+			while (NULL != (lineEnd = (char *)memchr(line, '\n', bufferTop - line))) {
+				*lineEnd = '\0';
+				if (!skipToEndOfLine) {
+					parseMappingLine(env, line, &mapping, usage);
+				}
+				skipToEndOfLine = false;
+				line = lineEnd + 1;
+			}
+
+			bufferUsed = bufferTop - line;
+			if (HUGE_PAGE_MANAGER_READ_BUFFER_SIZE == bufferUsed) {
+				/* a line longer than the buffer (a header with a long path): the fields needed are at its start */
+				*bufferTop = '\0';
+				if (!skipToEndOfLine) {
+					parseMappingLine(env, buffer, &mapping, usage);
+				}
+				skipToEndOfLine = true;
+				bufferUsed = 0;
+			} else {
+				memmove(buffer, line, bufferUsed);
+			}
+		}
+
+		if ((0 < bufferUsed) && !skipToEndOfLine) {
+			buffer[bufferUsed] = '\0';
+			parseMappingLine(env, buffer, &mapping, usage);
+		}
+		attributeMapping(env, &mapping, usage);
+
+		omrfile_close(fd);
+		result = true;
+	}
+#endif /* defined(LINUX) */
+	return result;
+}
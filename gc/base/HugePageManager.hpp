@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HUGEPAGEMANAGER_HPP_)
+#define HUGEPAGEMANAGER_HPP_
+
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "Math.hpp"
+
+class MM_EnvironmentBase;
+class MM_MemoryHandle;
+
+/* Maximum number of memory handles tracked for one structure (a split heap reserves two) */
+#define HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE 4
+
+/**
+ * Applies the huge page policy to the page size and alignment parameters of the heap and the GC metadata,
+ * and reports how much of the heap, card table and mark map actually ended up backed by huge pages.
+ *
+ * Transparent huge pages are requested by the port library (madvise(MADV_HUGEPAGE) at reserve time), but the
+ * kernel only backs huge page aligned ranges. The transparent policy therefore aligns the reservations of the heap,
+ * the card table and the mark map (and so the region boundaries) to the huge page size. The explicit policy also
+ * reserves them with explicit (hugetlbfs) pages of the huge page size, and falls back to the transparent policy
+ * when the port library does not offer that size.
+ */
+class MM_HugePageManager
+{
+	/* Data Members */
+public:
+	enum HugePagePolicy {
+		HUGE_PAGE_POLICY_DEFAULT = 0, /**< page sizes and alignment are left as configured */
+		HUGE_PAGE_POLICY_OFF, /**< small pages only, transparent huge pages are not requested */
+		HUGE_PAGE_POLICY_TRANSPARENT, /**< small pages, aligned so the kernel can back them with transparent huge pages */
+		HUGE_PAGE_POLICY_EXPLICIT /**< explicit (hugetlbfs) pages of the huge page size */
+	};
+
+	enum Structure {
+		STRUCTURE_HEAP = 0,
+		STRUCTURE_CARD_TABLE,
+		STRUCTURE_MARK_MAP,
+		STRUCTURE_COUNT
+	};
+
+	/**
+	 * Huge page backing of one structure, summed over all the memory registered for it.
+	 */
+	struct Usage {
+		uintptr_t reservedBytes; /**< bytes of address space reserved */
+		uintptr_t residentBytes; /**< bytes backed by physical memory */
+		uintptr_t hugePageBytes; /**< resident bytes backed by transparent or explicit huge pages */
+		uintptr_t pageSize; /**< page size the memory was reserved with */
+	};
+protected:
+private:
+	struct MappingInfo;
+
+	HugePagePolicy _effectivePolicy; /**< the policy in effect (explicit falls back to transparent if the page size is not supported) */
+	uintptr_t _hugePageSize; /**< huge page size the policy was applied with */
+	MM_MemoryHandle *_handles[STRUCTURE_COUNT][HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE]; /**< memory registered for each structure */
+	Usage _sampledUsage[STRUCTURE_COUNT]; /**< usage as of the last sample (see sampleUsage()) */
+	bool _usageSampled; /**< true once _sampledUsage has been collected */
+	uintptr_t _cyclesSinceSample; /**< cycles ended since _sampledUsage was collected */
+
+	/* Member Functions */
+private:
+	/**
+	 * Add the resident and huge page backed bytes of the registered memory, as found in /proc/self/smaps, to usage.
+	 * Mappings that only partly overlap a structure are attributed proportionally.
+	 * @return true if the mappings could be read
+	 */
+	bool collectMappingUsage(MM_EnvironmentBase *env, Usage usage[STRUCTURE_COUNT]);
+
+	/**
+	 * Parse one line of /proc/self/smaps, attributing the current mapping to the structures it overlaps when the next one starts.
+	 */
+	void parseMappingLine(MM_EnvironmentBase *env, const char *line, MappingInfo *mapping, Usage usage[STRUCTURE_COUNT]);
+
+	void attributeMapping(MM_EnvironmentBase *env, MappingInfo *mapping, Usage usage[STRUCTURE_COUNT]);
+protected:
+public:
+	/**
+	 * Convert a policy name (off, transparent or explicit) to the policy.
+	 * @param name[in] the name of the policy
+	 * @param policy[out] the policy
+	 * @return true if the name is recognized
+	 */
+	static bool parsePolicy(const char *name, HugePagePolicy *policy);
+
+	static const char *getPolicyName(HugePagePolicy policy);
+
+	static const char *getStructureName(Structure structure);
+
+	/**
+	 * Apply extensions->hugePagePolicy to the requested heap and metadata page sizes.
+	 * Must be called before the region size is initialized and before any memory is reserved.
+	 * @param env[in] the current thread
+	 * @return false if extensions->hugePageSize is not a usable page size
+	 */
+	bool applyPolicy(MM_EnvironmentBase *env);
+
+	HugePagePolicy getEffectivePolicy() const { return _effectivePolicy; }
+
+	uintptr_t getHugePageSize() const { return _hugePageSize; }
+
+	/**
+	 * @return true if a policy other than the default is in effect, in which case the backing is reported
+	 */
+	bool isReportingEnabled() const { return HUGE_PAGE_POLICY_DEFAULT != _effectivePolicy; }
+
+	/**
+	 * @return true if reservations and region boundaries should be aligned to the huge page size
+	 */
+	bool isAlignmentRequired() const
+	{
+		return (HUGE_PAGE_POLICY_TRANSPARENT == _effectivePolicy) || (HUGE_PAGE_POLICY_EXPLICIT == _effectivePolicy);
+	}
+
+	/**
+	 * @return the port library vmem options to add to the reservations of the heap and GC metadata
+	 */
+	uintptr_t getReservationOptions() const
+	{
+		return (HUGE_PAGE_POLICY_OFF == _effectivePolicy) ? OMRPORT_VMEM_NO_ADVISE_HUGEPAGE : 0;
+	}
+
+	/**
+	 * @param alignment[in] the alignment a structure requires
+	 * @return the alignment to reserve the structure with, so that huge pages can back it from its base
+	 */
+	uintptr_t getReservationAlignment(uintptr_t alignment) const
+	{
+		return isAlignmentRequired() ? MM_Math::roundToCeiling(_hugePageSize, alignment) : alignment;
+	}
+
+	/**
+	 * Track the memory reserved for a structure. The handle must be unregistered before the memory is released.
+	 */
+	void registerMemory(Structure structure, MM_MemoryHandle *handle);
+
+	void unregisterMemory(Structure structure, MM_MemoryHandle *handle);
+
+	/**
+	 * Gather the huge page backing of every structure.
+	 * On platforms where the mappings cannot be inspected, memory reserved with pages of at least the huge
+	 * page size is reported as huge page backed and the resident size is not known (reported as reserved).
+	 * @param env[in] the current thread
+	 * @param usage[out] STRUCTURE_COUNT elements, indexed by Structure
+	 */
+	void collectUsage(MM_EnvironmentBase *env, Usage usage[STRUCTURE_COUNT]);
+
+	/**
+	 * Called at the end of every cycle. Collects the usage on the first call, and then again once
+	 * extensions->hugePageUsageSampleInterval cycles have ended since the last sample. Reading the mappings
+	 * is costly, so this must not be called while holding the verbose reporting lock.
+	 * @param env[in] the current thread
+	 */
+	void sampleUsage(MM_EnvironmentBase *env);
+
+	/**
+	 * @return STRUCTURE_COUNT elements, indexed by Structure, as of the last call to sampleUsage() that collected them
+	 */
+	const Usage *getSampledUsage() const { return _sampledUsage; }
+
+	/**
+	 * @return the number of cycles ended since the sampled usage was collected
+	 */
+	uintptr_t getCyclesSinceSample() const { return _cyclesSinceSample; }
+
+	/**
+	 * Create HugePageManager object.
+	 */
+	MM_HugePageManager()
+		: _effectivePolicy(HUGE_PAGE_POLICY_DEFAULT)
+		, _hugePageSize(0)
+		, _usageSampled(false)
+		, _cyclesSinceSample(0)
+	{
+		for (uintptr_t structure = 0; structure < STRUCTURE_COUNT; structure++) {
+			_sampledUsage[structure].reservedBytes = 0;
+			_sampledUsage[structure].residentBytes = 0;
+			_sampledUsage[structure].hugePageBytes = 0;
+			_sampledUsage[structure].pageSize = 0;
+			for (uintptr_t i = 0; i < HUGE_PAGE_MANAGER_HANDLES_PER_STRUCTURE; i++) {
+				_handles[structure][i] = NULL;
+			}
+		}
+	}
+};
+
+#endif /* HUGEPAGEMANAGER_HPP_ */
@@ -26,6 +26,8 @@
 
 #include <string.h>
 
+#include "AtomicOperations.hpp"
+
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -46,6 +48,13 @@
 #else
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "WorkPacketsStealing.hpp"
+#if defined(OMR_GC_VLHGC)
+#include "WorkPacketsBalanced.hpp"
+#endif /* defined(OMR_GC_VLHGC) */
+
+/* upper bound for the number of objects popped and prefetched ahead of scanning in completeScan() */
+#define MARKING_PREFETCH_DEPTH_MAXIMUM 16
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -90,6 +99,7 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 	if (!_markMap) {
 		goto error_no_memory;
 	}
+	_extensions->_hugePageManager.registerMemory(MM_HugePageManager::STRUCTURE_MARK_MAP, _markMap->getHeapMapMemoryHandle());
 
 	_workPackets = createWorkPackets(env);
 	if (NULL == _workPackets) {
@@ -109,6 +119,7 @@ void
 MM_MarkingScheme::tearDown(MM_EnvironmentBase *env)
 {
 	if (_markMap) {
+		_extensions->_hugePageManager.unregisterMemory(MM_HugePageManager::STRUCTURE_MARK_MAP, _markMap->getHeapMapMemoryHandle());
 		_markMap->kill(env);
 		_markMap = NULL;
 	}
@@ -174,6 +185,7 @@ MM_MarkingScheme::masterSetupForGC(MM_EnvironmentBase *env)
 {
 	/* Initialize the marking stack */
 	_workPackets->reset(env);
+	_prefetchDepth = OMR_MAX(OMR_MIN(_extensions->markingPrefetchDepth, (uintptr_t)MARKING_PREFETCH_DEPTH_MAXIMUM), 1);
 
 	_delegate.masterSetupForGC(env);
 }
@@ -190,6 +202,7 @@ MM_MarkingScheme::masterSetupForWalk(MM_EnvironmentBase *env)
 {
 	/* Initialize the marking stack */
 	_workPackets->reset(env);
+	_prefetchDepth = OMR_MAX(OMR_MIN(_extensions->markingPrefetchDepth, (uintptr_t)MARKING_PREFETCH_DEPTH_MAXIMUM), 1);
 
 	_delegate.masterSetupForWalk(env);
 }
@@ -205,6 +218,7 @@ MM_MarkingScheme::workerSetupForGC(MM_EnvironmentBase *env)
 {
 	env->_markStats.clear();
 	env->_workPacketStats.clear();
+	env->_rootScannerStats.clear();
 	env->_workStack.reset(env, _workPackets);
 	_delegate.workerSetupForGC(env);
 }
@@ -322,12 +336,65 @@ void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
 	do {
+		if (1 < _prefetchDepth) {
+			completeScanPrefetched(env);
+		} else {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
+void
+MM_MarkingScheme::completeScanPrefetched(MM_EnvironmentBase *env)
+{
+	omrobjectptr_t fifo[MARKING_PREFETCH_DEPTH_MAXIMUM];
+	uintptr_t depth = _prefetchDepth;
+	uintptr_t oldestIndex = 0;
+	uintptr_t pendingCount = 0;
+
+	Assert_MM_true((1 < depth) && (MARKING_PREFETCH_DEPTH_MAXIMUM >= depth));
+
+	for (;;) {
 		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
+		if (0 == pendingCount) {
+			/* nothing is held back, so this thread may wait for work (or for every thread to run out of work) */
+			objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+			if (NULL == objectPtr) {
+				break;
+			}
+		} else {
+			/* objects in the FIFO are invisible to other threads, never wait for work while holding them */
+			objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+		}
+
+		uintptr_t scanCount = 0;
+		if (NULL != objectPtr) {
+			MM_AtomicOperations::prefetch(objectPtr);
+			uintptr_t newestIndex = oldestIndex + pendingCount;
+			fifo[(newestIndex < depth) ? newestIndex : (newestIndex - depth)] = objectPtr;
+			pendingCount += 1;
+			/* scan the oldest object once the FIFO is full */
+			scanCount = (depth == pendingCount) ? 1 : 0;
+		} else {
+			/* no more work immediately available: drain the FIFO, scanning may produce more */
+			scanCount = pendingCount;
+		}
+
+		while (0 < scanCount) {
+			omrobjectptr_t oldestPtr = fifo[oldestIndex];
+			oldestIndex = ((oldestIndex + 1) == depth) ? 0 : (oldestIndex + 1);
+			pendingCount -= 1;
+			scanCount -= 1;
+			env->_markStats._bytesScanned += scanObject(env, oldestPtr);
 			env->_markStats._objectsScanned += 1;
 		}
-	} while (_workPackets->handleWorkPacketOverflow(env));
+	}
+
+	Assert_MM_true(0 == pendingCount);
 }
 
 /****************************************
@@ -403,6 +470,13 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 			workPackets = MM_WorkPacketsConcurrent::newInstance(env);
 #endif /* defined OMR_GC_MODRON_CONCURRENT_MARK */
 		}
+#if defined(OMR_GC_VLHGC)
+	} else if (_extensions->isVLHGC()) {
+		/* the balanced collector shares these packets with its copy-forward, which overflows them differently */
+		workPackets = MM_WorkPacketsBalanced::newInstance(env);
+#endif /* defined(OMR_GC_VLHGC) */
+	} else if (_extensions->workPacketStealing) {
+		workPackets = MM_WorkPacketsStealing::newInstance(env);
 	} else {
 		workPackets = MM_WorkPacketsStandard::newInstance(env);
 	}
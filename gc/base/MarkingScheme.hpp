@@ -56,6 +56,7 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	uintptr_t _prefetchDepth; /**< number of objects held in the prefetch FIFO of completeScan() for this cycle (sampled from markingPrefetchDepth), 1 means no prefetching */
 
 public:
 
@@ -76,6 +77,12 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Variant of the completeScan() work loop which pops up to _prefetchDepth objects ahead of scanning and
+	 * prefetches their headers, scanning the oldest popped object each time the FIFO is full.
+	 */
+	void completeScanPrefetched(MM_EnvironmentBase *env);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -308,6 +315,7 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _prefetchDepth(1)
 	{
 		_typeId = __FUNCTION__;
 	}
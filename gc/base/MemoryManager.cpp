@@ -66,7 +66,7 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 	MM_VirtualMemory* instance = NULL;
 	uintptr_t mode = (OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE);
-	uintptr_t options = 0;
+	uintptr_t options = extensions->_hugePageManager.getReservationOptions();
 	uint32_t memoryCategory = OMRMEM_CATEGORY_MM_RUNTIME_HEAP;
 
 	uintptr_t pageSize = extensions->requestedPageSize;
@@ -444,7 +444,7 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			void* preferredAddress = NULL;
 			void* ceiling = NULL;
 			uintptr_t mode = (OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE);
-			uintptr_t options = 0;
+			uintptr_t options = extensions->_hugePageManager.getReservationOptions();
 
 			uintptr_t pageSize = extensions->gcmetadataPageSize;
 			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
@@ -86,6 +86,7 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 	MM_HeapLinkedFreeHeader* candidateHintEntry = NULL;
 	uintptr_t candidateHintSize = 0;
 	uintptr_t currentFreeEntrySize = 0;
+	uintptr_t largestFreeEntryInList = 0;
 
 	MM_HeapLinkedFreeHeader* currentFreeEntry = _heapFreeLists[curFreeList]._freeList;
 	*previousFreeEntry = NULL;
@@ -107,6 +108,9 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 		if (currentFreeEntrySize > *largestFreeEntry) {
 			*largestFreeEntry = currentFreeEntrySize;
 		}
+		if (currentFreeEntrySize > largestFreeEntryInList) {
+			largestFreeEntryInList = currentFreeEntrySize;
+		}
 
 		if (sizeInBytesRequired <= currentFreeEntrySize) {
 			/* in first pass, we ignore reserved free entry */
@@ -134,6 +138,11 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 		currentFreeEntry = currentFreeEntry->getNext();
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > *previousFreeEntry));
 	}
+
+	if ((NULL == currentFreeEntry) && (NULL == allocateHintUsed)) {
+		/* the whole list was walked, so its size classes are known exactly up to the largest entry */
+		_heapFreeLists[curFreeList].trimSizeClasses(largestFreeEntryInList);
+	}
 	
 	_allocSearchCount += walkCountCurrentList;
 	
@@ -153,6 +162,8 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocate(MM_EnvironmentBase* env,
 	uintptr_t recycleEntrySize = 0;
 	void* addrBase = NULL;
 
+	recordAllocatingThread(env);
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -171,7 +182,13 @@ retry:
 	suggestedFreeList = curFreeList;
 
 	do {
-		if (NULL != _heapFreeLists[curFreeList]._freeList) {
+		if (skipReserved && (NULL != _heapFreeLists[curFreeList]._freeList) && !_heapFreeLists[curFreeList].mayContainEntryOfSize(sizeInBytesRequired)) {
+			/* every entry of this list is in a lower size class, skip it without taking the lock */
+			uintptr_t largestFreeEntryBound = MM_Bits::highestSetBit(sizeInBytesRequired) - 1;
+			if (largestFreeEntryBound > largestFreeEntry) {
+				largestFreeEntry = largestFreeEntryBound;
+			}
+		} else if (NULL != _heapFreeLists[curFreeList]._freeList) {
 			if (lockingRequired) {
 				_heapFreeLists[curFreeList]._lock.acquire();
 				_heapFreeLists[curFreeList]._timesLocked += 1;
@@ -309,6 +326,8 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* en
 	uintptr_t suggestedFreeList;
 	uintptr_t curFreeList;
 
+	recordAllocatingThread(env);
+
 	/* first pass iterating if skipReserved = true */
 	bool skipReserved = true;
 retry:
@@ -495,6 +514,10 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 		return;
 	}
 
+	/* All entries are on the first list, so this is where the split can change */
+	updateSplitAmount(env);
+	lastFreeListIndex = _heapFreeListCount - 1;
+
 	/* Free list splitting by equal memory size */
 	uintptr_t freeListSplitSize = _heapFreeLists[0]._freeSize / _heapFreeListCount;
 	uintptr_t currentFreeListIndex = 0;
@@ -529,6 +552,11 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 
 		_reservedFreeEntrySize = _sweepPoolState->_largestFreeEntry;
 
+		/* The size classes of each list are gathered from the chunks it is made of (recorded by the sweep threads) */
+		for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+			_heapFreeLists[i]._sizeClasses = 0;
+		}
+
 		/* Iterate over all the sweep chunks to find split candidates. */
 		uintptr_t processedChunkCount = 0;
 		for (chunk = sectioningIterator.nextChunk(); NULL != chunk; chunk = sectioningIterator.nextChunk()) {
@@ -537,12 +565,13 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 				break;
 			}
 			++processedChunkCount;
-			if ((currentFreeListIndex + 1) >= _heapFreeListCount) {
-				/* We have filled up all the free lists. */
-				break;
+			if (this != chunk->memoryPool) {
+				/* This chunk does not belong to this pool. */
+				continue;
 			}
-			if ((this != chunk->memoryPool) || (NULL == chunk->_splitCandidate)) {
-				/* This chunk is not a split candidate for this pool. */
+			if ((NULL == chunk->_splitCandidate) || ((currentFreeListIndex + 1) >= _heapFreeListCount)) {
+				/* This chunk is not a split candidate (or we have filled up all the free lists) - its entries stay on the current list. */
+				_heapFreeLists[currentFreeListIndex]._sizeClasses |= chunk->_freeEntrySizeClasses;
 				continue;
 			}
 
@@ -580,6 +609,7 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 				accumulatedFreeSize = chunk->_accumulatedFreeSize;
 				accumulatedFreeHoles = chunk->_accumulatedFreeHoles;
 			}
+			_heapFreeLists[currentFreeListIndex]._sizeClasses |= chunk->_freeEntrySizeClasses;
 		}
 
 		if (_heapFreeListCount == _reservedFreeListIndex) {
@@ -599,10 +629,12 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 
 		_heapFreeLists[0]._freeCount = 0;
 		_heapFreeLists[0]._freeSize = 0;
+		_heapFreeLists[0]._sizeClasses = 0;
 
 		while (NULL != currentFreeList) {
 			_heapFreeLists[currentFreeListIndex]._freeSize += currentFreeList->getSize();
 			_heapFreeLists[currentFreeListIndex]._freeCount += 1;
+			_heapFreeLists[currentFreeListIndex].addSizeClass(currentFreeList->getSize());
 
 			if (currentFreeList->getSize() > _reservedFreeEntrySize) {
 				_reservedFreeEntrySize = currentFreeList->getSize();
@@ -621,6 +653,7 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 				_heapFreeLists[currentFreeListIndex]._freeList = currentFreeList;
 				_heapFreeLists[currentFreeListIndex]._freeSize = 0;
 				_heapFreeLists[currentFreeListIndex]._freeCount = 0;
+				_heapFreeLists[currentFreeListIndex]._sizeClasses = 0;
 			}
 		}
 	}
@@ -645,6 +678,25 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 	}
 }
 
+void
+MM_MemoryPoolSplitAddressOrderedList::updateSplitAmount(MM_EnvironmentBase* env)
+{
+	uintptr_t allocatingThreadCount = MM_Bits::populationCount(_allocatingThreads);
+	_allocatingThreads = 0;
+
+	if (_heapFreeListCountExtended > _heapFreeListCountMinimum) {
+		uintptr_t splitAmount = (allocatingThreadCount + SPLIT_FREE_LIST_THREADS_PER_LIST - 1) / SPLIT_FREE_LIST_THREADS_PER_LIST;
+		splitAmount = OMR_MIN(OMR_MAX(splitAmount, _heapFreeListCountMinimum), _heapFreeListCountExtended);
+		if (splitAmount != _heapFreeListCount) {
+			/* lists that leave the active range are empty, the previous split has been collapsed into the first list */
+			for (uintptr_t i = 1; i < _heapFreeListCountExtended; ++i) {
+				Assert_MM_true(NULL == _heapFreeLists[i]._freeList);
+			}
+			_heapFreeListCount = splitAmount;
+		}
+	}
+}
+
 /**
  * Add the range of memory to the free list of the receiver.
  *
@@ -671,6 +723,9 @@ MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, u
 		return;
 	}
 
+	/* the new range may coalesce with a neighbour on any list */
+	invalidateSizeClasses();
+
 	MM_HeapLinkedFreeHeader** head = NULL;
 	uintptr_t curFreeListIndex = 0;
 	for (curFreeListIndex = 0; curFreeListIndex < _heapFreeListCount; ++curFreeListIndex) {
@@ -815,6 +870,9 @@ MM_MemoryPoolSplitAddressOrderedList::contractWithRange(MM_EnvironmentBase* env,
 		return NULL;
 	}
 
+	/* the entry the range is taken from may be left in a smaller size class */
+	invalidateSizeClasses();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	uintptr_t freeListIndex;
@@ -935,6 +993,8 @@ MM_MemoryPoolSplitAddressOrderedList::addFreeEntries(MM_EnvironmentBase* env,
 
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	invalidateSizeClasses();
+
 	MM_HeapLinkedFreeHeader* freeEntryToAdd = freeListHead;
 	while (freeEntryToAdd != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeEntryToAdd->getSize());
@@ -1071,6 +1131,9 @@ MM_MemoryPoolSplitAddressOrderedList::removeFreeEntriesWithinRange(MM_Environmen
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* entries straddling the range are trimmed into smaller size classes */
+	invalidateSizeClasses();
+
 	/* Find the first free entry, if any, within specified range */
 	uintptr_t currentFreeListIndex;
 	previousFreeEntry = NULL;
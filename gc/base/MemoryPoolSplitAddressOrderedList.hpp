@@ -31,6 +31,8 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolSplitAddressOrderedListBase.hpp"
@@ -53,6 +55,7 @@ private:
   	MM_HeapLinkedFreeHeader* _previousReservedFreeEntry;	/**< combination _previousReservedFreeEntry and _reservedFreeListIndex are used to identify or update the reservedFreeEntry */
  	uintptr_t _reservedFreeListIndex;		/**< the reservedFreeEntry is initialized only once in first pass iterating after sweep, used/updated only in second pass */
 	bool _reservedFreeEntryAvaliable;	/**< True if the reserved Free Entry can be used */
+	volatile uintptr_t _allocatingThreads; /**< one bit per (environment id modulo bits per slot) of the threads that allocated since the last rebuild */
 protected:
 public:
 	/*
@@ -143,6 +146,26 @@ private:
 	}
 
 	/* helpers for maintaining reserved free entry - end */
+
+	/**
+	 * Note the thread as allocating from the pool. The bit is only written the first time in a cycle, so
+	 * the word stays shared between the caches of the allocating threads.
+	 */
+	MMINLINE void recordAllocatingThread(MM_EnvironmentBase* env)
+	{
+		uintptr_t threadBit = ((uintptr_t)1) << (env->getEnvironmentId() % J9BITS_BITS_IN_SLOT);
+		uintptr_t oldValue = _allocatingThreads;
+		while ((0 == (oldValue & threadBit)) && (oldValue != MM_AtomicOperations::lockCompareExchange(&_allocatingThreads, oldValue, oldValue | threadBit))) {
+			oldValue = _allocatingThreads;
+		}
+	}
+
+	/**
+	 * Resize the split to the number of threads that allocated from the pool since the last rebuild, within
+	 * the split amount the pool was created with and splitFreeListSplitAmountMaximum. Must be called while all
+	 * free entries are on the first list.
+	 */
+	void updateSplitAmount(MM_EnvironmentBase* env);
 	
 protected:
 	virtual void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
@@ -178,8 +201,11 @@ public:
 		, _previousReservedFreeEntry((MM_HeapLinkedFreeHeader*) UDATA_MAX)
 		, _reservedFreeListIndex(splitAmount)
 		, _reservedFreeEntryAvaliable(false)
+		, _allocatingThreads(0)
 	{
 		_typeId = __FUNCTION__;
+		/* lists past _heapFreeListCount are kept empty until the split grows into them */
+		_heapFreeListCountExtended = OMR_MAX(splitAmount, env->getExtensions()->splitFreeListSplitAmountMaximum);
 	};
 
 	MM_MemoryPoolSplitAddressOrderedList(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, uintptr_t splitAmount, const char* name)
@@ -188,8 +214,10 @@ public:
 		, _previousReservedFreeEntry((MM_HeapLinkedFreeHeader*)UDATA_MAX)
 		, _reservedFreeListIndex(splitAmount)
 		, _reservedFreeEntryAvaliable(false)
+		, _allocatingThreads(0)
 	{
 		_typeId = __FUNCTION__;
+		_heapFreeListCountExtended = OMR_MAX(splitAmount, env->getExtensions()->splitFreeListSplitAmountMaximum);
 	};
 
 	/*
@@ -111,6 +111,7 @@ void J9ModronFreeList::reset()
 	_freeList = NULL;
 	_freeSize = 0;
 	_freeCount = 0;
+	_sizeClasses = UDATA_MAX;
 	_timesLocked = 0;
 	clearHints();
 }
@@ -141,11 +142,12 @@ MM_MemoryPoolSplitAddressOrderedListBase::initialize(MM_EnvironmentBase* env)
 	 */
 	_sweepPoolManager = extensions->sweepPoolManagerSmallObjectArea;
 
-	_currentThreadFreeList = (uintptr_t*)extensions->getForge()->allocate(sizeof(uintptr_t) * _heapFreeListCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	/* sized for the largest split the pool can grow to */
+	_currentThreadFreeList = (uintptr_t*)extensions->getForge()->allocate(sizeof(uintptr_t) * _heapFreeListCountExtended, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _currentThreadFreeList) {
 		return false;
 	} else {
-		for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+		for (uintptr_t i = 0; i < _heapFreeListCountExtended; ++i) {
 			_currentThreadFreeList[i] = 0;
 		}
 	}
@@ -501,6 +503,7 @@ MM_MemoryPoolSplitAddressOrderedListBase::recycleHeapChunk(MM_EnvironmentBase* e
 		} else {
 			_heapFreeLists[curFreeList]._freeList = (MM_HeapLinkedFreeHeader*)addrBase;
 		}
+		_heapFreeLists[curFreeList].addSizeClass((uintptr_t)addrTop - (uintptr_t)addrBase);
 
 		return true;
 	}
@@ -32,6 +32,7 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "Bits.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -47,6 +48,7 @@ public:
 
 	uintptr_t _freeSize;
 	uintptr_t _freeCount;
+	uintptr_t _sizeClasses; /**< bit i is set if the list may hold an entry whose highest size bit is i (UDATA_MAX when unknown), never missing a class present on the list */
 
 	/* Hint support */
 	struct J9ModronAllocateHint* _hintActive;
@@ -60,6 +62,40 @@ public:
 	void clearHints();
 	void reset();
 
+	/**
+	 * Record that an entry of the given size was put on the list (the lock must be held).
+	 */
+	MMINLINE void addSizeClass(uintptr_t freeEntrySize)
+	{
+		uintptr_t sizeClass = MM_Bits::highestSetBit(freeEntrySize);
+		if (0 == (_sizeClasses & sizeClass)) {
+			_sizeClasses |= sizeClass;
+		}
+	}
+
+	/**
+	 * Drop the size classes above the largest entry found by a walk of the whole list (the lock must be held).
+	 */
+	MMINLINE void trimSizeClasses(uintptr_t largestFreeEntrySize)
+	{
+		if (0 == largestFreeEntrySize) {
+			_sizeClasses = 0;
+		} else {
+			_sizeClasses &= (MM_Bits::highestSetBit(largestFreeEntrySize) << 1) - 1;
+		}
+	}
+
+	/**
+	 * May be called without holding the lock: classes are only cleared at times the list is not allocated from
+	 * or, under the lock, when they are known to be absent, and an entry only ever shrinks into a lower class
+	 * of an entry whose class is already recorded.
+	 * @return false if no entry on the list can satisfy a request of the given size
+	 */
+	MMINLINE bool mayContainEntryOfSize(uintptr_t sizeInBytesRequired)
+	{
+		return 0 != (_sizeClasses & ~(MM_Bits::highestSetBit(sizeInBytesRequired) - 1));
+	}
+
 	MMINLINE void addHint(MM_HeapLinkedFreeHeader* freeEntry, uintptr_t lookupSize)
 	{
 		/* Travel the list removing any hints that this new hint will override */
@@ -242,6 +278,7 @@ public:
 		, _timesLocked(0)
 		, _freeSize(0)
 		, _freeCount(0)
+		, _sizeClasses(UDATA_MAX)
 		, _hintActive(NULL)
 		, _hintInactive(NULL)
 		, _hintLru(0)
@@ -262,6 +299,7 @@ protected:
 	/* Basic free list support */
 	uintptr_t _heapFreeListCount;
 	uintptr_t _heapFreeListCountExtended;
+	uintptr_t _heapFreeListCountMinimum; /**< split amount the pool was created with, _heapFreeListCount never drops below it */
 	uintptr_t* _currentThreadFreeList;
 	J9ModronFreeList* _heapFreeLists;
 
@@ -308,6 +346,16 @@ protected:
 		}
 	}
 
+	/**
+	 * Forget the size classes of all lists, used after the lists were changed outside of allocation and rebuild.
+	 */
+	MMINLINE void invalidateSizeClasses()
+	{
+		for (uintptr_t i = 0; i < _heapFreeListCountExtended; ++i) {
+			_heapFreeLists[i]._sizeClasses = UDATA_MAX;
+		}
+	}
+
 	bool printFreeListValidity(MM_EnvironmentBase* env);
 public:
 	virtual void* allocateObject(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
@@ -368,6 +416,11 @@ public:
 	virtual uintptr_t getActualFreeMemorySize();
 	virtual uintptr_t getActualFreeEntryCount();
 
+	/**
+	 * @return the number of free lists the free entries are currently split across
+	 */
+	MMINLINE uintptr_t getFreeListCount() { return _heapFreeListCount; }
+
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
 	 */
@@ -375,6 +428,7 @@ public:
 		: MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		, _heapFreeListCount(splitAmount)
 		, _heapFreeListCountExtended(splitAmount)
+		, _heapFreeListCountMinimum(splitAmount)
 		, _currentThreadFreeList(0)
 		, _heapFreeLists(NULL)
 		, _largeObjectAllocateStatsForFreeList(NULL)
@@ -386,6 +440,7 @@ public:
 		: MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		, _heapFreeListCount(splitAmount)
 		, _heapFreeListCountExtended(splitAmount)
+		, _heapFreeListCountMinimum(splitAmount)
 		, _currentThreadFreeList(0)
 		, _heapFreeLists(NULL)
 		, _largeObjectAllocateStatsForFreeList(NULL)
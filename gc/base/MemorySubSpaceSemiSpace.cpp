@@ -773,9 +773,18 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 				_tiltedAverageBytesFlippedDelta);
 		}
 
+		/* The copy cost tenure strategy predicts the bytes flipped at the tenure age it chose for the next scavenge */
+		uintptr_t expectedBytesFlipped = _tiltedAverageBytesFlipped;
+		if (0 != extensions->scavengerStats._tenureDecisionAge) {
+			expectedBytesFlipped = extensions->scavengerStats._tenureDecisionSurvivorBytes;
+			if(debug) {
+				omrtty_printf("\ttenure age %zu predicted bytes flipped: %zu\n", extensions->scavengerStats._tenureDecisionAge, expectedBytesFlipped);
+			}
+		}
+
 		/* Calculate the desired survivor space ratio */
 		double survivorSizeAmplification = 1.04 + extensions->dispatcher->threadCount() / 100.0;
-		double desiredSurvivorSize = (_tiltedAverageBytesFlipped + _tiltedAverageBytesFlippedDelta) * survivorSizeAmplification;
+		double desiredSurvivorSize = (expectedBytesFlipped + _tiltedAverageBytesFlippedDelta) * survivorSizeAmplification;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		if (_extensions->isConcurrentScavengerEnabled()) {
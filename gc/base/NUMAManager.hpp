@@ -106,6 +106,24 @@ public:
 	 */
 	uintptr_t getAffinityLeaderCount() const;
 
+	/**
+	 * Map a GC thread to an affinity leader. Slave IDs are handed out to affinity leaders in contiguous blocks
+	 * so that threads which share a node also share adjacent IDs.
+	 * @param slaveID[in] The slave ID of the GC thread
+	 * @param threadCount[in] The maximum number of GC threads
+	 * @return The affinity leader index starting from 1 (as accepted by getJ9NodeNumber), or 0 if there are no affinity leaders
+	 */
+	uintptr_t getAffinityLeaderIndexForGCThread(uintptr_t slaveID, uintptr_t threadCount) const
+	{
+		uintptr_t affinityLeaderIndex = 0;
+
+		if ((0 < _affinityLeaderCount) && (slaveID < threadCount)) {
+			affinityLeaderIndex = ((slaveID * _affinityLeaderCount) / threadCount) + 1;
+		}
+
+		return affinityLeaderIndex;
+	}
+
 	/**
 	 * @return The highest j9NodeNumber of all NUMA nodes currently known to the receiver or 0 if NUMA is not enabled or available
 	 */
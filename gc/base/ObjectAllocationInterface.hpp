@@ -37,6 +37,7 @@
 #include "AllocationStats.hpp"
 
 class MM_AllocateDescription;
+class MM_AllocationSamplingStats;
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
 class MM_MemoryPool;
@@ -59,6 +60,7 @@ protected:
 	MM_EnvironmentBase *_owningEnv;  /**< The environment with which the receiver is associated */
 	MM_AllocationStats _stats; /**< Allocation statistics for this allocation interface. */
 	MM_FrequentObjectsStats* _frequentObjectsStats;
+	MM_AllocationSamplingStats *_allocationSamplingStats; /**< Allocation samples taken by the owning thread since the last collection */
 
 public:
 
@@ -88,6 +90,7 @@ protected:
 		_owningEnv(env)
 		,_stats()
 		,_frequentObjectsStats(NULL)
+		,_allocationSamplingStats(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -95,6 +98,7 @@ protected:
 public:
 	MM_AllocationStats* getAllocationStats() { return &_stats; }
 	MM_FrequentObjectsStats* getFrequentObjectsStats() { return _frequentObjectsStats; }
+	MM_AllocationSamplingStats *getAllocationSamplingStats() { return _allocationSamplingStats; }
 	MM_EnvironmentBase *getOwningEnv() { return _owningEnv; }
 
 	virtual void kill(MM_EnvironmentBase *env) = 0;
@@ -322,7 +322,7 @@ public:
 		return _delegate.initializeAllocation(env, allocatedBytes, allocateInitialization);
 	}
 
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	/**
 	 * Calculate the actual object size and the size adjusted to object alignment. The calculated object size
 	 * includes any expansion bytes allocated if the object will grow when moved.
@@ -337,7 +337,7 @@ public:
 	{
 		_delegate.calculateObjectDetailsForCopy(env, forwardedHeader, objectCopySizeInBytes, objectReserveSizeInBytes, hotFieldAlignmentDescriptor);
 	}
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
 	 * Set run-time object alignment and shift values in this object model and in the OMR VM struct. These
@@ -403,19 +403,19 @@ public:
 		bool result = false;
 		void *headerSlotPtr = getObjectHeaderSlotAddress((omrobjectptr_t)objectPtr);
 		if (compressObjectReferences()) {
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-			/* for ConcurrentScavenger, forwarded bit must be 0, otherwise it's a self-forwarded object */
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
+			/* with self-forwarding, forwarded bit must be 0, otherwise it's a self-forwarded object */
 			result = ((uint32_t)J9_GC_OBJ_HEAP_HOLE == (*(uint32_t*)headerSlotPtr & (uint32_t)(J9_GC_OBJ_HEAP_HOLE | OMR_FORWARDED_TAG)));
 #else
 			result = ((uint32_t)J9_GC_OBJ_HEAP_HOLE == (*(uint32_t*)headerSlotPtr & (uint32_t)J9_GC_OBJ_HEAP_HOLE));
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#endif /* defined(FORWARDEDHEADER_SELF_FORWARDING) */
 		} else {
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-			/* for ConcurrentScavenger, forwarded bit must be 0, otherwise it's a self-forwarded object */
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
+			/* with self-forwarding, forwarded bit must be 0, otherwise it's a self-forwarded object */
 			result = ((uintptr_t)J9_GC_OBJ_HEAP_HOLE == (*(uintptr_t*)headerSlotPtr & (uintptr_t)(J9_GC_OBJ_HEAP_HOLE | OMR_FORWARDED_TAG)));
 #else
 			result = ((uintptr_t)J9_GC_OBJ_HEAP_HOLE == (*(uintptr_t*)headerSlotPtr & (uintptr_t)J9_GC_OBJ_HEAP_HOLE));
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#endif /* defined(FORWARDEDHEADER_SELF_FORWARDING) */
 		}
 		return result;
 	}
@@ -806,7 +806,7 @@ public:
 		return result;
 	}
 
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	/**
 	 * Returns TRUE if the object referred to by the forwarded header is indexable.
 	 *
@@ -892,7 +892,7 @@ public:
 		uintptr_t age = objectAge << OMR_OBJECT_METADATA_AGE_SHIFT;
 		setObjectFlags(destinationObjectPtr, OMR_OBJECT_METADATA_AGE_MASK, age);
 	}
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
 	 * Constructor.
@@ -36,6 +36,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 #include "Task.hpp"
 
 #include "ParallelDispatcher.hpp"
@@ -52,6 +53,10 @@ typedef struct slaveThreadInfo {
 
 #define MINIMUM_HEAP_PER_THREAD (2*1024*1024)
 
+/* Number of work units an adapted task is split into per thread, so its threads can balance their work */
+#define ADAPTIVE_WORK_UNITS_PER_THREAD 16
+#define ADAPTIVE_WORK_RATE_HISTORY_WEIGHT ((float)0.5)
+
 uintptr_t
 dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 {
@@ -77,6 +82,10 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	/* Enviroment initialization specific for GC threads (after slave ID is set) */
 	env->initializeGCThread();
 
+	if (env->getExtensions()->numaGCThreadAffinity) {
+		dispatcher->bindGCThreadToNUMANode(env);
+	}
+
 	/* Signal that the thread was created succesfully */
 	slaveInfo->slaveFlags = SLAVE_INFO_FLAG_OK;
 
@@ -233,6 +242,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		forge->free(_threadTable);
 		_threadTable = NULL;
 	}
+	if(_masterThreadNUMANodes) {
+		forge->free(_masterThreadNUMANodes);
+		_masterThreadNUMANodes = NULL;
+	}
 
 	MM_Dispatcher::kill(env);
 }
@@ -270,6 +283,19 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	memset(_adaptiveTaskHistory, 0, sizeof(_adaptiveTaskHistory));
+
+	if (_extensions->numaGCThreadAffinity) {
+		/* room for every node the master thread might have affinity with when it is bound for a task */
+		_masterThreadNUMANodesSize = omrthread_numa_get_max_node();
+		if (0 < _masterThreadNUMANodesSize) {
+			_masterThreadNUMANodes = (uintptr_t *)forge->allocate(_masterThreadNUMANodesSize * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if(!_masterThreadNUMANodes) {
+				goto error_no_memory;
+			}
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -428,6 +454,9 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+	if (_extensions->adaptiveGCThreading && !_extensions->isMetronomeGC()) {
+		taskActiveThreadCount = adaptThreadCountForTask(env, task, taskActiveThreadCount);
+	}
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -463,6 +492,82 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 	return toReturn;
 }
 
+MM_ParallelDispatcher::AdaptiveTaskHistory *
+MM_ParallelDispatcher::findAdaptiveTaskHistory(uintptr_t vmStateID, bool allocate)
+{
+	for (uintptr_t i = 0; i < adaptive_task_history_size; i++) {
+		AdaptiveTaskHistory *history = &_adaptiveTaskHistory[i];
+		if (vmStateID == history->vmStateID) {
+			return history;
+		}
+		if (0 == history->vmStateID) {
+			/* entries are used in order, so there is no entry for this type of task yet */
+			if (allocate) {
+				history->vmStateID = vmStateID;
+				return history;
+			}
+			break;
+		}
+	}
+	return NULL;
+}
+
+uintptr_t
+MM_ParallelDispatcher::adaptThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
+{
+	uintptr_t adaptedThreadCount = threadCount;
+	uintptr_t workEstimate = task->getWorkEstimate(env);
+
+	_adaptiveTask = NULL;
+	if (0 != workEstimate) {
+		AdaptiveTaskHistory *history = findAdaptiveTaskHistory(task->getVMStateID(), true);
+		if (NULL != history) {
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			history->predictedTime = 0;
+			if (0.0f < history->workRate) {
+				/* assume the work is spread evenly over the threads, without synchronization cost beyond what
+				 * the measured work rate already includes
+				 */
+				float singleThreadTime = (float)workEstimate / history->workRate;
+				float requiredThreadCount = singleThreadTime / (float)_extensions->adaptiveGCThreadingTargetTime;
+				if (requiredThreadCount < (float)threadCount) {
+					adaptedThreadCount = (uintptr_t)requiredThreadCount + 1;
+				}
+				history->predictedTime = (uint64_t)(singleThreadTime / (float)adaptedThreadCount);
+			}
+			history->workEstimate = workEstimate;
+			history->threadCountAvailable = threadCount;
+			history->threadCount = adaptedThreadCount;
+			history->actualTime = 0;
+			/* only report the work unit size of the tasks which apply it */
+			uintptr_t workUnitSize = workEstimate / (adaptedThreadCount * ADAPTIVE_WORK_UNITS_PER_THREAD);
+			history->workUnitSize = task->setWorkUnitSize(env, workUnitSize) ? workUnitSize : 0;
+
+			_adaptiveTask = history;
+			_adaptiveTaskStartTime = omrtime_hires_clock();
+		}
+	}
+
+	return adaptedThreadCount;
+}
+
+void
+MM_ParallelDispatcher::recordAdaptiveTaskOutcome(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	AdaptiveTaskHistory *history = _adaptiveTask;
+	uint64_t actualTime = omrtime_hires_delta(_adaptiveTaskStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	float workRate = (float)history->workEstimate / ((float)OMR_MAX(actualTime, 1) * (float)history->threadCount);
+
+	history->actualTime = actualTime;
+	if (0.0f < history->workRate) {
+		history->workRate = MM_Math::weightedAverage(history->workRate, workRate, ADAPTIVE_WORK_RATE_HISTORY_WEIGHT);
+	} else {
+		history->workRate = workRate;
+	}
+	_adaptiveTask = NULL;
+}
+
 void
 MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
 {
@@ -483,10 +588,31 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	omrthread_monitor_exit(_slaveThreadMutex);
 }
 
+bool
+MM_ParallelDispatcher::bindGCThreadToNUMANode(MM_EnvironmentBase *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t affinityLeaderIndex = numaManager->getAffinityLeaderIndexForGCThread(env->getSlaveID(), threadCountMaximum());
+	uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(affinityLeaderIndex);
+	if (0 != j9NodeNumber) {
+		return env->setNumaAffinity(&j9NodeNumber, 1);
+	}
+	return false;
+}
+
 void
 MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 {
 	uintptr_t slaveID = env->getSlaveID();
+
+	if (_extensions->numaGCThreadAffinity && env->isMasterThread() && !useSeparateMasterThread()) {
+		/* the master is the thread which requested the GC, bind it like the slaves for the duration of the task only */
+		_masterThreadNUMANodeCount = _masterThreadNUMANodesSize;
+		if ((NULL == _masterThreadNUMANodes) || (0 != omrthread_numa_get_node_affinity(env->getOmrVMThread()->_os_thread, _masterThreadNUMANodes, &_masterThreadNUMANodeCount))) {
+			_masterThreadNUMANodeCount = 0;
+		}
+		_masterThreadNUMABound = bindGCThreadToNUMANode(env);
+	}
 	
 	env->resetWorkUnitIndex();
 	_statusTable[slaveID] = slave_status_active;
@@ -511,6 +637,16 @@ MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 {
+	if (NULL != _adaptiveTask) {
+		recordAdaptiveTaskOutcome(env);
+	}
+
+	if (_masterThreadNUMABound) {
+		/* restore the node affinity the master thread had before the task (no nodes restores the default affinity) */
+		omrthread_numa_set_node_affinity(env->getOmrVMThread()->_os_thread, _masterThreadNUMANodes, _masterThreadNUMANodeCount, 0);
+		_masterThreadNUMABound = false;
+	}
+
 	omrthread_monitor_enter(_slaveThreadMutex);
 	
 	_slaveThreadsReservedForGC = false;
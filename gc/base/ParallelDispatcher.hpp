@@ -45,7 +45,21 @@ class MM_ParallelDispatcher : public MM_Dispatcher
 	/*
 	 * Data members
 	 */
-private:
+public:
+	/**
+	 * The last adaptive choice made for a type of task, and its outcome (see MM_GCExtensionsBase::adaptiveGCThreading).
+	 */
+	struct AdaptiveTaskHistory {
+		uintptr_t vmStateID; /**< VM state ID of the tasks the entry describes, 0 if the entry is unused */
+		float workRate; /**< weighted average of the work (bytes) a thread completes per microsecond, 0 until measured */
+		uintptr_t workEstimate; /**< estimated work of the last dispatch */
+		uintptr_t threadCountAvailable; /**< number of threads the last dispatch could have used */
+		uintptr_t threadCount; /**< number of threads chosen for the last dispatch */
+		uintptr_t workUnitSize; /**< work unit size applied by the last dispatch, 0 if the task ignored the suggestion */
+		uint64_t predictedTime; /**< predicted duration of the last dispatch in microseconds, 0 if there was no prediction */
+		uint64_t actualTime; /**< duration of the last dispatch in microseconds */
+	};
+
 protected:
 	MM_GCExtensionsBase *_extensions;
 
@@ -81,6 +95,18 @@ protected:
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	enum {
+		adaptive_task_history_size = 8
+	};
+
+	AdaptiveTaskHistory _adaptiveTaskHistory[adaptive_task_history_size]; /**< adaptive GC threading history, one entry per type of task */
+	AdaptiveTaskHistory *_adaptiveTask; /**< history of the task being dispatched, NULL if its thread count was not adapted */
+	uint64_t _adaptiveTaskStartTime; /**< time (hi-res ticks) the dispatch of _adaptiveTask started */
+	uintptr_t *_masterThreadNUMANodes; /**< NUMA nodes the master thread had affinity with before the current task, see numaGCThreadAffinity */
+	uintptr_t _masterThreadNUMANodesSize; /**< capacity of _masterThreadNUMANodes (the highest NUMA node number) */
+	uintptr_t _masterThreadNUMANodeCount; /**< number of valid entries in _masterThreadNUMANodes (0 if the master thread had no node affinity) */
+	bool _masterThreadNUMABound; /**< true if the master thread was bound to the node of slave ID 0 for the current task */
+
 public:
 
 	/*
@@ -113,6 +139,29 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Reduce the thread count of a task to the fewest threads predicted to complete its estimated work
+	 * within MM_GCExtensionsBase::adaptiveGCThreadingTargetTime, and suggest the work unit size of the task.
+	 * The prediction uses the work rate measured by previous dispatches of the same type of task.
+	 * @param task the task about to be dispatched
+	 * @param threadCount the number of threads available to the task
+	 * @return the number of threads to dispatch the task with
+	 */
+	uintptr_t adaptThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount);
+
+	/**
+	 * Measure the duration of the task whose thread count was adapted, and update the work rate of its type.
+	 */
+	void recordAdaptiveTaskOutcome(MM_EnvironmentBase *env);
+
+	AdaptiveTaskHistory *findAdaptiveTaskHistory(uintptr_t vmStateID, bool allocate);
+
+	/**
+	 * Bind the calling GC thread to the NUMA node which owns its slave ID (no-op unless physical NUMA is enabled).
+	 * @return true if the thread was bound
+	 */
+	bool bindGCThreadToNUMANode(MM_EnvironmentBase *env);
 	
 public:
 	virtual bool startUpThreads();
@@ -124,6 +173,12 @@ public:
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
 	virtual void setThreadCount(uintptr_t threadCount);
 
+	/**
+	 * @param vmStateID VM state ID of a type of task
+	 * @return the adaptive GC threading history of the type of task, NULL if no dispatch of it was adapted
+	 */
+	MMINLINE AdaptiveTaskHistory *getAdaptiveTaskHistory(uintptr_t vmStateID) { return findAdaptiveTaskHistory(vmStateID, false); }
+
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
 	MMINLINE void * getSignalHandlerArg() {return _handler_arg;}
 
@@ -150,6 +205,12 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_adaptiveTask(NULL)
+		,_adaptiveTaskStartTime(0)
+		,_masterThreadNUMANodes(NULL)
+		,_masterThreadNUMANodesSize(0)
+		,_masterThreadNUMANodeCount(0)
+		,_masterThreadNUMABound(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -22,8 +22,10 @@
 
 #include "ParallelHeapWalker.hpp"
 
+#include "omrgcconsts.h"
 #include "ModronAssertions.h"
 
+#include "AtomicOperations.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ParallelTask.hpp"
 #include "Dispatcher.hpp"
@@ -34,6 +36,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +83,69 @@ public:
 	}
 };
 
+/* Upper bound of the chunk size of a chunked walk, which also bounds how far an increment overruns its time budget */
+#define PARALLEL_HEAP_WALK_CHUNK_SIZE_MAX (4 * 1024 * 1024)
+
+/**
+ * Task driving the phases of a chunked heap walk (see MM_ParallelHeapWalker::startIncrementalWalk()).
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_ParallelHeapWalker *_heapWalker;
+	MM_ParallelHeapWalkState *_state;
+	uint64_t _deadline; /**< hires clock value after which no more chunks are claimed, 0 for no limit */
+	bool _locateChunkBases; /**< find the first object of each chunk rather than walk the chunks */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/*
+	 * Create a ParallelObjectBatchDoTask object.
+	 */
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_ParallelHeapWalkState *state, uint64_t deadline, bool locateChunkBases)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _heapWalker(heapWalker)
+		, _state(state)
+		, _deadline(deadline)
+		, _locateChunkBases(locateChunkBases)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+MM_ParallelHeapWalkState *
+MM_ParallelHeapWalkState::newInstance(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData)
+{
+	MM_ParallelHeapWalkState *state = (MM_ParallelHeapWalkState *)env->getForge()->allocate(sizeof(MM_ParallelHeapWalkState), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != state) {
+		new(state) MM_ParallelHeapWalkState(function, userData);
+	}
+	return state;
+}
+
+void
+MM_ParallelHeapWalkState::kill(MM_EnvironmentBase *env)
+{
+	if (NULL != _chunks) {
+		env->getForge()->free(_chunks);
+		_chunks = NULL;
+	}
+	env->getForge()->free(this);
+}
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -158,6 +224,231 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * @return number of collections (of any kind) completed so far, used to detect that a walk went stale
+ */
+uintptr_t
+MM_ParallelHeapWalker::getGCCount(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t gcCount = extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	gcCount += extensions->scavengerStats._gcCount;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	return gcCount;
+}
+
+/**
+ * Split the regions selected by walkFlags into chunks. Without a usable mark map every region is a single
+ * chunk, since the first object of an arbitrary address range can not be found otherwise.
+ * Chunk bases are set to the chunk low address (region low address for the first chunk of a region) and
+ * tops to the chunk high address; locateChunkBases() and startIncrementalWalk() refine both.
+ * @return false if the chunk table could not be allocated
+ */
+bool
+MM_ParallelHeapWalker::buildChunkTable(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uintptr_t walkFlags, bool useMarkMap)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t typeFlags = 0;
+	if (walkFlags & J9_MU_WALK_NEW_AND_REMEMBERED_ONLY) {
+		typeFlags |= MEMORY_TYPE_NEW;
+	}
+
+	uintptr_t chunkSize = UDATA_MAX;
+	if (useMarkMap) {
+		uintptr_t heapChunkFactor = extensions->dispatcher->threadCount() * 8;
+		chunkSize = OMR_MIN(extensions->heap->getMemorySize() / heapChunkFactor, PARALLEL_HEAP_WALK_CHUNK_SIZE_MAX);
+		chunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, OMR_MAX(chunkSize, 1));
+	}
+
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+
+	uintptr_t chunkCount = 0;
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator countIterator(regionManager);
+	while (NULL != (region = countIterator.nextRegion())) {
+		if (typeFlags == (region->getTypeFlags() & typeFlags)) {
+			uintptr_t regionSize = region->getSize();
+			chunkCount += (regionSize / chunkSize) + ((0 == (regionSize % chunkSize)) ? 0 : 1);
+		}
+	}
+
+	bool result = true;
+	if (0 != chunkCount) {
+		state->_chunks = (MM_ParallelHeapWalkState::Chunk *)env->getForge()->allocate(sizeof(MM_ParallelHeapWalkState::Chunk) * chunkCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == state->_chunks) {
+			result = false;
+		} else {
+			MM_ParallelHeapWalkState::Chunk *chunk = state->_chunks;
+			GC_HeapRegionIterator regionIterator(regionManager);
+			while (NULL != (region = regionIterator.nextRegion())) {
+				if (typeFlags == (region->getTypeFlags() & typeFlags)) {
+					uintptr_t chunkBase = (uintptr_t)region->getLowAddress();
+					uintptr_t regionTop = (uintptr_t)region->getHighAddress();
+					while (chunkBase < regionTop) {
+						uintptr_t chunkTop = chunkBase + OMR_MIN(chunkSize, regionTop - chunkBase);
+						chunk->_region = region;
+						chunk->_base = (void *)chunkBase;
+						chunk->_top = (void *)chunkTop;
+						chunk += 1;
+						chunkBase = chunkTop;
+					}
+				}
+			}
+			Assert_MM_true(chunk == (state->_chunks + chunkCount));
+			state->_chunkCount = chunkCount;
+		}
+	}
+
+	regionManager->unlock();
+	return result;
+}
+
+/**
+ * Replace the base of every chunk that does not start a region with its first marked object (or NULL if it
+ * has none). Called in parallel by all threads of the task.
+ */
+void
+MM_ParallelHeapWalker::locateChunkBases(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state)
+{
+	MM_HeapMapIterator markedObjectIterator(env->getExtensions());
+
+	for (uintptr_t i = 0; i < state->_chunkCount; i++) {
+		MM_ParallelHeapWalkState::Chunk *chunk = &state->_chunks[i];
+		if (chunk->_base != chunk->_region->getLowAddress()) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				markedObjectIterator.reset(_markMap, (uintptr_t *)chunk->_base, (uintptr_t *)chunk->_top);
+				chunk->_base = (void *)markedObjectIterator.nextObject();
+			}
+		}
+	}
+}
+
+/**
+ * Claim and walk chunks until none are left or the deadline has passed. Called in parallel by all threads
+ * of the task. Every thread claims at least one chunk before checking the deadline, so each increment makes
+ * progress even when the budget is smaller than the time needed to walk a single chunk. Chunks are claimed
+ * in index order, so the claimed chunks always form a prefix of the table and the walk resumes at
+ * _nextChunkIndex in the next increment.
+ */
+void
+MM_ParallelHeapWalker::walkChunks(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uint64_t deadline)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	omrobjectptr_t batch[OMR_HEAP_WALK_BATCH_SIZE];
+	uintptr_t objectsWalked = 0;
+
+	do {
+		uintptr_t chunkIndex = MM_AtomicOperations::add(&state->_nextChunkIndex, 1) - 1;
+		if (chunkIndex >= state->_chunkCount) {
+			break;
+		}
+
+		MM_ParallelHeapWalkState::Chunk *chunk = &state->_chunks[chunkIndex];
+		if (NULL != chunk->_base) {
+			GC_ObjectHeapBufferedIterator objectIterator(extensions, chunk->_region, chunk->_base, chunk->_top);
+			uintptr_t batchCount = 0;
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = objectIterator.nextObject())) {
+				batch[batchCount] = object;
+				batchCount += 1;
+				if (OMR_HEAP_WALK_BATCH_SIZE == batchCount) {
+					state->_function(omrVMThread, chunk->_region, batch, batchCount, state->_userData);
+					objectsWalked += batchCount;
+					batchCount = 0;
+				}
+			}
+			if (0 != batchCount) {
+				state->_function(omrVMThread, chunk->_region, batch, batchCount, state->_userData);
+				objectsWalked += batchCount;
+			}
+		}
+	} while ((0 == deadline) || (omrtime_hires_clock() < deadline));
+
+	MM_AtomicOperations::add(&state->_objectsWalked, objectsWalked);
+}
+
+MM_ParallelHeapWalkState *
+MM_ParallelHeapWalker::startIncrementalWalk(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	bool useMarkMap = _markMap->isMarkMapValid();
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+		useMarkMap = true;
+	}
+
+	MM_ParallelHeapWalkState *state = MM_ParallelHeapWalkState::newInstance(env, function, userData);
+	if (NULL != state) {
+		if (!buildChunkTable(env, state, walkFlags, useMarkMap)) {
+			state->kill(env);
+			return NULL;
+		}
+
+		if (useMarkMap && (0 != state->_chunkCount)) {
+			MM_ParallelObjectBatchDoTask locateTask(env, this, state, 0, true);
+			env->getExtensions()->dispatcher->run(env, &locateTask);
+		}
+
+		/* each chunk walks up to the first object of the next non-empty chunk of its region */
+		void *nextBase = NULL;
+		for (uintptr_t i = state->_chunkCount; i > 0; i--) {
+			MM_ParallelHeapWalkState::Chunk *chunk = &state->_chunks[i - 1];
+			if ((i == state->_chunkCount) || (chunk->_region != state->_chunks[i]._region)) {
+				nextBase = chunk->_region->getHighAddress();
+			}
+			chunk->_top = nextBase;
+			if (NULL != chunk->_base) {
+				nextBase = chunk->_base;
+			}
+		}
+
+		state->_gcCount = getGCCount(env);
+	}
+
+	return state;
+}
+
+MM_ParallelHeapWalker::WalkResult
+MM_ParallelHeapWalker::walkIncrement(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uint64_t timeBudget)
+{
+	if (state->_gcCount != getGCCount(env)) {
+		return walkInvalidated;
+	}
+
+	if (!state->isComplete()) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		/* caches handed out since the last increment have to be made walkable again */
+		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+		uint64_t deadline = 0;
+		if (0 != timeBudget) {
+			deadline = omrtime_hires_clock() + ((timeBudget * omrtime_hires_frequency()) / 1000000);
+		}
+		state->_incrementCount += 1;
+		MM_ParallelObjectBatchDoTask walkTask(env, this, state, deadline, false);
+		env->getExtensions()->dispatcher->run(env, &walkTask);
+	}
+
+	return state->isComplete() ? walkComplete : walkIncomplete;
+}
+
+bool
+MM_ParallelHeapWalker::allObjectsDoBatched(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	MM_ParallelHeapWalkState *state = startIncrementalWalk(env, function, userData, walkFlags, prepareHeapForWalk);
+	if (NULL == state) {
+		return false;
+	}
+	WalkResult result = walkIncrement(env, state, 0);
+	Assert_MM_true(walkComplete == result);
+	state->kill(env);
+	return true;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +457,13 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	if (_locateChunkBases) {
+		_heapWalker->locateChunkBases(env, _state);
+	} else {
+		_heapWalker->walkChunks(env, _state, _deadline);
+	}
+}
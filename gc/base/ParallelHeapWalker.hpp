@@ -25,13 +25,93 @@
 
 #include "omr.h"
 #include "omrcfg.h"
+#include "modronbase.h"
 
 #include "HeapWalker.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/**
+ * Callback receiving a batch of objects found by a chunked heap walk. All objects of a batch lie in the
+ * same region. Batches are delivered concurrently from several GC threads.
+ */
+typedef void (*MM_HeapWalkerObjectBatchFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t *, uintptr_t, void *);
+
+/* Maximum number of objects delivered to a MM_HeapWalkerObjectBatchFunc at once */
+#define OMR_HEAP_WALK_BATCH_SIZE 256
+
+/**
+ * State of a chunked (and possibly incremental) parallel heap walk.
+ *
+ * The walked regions are split into chunks when the walk starts and the first object of every chunk is
+ * located through the mark map, so later increments do not depend on the mark map any more. The walk stays
+ * valid as long as no collection moves or frees objects; objects allocated between increments may or may
+ * not be reported.
+ * @see MM_ParallelHeapWalker::startIncrementalWalk()
+ */
+class MM_ParallelHeapWalkState : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct Chunk {
+		MM_HeapRegionDescriptor *_region; /**< region the chunk belongs to */
+		void *_base; /**< first object to walk, NULL if the chunk contains no object start */
+		void *_top; /**< walk objects starting below this address */
+	};
+
+	MM_HeapWalkerObjectBatchFunc _function;
+	void *_userData;
+	Chunk *_chunks; /**< chunk table, _chunkCount entries in address order */
+	uintptr_t _chunkCount;
+	volatile uintptr_t _nextChunkIndex; /**< chunks below this index have been claimed by a walking thread */
+	uintptr_t _gcCount; /**< collection count when the walk was started */
+	volatile uintptr_t _objectsWalked;
+	uintptr_t _incrementCount;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	static MM_ParallelHeapWalkState *newInstance(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MMINLINE bool isComplete() { return _nextChunkIndex >= _chunkCount; }
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+	MMINLINE uintptr_t getChunksClaimed() { return OMR_MIN(_nextChunkIndex, _chunkCount); }
+	MMINLINE uintptr_t getObjectsWalked() { return _objectsWalked; }
+	MMINLINE uintptr_t getIncrementCount() { return _incrementCount; }
+
+	MM_ParallelHeapWalkState(MM_HeapWalkerObjectBatchFunc function, void *userData)
+		: MM_BaseVirtual()
+		, _function(function)
+		, _userData(userData)
+		, _chunks(NULL)
+		, _chunkCount(0)
+		, _nextChunkIndex(0)
+		, _gcCount(0)
+		, _objectsWalked(0)
+		, _incrementCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Friends
+	 */
+	friend class MM_ParallelHeapWalker;
+	friend class MM_ParallelObjectBatchDoTask;
+};
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -42,11 +122,23 @@ private:
 	MM_ParallelGlobalGC *_globalCollector;
 protected:
 public:
-	
+	/**
+	 * Result of MM_ParallelHeapWalker::walkIncrement()
+	 */
+	enum WalkResult {
+		walkComplete = 0, /**< every chunk has been walked, the state can be killed */
+		walkIncomplete, /**< the time budget expired before every chunk was walked */
+		walkInvalidated /**< a collection ran since the walk started, the walk has to be started over */
+	};
+
 	/*
 	 * Function members
 	 */
 private:
+	uintptr_t getGCCount(MM_EnvironmentBase *env);
+	bool buildChunkTable(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uintptr_t walkFlags, bool useMarkMap);
+	void locateChunkBases(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state);
+	void walkChunks(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uint64_t deadline);
 protected:
 public:	
 	/**
@@ -61,6 +153,33 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Start a chunked walk of all objects of the heap. Nothing is walked until walkIncrement() is called.
+	 * The caller must have exclusive access to the heap for this call and for every increment.
+	 * @param function[in] callback receiving batches of objects, called from GC threads in parallel
+	 * @param userData[in] passed through to function
+	 * @param walkFlags[in] J9_MU_WALK_NEW_AND_REMEMBERED_ONLY restricts the walk to new space
+	 * @param prepareHeapForWalk[in] mark the heap first so that it can be split into chunks for parallelism
+	 * (otherwise regions are only split when the mark map is valid)
+	 * @return the walk state or NULL if it could not be allocated
+	 */
+	MM_ParallelHeapWalkState *startIncrementalWalk(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
+	/**
+	 * Walk chunks of an incremental walk in parallel until all chunks are walked or the time budget expires.
+	 * The budget is checked between chunks, so an increment may overrun it by the time needed to walk a chunk.
+	 * @param timeBudget[in] budget of this increment in microseconds, 0 for no limit
+	 * @return walkComplete, walkIncomplete or walkInvalidated
+	 */
+	WalkResult walkIncrement(MM_EnvironmentBase *env, MM_ParallelHeapWalkState *state, uint64_t timeBudget);
+
+	/**
+	 * Walk through all objects of the heap in parallel, delivering them to the provided function in batches
+	 * of at most OMR_HEAP_WALK_BATCH_SIZE objects.
+	 * @return false if the walk state could not be allocated
+	 */
+	bool allObjectsDoBatched(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +204,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectBatchDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
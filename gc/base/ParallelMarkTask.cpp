@@ -30,6 +30,8 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "MarkingScheme.hpp"
 #include "WorkStack.hpp"
 
@@ -40,6 +42,23 @@ MM_ParallelMarkTask::getVMStateID()
 	return OMRVMSTATE_GC_MARK;
 }
 
+uintptr_t
+MM_ParallelMarkTask::getWorkEstimate(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t lastGlobalGCFreeBytes = extensions->getLastGlobalGCFreeBytes();
+	uintptr_t workEstimate = 0;
+
+	/* the live set left by the previous global collection (collectors which do not record it get no estimate) */
+	if (0 != lastGlobalGCFreeBytes) {
+		uintptr_t oldHeapSize = extensions->heap->getActiveMemorySize(MEMORY_TYPE_OLD);
+		if (oldHeapSize > lastGlobalGCFreeBytes) {
+			workEstimate = oldHeapSize - lastGlobalGCFreeBytes;
+		}
+	}
+	return workEstimate;
+}
+
 void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
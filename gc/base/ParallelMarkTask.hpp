@@ -51,6 +51,12 @@ private:
 	
 public:
 	virtual uintptr_t getVMStateID();
+
+	/**
+	 * Estimate the marking work from the live set of the previous global collection.
+	 * @see MM_Task::getWorkEstimate
+	 */
+	virtual uintptr_t getWorkEstimate(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "OMRVMThreadListIterator.hpp"
+#include "RootScannerStats.hpp"
+#include "Task.hpp"
+
+#include "ParallelRootScanner.hpp"
+
+MM_ParallelRootScanner::MM_ParallelRootScanner(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _scanningEntity(RootScannerEntity_None)
+	, _scanningStartTime(0)
+	, _extensions(env->getExtensions())
+	, _statsEnabled(env->getExtensions()->rootScannerStatsEnabled)
+	, _threadsPerUnit(DEFAULT_THREADS_PER_UNIT)
+	, _entriesPerUnit(DEFAULT_ENTRIES_PER_UNIT)
+{
+	_typeId = __FUNCTION__;
+}
+
+void
+MM_ParallelRootScanner::doThread(MM_EnvironmentBase *env, OMR_VMThread *walkThread)
+{
+	Assert_MM_unreachable();
+}
+
+void
+MM_ParallelRootScanner::doHashTableEntry(MM_EnvironmentBase *env, RootScannerEntity entity, void *entry)
+{
+	Assert_MM_unreachable();
+}
+
+bool
+MM_ParallelRootScanner::scanUnitStarted(MM_EnvironmentBase *env, RootScannerEntity entity)
+{
+	/* roots may also be scanned outside of a task, e.g. by a mutator paying concurrent mark tax */
+	bool claimed = (NULL == env->_currentTask) || J9MODRON_HANDLE_NEXT_WORK_UNIT(env);
+	if (claimed) {
+		reportScanningStarted(env, entity);
+	}
+	return claimed;
+}
+
+void
+MM_ParallelRootScanner::scanUnitEnded(MM_EnvironmentBase *env)
+{
+	reportScanningEnded(env);
+}
+
+void
+MM_ParallelRootScanner::reportScanningStarted(MM_EnvironmentBase *env, RootScannerEntity entity)
+{
+	if (_statsEnabled) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		Assert_MM_true(RootScannerEntity_None == _scanningEntity);
+		_scanningEntity = entity;
+		_scanningStartTime = omrtime_hires_clock();
+	}
+}
+
+void
+MM_ParallelRootScanner::reportScanningEnded(MM_EnvironmentBase *env)
+{
+	if (_statsEnabled) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_RootScannerStats *stats = &env->_rootScannerStats;
+		uint64_t endTime = omrtime_hires_clock();
+		/* a zero scan time means the entity was not scanned, even on a coarse clock */
+		uint64_t scanTime = OMR_MAX(endTime - _scanningStartTime, 1);
+
+		Assert_MM_true(RootScannerEntity_None != _scanningEntity);
+		stats->_entityScanTime[_scanningEntity] += scanTime;
+		if (scanTime > stats->_maxIncrementTime) {
+			stats->_maxIncrementTime = scanTime;
+			stats->_maxIncrementEntity = _scanningEntity;
+		}
+		stats->_statsUsed = true;
+		_scanningEntity = RootScannerEntity_None;
+	}
+}
+
+void
+MM_ParallelRootScanner::scanThreads(MM_EnvironmentBase *env)
+{
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = threadListIterator.nextOMRVMThread();
+	while (NULL != walkThread) {
+		if (scanUnitStarted(env, RootScannerEntity_Threads)) {
+			for (uintptr_t i = 0; (i < _threadsPerUnit) && (NULL != walkThread); i++) {
+				doThread(env, walkThread);
+				walkThread = threadListIterator.nextOMRVMThread();
+			}
+			scanUnitEnded(env);
+		} else {
+			for (uintptr_t i = 0; (i < _threadsPerUnit) && (NULL != walkThread); i++) {
+				walkThread = threadListIterator.nextOMRVMThread();
+			}
+		}
+	}
+}
+
+void
+MM_ParallelRootScanner::scanHashTable(MM_EnvironmentBase *env, J9HashTable *table, RootScannerEntity entity)
+{
+	if (NULL != table) {
+		J9HashTableState state;
+		void *entry = hashTableStartDo(table, &state);
+		while (NULL != entry) {
+			if (scanUnitStarted(env, entity)) {
+				for (uintptr_t i = 0; (i < _entriesPerUnit) && (NULL != entry); i++) {
+					doHashTableEntry(env, entity, entry);
+					entry = hashTableNextDo(&state);
+				}
+				scanUnitEnded(env);
+			} else {
+				for (uintptr_t i = 0; (i < _entriesPerUnit) && (NULL != entry); i++) {
+					entry = hashTableNextDo(&state);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PARALLELROOTSCANNER_HPP_)
+#define PARALLELROOTSCANNER_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+#include "omrhashtable.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+#include "RootScannerTypes.h"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Base class for root scanners which share the root set between the threads of a parallel task.
+ *
+ * Each kind of root (thread, global table, remembered set) is split into units of work which are handed
+ * out through the work unit index of the current task, so any thread of the task can pick up any unit. As
+ * with J9MODRON_HANDLE_NEXT_WORK_UNIT, every thread of the task must walk the same roots in the same order,
+ * skipping the units it does not own.
+ *
+ * The class can also be used as is to share and time root sets which are walked by their owner, through
+ * scanUnitStarted() and scanUnitEnded().
+ *
+ * When root scanner statistics are enabled (MM_GCExtensionsBase::rootScannerStatsEnabled), the time spent in
+ * each claimed unit is charged to its root scanner entity in the MM_RootScannerStats of the scanning thread.
+ * @ingroup GC_Base
+ */
+class MM_ParallelRootScanner : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	RootScannerEntity _scanningEntity; /**< Entity being timed, RootScannerEntity_None when no unit is being scanned */
+	uint64_t _scanningStartTime; /**< Start time of the unit being scanned */
+
+protected:
+	MM_GCExtensionsBase *_extensions;
+	bool _statsEnabled; /**< Whether scanning time is recorded in the root scanner statistics of the scanning thread */
+	uintptr_t _threadsPerUnit; /**< Number of threads walked as a single unit of work */
+	uintptr_t _entriesPerUnit; /**< Number of table or remembered set entries walked as a single unit of work */
+
+public:
+	static const uintptr_t DEFAULT_THREADS_PER_UNIT = 1;
+	static const uintptr_t DEFAULT_ENTRIES_PER_UNIT = 256;
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	/**
+	 * Scan the roots held by a thread (stack slots, thread local references). The default implementation
+	 * fails, scanners walking threads through scanThreads() must override it.
+	 * @param env The environment for the calling thread
+	 * @param walkThread The thread whose roots are scanned
+	 */
+	virtual void doThread(MM_EnvironmentBase *env, OMR_VMThread *walkThread);
+
+	/**
+	 * Scan the roots held by an entry of a hash table walked through scanHashTable(). The default
+	 * implementation fails, scanners walking hash tables must override it.
+	 * @param env The environment for the calling thread
+	 * @param entity The root scanner entity the table was walked for
+	 * @param entry The hash table entry
+	 */
+	virtual void doHashTableEntry(MM_EnvironmentBase *env, RootScannerEntity entity, void *entry);
+
+public:
+	/**
+	 * Claim the next unit of root scanning work. If the calling thread owns the unit, its scanning time is charged
+	 * to the given entity until scanUnitEnded() is called.
+	 * @param env The environment for the calling thread
+	 * @param entity The root scanner entity the unit belongs to
+	 * @return true if the calling thread owns the unit and must scan it, false otherwise
+	 */
+	bool scanUnitStarted(MM_EnvironmentBase *env, RootScannerEntity entity);
+
+	/**
+	 * Complete the unit claimed by the last successful call to scanUnitStarted().
+	 * @param env The environment for the calling thread
+	 */
+	void scanUnitEnded(MM_EnvironmentBase *env);
+
+	/**
+	 * Start timing the given entity for a root set which is already split into units by its own structure
+	 * (e.g. the remembered set puddles of the scavenger). The caller is responsible for sharing the work.
+	 * @param env The environment for the calling thread
+	 * @param entity The root scanner entity being scanned
+	 */
+	void reportScanningStarted(MM_EnvironmentBase *env, RootScannerEntity entity);
+
+	/**
+	 * Stop timing the entity given to the last call to reportScanningStarted().
+	 * @param env The environment for the calling thread
+	 */
+	void reportScanningEnded(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan the roots of all threads, _threadsPerUnit threads per unit of work.
+	 * @param env The environment for the calling thread
+	 */
+	void scanThreads(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan all entries of a hash table, _entriesPerUnit entries per unit of work. The table must not be
+	 * modified while it is scanned.
+	 * @param env The environment for the calling thread
+	 * @param table The hash table to scan, may be NULL
+	 * @param entity The root scanner entity the table is charged to
+	 */
+	void scanHashTable(MM_EnvironmentBase *env, J9HashTable *table, RootScannerEntity entity);
+
+	MMINLINE uintptr_t getEntriesPerUnit() { return _entriesPerUnit; }
+
+	MM_ParallelRootScanner(MM_EnvironmentBase *env);
+};
+
+#endif /* PARALLELROOTSCANNER_HPP_ */
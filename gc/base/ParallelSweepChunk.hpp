@@ -36,6 +36,7 @@
 #include <string.h>
 
 #include "BaseNonVirtual.hpp"
+#include "Bits.hpp"
 
 class MM_MemoryPool;
 class MM_HeapLinkedFreeHeader;
@@ -83,6 +84,7 @@ public:
 	MM_HeapLinkedFreeHeader* _splitCandidatePreviousEntry;
 	uintptr_t _accumulatedFreeSize;
 	uintptr_t _accumulatedFreeHoles;
+	uintptr_t _freeEntrySizeClasses; /**< highest set bits of the sizes of the free entries connected for this chunk (see J9ModronFreeList::_sizeClasses) */
 
 	/**
 	 * clear the Chunk object.
@@ -111,6 +113,14 @@ public:
  		}
 	}
 
+	/**
+	 * Record the size class of a free entry that was connected for this chunk.
+	 */
+	MMINLINE void addFreeEntrySizeClass(uintptr_t freeEntrySize)
+	{
+		_freeEntrySizeClasses |= MM_Bits::highestSetBit(freeEntrySize);
+	}
+
 	/**
 	 * Create a ParallelSweepChunk object.
 	 */	
@@ -147,7 +157,8 @@ public:
 		_splitCandidate(NULL),
 		_splitCandidatePreviousEntry(NULL),
 		_accumulatedFreeSize(0),
-		_accumulatedFreeHoles(0)
+		_accumulatedFreeHoles(0),
+		_freeEntrySizeClasses(0)
 	{
 		_typeId = __FUNCTION__;
 	};
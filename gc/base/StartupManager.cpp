@@ -37,6 +37,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCPARTIALCOMPACTMOVEBUDGET "-Xgc:partialCompactMoveBudget="
+#define OMR_XGCPARTIALCOMPACTMOVEBUDGET_LENGTH 30
+#define OMR_XGCCOMPACTSLIDINGWINDOWS "-Xgc:compactSlidingWindows"
+#define OMR_XGCCOMPACTSLIDINGWINDOWS_LENGTH 26
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,6 +52,22 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNCHRONOUS_LOGGING "-Xgc:asynchronousLogging"
+#define OMR_XGCASYNCHRONOUS_LOGGING_LENGTH 24
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCHUGEPAGES "-Xgc:hugePages="
+#define OMR_XGCHUGEPAGES_LENGTH 15
+#define OMR_XGCHUGEPAGESIZE "-Xgc:hugePageSize="
+#define OMR_XGCHUGEPAGESIZE_LENGTH 18
+#define OMR_XGCHUGEPAGEUSAGESAMPLEINTERVAL "-Xgc:hugePageUsageSampleInterval="
+#define OMR_XGCHUGEPAGEUSAGESAMPLEINTERVAL_LENGTH 33
+#define OMR_XGCRELEASEFREEPAGESAFTERGLOBALGC "-Xgc:releaseFreePagesAfterGlobalGC"
+#define OMR_XGCRELEASEFREEPAGESAFTERGLOBALGC_LENGTH 34
+#define OMR_XGCRELEASEFREEPAGESGRANULESIZE "-Xgc:releaseFreePagesGranuleSize="
+#define OMR_XGCRELEASEFREEPAGESGRANULESIZE_LENGTH 33
+#define OMR_XGCRELEASEFREEPAGESMAXIMUMPERGC "-Xgc:releaseFreePagesMaximumPerGC="
+#define OMR_XGCRELEASEFREEPAGESMAXIMUMPERGC_LENGTH 34
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -264,6 +284,20 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCPARTIALCOMPACTMOVEBUDGET, OMR_XGCPARTIALCOMPACTMOVEBUDGET_LENGTH)) {
+		/* budget is given in microseconds */
+		char *value = option + OMR_XGCPARTIALCOMPACTMOVEBUDGET_LENGTH;
+		uintptr_t budget = 0;
+		uintptr_t count = getUDATAValue(value, &budget);
+		if ((0 == count) || (((uintptr_t)-1) == count) || ('\0' != value[count])) {
+			result = false;
+		} else {
+			extensions->partialCompactMoveBudget = budget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACTSLIDINGWINDOWS, OMR_XGCCOMPACTSLIDINGWINDOWS_LENGTH)) {
+		extensions->compactSlidingWindows = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +310,52 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNCHRONOUS_LOGGING, OMR_XGCASYNCHRONOUS_LOGGING_LENGTH)) {
+		extensions->asynchronousLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGEPAGES, OMR_XGCHUGEPAGES_LENGTH)) {
+		result = MM_HugePageManager::parsePolicy(option + OMR_XGCHUGEPAGES_LENGTH, &extensions->hugePagePolicy);
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGEPAGESIZE, OMR_XGCHUGEPAGESIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCHUGEPAGESIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->hugePageSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHUGEPAGEUSAGESAMPLEINTERVAL, OMR_XGCHUGEPAGEUSAGESAMPLEINTERVAL_LENGTH)) {
+		char *value = option + OMR_XGCHUGEPAGEUSAGESAMPLEINTERVAL_LENGTH;
+		uintptr_t interval = 0;
+		uintptr_t count = getUDATAValue(value, &interval);
+		if ((0 == count) || (((uintptr_t)-1) == count) || ('\0' != value[count])) {
+			result = false;
+		} else {
+			extensions->hugePageUsageSampleInterval = interval;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCRELEASEFREEPAGESAFTERGLOBALGC, OMR_XGCRELEASEFREEPAGESAFTERGLOBALGC_LENGTH)) {
+		extensions->releaseFreePagesAfterGlobalGC = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCRELEASEFREEPAGESGRANULESIZE, OMR_XGCRELEASEFREEPAGESGRANULESIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCRELEASEFREEPAGESGRANULESIZE_LENGTH, &value) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->releaseFreePagesGranuleSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCRELEASEFREEPAGESMAXIMUMPERGC, OMR_XGCRELEASEFREEPAGESMAXIMUMPERGC_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCRELEASEFREEPAGESMAXIMUMPERGC_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->releaseFreePagesMaximumPerGC = value;
+		}
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -171,6 +171,8 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 		previousFreeEntrySize += leadingFreeEntrySize;
 		sweepState->_sweepFreeBytes += leadingFreeEntrySize;
  		sweepState->updateLargestFreeEntry(previousFreeEntrySize, previousPreviousFreeEntry);
+		/* the grown entry stays with the chunk that connected it (no chunk in between connected anything) */
+		previousConnectChunk->addFreeEntrySizeClass(previousFreeEntrySize);
 		memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(previousFreeEntrySize);
 
 		/* Consume the leading entry */
@@ -213,6 +215,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeBytes += jointFreeSize;
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(jointFreeSize, previousPreviousFreeEntry);
+					chunk->addFreeEntrySizeClass(jointFreeSize);
 
 					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(jointFreeSize);
 				}
@@ -246,6 +249,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeBytes += previousConnectChunk->trailingFreeCandidateSize;
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(previousConnectChunk->trailingFreeCandidateSize, previousPreviousFreeEntry);
+					chunk->addFreeEntrySizeClass(previousConnectChunk->trailingFreeCandidateSize);
 
 					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(previousConnectChunk->trailingFreeCandidateSize);
 				}
@@ -289,6 +293,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeBytes += leadingFreeEntrySize;
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(leadingFreeEntrySize, previousPreviousFreeEntry);
+					chunk->addFreeEntrySizeClass(leadingFreeEntrySize);
 
 					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(leadingFreeEntrySize);
 				}
@@ -391,6 +396,7 @@ MM_SweepPoolManagerAddressOrderedListBase::flushFinalChunk(
 			sweepState->_sweepFreeBytes += sweepState->_connectPreviousChunk->trailingFreeCandidateSize;
 			sweepState->_sweepFreeHoles += 1;
 	 		sweepState->updateLargestFreeEntry(sweepState->_connectPreviousChunk->trailingFreeCandidateSize, sweepState->_connectPreviousPreviousFreeEntry);
+			sweepState->_connectPreviousChunk->addFreeEntrySizeClass(sweepState->_connectPreviousChunk->trailingFreeCandidateSize);
 
 			memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(sweepState->_connectPreviousChunk->trailingFreeCandidateSize);
 		}
@@ -498,6 +504,7 @@ MM_SweepPoolManagerAddressOrderedListBase::addFreeMemory(MM_EnvironmentBase *env
 				sweepChunk->freeHoles += 1;
 //				sweepChunk->_largestFreeEntry = max(sweepChunk->_largestFreeEntry , heapFreeByteCount);
 				sweepChunk->updateLargestFreeEntry(heapFreeByteCount, sweepChunk->freeListTail);
+				sweepChunk->addFreeEntrySizeClass(heapFreeByteCount);
 
 				/* increment thread local sizeClass stats that will later be merged */
 				memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(heapFreeByteCount, &env->_freeEntrySizeClassStats);
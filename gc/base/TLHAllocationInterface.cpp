@@ -36,6 +36,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSamplingStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -82,6 +83,17 @@ MM_TLHAllocationInterface::initialize(MM_EnvironmentBase *env)
 		result = (NULL != _frequentObjectsStats);
 	}
 
+	if (result && extensions->allocationSamplingEnabled) {
+		_allocationSamplingStats = MM_AllocationSamplingStats::newInstance(env, extensions->allocationSamplingMaxSites);
+		result = (NULL != _allocationSamplingStats);
+		if (result) {
+			/* the seed only needs to differ between threads, it must not be 0 */
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			env->_allocationSamplingSeed = (omrtime_hires_clock() ^ (uint64_t)(uintptr_t)env) | 1;
+			env->_allocationSamplingBytesRemaining = MM_AllocationSamplingStats::nextInterval(&env->_allocationSamplingSeed, extensions->allocationSamplingInterval);
+		}
+	}
+
 	if (result) {
 		reconnect(env, false);
 	}
@@ -99,6 +111,11 @@ MM_TLHAllocationInterface::tearDown(MM_EnvironmentBase *env)
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
 	}
+
+	if (NULL != _allocationSamplingStats) {
+		_allocationSamplingStats->kill(env);
+		_allocationSamplingStats = NULL;
+	}
 }
 
 /**
@@ -133,6 +150,10 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 	
 	_tlhAllocationSupport.reconnect(env, shouldFlush);
 
+	if (shouldFlush) {
+		_sizeClassCache.flushCache(env);
+	}
+
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.reconnect(env, shouldFlush);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
@@ -190,6 +211,10 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	} else {
 		result = allocateFromTLH(env, allocDescription, shouldCollectOnFailure);
 
+		if ((NULL == result) && (NULL == ac) && env->getExtensions()->tlhSizeClassCache) {
+			result = _sizeClassCache.allocateObject(env, allocDescription);
+		}
+
 		if (NULL == result) {
 			if (NULL != ac) {
 				result = ac->allocateObject(env, allocDescription, shouldCollectOnFailure);
@@ -209,11 +234,44 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 
 	}
 
+	if ((NULL != _allocationSamplingStats) && (NULL != result)) {
+		sampleAllocation(env, allocDescription, _stats.bytesAllocated() - _bytesAllocatedBase);
+	}
+
 	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
 
 	return result;
 }
 
+void
+MM_TLHAllocationInterface::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t bytesAllocated)
+{
+	/* Allocations served from the current TLH do not add to the allocated bytes, so this only samples at TLH refills
+	 * (and allocations made outside of the TLH). A refill may cover several sampling intervals.
+	 */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t samples = 0;
+	_allocationSamplingStats->_allocatedBytes += bytesAllocated;
+	while (bytesAllocated >= env->_allocationSamplingBytesRemaining) {
+		bytesAllocated -= env->_allocationSamplingBytesRemaining;
+		env->_allocationSamplingBytesRemaining = MM_AllocationSamplingStats::nextInterval(&env->_allocationSamplingSeed, extensions->allocationSamplingInterval);
+		samples += 1;
+	}
+	env->_allocationSamplingBytesRemaining -= bytesAllocated;
+
+	if (0 < samples) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t size = allocDescription->getBytesRequested();
+		void *site = env->getAllocationSite(size);
+		/* each sample stands for the mean interval worth of allocated bytes */
+		uintptr_t weight = samples * extensions->allocationSamplingInterval;
+		_allocationSamplingStats->update(site, weight);
+		TRIGGER_J9HOOK_MM_OMR_ALLOCATION_SAMPLE(extensions->omrHookInterface, env->getOmrVMThread(), startTime, site, size, weight);
+		_allocationSamplingStats->_sampleTime += omrtime_hires_clock() - startTime;
+	}
+}
+
 void *
 MM_TLHAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -264,6 +322,9 @@ MM_TLHAllocationInterface::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescr
 {
 	void *result = NULL;
 
+	if (_sizeClassCache.isRefilling()) {
+		result = _sizeClassCache.allocateTLH(env, allocDescription, memorySubSpace, memoryPool);
+	} else
 #if defined(OMR_GC_NON_ZERO_TLH)
 	if (allocDescription->getNonZeroTLHFlag()) {
 		result = _tlhAllocationSupportNonZero.allocateTLH(env, allocDescription, memorySubSpace, memoryPool);
@@ -297,6 +358,8 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	_sizeClassCache.flushCache(env);
 }
 
 void
@@ -34,6 +34,7 @@
 
 #include "ObjectAllocationInterface.hpp"
 #include "TLHAllocationSupport.hpp"
+#include "TLHSizeClassCache.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
@@ -61,6 +62,8 @@ private:
 	MM_TLHAllocationSupport _tlhAllocationSupportNonZero; /**< TLH Allocation sub interface class */
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 
+	MM_TLHSizeClassCache _sizeClassCache; /**< caches for allocations that do not fit the TLH */
+
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
 
@@ -91,6 +94,14 @@ private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Take allocation samples for the bytes allocated by an out of line allocation, if they exhaust the current
+	 * sampling interval (see MM_GCExtensionsBase::allocationSamplingEnabled).
+	 * @param allocDescription Description of the allocation which just succeeded
+	 * @param bytesAllocated Bytes allocated by the thread (including TLH refills) during the allocation
+	 */
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t bytesAllocated);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -101,11 +112,13 @@ private:
 #if defined(OMR_GC_NON_ZERO_TLH)
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+		_sizeClassCache(env),
 		_cachedAllocationsEnabled(true),
 		_bytesAllocatedBase(0)
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
+		_sizeClassCache._objectAllocationInterface = this;
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 		_tlhAllocationSupportNonZero._objectAllocationInterface = this;
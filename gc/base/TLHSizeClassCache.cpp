@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+
+#include "TLHSizeClassCache.hpp"
+
+#include "ModronAssertions.h"
+
+#include "AllocateDescription.hpp"
+#include "AllocationStats.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectAllocationInterface.hpp"
+#if defined(OMR_GC_OBJECT_MAP)
+#include "ObjectMap.hpp"
+#endif /* defined(OMR_GC_OBJECT_MAP) */
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+uintptr_t
+MM_TLHSizeClassCache::getSizeClass(MM_EnvironmentBase *env, uintptr_t sizeInBytes)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t sizeClass = OMR_TLH_SIZE_CLASS_COUNT;
+
+	/* anything up to the TLH minimum size always fits a TLH refresh */
+	if ((sizeInBytes > extensions->tlhMinimumSize) && (sizeInBytes <= extensions->tlhSizeClassCacheMaximumSize)) {
+		uintptr_t classTop = extensions->tlhMinimumSize << 1;
+		sizeClass = 0;
+		while ((sizeInBytes > classTop) && (OMR_TLH_SIZE_CLASS_COUNT > sizeClass)) {
+			classTop <<= 1;
+			sizeClass += 1;
+		}
+	}
+
+	return sizeClass;
+}
+
+void
+MM_TLHSizeClassCache::clearRegion(MM_EnvironmentBase *env, Region *region)
+{
+	if (NULL != region->_memoryPool) {
+		region->_memoryPool->abandonTlhHeapChunk(region->_alloc, region->_top);
+
+		MM_MemorySubSpace *subspace = env->getMemorySpace()->getDefaultMemorySubSpace();
+		TRIGGER_J9HOOK_MM_PRIVATE_CACHE_CLEARED(env->getExtensions()->privateHookInterface, _omrVMThread, subspace, region->_base, region->_alloc, region->_top);
+
+#if defined(OMR_GC_OBJECT_MAP)
+		/* Mark all objects allocated from the region as valid objects */
+		env->getExtensions()->getObjectMap()->markValidObjectForRange(env, region->_base, region->_alloc);
+#endif /* defined(OMR_GC_OBJECT_MAP) */
+	}
+	memset(region, 0, sizeof(Region));
+}
+
+bool
+MM_TLHSizeClassCache::refill(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeClass)
+{
+	clearRegion(env, &_regions[sizeClass]);
+
+	/* The subspace calls back through the allocation interface, which forwards to allocateTLH() while _refillSizeClass is set.
+	 * Never collect here: if the pool can not supply a region the caller falls back to the regular allocation path.
+	 */
+	MM_MemorySpace *memorySpace = _objectAllocationInterface->getOwningEnv()->getMemorySpace();
+	_refillSizeClass = sizeClass;
+	void *base = memorySpace->getDefaultMemorySubSpace()->allocateTLH(env, allocDescription, _objectAllocationInterface, NULL, NULL, false);
+	_refillSizeClass = OMR_TLH_SIZE_CLASS_COUNT;
+
+	if (NULL != base) {
+		Region *region = &_regions[sizeClass];
+		MM_MemorySubSpace *subspace = env->getMemorySpace()->getDefaultMemorySubSpace();
+		TRIGGER_J9HOOK_MM_PRIVATE_CACHE_REFRESHED(env->getExtensions()->privateHookInterface, _omrVMThread, subspace, region->_base, region->_top);
+		_objectAllocationInterface->getAllocationStats()->_sizeClassCacheRefillCount += 1;
+	}
+
+	return (NULL != base);
+}
+
+void *
+MM_TLHSizeClassCache::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	void *addrBase = NULL;
+	void *addrTop = NULL;
+
+	Assert_MM_true(isRefilling());
+
+	uintptr_t refillSize = (extensions->tlhMinimumSize << (_refillSizeClass + 1)) * extensions->tlhSizeClassCacheBatchCount;
+	if (NULL != memoryPool->allocateTLH(env, allocDescription, refillSize, addrBase, addrTop)) {
+		Region *region = &_regions[_refillSizeClass];
+		region->_base = addrBase;
+		region->_alloc = addrBase;
+		region->_top = addrTop;
+		region->_memorySubSpace = memorySubSpace;
+		region->_memoryPool = memoryPool;
+		allocDescription->setMemorySubSpace(memorySubSpace);
+		allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
+		return addrBase;
+	}
+
+	return NULL;
+}
+
+void *
+MM_TLHSizeClassCache::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	void *result = NULL;
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	uintptr_t sizeClass = getSizeClass(env, sizeInBytesRequired);
+
+	if (OMR_TLH_SIZE_CLASS_COUNT > sizeClass) {
+		Region *region = &_regions[sizeClass];
+		if ((sizeInBytesRequired > ((uintptr_t)region->_top - (uintptr_t)region->_alloc)) && !refill(env, allocDescription, sizeClass)) {
+			return NULL;
+		}
+
+		/* the pool may hand out less than was asked for; the region is kept for smaller objects of the class */
+		if (sizeInBytesRequired <= ((uintptr_t)region->_top - (uintptr_t)region->_alloc)) {
+			result = region->_alloc;
+			region->_alloc = (void *)((uintptr_t)region->_alloc + sizeInBytesRequired);
+			allocDescription->setObjectFlags(region->_memorySubSpace->getObjectFlags());
+			allocDescription->setMemorySubSpace(region->_memorySubSpace);
+			allocDescription->setMemoryPool(region->_memoryPool);
+			_objectAllocationInterface->getAllocationStats()->_sizeClassCacheAllocationCount += 1;
+		}
+	}
+
+	return result;
+}
+
+void
+MM_TLHSizeClassCache::flushCache(MM_EnvironmentBase *env)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_TLH_SIZE_CLASS_COUNT; sizeClass++) {
+		clearRegion(env, &_regions[sizeClass]);
+	}
+}
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TLHSIZECLASSCACHE_HPP_)
+#define TLHSIZECLASSCACHE_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "EnvironmentBase.hpp"
+
+class MM_AllocateDescription;
+class MM_MemoryPool;
+class MM_MemorySubSpace;
+class MM_ObjectAllocationInterface;
+struct OMR_VMThread;
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+/* Number of size classes. Class i serves sizes in (tlhMinimumSize << i, tlhMinimumSize << (i + 1)] */
+#define OMR_TLH_SIZE_CLASS_COUNT 8
+
+/**
+ * Per thread size class caches for the allocations the TLH declines.
+ *
+ * Objects larger than half the TLH refresh size are not allocated from the TLH, so without this cache each of them
+ * takes the memory pool lock. Each size class owns a private region of heap taken from the pool in one batch,
+ * large enough for tlhSizeClassCacheBatchCount objects of the largest size in the class, and objects of that class
+ * are bump allocated from it. The regions behave like TLHs: they are reported through the cache refreshed/cleared
+ * hooks and are abandoned back to the pool when the caches are flushed for a collection, so the first allocations
+ * after a collection refill from the freshly swept free lists.
+ * @ingroup GC_Base
+ */
+class MM_TLHSizeClassCache
+{
+public:
+protected:
+private:
+	struct Region {
+		void *_base; /**< base of the region */
+		void *_alloc; /**< next free byte in the region */
+		void *_top; /**< top (exclusive) of the region */
+		MM_MemorySubSpace *_memorySubSpace; /**< subspace the region was taken from */
+		MM_MemoryPool *_memoryPool; /**< pool the region was taken from */
+	};
+
+	OMR_VMThread * const _omrVMThread; /**< thread owning the caches */
+	MM_ObjectAllocationInterface *_objectAllocationInterface; /**< allocation interface the caches belong to */
+	Region _regions[OMR_TLH_SIZE_CLASS_COUNT]; /**< current region of each size class */
+	uintptr_t _refillSizeClass; /**< size class being refilled while the subspace calls back through allocateTLH(), OMR_TLH_SIZE_CLASS_COUNT otherwise */
+
+public:
+	/**
+	 * Allocate the object described by allocDescription from the cache of its size class, refilling the cache
+	 * from the memory pool if needed. Never collects.
+	 * @return the object or NULL if the size is not cached or no memory could be found
+	 */
+	void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Take the region of the size class being refilled from the given pool. Called back by the memory subspace
+	 * during a refill.
+	 * @return the base of the region or NULL on failure
+	 */
+	void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * @return true while a size class is being refilled
+	 */
+	MMINLINE bool isRefilling() { return OMR_TLH_SIZE_CLASS_COUNT > _refillSizeClass; }
+
+	/**
+	 * Return the unused part of every region to its pool.
+	 * @note The calling environment may not be the owning environment.
+	 */
+	void flushCache(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the size class serving sizeInBytes, or OMR_TLH_SIZE_CLASS_COUNT if that size is not cached
+	 */
+	uintptr_t getSizeClass(MM_EnvironmentBase *env, uintptr_t sizeInBytes);
+
+	/**
+	 * Abandon the unused part of a region and reset it.
+	 */
+	void clearRegion(MM_EnvironmentBase *env, Region *region);
+
+	/**
+	 * Replace the region of sizeClass by a new one taken from the default memory subspace.
+	 * @return true if a new region was installed
+	 */
+	bool refill(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeClass);
+
+	/**
+	 * Create a TLHSizeClassCache object.
+	 */
+	MM_TLHSizeClassCache(MM_EnvironmentBase *env) :
+		_omrVMThread(env->getOmrVMThread()),
+		_objectAllocationInterface(NULL),
+		_refillSizeClass(OMR_TLH_SIZE_CLASS_COUNT)
+	{
+		memset(_regions, 0, sizeof(_regions));
+	};
+
+	/*
+	 * friends
+	 */
+	friend class MM_TLHAllocationInterface;
+};
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#endif /* TLHSIZECLASSCACHE_HPP_ */
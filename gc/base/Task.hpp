@@ -76,6 +76,22 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Estimate the work of this dispatch from previous collections, for the dispatcher to choose the number of
+	 * threads and the work unit size of the task (see MM_GCExtensionsBase::adaptiveGCThreading).
+	 * @return the estimated work, in bytes, or 0 if the task has no estimate
+	 */
+	virtual uintptr_t getWorkEstimate(MM_EnvironmentBase *env) { return 0; }
+
+	/**
+	 * Suggest the size of the units of work handed out to the threads of this dispatch.
+	 * Called by the dispatcher before masterSetup().
+	 * @param workUnitSize the suggested work unit size, in bytes
+	 * @return true if the task applies the work unit size, false if it keeps its own
+	 * @note no-op
+	 */
+	virtual bool setWorkUnitSize(MM_EnvironmentBase *env, uintptr_t workUnitSize) { return false; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -241,6 +241,19 @@ getLoaResizeReasonAsString(LoaResizeReason reason)
 	}
 }
 
+const char *
+getReleaseFreePagesReasonAsString(ReleaseFreePagesReason reason)
+{
+	switch(reason) {
+	case RELEASE_FREE_PAGES_IDLE:
+		return "idle";
+	case RELEASE_FREE_PAGES_AFTER_GLOBAL_GC:
+		return "free after global gc";
+	default:
+		return "unknown";
+	}
+}
+
 const char *
 getSystemGCReasonAsString(uint32_t gcCode)
 {
@@ -57,6 +57,7 @@ const char *getPercolateReasonAsString(PercolateReason mode);
 const char *getExpandReasonAsString(ExpandReason reason);
 const char *getContractReasonAsString(ContractReason reason);
 const char *getLoaResizeReasonAsString(LoaResizeReason reason);
+const char *getReleaseFreePagesReasonAsString(ReleaseFreePagesReason reason);
 
 const char *getSystemGCReasonAsString(uint32_t gcCode);
 
@@ -247,7 +247,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* generational mode relies on newly allocated cells being unmarked (young) until the next collection */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
@@ -310,6 +311,13 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 					}
 				}
 			}
+
+			/* While small regions are left queued by a lazy sweep, every region handed out pays for sweeping one more
+			 * (of any size class), so that little is left for the GC threads to sweep at the start of the next collection.
+			 */
+			if (!done && _regionPool->isSweepingSmallPages()) {
+				_regionPool->sweepNextSmallRegion(env);
+			}
 		}
 
 		smallAllocationUnlock();
@@ -413,10 +413,57 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
 		decrementCurrentTotalCountOfSweepRegions(1);
 		_smallFullRegions[sizeClass]->enqueue(region);
+		MM_AtomicOperations::add(&_regionsSweptByAllocation, 1);
 	}
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::sweepNextSmallRegion(MM_EnvironmentBase *env)
+{
+	uintptr_t sizeClassCount = OMR_SIZECLASSES_MAX_SMALL - OMR_SIZECLASSES_MIN_SMALL + 1;
+	uintptr_t startSizeClass = _nextPacedSweepSizeClass;
+
+	for (uintptr_t i = 0; i < sizeClassCount; i++) {
+		uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL + ((startSizeClass - OMR_SIZECLASSES_MIN_SMALL + i) % sizeClassCount);
+		MM_HeapRegionDescriptorSegregated *region = _smallSweepRegions[sizeClass]->dequeue();
+		if (NULL != region) {
+			/* spread the sweeping over the size classes, like the interleaved sweep of the GC threads */
+			_nextPacedSweepSizeClass = OMR_SIZECLASSES_MIN_SMALL + ((sizeClass - OMR_SIZECLASSES_MIN_SMALL + 1) % sizeClassCount);
+			decrementCurrentCountOfSweepRegions(sizeClass, 1);
+			decrementCurrentTotalCountOfSweepRegions(1);
+
+			_sweepScheme->sweepRegion(env, region);
+			uintptr_t numCells = region->getNumCells();
+			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+			if (memoryPoolACL->getFreeCount() < numCells) {
+				uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+				if (memoryPoolACL->getMarkCount() == numCells) {
+					_smallFullRegions[sizeClass]->enqueue(region);
+				} else {
+					enqueueAvailable(region, sizeClass, occupancy, env->getEnvironmentId() % _splitAvailableListSplitCount);
+				}
+			} else {
+				region->emptyRegionReturned(env);
+				region->setFree(1);
+				decrementRegionsInUse(1);
+				_singleFreeList->push(region);
+			}
+			MM_AtomicOperations::add(&_regionsSweptByAllocation, 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+uintptr_t
+MM_RegionPoolSegregated::resetRegionsSweptByAllocation()
+{
+	uintptr_t regionsSwept = _regionsSweptByAllocation;
+	_regionsSweptByAllocation = 0;
+	return regionsSwept;
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
@@ -136,6 +136,8 @@ private:
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
+	volatile uintptr_t _regionsSweptByAllocation; /**< small regions swept by allocating threads since the last call to resetRegionsSweptByAllocation() */
+	uintptr_t _nextPacedSweepSizeClass; /**< size class sweepNextSmallRegion() starts looking from (a hint, races are harmless) */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
 
@@ -174,6 +176,18 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep one small region left queued by a lazy sweep, of any size class, on behalf of an allocating thread.
+	 * The region is returned to the available, full or free regions like a region swept by the GC threads.
+	 * @return true if a region was swept, false if none is left queued
+	 */
+	bool sweepNextSmallRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of small regions swept by allocating threads since the previous call
+	 */
+	uintptr_t resetRegionsSweptByAllocation();
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -238,6 +252,7 @@ public:
 	MMINLINE uintptr_t getSplitAvailableListSplitCount() { return _splitAvailableListSplitCount; }
 
 	void setSweepSmallPages(bool sweepSmall) { _isSweepingSmall = sweepSmall; }
+	bool isSweepingSmallPages() const { return _isSweepingSmall; }
 	void resetSkipAvailableRegionForAllocation() { memset(&_skipAvailableRegionForAllocation[0], 0, sizeof(_skipAvailableRegionForAllocation)); }
 
 	void updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy);
@@ -277,6 +292,8 @@ public:
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
 		, _isSweepingSmall(false)
+		, _regionsSweptByAllocation(0)
+		, _nextPacedSweepSizeClass(OMR_SIZECLASSES_MIN_SMALL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -30,9 +30,15 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "ParallelRootScanner.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedMinorMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
@@ -94,6 +100,17 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (_extensions->segregatedGenerational) {
+		if (!_rememberedSet.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
+			return false;
+		}
+		_rememberedSet.setGrowSize(OMR_SCV_REMSET_SIZE);
+		if (!_rememberedSetLock.initialize(env, &_extensions->lnrlOptions, "MM_SegregatedGC:_rememberedSetLock")) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -112,6 +129,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (_extensions->segregatedGenerational) {
+		_rememberedSet.tearDown(env);
+		_rememberedSetLock.tearDown();
+	}
 }
 
 bool
@@ -174,6 +196,111 @@ MM_SegregatedGC::abortCollection(MM_EnvironmentBase* env, CollectionAbortReason
 
 }
 
+/*
+ * Generational support
+ */
+void
+MM_SegregatedGC::rememberObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	if (_extensions->objectModel.atomicSetRememberedState(objectPtr, STATE_REMEMBERED)) {
+		_rememberedSetLock.acquire();
+		uintptr_t *entry = _rememberedSet.allocateElementNoContention(env);
+		if (NULL != entry) {
+			*entry = (uintptr_t)objectPtr;
+			_rememberedSetCount += 1;
+		} else {
+			/* the next collection will be a full one, which does not need the remembered set */
+			_rememberedSetOverflow = true;
+		}
+		_rememberedSetLock.release();
+
+		if (NULL == entry) {
+			_extensions->objectModel.atomicSwitchReferencedState(objectPtr, STATE_REMEMBERED, STATE_NOT_REMEMBERED);
+		}
+	}
+}
+
+void
+MM_SegregatedGC::scanRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_ParallelRootScanner rootScanner(env);
+	GC_SublistIterator rememberedSetIterator(&_rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		if (rootScanner.scanUnitStarted(env, RootScannerEntity_RememberedSet)) {
+			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+				_markingScheme->scanObject(env, *slotPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+			}
+			rootScanner.scanUnitEnded(env);
+		}
+	}
+}
+
+void
+MM_SegregatedGC::clearRememberedSet(MM_EnvironmentBase *env)
+{
+	GC_SublistIterator rememberedSetIterator(&_rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+			_extensions->objectModel.clearRemembered(*slotPtr);
+		}
+	}
+	_rememberedSet.clear(env);
+	_rememberedSetCount = 0;
+	_rememberedSetOverflow = false;
+}
+
+bool
+MM_SegregatedGC::shouldCollectMinor(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	bool result = _extensions->segregatedGenerational
+		&& !gcCode.isExplicitGC()
+		&& !gcCode.isAggressiveGC()
+		&& !_rememberedSetOverflow
+		&& (_minorCollectionCount < _extensions->segregatedMinorCollectionsPerMajor);
+
+	_minorCollectionCount = result ? (_minorCollectionCount + 1) : 0;
+	return result;
+}
+
+bool
+MM_SegregatedGC::shouldSweepLazily(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	return _extensions->segregatedLazySweep
+		&& !gcCode.isExplicitGC()
+		&& !gcCode.isAggressiveGC();
+}
+
+void
+MM_SegregatedGC::completeLazySweep(MM_EnvironmentBase *env)
+{
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
+	if (_sweepScheme->isSweepQueued(memoryPool)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+		MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+		sweepStats->_lazySweepAllocationRegions = regionPool->resetRegionsSweptByAllocation();
+		sweepStats->_lazySweepLeftoverRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+		reportSweepStart(env);
+		sweepStats->_startTime = omrtime_hires_clock();
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool, MM_SegregatedSweepTask::sweep_complete);
+		_dispatcher->run(env, &sweepTask);
+		sweepStats->_endTime = omrtime_hires_clock();
+		reportSweepEnd(env);
+
+		/* a full sweep later in this collection has no lazy sweep to report */
+		sweepStats->_lazySweepAllocationRegions = 0;
+		sweepStats->_lazySweepLeftoverRegions = 0;
+	}
+}
+
 /*
  * Garbage Collection
  */
@@ -190,6 +317,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
+	/* Regions left unswept by the previous collection still rely on its mark map. They must be swept before
+	 * the allocation contexts put the regions they allocated into since then on the sweep lists.
+	 */
+	completeLazySweep(env);
+
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
 	 * we really need to do this here? */
 	/* Flush the allocation contexts */
@@ -209,12 +341,26 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //	}
 
 	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	if (shouldCollectMinor(env)) {
+		/* objects marked by earlier collections stay marked (old), only unmarked (young) cells can be reclaimed */
+		Trc_MM_SegregatedGC_minorCollection(env->getLanguageVMThread(), _minorCollectionCount, _rememberedSetCount);
+		markStats->_minorCollections = _minorCollectionCount;
+		markStats->_rememberedObjects = _rememberedSetCount;
+		MM_SegregatedMinorMarkTask markTask(env, _dispatcher, this, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	} else {
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if (_extensions->segregatedGenerational) {
+		/* every live object is old once marking is done, so no old to young references are left to remember */
+		clearRememberedSet(env);
+	}
+
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->masterCleanupAfterGC(env);
@@ -224,20 +370,31 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/*
 	 * Sweeping
 	 */
-	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
-	reportSweepStart(env);
-	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
-	_dispatcher->run(env, &sweepTask);
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
-	/* We now have accurate free space statistics so recalculate any expand/contract amount */
-	activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
-	sweepStats->_endTime = omrtime_hires_clock();
-	reportSweepEnd(env);
-
-	/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
-	activeSubSpace->performResize(env, allocDescription);
+	if (shouldSweepLazily(env)) {
+		/* Only queue the small regions, allocating threads sweep them on demand (see MM_AllocationContextSegregated::preAllocateSmall())
+		 * and the GC threads sweep the rest at the start of the next collection. Free space statistics are pessimistic until then,
+		 * so the heap is not resized on them: an allocation this collection can not satisfy is retried after an aggressive
+		 * collection, which sweeps every region before deciding on a resize.
+		 */
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool, MM_SegregatedSweepTask::sweep_queue);
+		_dispatcher->run(env, &sweepTask);
+	} else {
+		MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+		reportSweepStart(env);
+		sweepStats->_startTime = omrtime_hires_clock();
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
+		_dispatcher->run(env, &sweepTask);
+		/* We now have accurate free space statistics so recalculate any expand/contract amount */
+		activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
+		sweepStats->_endTime = omrtime_hires_clock();
+		reportSweepEnd(env);
+
+		/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
+		activeSubSpace->performResize(env, allocDescription);
+	}
 
 	/* Heap size now fixed for next cycle so reset heap statistics */
 	_extensions->heap->resetHeapStatistics(true);
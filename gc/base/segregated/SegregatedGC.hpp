@@ -28,8 +28,10 @@
 
 #include "CollectionStatisticsStandard.hpp"
 #include "GlobalCollector.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #include "MarkMap.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SublistPool.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -48,6 +50,12 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+
+	MM_SublistPool _rememberedSet; /**< marked (old) objects given a reference to an unmarked (young) object since the last collection */
+	MM_LightweightNonReentrantLock _rememberedSetLock; /**< serializes mutator additions to _rememberedSet */
+	volatile bool _rememberedSetOverflow; /**< set when _rememberedSet could not grow, forces the next collection to be a full one */
+	uintptr_t _rememberedSetCount; /**< number of objects added to _rememberedSet since the last collection */
+	uintptr_t _minorCollectionCount; /**< number of consecutive minor collections since the last full collection */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +81,33 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide if the current collection may be a minor one. Explicit and aggressive collections, collections
+	 * following a remembered set overflow and collections following segregatedMinorCollectionsPerMajor
+	 * consecutive minor collections are full.
+	 * @return true if only objects allocated since the last collection should be reclaimed
+	 */
+	bool shouldCollectMinor(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide if the small regions of the current collection may be swept lazily (see segregatedLazySweep).
+	 * Explicit and aggressive collections sweep the whole heap before returning.
+	 * @return true if small regions should be left queued for allocating threads to sweep
+	 */
+	bool shouldSweepLazily(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep, in parallel, the small regions left queued by the previous lazily swept collection. Must be
+	 * called before marking, since sweeping the queued regions relies on the mark map of that collection.
+	 */
+	void completeLazySweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Reset the remembered state of every object in the remembered set and empty it. Must be called single
+	 * threaded, after marking and before sweeping (so dead remembered objects are still intact).
+	 */
+	void clearRememberedSet(MM_EnvironmentBase *env);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -100,6 +135,37 @@ public:
 
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
+	/**
+	 * Generational write barrier, called by the out-of-line write barrier when segregatedGenerational is enabled.
+	 *
+	 * Generational mode uses sticky mark bits: the mark map is not cleared before a minor collection, so objects
+	 * marked by an earlier collection are old, and cells handed out since are unmarked (young). A minor collection
+	 * marks from the roots and from the remembered set only, then sweeps the unmarked cells. The barrier records
+	 * old parents that are given a reference to a young child.
+	 *
+	 * @param env[in] the mutator thread
+	 * @param parentObject[in] the object the reference was stored into
+	 * @param childObject[in] the stored reference (may be NULL)
+	 */
+	MMINLINE void
+	generationalWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if ((NULL != childObject) && !_rememberedSetOverflow && _markingScheme->isMarked(parentObject) && !_markingScheme->isMarked(childObject)) {
+			rememberObject(env, parentObject);
+		}
+	}
+
+	/**
+	 * Add an old object to the remembered set, unless it is already remembered.
+	 */
+	void rememberObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Scan every object in the remembered set, marking its young children. Called by each thread of a minor
+	 * collection mark task, the remembered set puddles are distributed over the threads as work units.
+	 */
+	void scanRememberedSet(MM_EnvironmentBase *env);
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -120,6 +186,9 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _rememberedSetOverflow(false)
+		, _rememberedSetCount(0)
+		, _minorCollectionCount(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
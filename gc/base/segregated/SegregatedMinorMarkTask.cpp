@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "SegregatedGC.hpp"
+#include "SegregatedMarkingScheme.hpp"
+#include "WorkPackets.hpp"
+
+#include "SegregatedMinorMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_SegregatedMinorMarkTask::MM_SegregatedMinorMarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SegregatedGC *collector, MM_CycleState *cycleState)
+	: MM_ParallelMarkTask(env, dispatcher, collector->getMarkingScheme(), false, cycleState)
+	, _collector(collector)
+{
+	_typeId = __FUNCTION__;
+}
+
+void
+MM_SegregatedMinorMarkTask::run(MM_EnvironmentBase *env)
+{
+	MM_SegregatedMarkingScheme *markingScheme = _collector->getMarkingScheme();
+
+	env->_workStack.prepareForWork(env, markingScheme->getWorkPackets());
+
+	markingScheme->markLiveObjectsInit(env, false);
+	markingScheme->markLiveObjectsRoots(env);
+	_collector->scanRememberedSet(env);
+	markingScheme->markLiveObjectsScan(env);
+	markingScheme->markLiveObjectsComplete(env);
+
+	env->_workStack.flush(env);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
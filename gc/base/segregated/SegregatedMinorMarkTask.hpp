@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMINORMARKTASK_HPP_)
+#define SEGREGATEDMINORMARKTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_SegregatedGC;
+
+/**
+ * Mark task of a generational (minor) segregated collection. The mark map is not initialized, so objects
+ * marked by earlier collections are treated as live and are not traced again. Marking starts from the roots
+ * and from the old objects in the collector's remembered set.
+ */
+class MM_SegregatedMinorMarkTask : public MM_ParallelMarkTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedGC *_collector;
+
+/* Methods */
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_SegregatedMinorMarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SegregatedGC *collector, MM_CycleState *cycleState);
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMINORMARKTASK_HPP_ */
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
 #include "SweepSchemeSegregated.hpp"
 
 #include "SegregatedSweepTask.hpp"
@@ -30,7 +31,19 @@
 void
 MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 {
-	_sweepScheme->sweep(env, _memoryPool, false);
+	switch (_mode) {
+	case sweep_all:
+		_sweepScheme->sweep(env, _memoryPool, false);
+		break;
+	case sweep_queue:
+		_sweepScheme->queueSweep(env, _memoryPool);
+		break;
+	case sweep_complete:
+		_sweepScheme->completeSweep(env, _memoryPool);
+		break;
+	default:
+		Assert_MM_unreachable();
+	}
 }
 
 void
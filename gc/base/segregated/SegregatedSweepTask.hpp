@@ -33,10 +33,19 @@ class MM_SegregatedSweepTask : public MM_ParallelTask
 {
 /* Data members / types */
 public:
+	/**
+	 * Portion of the sweep run by the task.
+	 */
+	enum SweepMode {
+		sweep_all = 0, /**< sweep every region */
+		sweep_queue, /**< sweep large and arraylet regions, leave small regions queued for lazy sweeping */
+		sweep_complete /**< sweep the small regions left queued by a previous sweep_queue task */
+	};
 protected:
 private:
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_MemoryPoolSegregated *_memoryPool;
+	SweepMode _mode;
 
 /* Methods */
 public:
@@ -47,10 +56,11 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	
-	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool)
+	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool, SweepMode mode = sweep_all)
 		: MM_ParallelTask(env, dispatcher)
 		, _sweepScheme(sweepScheme)
 		, _memoryPool(memoryPool)
+		, _mode(mode)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -102,6 +102,43 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	_memoryPool = memoryPool;
 	_isFixHeapForWalk = isFixHeapForWalk;
 
+	sweepLargeAndQueueSmall(env);
+	sweepQueuedSmall(env);
+}
+
+void
+MM_SweepSchemeSegregated::queueSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	_isFixHeapForWalk = false;
+
+	sweepLargeAndQueueSmall(env);
+
+	/* make the regions freed by the large and arraylet sweeps available to multi-region allocations right away */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		postSweep(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_SweepSchemeSegregated::completeSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	_isFixHeapForWalk = false;
+
+	sweepQueuedSmall(env);
+}
+
+bool
+MM_SweepSchemeSegregated::isSweepQueued(MM_MemoryPoolSegregated *memoryPool)
+{
+	return memoryPool->getRegionPool()->isSweepingSmallPages();
+}
+
+void
+MM_SweepSchemeSegregated::sweepLargeAndQueueSmall(MM_EnvironmentBase *env)
+{
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		preSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -117,6 +154,12 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		regionPool->resetSkipAvailableRegionForAllocation();
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
+}
+
+void
+MM_SweepSchemeSegregated::sweepQueuedSmall(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
 
 	incrementalSweepSmall(env);
 	regionPool->joinBucketListsForSplitIndex(env);
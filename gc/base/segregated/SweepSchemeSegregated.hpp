@@ -64,6 +64,24 @@ public:
 	MM_MarkMap *getMarkMap(MM_EnvironmentBase * env);
 
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
+
+	/**
+	 * First half of a lazy sweep: sweep the large and arraylet regions and queue the small regions for sweeping.
+	 * Queued small regions are swept on demand by allocating threads (see MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass())
+	 * until completeSweep() sweeps the rest.
+	 */
+	void queueSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+	/**
+	 * Second half of a lazy sweep: sweep the small regions which were queued by queueSweep() and not yet swept by
+	 * allocating threads. This must complete before the mark map is used by the next collection.
+	 */
+	void completeSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+	/**
+	 * @return true if small regions queued by queueSweep() are waiting for completeSweep()
+	 */
+	bool isSweepQueued(MM_MemoryPoolSegregated *memoryPool);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
@@ -96,6 +114,8 @@ private:
 	void sweepArrayletRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void sweepLargeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
+	void sweepLargeAndQueueSmall(MM_EnvironmentBase *env);
+	void sweepQueuedSmall(MM_EnvironmentBase *env);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
@@ -280,12 +280,27 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
+	if (0 != omrthread_monitor_init_with_name(&_slidingMonitor, 0, "MM_CompactScheme::sliding")) {
+		return false;
+	}
 	return _delegate.initialize(env, _omrVM, _markMap, this);
 }
 
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _slidingBlocks) {
+		env->getForge()->free(_slidingBlocks);
+		_slidingBlocks = NULL;
+	}
+	if (NULL != _slidingWindows) {
+		env->getForge()->free(_slidingWindows);
+		_slidingWindows = NULL;
+	}
+	if (NULL != _slidingMonitor) {
+		omrthread_monitor_destroy(_slidingMonitor);
+		_slidingMonitor = NULL;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -339,11 +354,11 @@ MM_CompactScheme::setFreeChunk(omrobjectptr_t from, omrobjectptr_t to)
 }
 
 void
-MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded)
+MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool partial)
 {
 	createSubAreaTable(env, singleThreaded);
-	setRealLimitsSubAreas(env);
-	removeNullSubAreas(env);
+	setRealLimitsSubAreas(env, partial);
+	removeNullSubAreas(env, partial);
 	completeSubAreaTable(env);
 }
 
@@ -430,11 +445,13 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
+				_subAreaTable[i].liveBytes = 0;
 				_subAreaTable[i++].currentAction = SubAreaEntry::none;
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
 			_subAreaTable[i].firstObject = (omrobjectptr_t)highAddress;
+			_subAreaTable[i].liveBytes = 0;
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
@@ -448,15 +465,16 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
  *  Set real limits for each subarea
  */
 void
-MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
+MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env, bool countLiveBytes)
 {
 	/* multi threaded pass to find real regions limits - where an object is found */
-	for (uintptr_t i = 1; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
-		/* i=1 because first region starts with heapAlloc thus we don't need to find its first object */
-		if ((SubAreaEntry::end_segment == _subAreaTable[i].state)
-		|| (SubAreaEntry::end_segment == _subAreaTable[i - 1].state)
-		) {
-			/* skip the end_segment and its successor */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			continue;
+		}
+		/* the first sub area of a segment starts at the segment base thus we don't need to find its first object */
+		bool firstInSegment = (0 == i) || (SubAreaEntry::end_segment == _subAreaTable[i - 1].state);
+		if (firstInSegment && !countLiveBytes) {
 			continue;
 		}
 
@@ -466,8 +484,19 @@ MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, start, end);
 			omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
 
-			_subAreaTable[i].firstObject = objectPtr;
-			Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			if (!firstInSegment) {
+				_subAreaTable[i].firstObject = objectPtr;
+				Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			}
+
+			if (countLiveBytes) {
+				uintptr_t liveBytes = 0;
+				while (NULL != objectPtr) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					objectPtr = markedObjectIterator.nextObject();
+				}
+				_subAreaTable[i].liveBytes = liveBytes;
+			}
 		}
 	}
 }
@@ -476,7 +505,7 @@ MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
  *  Remove empty sub areas from lists.
  */
 void
-MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
+MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env, bool partial)
 {
 	/*single threaded pass to eliminate null sub areas */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
@@ -488,6 +517,7 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
 				_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
 				_subAreaTable[j].state = _subAreaTable[i].state;
+				_subAreaTable[j].liveBytes = _subAreaTable[i].liveBytes;
 				if ((j > 0) && (_subAreaTable[j-1].state == SubAreaEntry::init)) {
 					_compactFrom = (_compactFrom < _subAreaTable[j-1].firstObject) ? _compactFrom : _subAreaTable[j-1].firstObject;
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
@@ -496,10 +526,93 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				j++;
 			}
 		}
+		if (partial) {
+			selectCompactWindow(env, j);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+/**
+ *  Select the sub areas a partial compaction moves within the move budget.
+ */
+void
+MM_CompactScheme::selectCompactWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount)
+{
+	uintptr_t budgetBytes = _extensions->partialCompactMoveBudget * _moveRate;
+	if ((budgetBytes / _moveRate) != _extensions->partialCompactMoveBudget) {
+		/* overflow - the budget covers any heap */
+		return;
+	}
+
+	/* Slide a window over the table looking for the run of sub areas with the most free memory whose live
+	 * bytes (an upper bound for the bytes moved) fit in the budget. end_segment entries may be part of
+	 * the run, so a window can span several segments. A sub area is the smallest unit of work, so a window
+	 * keeps at least one even when that sub area alone exceeds the budget.
+	 */
+	uintptr_t windowLive = 0;
+	uintptr_t windowFree = 0;
+	uintptr_t bestFree = 0;
+	uintptr_t bestLow = 0;
+	uintptr_t bestHigh = 0;
+	uintptr_t low = 0;
+	bool wholeHeapFits = true;
+	for (uintptr_t high = 0; high < subAreaCount; high++) {
+		SubAreaEntry *entry = &_subAreaTable[high];
+		if (SubAreaEntry::init != entry->state) {
+			continue;
+		}
+		windowLive += entry->liveBytes;
+		windowFree += ((uintptr_t)_subAreaTable[high + 1].firstObject - (uintptr_t)entry->firstObject) - entry->liveBytes;
+		if (windowLive > budgetBytes) {
+			wholeHeapFits = false;
+		}
+		while ((windowLive > budgetBytes) && (low < high)) {
+			SubAreaEntry *lowEntry = &_subAreaTable[low];
+			if (SubAreaEntry::init == lowEntry->state) {
+				windowLive -= lowEntry->liveBytes;
+				windowFree -= ((uintptr_t)_subAreaTable[low + 1].firstObject - (uintptr_t)lowEntry->firstObject) - lowEntry->liveBytes;
+			}
+			low += 1;
+		}
+		if ((low <= high) && (windowFree > bestFree)) {
+			bestFree = windowFree;
+			bestLow = low;
+			bestHigh = high + 1;
+		}
+	}
+
+	if (wholeHeapFits) {
+		return;
+	}
+
+	_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+	_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if (SubAreaEntry::init == _subAreaTable[i].state) {
+			if ((i < bestLow) || (i >= bestHigh)) {
+				_subAreaTable[i].state = SubAreaEntry::fixup_only;
+			} else {
+				_compactFrom = (_compactFrom < _subAreaTable[i].firstObject) ? _compactFrom : _subAreaTable[i].firstObject;
+				_compactTo = (_compactTo > _subAreaTable[i + 1].firstObject) ? _compactTo : _subAreaTable[i + 1].firstObject;
+			}
+		}
+	}
+
+	env->_compactStats._windowSize = (_compactFrom < _compactTo) ? ((uintptr_t)_compactTo - (uintptr_t)_compactFrom) : 0;
+	Trc_MM_CompactScheme_selectCompactWindow(env->getLanguageVMThread(), _compactFrom, _compactTo, budgetBytes, bestFree);
+}
+
+void
+MM_CompactScheme::updateMoveRate(MM_EnvironmentBase *env, uintptr_t movedBytes, uint64_t moveTime)
+{
+	/* very short moves are dominated by setup and say little about throughput */
+	if ((0 != moveTime) && (movedBytes >= DESIRED_SUBAREA_SIZE)) {
+		uintptr_t observedRate = OMR_MAX((uintptr_t)1, (uintptr_t)(movedBytes / moveTime));
+		_moveRate = (_moveRate + observedRate) / 2;
+	}
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -537,6 +650,14 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	uintptr_t fixupObjectsCount = 0;
 	bool singleThreaded = false;
 
+	/* A compaction is partial (its move phase is confined to the move budget, fixup still covers the whole
+	 * heap) unless it is needed to free memory at the top of the heap
+	 * (contraction) or has to recover every free byte (aggressive).
+	 */
+	bool partial = (0 != _extensions->partialCompactMoveBudget)
+		&& !aggressive
+		&& (COMPACT_CONTRACT != _extensions->globalGCStats.compactStats._compactReason);
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		/* Do any necessary initialization */
 		/* TODO: Perhaps the task dispatch should occur internally within so that the initialization doesn't need to be
@@ -550,6 +671,21 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Sliding windows leave a free chunk at the top of every window, so they are not used when the
+		 * compaction has to gather the free memory (aggressive, or to satisfy an allocation) or move it to
+		 * the top of the heap (contraction).
+		 */
+		_slidingCompaction = false;
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+		/* objects growing when moved could overwrite their neighbours before they slide */
+		if (_extensions->compactSlidingWindows && !partial && !aggressive
+			&& !isCompactingForAllocation(_extensions->globalGCStats.compactStats._compactReason)
+		) {
+			_slidingCompaction = createSlidingTables(env);
+		}
+		env->_compactStats._slidingWindows = _slidingCompaction ? _slidingWindowCount : 0;
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -563,14 +699,31 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		singleThreaded = true;
 	}
 
-	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
-	env->_compactStats._setupEndTime = omrtime_hires_clock();
+	if (_slidingCompaction) {
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		slidingWorkerSetupForGC(env);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
+
+		env->_compactStats._moveStartTime = omrtime_hires_clock();
+		slideBlocks(env, objectCount, byteCount);
+		env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
+
+		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupSlidingBlocks(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else {
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		workerSetupForGC(env, singleThreaded, partial);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
+	}
 
 	/* If a single threaded compaction force compact to run on master thread. Required
 	 * to ensure all events issued on master thread.
 	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+	if (!_slidingCompaction && (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID))) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
 		moveObjects(env, objectCount, byteCount, skippedObjectCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
@@ -600,7 +753,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_slidingCompaction) {
+			rebuildFreelistSliding(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -614,7 +771,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_slidingCompaction) {
+			rebuildMarkbitsSliding(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -685,10 +846,32 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeSize = 0;
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
-			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
+			} else if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Objects of a sub area left out of a partial compaction did not move, so its
+				 * free memory is found between the marked objects
+				 */
+				omrobjectptr_t finish = subAreaTable[i + 1].firstObject;
+				/* The next sub area starts at the first marked object of its page, so no object of this sub area
+				 * starts on the page of finish. This only holds at the end of a segment if the segment top is page aligned.
 				 */
+				Assert_MM_true((SubAreaEntry::end_segment != subAreaTable[i + 1].state) || (finish == pageStart(pageIndex(finish))));
+				if ((NULL == currentFreeBase) && !_markMap->isBitSet(subAreaTable[i].firstObject)) {
+					/* first sub area of the segment, which does not start with an object */
+					currentFreeBase = (void *)subAreaTable[i].firstObject;
+				}
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					if ((NULL != currentFreeBase) && ((void *)objectPtr > currentFreeBase)) {
+						addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+					}
+					currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+				}
+				if (currentFreeBase == (void *)finish) {
+					currentFreeBase = NULL;
+				}
+			} else {
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -1411,7 +1594,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1454,8 +1637,11 @@ MM_CompactScheme::rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapR
 void
 MM_CompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
 {
-	MM_CompactFixHeapForWalkTask fixHeapForWalkTask(env, _dispatcher, this);
-	_dispatcher->run(env, &fixHeapForWalkTask);
+	/* a sliding compaction moves every object, so there are no fixup_only sub areas to walk */
+	if (!_slidingCompaction) {
+		MM_CompactFixHeapForWalkTask fixHeapForWalkTask(env, _dispatcher, this);
+		_dispatcher->run(env, &fixHeapForWalkTask);
+	}
 }
 
 void
@@ -1515,4 +1701,324 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+bool
+MM_CompactScheme::isCompactingForAllocation(CompactReason compactReason)
+{
+	switch (compactReason) {
+	case COMPACT_LARGE:
+	case COMPACT_AVOID_DESPERATE:
+	case COMPACT_MEMORY_INSUFFICIENT:
+	case COMPACT_CONTRACT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool
+MM_CompactScheme::createSlidingTables(MM_EnvironmentStandard *env)
+{
+	Assert_MM_true(0 == (COMPACT_SLIDING_BLOCK_SIZE % sizeof_page));
+	Assert_MM_true(0 == (COMPACT_SLIDING_WINDOW_SIZE % COMPACT_SLIDING_BLOCK_SIZE));
+
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t blockCount = 0;
+	uintptr_t windowCount = 0;
+	while (NULL != (region = regionCounter.nextRegion())) {
+		if (region->isCommitted() && (0 != region->getSize())) {
+			blockCount += ((region->getSize() - 1) / COMPACT_SLIDING_BLOCK_SIZE) + 1;
+			windowCount += ((region->getSize() - 1) / COMPACT_SLIDING_WINDOW_SIZE) + 1;
+		}
+	}
+
+	if (blockCount > _slidingBlockCapacity) {
+		if (NULL != _slidingBlocks) {
+			env->getForge()->free(_slidingBlocks);
+		}
+		_slidingBlockCapacity = 0;
+		_slidingBlocks = (SlidingBlockEntry *)env->getForge()->allocate(sizeof(SlidingBlockEntry) * blockCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _slidingBlocks) {
+			return false;
+		}
+		_slidingBlockCapacity = blockCount;
+	}
+	if (windowCount > _slidingWindowCapacity) {
+		if (NULL != _slidingWindows) {
+			env->getForge()->free(_slidingWindows);
+		}
+		_slidingWindowCapacity = 0;
+		_slidingWindows = (SlidingWindowEntry *)env->getForge()->allocate(sizeof(SlidingWindowEntry) * windowCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _slidingWindows) {
+			return false;
+		}
+		_slidingWindowCapacity = windowCount;
+	}
+
+	uintptr_t blockIndex = 0;
+	uintptr_t windowIndex = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t regionLow = (uintptr_t)region->getLowAddress();
+		uintptr_t regionHigh = (uintptr_t)region->getHighAddress();
+		for (uintptr_t windowLow = regionLow; windowLow < regionHigh; windowLow += COMPACT_SLIDING_WINDOW_SIZE) {
+			uintptr_t windowHigh = OMR_MIN(regionHigh, windowLow + COMPACT_SLIDING_WINDOW_SIZE);
+			SlidingWindowEntry *window = &_slidingWindows[windowIndex++];
+			window->firstBlock = blockIndex;
+			window->blockCount = 0;
+			window->base = windowLow;
+			window->top = windowHigh;
+			window->destinationTop = windowLow;
+			window->memorySubSpace = region->getSubSpace();
+			for (uintptr_t blockLow = windowLow; blockLow < windowHigh; blockLow += COMPACT_SLIDING_BLOCK_SIZE) {
+				SlidingBlockEntry *block = &_slidingBlocks[blockIndex++];
+				block->low = (omrobjectptr_t)blockLow;
+				block->high = (omrobjectptr_t)OMR_MIN(windowHigh, blockLow + COMPACT_SLIDING_BLOCK_SIZE);
+				block->liveBytes = 0;
+				block->sourceTop = 0;
+				block->windowSourceTop = 0;
+				block->destination = 0;
+				block->dependencyLow = 0;
+				block->moved = 0;
+				window->blockCount += 1;
+			}
+		}
+	}
+	_slidingBlockCount = blockIndex;
+	_slidingWindowCount = windowIndex;
+
+	/* every object may move */
+	_compactFrom = (omrobjectptr_t)_heap->getHeapBase();
+	_compactTo = (omrobjectptr_t)_heap->getHeapTop();
+
+	return true;
+}
+
+void
+MM_CompactScheme::slidingWorkerSetupForGC(MM_EnvironmentStandard *env)
+{
+	/* live bytes and extent of the objects of every block */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlocks[i];
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)block->low, (uintptr_t *)block->high);
+			omrobjectptr_t objectPtr = NULL;
+			uintptr_t liveBytes = 0;
+			uintptr_t sourceTop = 0;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				liveBytes += objectSize;
+				sourceTop = (uintptr_t)objectPtr + objectSize;
+			}
+			block->liveBytes = liveBytes;
+			block->sourceTop = sourceTop;
+		}
+	}
+
+	/* Single threaded pass to start every window after the objects straddling into it, which belong to
+	 * (and are moved with) a lower window. Objects do not cross regions, so the running top never exceeds
+	 * the low address of the first window of a region. A window covered by a large object is left empty.
+	 */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t straddlingTop = 0;
+		for (uintptr_t w = 0; w < _slidingWindowCount; w++) {
+			SlidingWindowEntry *window = &_slidingWindows[w];
+			uintptr_t windowLow = (uintptr_t)_slidingBlocks[window->firstBlock].low;
+			window->base = OMR_MAX(windowLow, straddlingTop);
+			if ((0 != w) && (_slidingWindows[w - 1].top == windowLow)) {
+				/* the free memory of the previous window of the region ends where this window starts */
+				_slidingWindows[w - 1].top = window->base;
+			}
+			for (uintptr_t i = window->firstBlock; i < (window->firstBlock + window->blockCount); i++) {
+				straddlingTop = OMR_MAX(straddlingTop, _slidingBlocks[i].sourceTop);
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* prefix sum of the live bytes over the blocks of every window, and the blocks each block has to wait for */
+	for (uintptr_t w = 0; w < _slidingWindowCount; w++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingWindowEntry *window = &_slidingWindows[w];
+			uintptr_t lastBlock = window->firstBlock + window->blockCount;
+			uintptr_t destination = window->base;
+			uintptr_t windowSourceTop = 0;
+			uintptr_t dependencyLow = window->firstBlock;
+			for (uintptr_t i = window->firstBlock; i < lastBlock; i++) {
+				SlidingBlockEntry *block = &_slidingBlocks[i];
+				block->destination = destination;
+				destination += block->liveBytes;
+				/* objects of the lower blocks ending above the destination of this block may be overwritten
+				 * by its objects; both destination and windowSourceTop grow with i, so dependencyLow only moves up
+				 */
+				while ((dependencyLow < i) && (_slidingBlocks[dependencyLow].windowSourceTop <= block->destination)) {
+					dependencyLow += 1;
+				}
+				block->dependencyLow = dependencyLow;
+				windowSourceTop = OMR_MAX(windowSourceTop, block->sourceTop);
+				block->windowSourceTop = windowSourceTop;
+			}
+			Assert_MM_true(destination <= window->top);
+			window->destinationTop = destination;
+		}
+	}
+
+	completeSubAreaTable(env);
+}
+
+void
+MM_CompactScheme::slideBlocks(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	/* Work units are handed out in increasing order and a block only waits for lower blocks of its
+	 * window, which have all been claimed by running threads, so the lowest block waiting can always proceed.
+	 */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlocks[i];
+			for (uintptr_t j = block->dependencyLow; j < i; j++) {
+				if (0 == _slidingBlocks[j].moved) {
+					omrthread_monitor_enter(_slidingMonitor);
+					while (0 == _slidingBlocks[j].moved) {
+						omrthread_monitor_wait(_slidingMonitor);
+					}
+					omrthread_monitor_exit(_slidingMonitor);
+				}
+			}
+			MM_AtomicOperations::loadSync();
+
+			slideBlock(env, block, objectCount, byteCount);
+
+			MM_AtomicOperations::storeSync();
+			omrthread_monitor_enter(_slidingMonitor);
+			block->moved = 1;
+			omrthread_monitor_notify_all(_slidingMonitor);
+			omrthread_monitor_exit(_slidingMonitor);
+		}
+	}
+}
+
+void
+MM_CompactScheme::slideBlock(MM_EnvironmentStandard *env, SlidingBlockEntry *block, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	omrobjectptr_t deadObject = (omrobjectptr_t)block->destination;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)block->low, (uintptr_t *)block->high);
+	omrobjectptr_t objectPtr = NULL;
+	intptr_t page = -1; /* invalid value */
+	intptr_t counter = 0; /* obj on page, first is zero */
+	CompactTableEntry entry;
+
+	/* the compact table entry of a page overlays the mark bits of that page, so it is only stored once
+	 * the iterator has moved past the page
+	 */
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+		/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+		saveForwardingPtr(entry, objectPtr, deadObject, page, counter);
+
+		if (deadObject != objectPtr) {
+			Assert_MM_true(deadObject < objectPtr);
+			memmove(deadObject, objectPtr, objectSize);
+			objectCount += 1;
+			byteCount += objectSize;
+		}
+		deadObject = (omrobjectptr_t)((uintptr_t)deadObject + objectSize);
+	}
+
+	if (page != -1) {
+		_compactTable[page] = entry;
+	}
+
+	Assert_MM_true((uintptr_t)deadObject == (block->destination + block->liveBytes));
+}
+
+void
+MM_CompactScheme::fixupSlidingBlocks(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlocks[i];
+			if (0 != block->liveBytes) {
+				/* the moved objects of a block are contiguous */
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)block->destination, (omrobjectptr_t)(block->destination + block->liveBytes), false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					objectCount++;
+					fixupObject.fixupObject(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::rebuildFreelistSliding(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t w = 0;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		MM_CompactMemoryPoolState poolStateObj;
+		MM_CompactMemoryPoolState *poolState = &poolStateObj;
+
+		/* Initialize current memory pool sweep chunk */
+		poolState->_memoryPool = memorySubSpace->getMemoryPool(region->getLowAddress());
+
+		for (; (w < _slidingWindowCount) && (_slidingWindows[w].top <= (uintptr_t)region->getHighAddress()); w++) {
+			SlidingWindowEntry *window = &_slidingWindows[w];
+			uintptr_t freeSize = window->top - window->destinationTop;
+			if (0 != freeSize) {
+#if defined(DEBUG_PAINT_FREE)
+				memset((void *)window->destinationTop, 0xBB, freeSize);
+#endif /* DEBUG_PAINT_FREE */
+				addFreeEntry(env, memorySubSpace, poolState, (void *)window->destinationTop, freeSize);
+			}
+		}
+
+		if (NULL != poolState->_freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+													(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+		}
+		flushPool(env, poolState);
+	}
+	Assert_MM_true(w == _slidingWindowCount);
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsSliding(MM_EnvironmentStandard *env)
+{
+	/* clear the compact table, which overlays the mark bits, before any bit is set at a new location */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			_markMap->setBitsInRange(env, _slidingBlocks[i].low, _slidingBlocks[i].high, true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlocks[i];
+			if (0 != block->liveBytes) {
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)block->destination, (omrobjectptr_t)(block->destination + block->liveBytes), false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					_markMap->setBit(objectPtr);
+				}
+			}
+		}
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
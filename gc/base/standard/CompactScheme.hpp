@@ -25,6 +25,7 @@
 
 #include "omrcfg.h"
 #include "omr.h"
+#include "omrthread.h"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
@@ -93,6 +94,7 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+        uintptr_t liveBytes; /**< bytes of marked objects in the subarea, only counted when the compaction is partial */
         
     	/* legal values for currentAction */
     	enum {
@@ -123,6 +125,31 @@ private:
     	};
     };
 
+    /* A sliding compaction divides every region in fixed size blocks, grouped in windows. The objects
+     * of a window slide towards the window base, in address order, so the destination of each block is
+     * the window base plus the live bytes of the blocks below it in the window (a prefix sum).
+     * Objects belong to the block they start in.
+     */
+    struct SlidingBlockEntry {
+		omrobjectptr_t low; /**< base address of the block */
+		omrobjectptr_t high; /**< top address of the block (not included) */
+		uintptr_t liveBytes; /**< bytes of the marked objects starting in the block */
+		uintptr_t sourceTop; /**< end of the last marked object starting in the block, 0 if there is none */
+		uintptr_t windowSourceTop; /**< highest sourceTop of the blocks of the window up to this one */
+		uintptr_t destination; /**< address the first object of the block is moved to */
+		uintptr_t dependencyLow; /**< index of the first block whose objects may lie in the destination of this block */
+		volatile uintptr_t moved; /**< set once the objects of the block have been moved */
+    };
+
+    struct SlidingWindowEntry {
+		uintptr_t firstBlock; /**< index of the first block of the window */
+		uintptr_t blockCount; /**< number of blocks in the window */
+		uintptr_t base; /**< start of the window: its low address, or the end of an object straddling into it */
+		uintptr_t top; /**< base of the next window of the region, or the region top */
+		uintptr_t destinationTop; /**< end of the objects of the window once moved */
+		MM_MemorySubSpace *memorySubSpace; /**< subspace owning the region of the window */
+    };
+
 protected:
     OMR_VM *_omrVM;
     MM_GCExtensionsBase *_extensions;
@@ -138,6 +165,15 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+    uintptr_t _moveRate; /**< observed bytes moved per microsecond, used to turn partialCompactMoveBudget into a byte budget */
+    SlidingBlockEntry *_slidingBlocks; /**< blocks of a sliding compaction, in address order */
+    uintptr_t _slidingBlockCount; /**< number of blocks used by the current sliding compaction */
+    uintptr_t _slidingBlockCapacity; /**< number of entries allocated for _slidingBlocks */
+    SlidingWindowEntry *_slidingWindows; /**< windows of a sliding compaction, in address order */
+    uintptr_t _slidingWindowCount; /**< number of windows used by the current sliding compaction */
+    uintptr_t _slidingWindowCapacity; /**< number of entries allocated for _slidingWindows */
+    bool _slidingCompaction; /**< true if the current (or last) compaction slides windows instead of evacuating sub areas */
+    omrthread_monitor_t _slidingMonitor; /**< used by the blocks of a sliding compaction to wait for the blocks their destination overlaps */
     MM_CompactDelegate _delegate;
 
 public:
@@ -165,9 +201,20 @@ protected:
      * Set the real limits for a specific subArea
      *
      * @param env[in] the current thread
+     * @param countLiveBytes[in] true if the live bytes of each subArea must be recorded
      */
-    void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
-    void removeNullSubAreas(MM_EnvironmentStandard *env);
+    void setRealLimitsSubAreas(MM_EnvironmentStandard *env, bool countLiveBytes);
+    void removeNullSubAreas(MM_EnvironmentStandard *env, bool partial);
+
+    /**
+     * Restrict the compaction to the contiguous run of subAreas which frees the most memory while moving
+     * no more live bytes than partialCompactMoveBudget allows. The subAreas outside of the run become fixup_only.
+     * Must be called by a single thread, after null subAreas have been removed.
+     *
+     * @param env[in] the current thread
+     * @param subAreaCount[in] number of entries in the subArea table (including end_segment entries)
+     */
+    void selectCompactWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount);
     void completeSubAreaTable(MM_EnvironmentStandard *env);
 
     void saveForwardingPtr(class CompactTableEntry&,
@@ -302,16 +349,88 @@ protected:
      * @return true if the action was changed, or false if another thread already changed it to newAction
      */
     bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+    /**
+     * Check if a compaction has to gather the free memory in the largest possible entries, because it was
+     * triggered by an allocation (or a failed tenure) that the free memory could not satisfy, by a heap close
+     * to running out of free memory, or by a heap contraction. Such compactions do not slide windows.
+     *
+     * @param compactReason[in] the reason of the compaction
+     * @return true if the compaction is needed to satisfy allocations or to contract the heap
+     */
+    static bool isCompactingForAllocation(CompactReason compactReason);
+
+    /**
+     * Divide the committed regions in blocks and windows for a sliding compaction, growing the tables if needed.
+     * Must be called by a single thread.
+     *
+     * @param env[in] the master thread
+     * @return true if the tables are ready, false if they could not be allocated
+     */
+    bool createSlidingTables(MM_EnvironmentStandard *env);
+
+    /**
+     * Count the live bytes of every block and compute in parallel the destination of each block with a
+     * prefix sum over the blocks of its window.
+     *
+     * @param env[in] the current thread
+     */
+    void slidingWorkerSetupForGC(MM_EnvironmentStandard *env);
+
+    /**
+     * Move the objects of every block to their destination and record their forwarding addresses. Any
+     * thread may move any block, once the blocks whose objects lie in its destination have been moved.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects moved (accumulated)
+     * @param[in/out] byteCount the number of bytes moved (accumulated)
+     */
+    void slideBlocks(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+
+    /**
+     * Move the objects of one block, see slideBlocks().
+     */
+    void slideBlock(MM_EnvironmentStandard *env, SlidingBlockEntry *block, uintptr_t &objectCount, uintptr_t &byteCount);
+
+    /**
+     * Fix up the references of the objects moved by a sliding compaction, a block at a time.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects fixed up (accumulated)
+     */
+    void fixupSlidingBlocks(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+
+    /**
+     * Rebuild the free lists from the memory left at the top of every window. Must be called by a single thread.
+     *
+     * @param env[in] the master thread
+     */
+    void rebuildFreelistSliding(MM_EnvironmentStandard *env);
+
+    /**
+     * Set the mark bits of the objects at their new location after a sliding compaction.
+     *
+     * @param env[in] the current thread
+     */
+    void rebuildMarkbitsSliding(MM_EnvironmentStandard *env);
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
 	void kill(MM_EnvironmentBase *env);
 
-    void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
+    void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded, bool partial);
 	void masterSetupForGC(MM_EnvironmentStandard *env);
     virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
     omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
+
+	/**
+	 * Fold the move throughput of a completed compaction into the rate used to size partial compactions.
+	 * @param env[in] the master thread
+	 * @param movedBytes[in] bytes moved by all threads
+	 * @param moveTime[in] duration of the move phase in microseconds
+	 */
+	void updateMoveRate(MM_EnvironmentBase *env, uintptr_t movedBytes, uint64_t moveTime);
 	void fixHeapForWalk(MM_EnvironmentBase *env);
 	void parallelFixHeapForWalk(MM_EnvironmentBase *env);
 
@@ -335,6 +454,15 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _moveRate(COMPACT_INITIAL_MOVE_RATE)
+    	, _slidingBlocks(NULL)
+    	, _slidingBlockCount(0)
+    	, _slidingBlockCapacity(0)
+    	, _slidingWindows(NULL)
+    	, _slidingWindowCount(0)
+    	, _slidingWindowCapacity(0)
+    	, _slidingCompaction(false)
+    	, _slidingMonitor(NULL)
     	, _delegate()
     {
     	_typeId = __FUNCTION__;
@@ -494,6 +494,13 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		/* The summary lets card cleaning skip cache lines of the card table which have no dirty cards */
+		if (_extensions->concurrentCardTableSummary) {
+			if (!initializeSummary(env, calculateCardTableSize(env, heap->getMaximumPhysicalRange()))) {
+				return false;
+			}
+		}
+	
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -609,6 +616,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			setSummaryBitForCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -966,6 +974,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			setSummaryBitForCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1012,6 +1021,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		setSummaryBitForCard(card);
 	}
 
 	return true;
@@ -1639,25 +1649,13 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
+			/* Is the card clean? If so skip to the next card which is not. This is based on
+	 		 * the premise that the card table will be mostly empty: runs of clean cards are
+	 		 * scanned a vector at a time, and if the card table keeps a summary, cache lines
+	 		 * of cards without any dirty card are not read at all.
 	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
+			if ((Card)CARD_CLEAN == *currentCard) {
+				currentCard = findFirstNonCleanCard(env, currentCard, lastCardToClean);
 
 				if (currentCard >= lastCardToClean) {
 					break;
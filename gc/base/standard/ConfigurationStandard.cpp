@@ -157,7 +157,7 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	uintptr_t minimumFreeEntrySize = extensions->tlhMinimumSize;
 
-	bool doSplit = 1 < extensions->splitFreeListSplitAmount;
+	bool doSplit = 1 < OMR_MAX(extensions->splitFreeListSplitAmount, extensions->splitFreeListSplitAmountMaximum);
 	bool doHybrid = extensions->enableHybridMemoryPool;
 
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "FreePageReleaser.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+#include "MemorySubSpace.hpp"
+#include "ModronAssertions.h"
+
+MM_FreePageReleaser *
+MM_FreePageReleaser::newInstance(MM_EnvironmentBase *env)
+{
+	MM_FreePageReleaser *releaser = (MM_FreePageReleaser *)env->getForge()->allocate(sizeof(MM_FreePageReleaser), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_FreePageReleaser();
+		if (!releaser->initialize(env)) {
+			releaser->kill(env);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_FreePageReleaser::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreePageReleaser::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Heap *heap = extensions->heap;
+	uintptr_t pageSize = heap->getPageSize();
+	uintptr_t granuleSize = extensions->releaseFreePagesGranuleSize;
+
+	if (extensions->_hugePageManager.isAlignmentRequired()) {
+		/* releasing part of a huge page would split it */
+		granuleSize = OMR_MAX(granuleSize, extensions->_hugePageManager.getHugePageSize());
+	}
+	_granuleSize = MM_Math::roundToCeiling(pageSize, OMR_MAX(granuleSize, pageSize));
+	_heapBase = (uintptr_t)heap->getHeapBase();
+	Assert_MM_true(0 == (_heapBase % pageSize));
+
+	/* a partial granule at the top of the reservation is never released */
+	_granuleCount = ((uintptr_t)heap->getHeapTop() - _heapBase) / _granuleSize;
+	if (0 != _granuleCount) {
+		_granuleStates = (uint8_t *)env->getForge()->allocate(_granuleCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _granuleStates) {
+			return false;
+		}
+		memset(_granuleStates, GRANULE_IN_USE, _granuleCount);
+	}
+
+	return true;
+}
+
+void
+MM_FreePageReleaser::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _granuleStates) {
+		env->getForge()->free(_granuleStates);
+		_granuleStates = NULL;
+	}
+	_granuleCount = 0;
+}
+
+void
+MM_FreePageReleaser::resetRange(void *lowAddress, void *highAddress)
+{
+	uintptr_t firstGranule = ((uintptr_t)lowAddress - _heapBase) / _granuleSize;
+	uintptr_t topGranule = OMR_MIN(_granuleCount, ((uintptr_t)highAddress - _heapBase + _granuleSize - 1) / _granuleSize);
+
+	for (uintptr_t i = firstGranule; i < topGranule; i++) {
+		_granuleStates[i] = GRANULE_IN_USE;
+	}
+}
+
+void
+MM_FreePageReleaser::flagFreeGranules(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)subSpace->getFirstFreeStartingAddr(env);
+	while (NULL != freeEntry) {
+		/* the header of the entry must stay committed */
+		uintptr_t freeBase = (uintptr_t)freeEntry + sizeof(MM_HeapLinkedFreeHeader);
+		uintptr_t freeTop = (uintptr_t)freeEntry->afterEnd();
+		uintptr_t firstGranule = (freeBase - _heapBase + _granuleSize - 1) / _granuleSize;
+		uintptr_t topGranule = OMR_MIN(_granuleCount, (freeTop - _heapBase) / _granuleSize);
+
+		for (uintptr_t i = firstGranule; i < topGranule; i++) {
+			_granuleStates[i] |= GRANULE_FREE;
+		}
+		freeEntry = (MM_HeapLinkedFreeHeader *)subSpace->getNextFreeStartingAddr(env, freeEntry);
+	}
+}
+
+void
+MM_FreePageReleaser::collectStart(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	flagFreeGranules(env, subSpace);
+
+	/* granules allocated into since the last global GC may be resident again */
+	for (uintptr_t i = 0; i < _granuleCount; i++) {
+		if (GRANULE_FREE == (_granuleStates[i] & GRANULE_FREE)) {
+			_granuleStates[i] &= GRANULE_STATE_MASK;
+		} else {
+			_granuleStates[i] = GRANULE_IN_USE;
+		}
+	}
+}
+
+uintptr_t
+MM_FreePageReleaser::releaseGranules(MM_EnvironmentBase *env, uintptr_t firstGranule, uintptr_t topGranule)
+{
+	void *base = (void *)(_heapBase + (firstGranule * _granuleSize));
+	uintptr_t size = (topGranule - firstGranule) * _granuleSize;
+	void *top = (void *)((uintptr_t)base + size);
+
+	if (!env->getExtensions()->heap->decommitMemory(base, size, base, top)) {
+		/* leave the granules idle so they are retried after the next global GC */
+		return 0;
+	}
+	for (uintptr_t i = firstGranule; i < topGranule; i++) {
+		_granuleStates[i] = GRANULE_RELEASED;
+	}
+	return size;
+}
+
+uintptr_t
+MM_FreePageReleaser::releaseFreePages(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	uintptr_t maximumRelease = env->getExtensions()->releaseFreePagesMaximumPerGC;
+	uintptr_t budget = (0 == maximumRelease) ? UDATA_MAX : maximumRelease;
+	uintptr_t releasedBytes = 0;
+	/* consecutive granules to release are collected into runs, so each run is decommitted with a single call */
+	uintptr_t runStart = 0;
+	uintptr_t runLength = 0;
+
+	flagFreeGranules(env, subSpace);
+
+	for (uintptr_t i = 0; i < _granuleCount; i++) {
+		uint8_t state = _granuleStates[i];
+		bool releaseGranule = false;
+
+		if (GRANULE_FREE != (state & GRANULE_FREE)) {
+			_granuleStates[i] = GRANULE_IN_USE;
+		} else {
+			state &= GRANULE_STATE_MASK;
+			_granuleStates[i] = state;
+			if (GRANULE_IN_USE == state) {
+				_granuleStates[i] = GRANULE_IDLE;
+			} else if ((GRANULE_IDLE == state) && (budget >= _granuleSize)) {
+				budget -= _granuleSize;
+				releaseGranule = true;
+			}
+		}
+
+		if (releaseGranule) {
+			if (0 == runLength) {
+				runStart = i;
+			}
+			runLength += 1;
+		} else if (0 != runLength) {
+			releasedBytes += releaseGranules(env, runStart, runStart + runLength);
+			runLength = 0;
+		}
+	}
+	if (0 != runLength) {
+		releasedBytes += releaseGranules(env, runStart, runStart + runLength);
+	}
+
+	return releasedBytes;
+}
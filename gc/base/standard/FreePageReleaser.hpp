@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(FREEPAGERELEASER_HPP_)
+#define FREEPAGERELEASER_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_MemorySubSpace;
+
+/**
+ * Returns tenure memory that is no longer used to the operating system after global collections.
+ *
+ * The heap is divided into fixed size granules with one state byte each. A granule is considered free when it
+ * lies entirely within a free list entry (excluding the entry header). Free granules are only decommitted once
+ * they have stayed free over a whole cycle: free at the start of a global GC, untouched by allocation until the
+ * start of the next one and still free at its end. This keeps memory that is only briefly free (between a GC and
+ * the next allocation burst) committed. The number of bytes decommitted per GC is limited by
+ * MM_GCExtensionsBase::releaseFreePagesMaximumPerGC.
+ *
+ * Decommitted pages stay mapped (see omrvmem_decommit_memory()), so they are recommitted lazily by the OS when
+ * the memory is allocated again.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_FreePageReleaser : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	enum {
+		GRANULE_IN_USE = 0, /**< granule may be backed by resident pages */
+		GRANULE_IDLE = 1, /**< granule was free at the end of the last global GC */
+		GRANULE_RELEASED = 2, /**< granule has been decommitted and not allocated into since */
+		GRANULE_STATE_MASK = 0x7F,
+		GRANULE_FREE = 0x80 /**< transient flag set while scanning the free list */
+	};
+
+	uint8_t *_granuleStates; /**< one state byte per granule of the heap reservation */
+	uintptr_t _granuleCount; /**< number of whole granules in the heap reservation */
+	uintptr_t _granuleSize; /**< size of a granule in bytes (a multiple of the heap page size) */
+	uintptr_t _heapBase; /**< base address granules are measured from */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Set the GRANULE_FREE flag of every granule that lies entirely within a free entry of the given subspace.
+	 */
+	void flagFreeGranules(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	/**
+	 * Decommit the granules [firstGranule, topGranule) and mark them released.
+	 * @return number of bytes decommitted
+	 */
+	uintptr_t releaseGranules(MM_EnvironmentBase *env, uintptr_t firstGranule, uintptr_t topGranule);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_FreePageReleaser *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the state of the granules overlapping the given range (used when the heap is expanded or contracted).
+	 */
+	void resetRange(void *lowAddress, void *highAddress);
+
+	/**
+	 * Record which granules are still untouched since the end of the previous global GC. Must be called at the
+	 * start of a global GC, after allocation caches have been flushed and before the free list is rebuilt.
+	 * @param subSpace[in] the tenure memory subspace
+	 */
+	void collectStart(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	/**
+	 * Decommit granules that stayed free over the whole cycle, up to the per-GC limit. Must be called at the end
+	 * of a global GC, once the free list of the subspace is complete.
+	 * @param subSpace[in] the tenure memory subspace
+	 * @return number of bytes decommitted
+	 */
+	uintptr_t releaseFreePages(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	MMINLINE uintptr_t getGranuleSize() { return _granuleSize; }
+
+	/**
+	 * Create a FreePageReleaser object.
+	 */
+	MM_FreePageReleaser()
+		: MM_BaseVirtual()
+		, _granuleStates(NULL)
+		, _granuleCount(0)
+		, _granuleSize(0)
+		, _heapBase(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+
+#endif /* FREEPAGERELEASER_HPP_ */
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+class MM_Packet;
+
+/* Number of entries in each deque, must be a power of two */
+#define OMR_WORKPACKETS_DEQUE_SIZE 64
+#define OMR_WORKPACKETS_DEQUE_MASK (OMR_WORKPACKETS_DEQUE_SIZE - 1)
+/* Padding used to keep the thief-side and owner-side indices on separate cache lines */
+#define OMR_WORKPACKETS_DEQUE_PADDING 128
+
+/**
+ * Bounded work-stealing deque of non-empty work packets (Chase-Lev).
+ *
+ * Each marking thread owns one deque. Only the owner pushes and pops, at the bottom end, so the common
+ * path takes no lock and at most one atomic operation (when racing for the last entry). Other threads
+ * steal the oldest packet from the top end with a single compare-and-swap. The deque does not grow: push()
+ * fails once it is full and the caller falls back to the shared packet lists.
+ *
+ * @see MM_CopyScanCacheDeque for the scavenger equivalent
+ * @ingroup GC_Modron_Standard
+ */
+class MM_PacketDeque
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by thieves (and by the owner when taking the last entry) */
+	uint8_t _topPadding[OMR_WORKPACKETS_DEQUE_PADDING - sizeof(uintptr_t)];
+	volatile uintptr_t _bottom; /**< index one past the newest entry, written only by the owning thread */
+	uintptr_t _stealSeed; /**< state of the owner's victim selection generator, touched only by the owning thread */
+	MM_Packet * volatile _entries[OMR_WORKPACKETS_DEQUE_SIZE]; /**< ring of entries addressed by masked indices */
+	uint8_t _entriesPadding[OMR_WORKPACKETS_DEQUE_PADDING]; /**< keeps the next deque's _top off the last line of this one */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Push a packet onto the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet the packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		/* a stale _top can only make the deque look fuller than it is */
+		if (OMR_WORKPACKETS_DEQUE_SIZE <= (bottom - _top)) {
+			return false;
+		}
+		_entries[bottom & OMR_WORKPACKETS_DEQUE_MASK] = packet;
+		/* entry must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the newest packet from the bottom of the deque. Must only be called by the owning thread.
+	 * @return the packet or NULL if the deque is empty (or the last entry was lost to a thief)
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			/* thieves can not advance _top past _bottom, so empty stays empty */
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation before looking at _top (store-load ordering) */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		MM_Packet *packet = NULL;
+		if (top < bottom) {
+			/* more than one entry left, no thief can reach this one */
+			packet = _entries[bottom & OMR_WORKPACKETS_DEQUE_MASK];
+		} else {
+			if (top == bottom) {
+				/* last entry - race thieves for it */
+				packet = _entries[bottom & OMR_WORKPACKETS_DEQUE_MASK];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+			}
+			/* the deque is now empty, (re)establish _bottom == _top */
+			_bottom = bottom + 1;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet from the top of the deque. May be called by any thread.
+	 * @return the packet or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		/* the entry must not be read ahead of the _bottom that published it */
+		MM_AtomicOperations::readBarrier();
+
+		if (top < bottom) {
+			MM_Packet *packet = _entries[top & OMR_WORKPACKETS_DEQUE_MASK];
+			if (top == MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				return packet;
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * @return true if the deque appeared empty at the time of the call
+	 */
+	MMINLINE bool isEmpty() { return _bottom <= _top; }
+
+	/**
+	 * Return the next value of the owner's victim selection sequence (xorshift).
+	 * Must only be called by the owning thread.
+	 */
+	MMINLINE uintptr_t
+	nextStealSeed()
+	{
+		uintptr_t seed = _stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_stealSeed = seed;
+		return seed;
+	}
+
+	/**
+	 * Create a deque.
+	 * @param stealSeed non-zero initial state of the victim selection sequence
+	 */
+	MM_PacketDeque(uintptr_t stealSeed)
+		: _top(0)
+		, _bottom(0)
+		, _stealSeed((0 == stealSeed) ? 1 : stealSeed)
+	{
+		for (uintptr_t i = 0; i < OMR_WORKPACKETS_DEQUE_SIZE; i++) {
+			_entries[i] = NULL;
+		}
+	}
+};
+
+#endif /* PACKETDEQUE_HPP_ */
@@ -39,6 +39,7 @@
 #include "CycleState.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreePageReleaser.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
@@ -314,6 +315,13 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->releaseFreePagesAfterGlobalGC) {
+		_freePageReleaser = MM_FreePageReleaser::newInstance(env);
+		if (NULL == _freePageReleaser) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -378,6 +386,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+	if (NULL != _freePageReleaser) {
+		_freePageReleaser->kill(env);
+		_freePageReleaser = NULL;
+	}
 }
 
 uintptr_t
@@ -506,7 +519,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	 */
 	if (_delegate.isAllowUserHeapWalk() || env->_cycleState->_gcCode.isRASDumpGC()) {
 		if (!_fixHeapForWalkCompleted) {
-#if defined(J9VM_GC_MODRON_COMPACTION)
+#if defined(OMR_GC_MODRON_COMPACTION)
 			if (compactedThisCycle) {
 				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 				U_64 startTime = omrtime_hires_clock();
@@ -514,7 +527,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 				_extensions->globalGCStats.fixHeapForWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 				_extensions->globalGCStats.fixHeapForWalkReason = FIXUP_DEBUG_TOOLING;
 			} else
-#endif /* J9VM_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_COMPACTION */
 			{
 				fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 			}
@@ -720,7 +733,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 	{
 		MM_MemoryPool *memoryPool= _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -745,7 +758,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t reusableFreeMemory = stats->getPageAlignedFreeMemory(pageSize);
 
 		uintptr_t darkMatter = 0;
-		if (!_extensions->concurrentSweep){
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatter = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t memoryFragmentationDiff = freeMemory - reusableFreeMemory;
@@ -996,6 +1009,7 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+	_compactScheme->updateMoveRate(env, compactStats->_movedBytes, omrtime_hires_delta(compactStats->_moveStartTime, compactStats->_moveEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -1058,6 +1072,11 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	}
 
 	GC_OMRVMInterface::flushCachesForGC(env);
+
+	if (NULL != _freePageReleaser) {
+		/* free list entries are still those built by the previous sweep, less what has been allocated since */
+		_freePageReleaser->collectStart(env, _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace());
+	}
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
@@ -1085,6 +1104,31 @@ MM_ParallelGlobalGC::tenureMemoryPoolPostCollect(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_ParallelGlobalGC::releaseFreePagesPostCollect(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MemorySubSpace *tenureMemorySubspace = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+
+	uint64_t startTime = omrtime_hires_clock();
+	uintptr_t releasedBytes = _freePageReleaser->releaseFreePages(env, tenureMemorySubspace);
+	uint64_t endTime = omrtime_hires_clock();
+
+	TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		endTime,
+		J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+		HEAP_RELEASE_FREE_PAGES,
+		tenureMemorySubspace->getTypeFlags(),
+		/* GC Time Ratio not applicable for "release free heap pages" */
+		0,
+		releasedBytes,
+		tenureMemorySubspace->getActiveMemorySize(),
+		omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		RELEASE_FREE_PAGES_AFTER_GLOBAL_GC);
+}
+
 void
 MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
 {
@@ -1092,6 +1136,11 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 
 	tenureMemoryPoolPostCollect(env);
 
+	/* the free list is only complete once sweep has completed */
+	if ((NULL != _freePageReleaser) && _sweepScheme->isSweepCompleted(env)) {
+		releaseFreePagesPostCollect(env);
+	}
+
 	reportGCCycleFinalIncrementEnding(env);
 	reportGlobalGCIncrementEnd(env);
 	reportGCIncrementEnd(env);
@@ -1319,6 +1368,10 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 		goto parallelGlobalGC_failed_heapAddRange;
 	}
 
+	if (NULL != _freePageReleaser) {
+		_freePageReleaser->resetRange(lowAddress, highAddress);
+	}
+
 	return true;
 
 parallelGlobalGC_failed_heapAddRange:
@@ -1345,6 +1398,10 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
+	if (NULL != _freePageReleaser) {
+		_freePageReleaser->resetRange(lowAddress, highAddress);
+	}
+
 	return result;
 }
 
@@ -50,6 +50,7 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
 class MM_Dispatcher;
+class MM_FreePageReleaser;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
 
@@ -71,6 +72,7 @@ private:
 	MM_CompactScheme *_compactScheme;
 	bool _compactThisCycle;		/**< keep a decision should compact run this cycle */
 #endif /* OMR_GC_MODRON_COMPACTION */
+	MM_FreePageReleaser *_freePageReleaser; /**< decommits tenure memory that stays free over a global GC cycle (NULL unless releaseFreePagesAfterGlobalGC is enabled) */
 
 protected:
 	MM_MarkingScheme *_markingScheme;
@@ -187,6 +189,11 @@ private:
 	 * redistribute free memory in tenure after global collection (move free memory from LOA to SOA)
 	 */
 	void tenureMemoryPoolPostCollect(MM_EnvironmentBase *env);
+
+	/**
+	 * Return tenure memory that stayed free over the whole cycle to the OS and report the amount released
+	 */
+	void releaseFreePagesPostCollect(MM_EnvironmentBase *env);
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -285,6 +292,7 @@ public:
 	 */
 	uintptr_t fixHeapForWalk(MM_EnvironmentBase *env, UDATA walkFlags, uintptr_t walkReason, MM_HeapWalkerObjectFunc walkFunction);
 	MM_HeapWalker *getHeapWalker() { return _heapWalker; }
+	MM_ParallelHeapWalker *getParallelHeapWalker() { return _heapWalker; }
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -333,6 +341,7 @@ public:
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
+		, _freePageReleaser(NULL)
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _heapWalker(NULL)
@@ -45,6 +45,19 @@ MM_ParallelScavengeTask::masterSetup(MM_EnvironmentBase *env)
 	_collector->setAliasThreshold(calculatedAliasThreshold);
 }
 
+uintptr_t
+MM_ParallelScavengeTask::getWorkEstimate(MM_EnvironmentBase *env)
+{
+	return _collector->getWorkEstimate(env);
+}
+
+bool
+MM_ParallelScavengeTask::setWorkUnitSize(MM_EnvironmentBase *env, uintptr_t workUnitSize)
+{
+	_collector->setScanCacheMaximumSize(workUnitSize);
+	return true;
+}
+
 void
 MM_ParallelScavengeTask::setup(MM_EnvironmentBase *env)
 {
@@ -58,6 +58,13 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	virtual void masterSetup(MM_EnvironmentBase *env);
+	virtual uintptr_t getWorkEstimate(MM_EnvironmentBase *env);
+
+	/**
+	 * Bound the size of the copy scan caches of the scavenge by the suggested work unit size.
+	 * @see MM_Task::setWorkUnitSize
+	 */
+	virtual bool setWorkUnitSize(MM_EnvironmentBase *env, uintptr_t workUnitSize);
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/**
@@ -47,6 +47,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapScan.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScan::findFirstNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -518,11 +512,26 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
+			/* Every map slot up to the next empty one is a dark matter candidate - skip the run at once,
+			 * sampling the same candidates as a slot by slot walk would
+			 */
+			uintptr_t *markMapRunTop = MM_HeapMapScan::findFirstEmptySlot(markMapCurrent + 1, markMapChunkTop);
+			uintptr_t runLength = markMapRunTop - markMapCurrent;
+			uintptr_t nextSample = darkMatterSampleRate - (darkMatterCandidates % darkMatterSampleRate);
+			while (nextSample <= runLength) {
+				uintptr_t sampleIndex = nextSample - 1;
+				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleIndex, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleIndex));
 				darkMatterSamples += 1;
+				if ((runLength - nextSample) < darkMatterSampleRate) {
+					break;
+				}
+				nextSample += darkMatterSampleRate;
 			}
+			darkMatterCandidates += runLength;
+
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * runLength;
+			markMapCurrent = markMapRunTop;
+			continue;
 		} else {
 			/* There is at least a single free slot in the mark map - check the head and tail */
 			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
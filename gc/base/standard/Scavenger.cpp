@@ -101,10 +101,29 @@
 
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.9)
+#define COPIED_BYTES_HISTORY_WEIGHT ((float)0.5)
+/* Work (in bytes) a remembered object is assumed to cost a scavenge, beyond copying its referents */
+#define REMEMBERED_OBJECT_WORK_ESTIMATE 64
 
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* upper bound for the number of slots held pending copy-forward while their referents are prefetched */
+#define SCAVENGER_PREFETCH_WINDOW_MAXIMUM 16
+
+/* granularity at which the heap is striped across NUMA nodes in NUMA-aware mode (rounded up to the heap page size) */
+#define SCAVENGER_NUMA_STRIPE_SIZE (1024 * 1024)
+
+/* layout of _stealingState: scan loop epoch above the idle thread count */
+#define SCAVENGER_STEALING_IDLE_BITS 16
+#define SCAVENGER_STEALING_IDLE_MASK ((((uintptr_t)1) << SCAVENGER_STEALING_IDLE_BITS) - 1)
+/* idle count value held by the thread completing the scan loop while it publishes the new epoch */
+#define SCAVENGER_STEALING_TERMINATING SCAVENGER_STEALING_IDLE_MASK
+/* bounds of the number of pause instructions between checks for work by an idle thread; the count doubles
+ * after every unsuccessful check, and once it reaches the maximum the thread also yields its processor */
+#define SCAVENGER_STEALING_SPIN_COUNT_MINIMUM 16
+#define SCAVENGER_STEALING_SPIN_COUNT_MAXIMUM 1024
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -280,6 +299,38 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	if (_extensions->scavengerNUMAAware && _extensions->numaGCThreadAffinity && !IS_CONCURRENT_ENABLED) {
+		/* node-local destinations only pay off if the copying threads stay on their nodes, so GC threads must be
+		 * bound to them; concurrent scavenger copies on mutator threads too, which are not bound to nodes
+		 */
+		uintptr_t nodeCount = _extensions->_numaManager.getAffinityLeaderCount();
+		if (1 < nodeCount) {
+			MM_Heap *heap = _extensions->heap;
+			uintptr_t stripeSize = MM_Math::roundToCeiling(heap->getPageSize(), SCAVENGER_NUMA_STRIPE_SIZE);
+			if (!_survivorNUMAChunkLists.initialize(env, nodeCount, heap->getHeapBase(), heap->getHeapTop(), stripeSize)) {
+				return false;
+			}
+			if (!_tenureNUMAChunkLists.initialize(env, nodeCount, heap->getHeapBase(), heap->getHeapTop(), stripeSize)) {
+				return false;
+			}
+			_numaAware = true;
+		}
+	}
+
+	if (_extensions->scavengerWorkStealing && !IS_CONCURRENT_ENABLED) {
+		/* concurrent scavenger hands scan caches between mutator and GC threads, so it keeps the shared scan list only */
+		uintptr_t dequeCount = _dispatcher->threadCountMaximum();
+		Assert_MM_true(dequeCount < SCAVENGER_STEALING_TERMINATING);
+		_scanCacheDeques = (MM_CopyScanCacheDeque *)env->getForge()->allocate(sizeof(MM_CopyScanCacheDeque) * dequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new(&_scanCacheDeques[i]) MM_CopyScanCacheDeque((uintptr_t)0x9E3779B9 * (i + 1));
+		}
+		_scanCacheDequeCount = dequeCount;
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
 		if (!_masterGCThread.initialize(this, true, true)) {
@@ -303,6 +354,15 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	_survivorNUMAChunkLists.tearDown(env);
+	_tenureNUMAChunkLists.tearDown(env);
+
+	if (NULL != _scanCacheDeques) {
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -368,12 +428,16 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_rescanThreadsForRememberedObjects = false;
 
 	_doneIndex = 0;
+	_stealingState = 0;
+	_scanCacheMaximumSize = _extensions->scavengerScanCacheMaximumSize;
 
 	restoreMasterThreadTenureTLHRemainders(env);
 
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	Assert_MM_true(!isScanCacheWorkAvailable());
+	Assert_MM_true(_survivorNUMAChunkLists.isEmpty() && _tenureNUMAChunkLists.isEmpty());
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -436,6 +500,23 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (_numaAware) {
+		/* The survivor space alternates between the two halves of the nursery, bind both (before their first touch, when
+		 * possible) whenever the nursery moves or resizes. Tenure memory is left to the default first touch placement.
+		 */
+		void *nurseryBase = OMR_MIN(_evacuateSpaceBase, _survivorSpaceBase);
+		void *nurseryTop = OMR_MAX(_evacuateSpaceTop, _survivorSpaceTop);
+		if ((nurseryBase != _numaBoundNurseryBase) || (nurseryTop != _numaBoundNurseryTop)) {
+			if (_survivorNUMAChunkLists.bindStripesToNodes(env, nurseryBase, nurseryTop)) {
+				_numaBoundNurseryBase = nurseryBase;
+				_numaBoundNurseryTop = nurseryTop;
+			}
+		}
+	}
+
+	/* Sample the prefetch window for this cycle so that it can be changed between collections */
+	_prefetchWindowSize = OMR_MAX(OMR_MIN(_extensions->scavengerPrefetchWindowSize, (uintptr_t)SCAVENGER_PREFETCH_WINDOW_MAXIMUM), 1);
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
@@ -482,6 +563,9 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
+	/* memory left on the node lists is not walkable, release it to the free lists before anyone walks the heap */
+	flushNUMAChunkLists(env);
+
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
 }
@@ -524,6 +608,24 @@ MM_Scavenger::reportScavengeEnd(MM_EnvironmentStandard *env, bool lastIncrement)
 	);
 }
 
+void
+MM_Scavenger::reportTenureDecision(MM_EnvironmentStandard *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+
+	TRIGGER_J9HOOK_MM_PRIVATE_SCAVENGER_TENURE_DECISION(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_SCAVENGER_TENURE_DECISION,
+		scavengerStats->_tenureDecisionAge,
+		scavengerStats->_tenureDecisionCopyBytes,
+		scavengerStats->_tenureDecisionPrematureTenureBytes,
+		scavengerStats->_tenureDecisionSurvivorBytes
+	);
+}
+
 void
 MM_Scavenger::reportGCStart(MM_EnvironmentStandard *env)
 {
@@ -637,6 +739,9 @@ void
 MM_Scavenger::clearThreadGCStats(MM_EnvironmentBase *env, bool firstIncrement)
 {
 	env->_scavengerStats.clear(firstIncrement);
+	if (firstIncrement) {
+		env->_rootScannerStats.clear();
+	}
 }
 
 void
@@ -702,6 +807,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
 
+	finalGCStats->_numaLocalChunkCount += scavStats->_numaLocalChunkCount;
+	finalGCStats->_numaRemoteChunkCount += scavStats->_numaRemoteChunkCount;
+
 	/* TODO: Fix this. Not true when merging Master GC threads stats for standard (non CS) Scavenger.
 	   Assert_MM_true(finalGCStats->_flipHistoryNewIndex == scavStats->_flipHistoryNewIndex); */
 
@@ -849,8 +957,12 @@ MM_Scavenger::calcGCStats(MM_EnvironmentStandard *env)
 			scavengerGCStats->_avgTenureBytesDeviation = (uintptr_t)MM_Math::weightedAverage((float)scavengerGCStats->_avgTenureBytesDeviation, 
 																				MM_Math::abs(tenureBytesDeviation), 
 																				TENURE_BYTES_HISTORY_WEIGHT);																											
+			scavengerGCStats->_avgCopiedBytes = (uintptr_t)MM_Math::weightedAverage((float)scavengerGCStats->_avgCopiedBytes,
+																				(float)(scavengerGCStats->_flipBytes + scavengerGCStats->_tenureAggregateBytes),
+																				COPIED_BYTES_HISTORY_WEIGHT);
 		} else {
 			scavengerGCStats->_avgInitialFree = initialFree;
+			scavengerGCStats->_avgCopiedBytes = scavengerGCStats->_flipBytes + scavengerGCStats->_tenureAggregateBytes;
 
 			/* We can assume that in the first GC, about half of the objects are long lived objects, so we use this heuristic to give a rough estimate for the starting point */
 			scavengerGCStats->_avgTenureBytes = (uintptr_t)(scavengerGCStats->_flipBytes / 2);
@@ -868,6 +980,31 @@ MM_Scavenger::calcGCStats(MM_EnvironmentStandard *env)
 	}
 }
 
+uintptr_t
+MM_Scavenger::getWorkEstimate(MM_EnvironmentBase *env)
+{
+	uintptr_t workEstimate = 0;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* the phases of a concurrent scavenge have different costs, which a single estimate does not describe */
+	if (!_extensions->isConcurrentScavengerEnabled())
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	{
+		uintptr_t avgCopiedBytes = _extensions->scavengerStats._avgCopiedBytes;
+		if (0 != avgCopiedBytes) {
+			workEstimate = avgCopiedBytes + (_extensions->rememberedSet.countElements() * REMEMBERED_OBJECT_WORK_ESTIMATE);
+		}
+	}
+	return workEstimate;
+}
+
+void
+MM_Scavenger::setScanCacheMaximumSize(uintptr_t scanCacheMaximumSize)
+{
+	uintptr_t minCacheSize = _extensions->scavengerScanCacheMinimumSize;
+	uintptr_t maxCacheSize = OMR_MAX(MM_Math::roundToFloor(minCacheSize, scanCacheMaximumSize), minCacheSize);
+	_scanCacheMaximumSize = OMR_MIN(maxCacheSize, _extensions->scavengerScanCacheMaximumSize);
+}
+
 /****************************************
  * Copy/forward routines
  ****************************************
@@ -905,8 +1042,9 @@ MM_Scavenger::calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, u
 MMINLINE uintptr_t
 MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 {
-	uintptr_t threadCount = _dispatcher->threadCount();
-	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
+	/* the task may run on fewer threads than the dispatcher has (see MM_GCExtensionsBase::adaptiveGCThreading) */
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t maxCacheSize = _scanCacheMaximumSize;
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
 	if (waitingThreads > 0) {
@@ -915,6 +1053,9 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 	}
 
 	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		env->approxScanCacheCount += _scanCacheDeques[i].getApproximateEntryCount();
+	}
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -975,7 +1116,11 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_numaAware) {
+					allocateResult = allocateNUMALocalChunk(env, &_survivorNUMAChunkLists, _survivorMemorySubSpace, &allocDescription, scanCacheSize, _extensions->tlhSurvivorDiscardThreshold, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1029,6 +1174,90 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 	return copyCache;
 }
 
+MMINLINE uintptr_t
+MM_Scavenger::getNUMANodeIndex(MM_EnvironmentStandard *env)
+{
+	uintptr_t affinityLeaderIndex = _extensions->_numaManager.getAffinityLeaderIndexForGCThread(env->getSlaveID(), _dispatcher->threadCountMaximum());
+	return (0 == affinityLeaderIndex) ? 0 : ((affinityLeaderIndex - 1) % _survivorNUMAChunkLists.getNodeCount());
+}
+
+bool
+MM_Scavenger::allocateNUMALocalChunk(MM_EnvironmentStandard *env, MM_ScavengerNUMAChunkLists *chunkLists, MM_MemorySubSpace *memorySubSpace, MM_AllocateDescription *allocDescription, uintptr_t chunkSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop)
+{
+	uintptr_t nodeIndex = getNUMANodeIndex(env);
+	uintptr_t minimumSize = OMR_MAX(discardThreshold, _objectAlignmentInBytes);
+	uintptr_t maximumSize = OMR_MAX(MM_Math::roundToFloor(_objectAlignmentInBytes, chunkSize), minimumSize);
+
+	if (chunkLists->popChunk(env, nodeIndex, maximumSize, minimumSize, &addrBase, &addrTop)) {
+		env->_scavengerStats._numaLocalChunkCount += 1;
+		return true;
+	}
+
+	/* Pull memory from the subspace until a local piece shows up. Allocation is roughly address ordered, so
+	 * a few attempts walk over the stripes of every node; pieces of other nodes are queued for their threads.
+	 */
+	for (uintptr_t attempt = 0; attempt < (2 * chunkLists->getNodeCount()); attempt++) {
+		void *chunkBase = NULL;
+		void *chunkTop = NULL;
+		if (NULL == memorySubSpace->collectorAllocateTLH(env, this, allocDescription, maximumSize, chunkBase, chunkTop)) {
+			break;
+		}
+
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		if (allocDescription->isLOAAllocation()) {
+			/* LOA memory is reported to the caller through allocDescription, so it can not be queued */
+			addrBase = chunkBase;
+			addrTop = chunkTop;
+			return true;
+		}
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+
+		bool foundLocal = false;
+		void *pieceBase = chunkBase;
+		while (pieceBase < chunkTop) {
+			void *pieceTop = OMR_MIN(chunkLists->getStripeTop(pieceBase), chunkTop);
+			uintptr_t pieceSize = (uintptr_t)pieceTop - (uintptr_t)pieceBase;
+			uintptr_t pieceNodeIndex = chunkLists->getNodeIndexForAddress(pieceBase);
+			if (pieceSize < minimumSize) {
+				memorySubSpace->abandonHeapChunk(pieceBase, pieceTop);
+			} else if (!foundLocal && (pieceNodeIndex == nodeIndex)) {
+				addrBase = pieceBase;
+				addrTop = pieceTop;
+				foundLocal = true;
+			} else {
+				chunkLists->pushChunk(env, pieceNodeIndex, pieceBase, pieceTop);
+			}
+			pieceBase = pieceTop;
+		}
+
+		if (foundLocal) {
+			env->_scavengerStats._numaLocalChunkCount += 1;
+			return true;
+		}
+	}
+
+	/* no local memory left (or not found quickly enough) - copying remotely beats failing the copy */
+	if (chunkLists->popChunk(env, nodeIndex, maximumSize, minimumSize, &addrBase, &addrTop)) {
+		env->_scavengerStats._numaLocalChunkCount += 1;
+		return true;
+	}
+	if (chunkLists->popRemoteChunk(env, nodeIndex, maximumSize, minimumSize, &addrBase, &addrTop)) {
+		env->_scavengerStats._numaRemoteChunkCount += 1;
+		return true;
+	}
+
+	return false;
+}
+
+void
+MM_Scavenger::flushNUMAChunkLists(MM_EnvironmentStandard *env)
+{
+	if (_numaAware) {
+		_survivorNUMAChunkLists.flush(env, _survivorMemorySubSpace);
+		_tenureNUMAChunkLists.flush(env, _tenureMemorySubSpace);
+	}
+}
+
 MM_CopyScanCacheStandard *
 MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes)
 {
@@ -1083,7 +1312,11 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_numaAware) {
+					allocateResult = allocateNUMALocalChunk(env, &_tenureNUMAChunkLists, _tenureMemorySubSpace, &allocDescription, scanCacheSize, _extensions->tlhTenureDiscardThreshold, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 				if (allocateResult && allocDescription.isLOAAllocation()) {
@@ -1277,6 +1510,36 @@ MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	return copyAndForward(env, slotObject);
 }
 
+bool
+MM_Scavenger::copyObjectSlots(MM_EnvironmentStandard *env, fomrobject_t *slots, uintptr_t slotCount)
+{
+	OMR_VM *omrVM = env->getOmrVM();
+	uintptr_t prefetchDistance = OMR_MIN(_prefetchWindowSize - 1, slotCount);
+	bool result = false;
+
+	for (uintptr_t i = 0; i < prefetchDistance; i++) {
+		GC_SlotObject prefetchSlot(omrVM, &slots[i]);
+		prefetchSlotReferent(&prefetchSlot);
+	}
+
+	for (uintptr_t i = 0; i < slotCount; i++) {
+		if ((i + prefetchDistance) < slotCount) {
+			GC_SlotObject prefetchSlot(omrVM, &slots[i + prefetchDistance]);
+			prefetchSlotReferent(&prefetchSlot);
+		}
+		GC_SlotObject slotObject(omrVM, &slots[i]);
+		omrobjectptr_t objectPtr = slotObject.readReferenceFromSlot();
+		if (isObjectInEvacuateMemory(objectPtr)) {
+			result |= copyAndForward(env, &slotObject);
+		} else if (isObjectInNewSpace(objectPtr)) {
+			/* already copied (or allocated during the concurrent cycle), there is nothing to store */
+			result = true;
+		}
+	}
+
+	return result;
+}
+
 omrobjectptr_t
 MM_Scavenger::copyObject(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader)
 {
@@ -1698,13 +1961,17 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	if (1 < _prefetchWindowSize) {
+		shouldRemember = scavengeObjectSlotsPrefetched(env, objectScanner, &slotsScanned, &slotsCopied);
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -1727,6 +1994,52 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	return shouldRemember;
 }
 
+MMINLINE bool
+MM_Scavenger::scavengeObjectSlotsPrefetched(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied)
+{
+	/* the scanner reuses its slot object, so pending slots are held by address */
+	fomrobject_t *window[SCAVENGER_PREFETCH_WINDOW_MAXIMUM];
+	uintptr_t windowSize = _prefetchWindowSize;
+	uintptr_t windowIndex = 0;
+	uintptr_t pendingCount = 0;
+	bool shouldRemember = false;
+	GC_SlotObject *slotObject = NULL;
+
+	Assert_MM_true((1 < windowSize) && (SCAVENGER_PREFETCH_WINDOW_MAXIMUM >= windowSize));
+
+	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if (windowSize == pendingCount) {
+			/* window is full, so the oldest pending slot is the one about to be overwritten */
+			GC_SlotObject pendingSlot(env->getOmrVM(), window[windowIndex]);
+			shouldRemember |= copyAndForward(env, &pendingSlot);
+			if (NULL != env->_effectiveCopyScanCache) {
+				*slotsCopied += 1;
+			}
+			*slotsScanned += 1;
+			pendingCount -= 1;
+		}
+		prefetchSlotReferent(slotObject);
+		window[windowIndex] = slotObject->readAddressFromSlot();
+		pendingCount += 1;
+		windowIndex = ((windowIndex + 1) == windowSize) ? 0 : (windowIndex + 1);
+	}
+
+	/* drain the remaining pending slots, oldest first */
+	windowIndex = (windowIndex + windowSize - pendingCount) % windowSize;
+	while (0 < pendingCount) {
+		GC_SlotObject pendingSlot(env->getOmrVM(), window[windowIndex]);
+		shouldRemember |= copyAndForward(env, &pendingSlot);
+		if (NULL != env->_effectiveCopyScanCache) {
+			*slotsCopied += 1;
+		}
+		*slotsScanned += 1;
+		pendingCount -= 1;
+		windowIndex = ((windowIndex + 1) == windowSize) ? 0 : (windowIndex + 1);
+	}
+
+	return shouldRemember;
+}
+
 void
 MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2)
 {
@@ -1942,6 +2255,10 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	if (NULL != _scanCacheDeques) {
+		return getNextScanCacheFromDeques(env);
+	}
+
 #if defined(OMR_SCAVENGER_TRACE) || defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 #endif /* OMR_SCAVENGER_TRACE || J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -2011,6 +2328,159 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	return cache;
 }
 
+MMINLINE bool
+MM_Scavenger::isScanCacheWorkAvailable()
+{
+	if (0 != _cachedEntryCount) {
+		return true;
+	}
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		if (!_scanCacheDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MMINLINE MM_CopyScanCacheStandard *
+MM_Scavenger::acquireScanCacheFromDeques(MM_EnvironmentStandard *env, MM_CopyScanCacheDeque *deque)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t victim = 0;
+
+	if (NULL != deque) {
+		cache = deque->pop();
+		if (NULL != cache) {
+			return cache;
+		}
+		victim = deque->nextStealSeed();
+	}
+
+	/* overflow from full deques (and caches released outside of a deque) go to the shared list */
+	if (0 != _cachedEntryCount) {
+		cache = getNextScanCacheFromList(env);
+		if (NULL != cache) {
+			return cache;
+		}
+	}
+
+	/* visit every other deque once, starting from a random victim */
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		MM_CopyScanCacheDeque *victimDeque = &_scanCacheDeques[(victim + i) % _scanCacheDequeCount];
+		if (victimDeque != deque) {
+			cache = victimDeque->steal();
+			if (NULL != cache) {
+#if defined(OMR_SCAVENGER_TRACE)
+				OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+				omrtty_printf("{SCAV: slaveID %zu stole scan cache (%p) from deque %zu}\n", env->getSlaveID(), cache, (victim + i) % _scanCacheDequeCount);
+#endif /* OMR_SCAVENGER_TRACE */
+				return cache;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::getNextScanCacheFromDeques(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheDeque *deque = getScanCacheDeque(env);
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	while (!shouldAbortScanLoop(env)) {
+		MM_CopyScanCacheStandard *cache = acquireScanCacheFromDeques(env, deque);
+		if (NULL != cache) {
+			return cache;
+		}
+
+		/* Out of work: flush buffers (other threads may not see them after we agree to leave the loop) and go idle */
+		flushBuffersForGetNextScanCache(env);
+
+		uintptr_t oldState = 0;
+		do {
+			oldState = _stealingState;
+			Assert_MM_true((oldState & SCAVENGER_STEALING_IDLE_MASK) < threadCount);
+		} while (oldState != MM_AtomicOperations::lockCompareExchange(&_stealingState, oldState, oldState + 1));
+		uintptr_t epoch = oldState >> SCAVENGER_STEALING_IDLE_BITS;
+		/* _waitingCount only feeds the cache sizing, aliasing and array splitting heuristics in this mode */
+		MM_AtomicOperations::add(&_waitingCount, 1);
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t idleStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		bool done = false;
+		bool aborted = false;
+		uintptr_t spinCount = SCAVENGER_STEALING_SPIN_COUNT_MINIMUM;
+		for (;;) {
+			uintptr_t state = _stealingState;
+			if (epoch != (state >> SCAVENGER_STEALING_IDLE_BITS)) {
+				/* another thread completed the scan loop */
+				done = true;
+				break;
+			}
+
+			uintptr_t idleCount = state & SCAVENGER_STEALING_IDLE_MASK;
+			if (SCAVENGER_STEALING_TERMINATING != idleCount) {
+				bool abort = shouldAbortScanLoop(env);
+				if (abort || isScanCacheWorkAvailable()) {
+					/* leave the idle state to look for work (or to abort); retry if the state changed under us */
+					if (state == MM_AtomicOperations::lockCompareExchange(&_stealingState, state, state - 1)) {
+						aborted = abort;
+						break;
+					}
+					continue;
+				}
+				if (threadCount == idleCount) {
+					/* every thread is idle and no work is visible: the scan loop is complete */
+					uintptr_t terminatingState = (state & ~SCAVENGER_STEALING_IDLE_MASK) | SCAVENGER_STEALING_TERMINATING;
+					if (state == MM_AtomicOperations::lockCompareExchange(&_stealingState, state, terminatingState)) {
+						_extensions->copyScanRatio.reset(env, false);
+						_doneIndex += 1;
+						/* _doneIndex must be visible before threads leave the loop on the new epoch */
+						MM_AtomicOperations::writeBarrier();
+						_stealingState = (epoch + 1) << SCAVENGER_STEALING_IDLE_BITS;
+						done = true;
+						break;
+					}
+					continue;
+				}
+			}
+
+			/* back off exponentially, so threads that stay idle stop competing for the state word and the processor */
+			for (uintptr_t spin = 0; spin < spinCount; spin++) {
+				MM_AtomicOperations::yieldCPU();
+			}
+			if (spinCount < SCAVENGER_STEALING_SPIN_COUNT_MAXIMUM) {
+				spinCount <<= 1;
+			} else {
+				omrthread_yield();
+			}
+		}
+
+		MM_AtomicOperations::subtract(&_waitingCount, 1);
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t idleEndTime = omrtime_hires_clock();
+		if (done) {
+			env->_scavengerStats.addToCompleteStallTime(idleStartTime, idleEndTime);
+		} else {
+			env->_scavengerStats.addToWorkStallTime(idleStartTime, idleEndTime);
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		if (done || aborted) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
 /**
  * Scans all the objects to scan in the scanCache, remembering objects as required,
  * and flushing the cache at the end.
@@ -3200,6 +3670,14 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
+	if (NULL != _scanCacheDeques) {
+		/* idle threads poll the deques rather than wait on _scanCacheMonitor, so there is nobody to notify */
+		MM_CopyScanCacheDeque *deque = getScanCacheDeque(env);
+		if ((NULL != deque) && deque->push(newCacheEntry)) {
+			return;
+		}
+	}
+
 	_scavengeCacheScanList.pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
@@ -3282,6 +3760,18 @@ MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 	return _scavengeCacheScanList.popCache(env);
 }
 
+void
+MM_Scavenger::flushScanCacheDeques(MM_EnvironmentStandard *env)
+{
+	/* only called once all other threads have left the scan loop, so stealing drains each deque */
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		MM_CopyScanCacheStandard *cache = NULL;
+		while (NULL != (cache = _scanCacheDeques[i].steal())) {
+			flushCache(env, cache);
+		}
+	}
+}
+
 /**
  * Determine whether a scavenge that has been started did complete successfully.
  * @return true if the scavenge completed successfully, false otherwise.
@@ -3681,6 +4171,9 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		setBackOutFlag(env, backOutStarted);
 
+		/* the tenure walk below must not run into memory still queued on the node lists */
+		flushNUMAChunkLists(env);
+
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
 		omrtty_printf("{SCAV: Complete back out(%p)}\n", env->getLanguageVMThread());
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
@@ -3692,6 +4185,7 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			flushScanCacheDeques(env);
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -3848,6 +4342,9 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
+	if (lastIncrement && _extensions->scvTenureStrategyCopyCost && scavengeCompletedSuccessfully(env)) {
+		adviseTenureAge(env);
+	}
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
@@ -4608,6 +5105,11 @@ MM_Scavenger::calculateTenureMask()
 	/* always tenure objects which have reached the maximum age */
 	uintptr_t newMask = ((uintptr_t)1 << OBJECT_HEADER_AGE_MAX);
 
+	if (_extensions->scvTenureStrategyCopyCost && _tenureAdvisor.hasDecision()) {
+		/* The Copy Cost strategy replaces the other strategies once it has sampled a scavenge. */
+		return newMask | calculateTenureMaskUsingFixed(_tenureAdvisor.getTenureAge());
+	}
+
 	/* Delegate tenure mask calculations to the active strategies. */
 	if (_extensions->scvTenureStrategyFixed) {
 		newMask |= calculateTenureMaskUsingFixed(_extensions->scvTenureFixedTenureAge);
@@ -4779,6 +5281,23 @@ MM_Scavenger::calculateTenureMaskUsingFixed(uintptr_t tenureAge)
 	return mask;
 }
 
+void
+MM_Scavenger::adviseTenureAge(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	uintptr_t newSpaceSize = _activeSubSpace->getTopLevelMemorySubSpace(MEMORY_TYPE_NEW)->getCurrentSize();
+	uintptr_t maximumSurvivorBytes = (uintptr_t)(newSpaceSize * _extensions->survivorSpaceMaximumSizeRatio);
+
+	_tenureAdvisor.update(env, scavengerStats, maximumSurvivorBytes);
+
+	scavengerStats->_tenureDecisionAge = _tenureAdvisor.getTenureAge();
+	scavengerStats->_tenureDecisionCopyBytes = _tenureAdvisor.getCopyBytes();
+	scavengerStats->_tenureDecisionPrematureTenureBytes = _tenureAdvisor.getPrematureTenureBytes();
+	scavengerStats->_tenureDecisionSurvivorBytes = _tenureAdvisor.getSurvivorBytes();
+
+	reportTenureDecision(env);
+}
+
 void 
 MM_Scavenger::resetTenureLargeAllocateStats(MM_EnvironmentBase *env)
 {
@@ -34,6 +34,7 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
@@ -42,6 +43,8 @@
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerNUMAChunkLists.hpp"
+#include "ScavengerTenureAdvisor.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -89,6 +92,7 @@ private:
 	void *_survivorSpaceBase, *_survivorSpaceTop;	/**< cached base and top heap pointers within survivor subspace */
 
 	uintptr_t _tenureMask; /**< A bit mask indicating which generations should be tenured on scavenge. */
+	MM_ScavengerTenureAdvisor _tenureAdvisor; /**< Survival histogram and tenure age choice of the Copy Cost scavenger tenure strategy */
 	bool _expandFailed;
 	bool _failedTenureThresholdReached;
 	uintptr_t _failedTenureLargestObject;
@@ -109,8 +113,18 @@ private:
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
+	uintptr_t _scanCacheMaximumSize; /**< maximum copy scan cache size of the current scavenge (scavengerScanCacheMaximumSize, unless adaptive GC threading suggested less) */
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
+	bool _numaAware; /**< true if copy caches are carved from memory striped to the copying thread's NUMA node (see scavengerNUMAAware) */
+	void *_numaBoundNurseryBase; /**< base of the nursery range whose stripes were last bound to their nodes (NUMA-aware mode only) */
+	void *_numaBoundNurseryTop; /**< top of the nursery range whose stripes were last bound to their nodes (NUMA-aware mode only) */
+	MM_ScavengerNUMAChunkLists _survivorNUMAChunkLists; /**< survivor memory reserved for copy caches, queued by owning node (NUMA-aware mode only) */
+	MM_ScavengerNUMAChunkLists _tenureNUMAChunkLists; /**< tenure memory reserved for copy caches, queued by owning node (NUMA-aware mode only) */
+	MM_CopyScanCacheDeque *_scanCacheDeques; /**< per-thread work-stealing deques of scan caches (indexed by slave ID), NULL unless scavengerWorkStealing is enabled */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
+	volatile uintptr_t _stealingState; /**< scan loop termination state for work-stealing mode: scan loop epoch in the high bits, idle thread count in the low bits */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
+	uintptr_t _prefetchWindowSize; /**< number of slots pending copy-forward in scavengeObjectSlots() for this cycle (sampled from scavengerPrefetchWindowSize), 1 means no prefetching */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
@@ -239,8 +253,75 @@ public:
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
+	/**
+	 * @return index (starting from 0) of the node the current GC thread is bound to in NUMA-aware mode
+	 */
+	MMINLINE uintptr_t getNUMANodeIndex(MM_EnvironmentStandard *env);
+
+	/**
+	 * NUMA-aware replacement for collectorAllocateTLH() on a copy destination subspace. Memory is taken from the node list of
+	 * the current thread first; otherwise chunks are allocated from the subspace and split at stripe boundaries, with the pieces
+	 * owned by other nodes queued for their threads. Memory of other nodes is only used when no local memory can be found.
+	 * @param env current thread environment
+	 * @param chunkLists the node lists for the subspace
+	 * @param memorySubSpace the subspace to allocate from
+	 * @param allocDescription allocation description for the subspace allocations (reports LOA allocations)
+	 * @param chunkSize preferred size of the chunk
+	 * @param discardThreshold pieces smaller than this are abandoned rather than used or queued
+	 * @param[out] addrBase base of the chunk
+	 * @param[out] addrTop top of the chunk
+	 * @return true if a chunk was found
+	 */
+	bool allocateNUMALocalChunk(MM_EnvironmentStandard *env, MM_ScavengerNUMAChunkLists *chunkLists, MM_MemorySubSpace *memorySubSpace, MM_AllocateDescription *allocDescription, uintptr_t chunkSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop);
+
+	/**
+	 * Return memory still queued on the NUMA node lists to the copy destination subspaces (single threaded).
+	 */
+	void flushNUMAChunkLists(MM_EnvironmentStandard *env);
+
 	MM_CopyScanCacheStandard *getNextScanCache(MM_EnvironmentStandard *env);
 
+	/**
+	 * Work-stealing variant of the scan list part of getNextScanCache(). Takes work from the thread's own deque,
+	 * then the shared scan cache list, then other threads' deques. Threads that find no work spin (without
+	 * blocking on _scanCacheMonitor) until work reappears or all threads agree that the scan loop is done.
+	 * @param env current thread environment
+	 * @return scan cache to process, or NULL if the scan loop is complete or aborted
+	 */
+	MM_CopyScanCacheStandard *getNextScanCacheFromDeques(MM_EnvironmentStandard *env);
+
+	/**
+	 * Try once to find a scan cache in the thread's own deque, the shared scan list and other threads' deques.
+	 * @param env current thread environment
+	 * @param deque the deque owned by the current thread (may be NULL)
+	 * @return scan cache or NULL if none was found
+	 */
+	MMINLINE MM_CopyScanCacheStandard *acquireScanCacheFromDeques(MM_EnvironmentStandard *env, MM_CopyScanCacheDeque *deque);
+
+	/**
+	 * @return true if any deque or the shared scan list appears to contain scan caches
+	 */
+	MMINLINE bool isScanCacheWorkAvailable();
+
+	/**
+	 * @return the deque owned by the current thread, or NULL if deques are not in use (or the thread has none)
+	 */
+	MMINLINE MM_CopyScanCacheDeque *
+	getScanCacheDeque(MM_EnvironmentStandard *env)
+	{
+		MM_CopyScanCacheDeque *deque = NULL;
+		uintptr_t slaveID = env->getSlaveID();
+		if (slaveID < _scanCacheDequeCount) {
+			deque = &_scanCacheDeques[slaveID];
+		}
+		return deque;
+	}
+
+	/**
+	 * Flush any scan caches left in the deques (backout).
+	 */
+	void flushScanCacheDeques(MM_EnvironmentStandard *env);
+
 	/**
 	 * Implementation of CopyAndForward for slotObject input format
 	 * @param slotObject input field in slotObject format
@@ -263,6 +344,20 @@ public:
 	 * @return Whether or not objectPtr should be remembered.
 	 */
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
+
+	/**
+	 * Copy and forward all remaining slots of an object scanner through a window of pending slots.
+	 * The referent of each slot entering the window is prefetched (if it is in evacuate space), and
+	 * the oldest pending slot is copy-forwarded once the window is full, so that the referent header
+	 * and forwarding word are likely to be cache resident by the time they are inspected. Slots are
+	 * processed in scanner order.
+	 * @param env The environment.
+	 * @param objectScanner The scanner to drain.
+	 * @param[out] slotsScanned incremented by the number of slots processed
+	 * @param[out] slotsCopied incremented by the number of slots whose referent was copied by this thread
+	 * @return Whether any slot refers to an object in new space.
+	 */
+	MMINLINE bool scavengeObjectSlotsPrefetched(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uint64_t *slotsScanned, uint64_t *slotsCopied);
 	MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);	
 	
 	/**
@@ -450,6 +545,7 @@ public:
 	void reportGCIncrementEnd(MM_EnvironmentStandard *env);
 	void reportScavengeStart(MM_EnvironmentStandard *env);
 	void reportScavengeEnd(MM_EnvironmentStandard *env, bool lastIncrement);
+	void reportTenureDecision(MM_EnvironmentStandard *env);
 
 	/**
 	 * Add the specified object to the remembered set.
@@ -574,6 +670,14 @@ public:
 	 */
 	uintptr_t calculateTenureMaskUsingFixed(uintptr_t tenureAge);
 
+	/**
+	 * The Copy Cost scavenger tenure strategy: sample the survival histogram of the scavenge
+	 * that just completed and choose the tenure age of the next one (see MM_ScavengerTenureAdvisor).
+	 * The decision is recorded in the cycle scavenger stats and reported.
+	 * @param env Master GC thread.
+	 */
+	void adviseTenureAge(MM_EnvironmentStandard *env);
+
 	/**
 	 * Calculates which generations should be tenured in the form of a bit mask.
 	 * @return mask of ages to tenure
@@ -589,6 +693,20 @@ public:
 	/* API used by ParallelScavengeTask to set _waitingCountAliasThreshold. */
 	void setAliasThreshold(uintptr_t waitingCountAliasThreshold) { _waitingCountAliasThreshold = waitingCountAliasThreshold; }
 
+	/**
+	 * Estimate the work of the next scavenge from previous ones (see MM_Task::getWorkEstimate()): the bytes
+	 * copied by previous scavenges on average, and the objects in the remembered set.
+	 * @return the estimated work, in bytes, or 0 if no scavenge completed yet
+	 */
+	uintptr_t getWorkEstimate(MM_EnvironmentBase *env);
+
+	/**
+	 * API used by ParallelScavengeTask to set _scanCacheMaximumSize. The size is rounded down to a multiple of
+	 * the minimum scan cache size (copy scan caches must stay aligned) and kept within the scan cache size bounds.
+	 * @param scanCacheMaximumSize the suggested maximum copy scan cache size, in bytes
+	 */
+	void setScanCacheMaximumSize(uintptr_t scanCacheMaximumSize);
+
 protected:
 	virtual void setupForGC(MM_EnvironmentBase *env);
 	virtual void masterSetupForGC(MM_EnvironmentStandard *env);
@@ -720,6 +838,20 @@ public:
 		/* check if the object in cached allocate (from GC perspective, evacuate) ranges */
 		return ((void *)objectPtr >= _evacuateSpaceBase) && ((void *)objectPtr < _evacuateSpaceTop);
 	}
+
+	/**
+	 * Prefetch the header (which holds the forwarding word) of the object referenced by a slot, if
+	 * the object is in evacuate space and so is about to be inspected by copyAndForward().
+	 * @param slotObject the slot to be copy-forwarded later
+	 */
+	MMINLINE void
+	prefetchSlotReferent(GC_SlotObject *slotObject)
+	{
+		omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+		if (isObjectInEvacuateMemory(objectPtr)) {
+			MM_AtomicOperations::prefetch(objectPtr);
+		}
+	}
 	
 	MMINLINE void *
 	getEvacuateBase()
@@ -773,6 +905,17 @@ public:
 	 */
 	bool copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr);
 	bool copyObjectSlot(MM_EnvironmentStandard *env, GC_SlotObject* slotObject);
+
+	/**
+	 * Batched form of copyObjectSlot() for bulk operations of the client language runtime, such as array copy
+	 * or clone. Slots referencing objects outside of evacuate space are left untouched, and the referents of
+	 * the following slots are prefetched (see scavengerPrefetchWindowSize) ahead of copy-forward.
+	 * @param[in] env Environment pointer for calling thread
+	 * @param[in/out] slots Pointer to the first of the contiguous slots to be copied and forwarded
+	 * @param[in] slotCount Number of slots
+	 * @return true if any of the slots references an object in new space on return
+	 */
+	bool copyObjectSlots(MM_EnvironmentStandard *env, fomrobject_t *slots, uintptr_t slotCount);
 	omrobjectptr_t copyObject(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
 	/**
@@ -834,6 +977,7 @@ public:
 		, _survivorSpaceBase(NULL)
 		, _survivorSpaceTop(NULL)
 		, _tenureMask(0)
+		, _tenureAdvisor()
 		, _expandFailed(false)
 		, _failedTenureThresholdReached(false)
 		, _countSinceForcingGlobalGC(0)
@@ -847,8 +991,18 @@ public:
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
+		, _scanCacheMaximumSize(0)
 		, _waitingCount(0)
+		, _numaAware(false)
+		, _numaBoundNurseryBase(NULL)
+		, _numaBoundNurseryTop(NULL)
+		, _survivorNUMAChunkLists()
+		, _tenureNUMAChunkLists()
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
+		, _stealingState(0)
 		, _cacheLineAlignment(0)
+		, _prefetchWindowSize(1)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
 #endif
@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <new>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "ScavengerNUMAChunkLists.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+bool
+MM_ScavengerNUMAChunkLists::initialize(MM_EnvironmentBase *env, uintptr_t nodeCount, void *heapBase, void *heapTop, uintptr_t stripeSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	Assert_MM_true(1 < nodeCount);
+	Assert_MM_true(0 < stripeSize);
+
+	_nodeLists = (NodeList *)extensions->getForge()->allocate(sizeof(NodeList) * nodeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _nodeLists) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < nodeCount; i++) {
+		new (&_nodeLists[i]) NodeList();
+		if (!_nodeLists[i]._lock.initialize(env, &extensions->lnrlOptions, "MM_ScavengerNUMAChunkLists:_nodeLists[]._lock")) {
+			/* only tear down the locks initialized so far */
+			_nodeCount = i;
+			return false;
+		}
+	}
+
+	_nodeCount = nodeCount;
+	_heapBase = (uintptr_t)heapBase;
+	_heapTop = (uintptr_t)heapTop;
+	_stripeSize = stripeSize;
+
+	return true;
+}
+
+void
+MM_ScavengerNUMAChunkLists::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _nodeLists) {
+		for (uintptr_t i = 0; i < _nodeCount; i++) {
+			_nodeLists[i]._lock.tearDown();
+		}
+		env->getExtensions()->getForge()->free(_nodeLists);
+		_nodeLists = NULL;
+	}
+	_nodeCount = 0;
+}
+
+bool
+MM_ScavengerNUMAChunkLists::bindStripesToNodes(MM_EnvironmentBase *env, void *base, void *top)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool result = true;
+
+	Assert_MM_true((_heapBase <= (uintptr_t)base) && ((uintptr_t)top <= _heapTop));
+
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		const MM_MemoryHandle *vmemHandle = ((MM_HeapVirtualMemory *)extensions->heap)->getVmemHandle();
+		uintptr_t rangeBase = (uintptr_t)base;
+		while (result && (rangeBase < (uintptr_t)top)) {
+			uintptr_t rangeTop = OMR_MIN((uintptr_t)getStripeTop((void *)rangeBase), (uintptr_t)top);
+			uintptr_t j9NodeNumber = extensions->_numaManager.getJ9NodeNumber(getNodeIndexForAddress((void *)rangeBase) + 1);
+			if (0 != j9NodeNumber) {
+				result = extensions->memoryManager->setNumaAffinity(vmemHandle, j9NodeNumber, (void *)rangeBase, rangeTop - rangeBase);
+			}
+			rangeBase = rangeTop;
+		}
+	}
+
+	return result;
+}
+
+void
+MM_ScavengerNUMAChunkLists::pushChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, void *base, void *top)
+{
+	Assert_MM_true(nodeIndex < _nodeCount);
+	Assert_MM_true(((uintptr_t)top - (uintptr_t)base) >= sizeof(FreeChunk));
+	Assert_MM_true(getNodeIndexForAddress(base) == nodeIndex);
+
+	NodeList *nodeList = &_nodeLists[nodeIndex];
+	nodeList->_lock.acquire();
+	pushLocked(nodeList, base, top);
+	nodeList->_lock.release();
+}
+
+bool
+MM_ScavengerNUMAChunkLists::popFromList(NodeList *nodeList, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top)
+{
+	bool result = false;
+
+	if (NULL != nodeList->_head) {
+		nodeList->_lock.acquire();
+		FreeChunk *chunk = nodeList->_head;
+		if (NULL != chunk) {
+			void *chunkTop = chunk->_top;
+			uintptr_t chunkSize = (uintptr_t)chunkTop - (uintptr_t)chunk;
+			*base = (void *)chunk;
+			if ((chunkSize > maximumSize) && ((chunkSize - maximumSize) >= OMR_MAX(minimumSize, sizeof(FreeChunk)))) {
+				/* hand out the low part and leave the remainder at the head of the list */
+				FreeChunk *remainder = (FreeChunk *)((uintptr_t)chunk + maximumSize);
+				remainder->_next = chunk->_next;
+				remainder->_top = chunkTop;
+				nodeList->_head = remainder;
+				*top = (void *)remainder;
+			} else {
+				nodeList->_head = chunk->_next;
+				nodeList->_chunkCount -= 1;
+				*top = chunkTop;
+			}
+			result = true;
+		}
+		nodeList->_lock.release();
+	}
+
+	return result;
+}
+
+bool
+MM_ScavengerNUMAChunkLists::popChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top)
+{
+	Assert_MM_true(nodeIndex < _nodeCount);
+	return popFromList(&_nodeLists[nodeIndex], maximumSize, minimumSize, base, top);
+}
+
+bool
+MM_ScavengerNUMAChunkLists::popRemoteChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top)
+{
+	/* visit the other nodes starting with the next one, so threads of different nodes spread over the victims */
+	for (uintptr_t i = 1; i < _nodeCount; i++) {
+		if (popFromList(&_nodeLists[(nodeIndex + i) % _nodeCount], maximumSize, minimumSize, base, top)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+MM_ScavengerNUMAChunkLists::releaseChunk(MM_EnvironmentBase *env, MM_MemorySubSpace *memorySubSpace, void *base, void *top)
+{
+	/* chunks are carved from a single TLH, so they never straddle two pools (e.g. the SOA and the LOA) */
+	MM_MemoryPool *memoryPool = memorySubSpace->getMemoryPool(base);
+	uintptr_t size = (uintptr_t)top - (uintptr_t)base;
+
+	/* a chunk too small for the free list is left behind as a hole, exactly as abandonHeapChunk() would */
+	if (memoryPool->createFreeEntry(env, base, top)) {
+		MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)base;
+		memoryPool->addFreeEntries(env, freeEntry, freeEntry, 1, size);
+	}
+}
+
+void
+MM_ScavengerNUMAChunkLists::flush(MM_EnvironmentBase *env, MM_MemorySubSpace *memorySubSpace)
+{
+	for (uintptr_t i = 0; i < _nodeCount; i++) {
+		NodeList *nodeList = &_nodeLists[i];
+		FreeChunk *chunk = nodeList->_head;
+		while (NULL != chunk) {
+			FreeChunk *next = chunk->_next;
+			releaseChunk(env, memorySubSpace, (void *)chunk, chunk->_top);
+			chunk = next;
+		}
+		nodeList->_head = NULL;
+		nodeList->_chunkCount = 0;
+	}
+}
+
+bool
+MM_ScavengerNUMAChunkLists::isEmpty()
+{
+	for (uintptr_t i = 0; i < _nodeCount; i++) {
+		if (NULL != _nodeLists[i]._head) {
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERNUMACHUNKLISTS_HPP_)
+#define SCAVENGERNUMACHUNKLISTS_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_MemorySubSpace;
+
+/**
+ * Per-node lists of free heap chunks reserved by the scavenger for copy caches.
+ *
+ * The heap is divided into fixed size stripes which are assigned to NUMA nodes round-robin (and, within the
+ * nursery, bound to those nodes when physical NUMA is available, see bindStripesToNodes()). Chunks the scavenger takes from
+ * a memory subspace are split at stripe boundaries and each piece is queued on the list of the node that
+ * owns it, so that GC threads can prefer memory local to the node they run on.
+ *
+ * The list links are stored in the free chunks themselves. Chunks on the lists are not walkable, so the
+ * lists must be flushed back to the free lists of the subspace before the heap is walked.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerNUMAChunkLists : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct FreeChunk {
+		FreeChunk *_next; /**< next chunk on the same node list */
+		void *_top; /**< top (exclusive) of this chunk */
+	};
+
+	struct NodeList {
+		FreeChunk *_head; /**< head of the list of chunks owned by this node */
+		uintptr_t _chunkCount; /**< number of chunks on the list */
+		MM_LightweightNonReentrantLock _lock; /**< lock for getting/putting chunks */
+
+		NodeList()
+			: _head(NULL)
+			, _chunkCount(0)
+		{
+		}
+	};
+
+	NodeList *_nodeLists; /**< one list per node, _nodeCount elements long */
+	uintptr_t _nodeCount; /**< number of nodes stripes are assigned to */
+	uintptr_t _heapBase; /**< base address the stripes are measured from */
+	uintptr_t _heapTop; /**< top of the striped address range */
+	uintptr_t _stripeSize; /**< size of a stripe in bytes (a multiple of the heap page size) */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE void
+	pushLocked(NodeList *nodeList, void *base, void *top)
+	{
+		FreeChunk *chunk = (FreeChunk *)base;
+		chunk->_next = nodeList->_head;
+		chunk->_top = top;
+		nodeList->_head = chunk;
+		nodeList->_chunkCount += 1;
+	}
+
+	/**
+	 * Take up to maximumSize bytes from the head chunk of the given list, leaving any remainder of at
+	 * least minimumSize bytes on the list.
+	 */
+	bool popFromList(NodeList *nodeList, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top);
+
+	/**
+	 * Link a chunk into the free list of the pool of the given subspace that owns it.
+	 */
+	void releaseChunk(MM_EnvironmentBase *env, MM_MemorySubSpace *memorySubSpace, void *base, void *top);
+
+protected:
+public:
+	/**
+	 * Initialize the lists.
+	 * @param env[in] the current thread
+	 * @param nodeCount[in] number of nodes to stripe the heap over (at least 2)
+	 * @param heapBase[in] base of the heap address range
+	 * @param heapTop[in] top of the heap address range
+	 * @param stripeSize[in] stripe size, must be a multiple of the heap page size
+	 * @return true on success
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t nodeCount, void *heapBase, void *heapTop, uintptr_t stripeSize);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getNodeCount() { return _nodeCount; }
+
+	/**
+	 * @return the index (starting from 0) of the node that owns the stripe containing address
+	 */
+	MMINLINE uintptr_t
+	getNodeIndexForAddress(void *address)
+	{
+		return (((uintptr_t)address - _heapBase) / _stripeSize) % _nodeCount;
+	}
+
+	/**
+	 * @return the top (exclusive) of the stripe containing address
+	 */
+	MMINLINE void *
+	getStripeTop(void *address)
+	{
+		uintptr_t offset = (uintptr_t)address - _heapBase;
+		return (void *)(_heapBase + ((offset / _stripeSize) + 1) * _stripeSize);
+	}
+
+	/**
+	 * Bind the stripes overlapping the given range to their nodes so pages are placed there on first touch.
+	 * Has no effect unless physical NUMA is supported.
+	 * @param env[in] the current thread
+	 * @param base[in] base of the range to bind (page aligned)
+	 * @param top[in] top of the range to bind (page aligned)
+	 * @return false if binding a stripe failed
+	 */
+	bool bindStripesToNodes(MM_EnvironmentBase *env, void *base, void *top);
+
+	/**
+	 * Queue a free chunk on the list of the given node. The chunk must lie within a single stripe
+	 * and be large enough to hold the list link.
+	 */
+	void pushChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, void *base, void *top);
+
+	/**
+	 * Take up to maximumSize bytes of memory owned by the given node.
+	 * @param minimumSize[in] smallest remainder worth keeping on the list (smaller remainders are handed out with the chunk)
+	 * @return true if memory was found
+	 */
+	bool popChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top);
+
+	/**
+	 * Take up to maximumSize bytes of memory owned by any node other than the given one (used once local memory is exhausted).
+	 * @return true if memory was found
+	 */
+	bool popRemoteChunk(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t maximumSize, uintptr_t minimumSize, void **base, void **top);
+
+	/**
+	 * Return every queued chunk to the free list of the given memory subspace, so memory reserved but not
+	 * used for copying remains available for allocation. Must be called single threaded.
+	 */
+	void flush(MM_EnvironmentBase *env, MM_MemorySubSpace *memorySubSpace);
+
+	/**
+	 * @return true if no chunks are queued on any node list
+	 */
+	bool isEmpty();
+
+	/**
+	 * Create a ScavengerNUMAChunkLists object.
+	 */
+	MM_ScavengerNUMAChunkLists()
+		: MM_BaseVirtual()
+		, _nodeLists(NULL)
+		, _nodeCount(0)
+		, _heapBase(0)
+		, _heapTop(0)
+		, _stripeSize(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* SCAVENGERNUMACHUNKLISTS_HPP_ */
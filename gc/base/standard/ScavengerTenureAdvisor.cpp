@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "ScavengerTenureAdvisor.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "ScavengerStats.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+void
+MM_ScavengerTenureAdvisor::sample(MM_EnvironmentBase *env, MM_ScavengerStats *stats)
+{
+	double historyWeight = env->getExtensions()->scvTenureCopyCostHistoryWeight;
+	MM_ScavengerStats::FlipHistory *current = stats->getFlipHistory(0);
+	MM_ScavengerStats::FlipHistory *previous = stats->getFlipHistory(1);
+
+	/* The bytes of age n before this scavenge were flipped to age n by the previous one (or, for age 0, allocated
+	 * since), and those surviving this scavenge are recorded at index n + 1 of its history.
+	 */
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		uintptr_t previousBytes = previous->_flipBytes[age];
+		if (0 != previousBytes) {
+			uintptr_t survivingBytes = current->_flipBytes[age + 1] + current->_tenureBytes[age + 1];
+			double survivalRate = OMR_MIN(1.0, (double)survivingBytes / (double)previousBytes);
+			if (_survivalRateSampled[age]) {
+				_survivalRates[age] = (historyWeight * _survivalRates[age]) + ((1.0 - historyWeight) * survivalRate);
+			} else {
+				_survivalRates[age] = survivalRate;
+				_survivalRateSampled[age] = true;
+			}
+		}
+	}
+
+	if (0 == _sampleCount) {
+		_allocatedBytes = (double)previous->_flipBytes[0];
+	} else {
+		_allocatedBytes = (historyWeight * _allocatedBytes) + ((1.0 - historyWeight) * (double)previous->_flipBytes[0]);
+	}
+	_sampleCount += 1;
+}
+
+void
+MM_ScavengerTenureAdvisor::decide(MM_EnvironmentBase *env, uintptr_t maximumSurvivorBytes)
+{
+	double prematureTenureWeight = env->getExtensions()->scvTenureCopyCostPrematureTenureWeight;
+
+	/* Fraction of the allocated bytes still live at each age. Ages without samples (typically the ages above a
+	 * low tenure age, which are never reached in new space) are assumed to survive like the closest younger age.
+	 */
+	double liveFraction[OBJECT_HEADER_AGE_MAX + 2];
+	double survivalRate = 1.0;
+	liveFraction[0] = 1.0;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		if (_survivalRateSampled[age]) {
+			survivalRate = _survivalRates[age];
+		}
+		liveFraction[age + 1] = liveFraction[age] * survivalRate;
+	}
+	/* whatever survives to the maximum age is long lived and tenured at any tenure age */
+	double longLivedFraction = liveFraction[OBJECT_HEADER_AGE_MAX + 1];
+
+	uintptr_t bestTenureAge = OBJECT_HEADER_AGE_MIN;
+	double bestCost = 0.0;
+	double bestFlipped = 0.0;
+	double bestTenured = 0.0;
+	double flipped = 0.0;
+	for (uintptr_t tenureAge = OBJECT_HEADER_AGE_MIN; tenureAge <= OBJECT_HEADER_AGE_MAX; tenureAge++) {
+		/* objects younger than the tenure age which survive are flipped, those of the tenure age are tenured */
+		flipped += liveFraction[tenureAge];
+		if ((OBJECT_HEADER_AGE_MIN < tenureAge) && ((flipped * _allocatedBytes) > (double)maximumSurvivorBytes)) {
+			/* flipped bytes only grow with the tenure age, so no older age fits survivor space either */
+			break;
+		}
+		double tenured = liveFraction[tenureAge + 1];
+		double prematurelyTenured = OMR_MAX(0.0, tenured - longLivedFraction);
+		double cost = flipped + tenured + (prematureTenureWeight * prematurelyTenured);
+		/* on a tie, prefer the older age (less premature tenuring) */
+		if ((OBJECT_HEADER_AGE_MIN == tenureAge) || (cost <= bestCost)) {
+			bestTenureAge = tenureAge;
+			bestCost = cost;
+			bestFlipped = flipped;
+			bestTenured = tenured;
+		}
+	}
+
+	Assert_MM_true((OBJECT_HEADER_AGE_MIN <= bestTenureAge) && (OBJECT_HEADER_AGE_MAX >= bestTenureAge));
+	_tenureAge = bestTenureAge;
+	_survivorBytes = (uintptr_t)(bestFlipped * _allocatedBytes);
+	_copyBytes = (uintptr_t)((bestFlipped + bestTenured) * _allocatedBytes);
+	_prematureTenureBytes = (uintptr_t)(OMR_MAX(0.0, bestTenured - longLivedFraction) * _allocatedBytes);
+}
+
+void
+MM_ScavengerTenureAdvisor::update(MM_EnvironmentBase *env, MM_ScavengerStats *stats, uintptr_t maximumSurvivorBytes)
+{
+	sample(env, stats);
+	decide(env, maximumSurvivorBytes);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERTENUREADVISOR_HPP_)
+#define SCAVENGERTENUREADVISOR_HPP_
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+class MM_EnvironmentBase;
+class MM_ScavengerStats;
+
+/**
+ * Chooses the scavenger tenure age from a per-age histogram of surviving bytes (copy cost tenure strategy).
+ *
+ * After each successful scavenge the flip history of MM_ScavengerStats is sampled for the fraction of the
+ * bytes of each age that survived, and the rates are folded into a decaying average. From the rates the
+ * advisor predicts, for each candidate tenure age, how many bytes a scavenge copies (flipped plus tenured)
+ * and how many of the tenured bytes die before reaching the maximum age (premature tenuring). The age with
+ * the lowest copy cost, charging premature tenure bytes scvTenureCopyCostPrematureTenureWeight times,
+ * is chosen among those whose flipped bytes fit the maximum survivor space. The flipped bytes predicted at
+ * that age are used to size survivor space.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerTenureAdvisor : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	double _survivalRates[OBJECT_HEADER_AGE_MAX + 1]; /**< decaying average of the fraction of bytes of each age surviving a scavenge */
+	bool _survivalRateSampled[OBJECT_HEADER_AGE_MAX + 1]; /**< true once the survival rate of the age has been sampled */
+	double _allocatedBytes; /**< decaying average of the bytes allocated in new space between scavenges */
+	uintptr_t _sampleCount; /**< number of scavenges sampled */
+	uintptr_t _tenureAge; /**< tenure age chosen after the last sample */
+	uintptr_t _copyBytes; /**< predicted bytes copied per scavenge at _tenureAge */
+	uintptr_t _prematureTenureBytes; /**< predicted bytes per scavenge tenured at _tenureAge but dying before the maximum age */
+	uintptr_t _survivorBytes; /**< predicted bytes flipped per scavenge at _tenureAge */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Fold the survival rates of the scavenge that just completed into the histogram.
+	 */
+	void sample(MM_EnvironmentBase *env, MM_ScavengerStats *stats);
+
+	/**
+	 * Choose the tenure age from the histogram.
+	 * @param maximumSurvivorBytes[in] largest survivor space the scavenger can get
+	 */
+	void decide(MM_EnvironmentBase *env, uintptr_t maximumSurvivorBytes);
+
+protected:
+public:
+	/**
+	 * Sample the scavenge that just completed (successfully) and choose the tenure age for the next one.
+	 * Must be called after the cycle stats are merged, so that the flip history of the cycle is complete.
+	 * @param env[in] the master GC thread
+	 * @param stats[in] the cycle scavenger stats
+	 * @param maximumSurvivorBytes[in] largest survivor space the scavenger can get
+	 */
+	void update(MM_EnvironmentBase *env, MM_ScavengerStats *stats, uintptr_t maximumSurvivorBytes);
+
+	/**
+	 * @return true once a tenure age has been chosen (the strategy has no history before the first sample)
+	 */
+	MMINLINE bool hasDecision() { return 0 != _sampleCount; }
+
+	MMINLINE uintptr_t getTenureAge() { return _tenureAge; }
+	MMINLINE uintptr_t getCopyBytes() { return _copyBytes; }
+	MMINLINE uintptr_t getPrematureTenureBytes() { return _prematureTenureBytes; }
+	MMINLINE uintptr_t getSurvivorBytes() { return _survivorBytes; }
+
+	/**
+	 * Create a ScavengerTenureAdvisor object.
+	 */
+	MM_ScavengerTenureAdvisor()
+		: MM_BaseVirtual()
+		, _allocatedBytes(0.0)
+		, _sampleCount(0)
+		, _tenureAge(OBJECT_HEADER_AGE_MAX)
+		, _copyBytes(0)
+		, _prematureTenureBytes(0)
+		, _survivorBytes(0)
+	{
+		_typeId = __FUNCTION__;
+		for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+			_survivalRates[age] = 0.0;
+			_survivalRateSampled[age] = false;
+		}
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* SCAVENGERTENUREADVISOR_HPP_ */
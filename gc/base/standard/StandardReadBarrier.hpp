@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef STANDARDREADBARRIER_HPP_
+#define STANDARDREADBARRIER_HPP_
+
+#include "objectdescription.h"
+
+#include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Scavenger.hpp"
+#include "SlotObject.hpp"
+
+struct OMR_VMThread;
+
+/**
+ * Out-of-line read barrier. While a concurrent scavenge is in progress, mutator threads must not observe
+ * references to objects in evacuate space, so this method must be called before a reference is loaded
+ * from a heap slot, unless an equivalent inline barrier is applied.
+ *
+ * If the slot references an object in evacuate space, the object is copied (if not already) and the slot
+ * is updated to the new location, through the same forwarding protocol as the scavenger threads (see
+ * MM_Scavenger::copyObjectSlot()). Outside of a concurrent scavenge the barrier is a no-op.
+ *
+ * @param omrThread The thread loading the reference
+ * @param srcSlot Points to the heap slot holding the reference
+ */
+MMINLINE void
+standardReadBarrier(OMR_VMThread *omrThread, fomrobject_t *srcSlot)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerEnabled() && extensions->scavenger->isConcurrentInProgress()) {
+		GC_SlotObject slotObject(omrThread->_vm, srcSlot);
+		if (extensions->scavenger->isObjectInEvacuateMemory(slotObject.readReferenceFromSlot())) {
+			extensions->scavenger->copyObjectSlot((MM_EnvironmentStandard *)env, &slotObject);
+		}
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+}
+
+/**
+ * Batched read barrier for bulk operations on a range of contiguous slots, such as array copy or clone.
+ * Equivalent to calling standardReadBarrier() for each slot, but the concurrent scavenge state is checked
+ * once for the whole range and the slots are processed by MM_Scavenger::copyObjectSlots().
+ *
+ * @param omrThread The thread loading the references
+ * @param srcSlots Points to the first of the heap slots holding the references
+ * @param slotCount The number of slots
+ * @see standardReadBarrier(OMR_VMThread *, fomrobject_t *)
+ */
+MMINLINE void
+standardReadBarrierBatch(OMR_VMThread *omrThread, fomrobject_t *srcSlots, uintptr_t slotCount)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerEnabled() && extensions->scavenger->isConcurrentInProgress()) {
+		extensions->scavenger->copyObjectSlots((MM_EnvironmentStandard *)env, srcSlots, slotCount);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+}
+
+/**
+ * Convenience method to call the out-of-line read barrier and load the reference from a heap slot.
+ *
+ * @param omrThread The thread loading the reference
+ * @param srcSlot Points to the heap slot holding the reference
+ * @return the (possibly forwarded) reference held by the slot
+ * @see standardReadBarrier(OMR_VMThread *, fomrobject_t *)
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrierLoad(OMR_VMThread *omrThread, fomrobject_t *srcSlot)
+{
+	standardReadBarrier(omrThread, srcSlot);
+
+	GC_SlotObject slotObject(omrThread->_vm, srcSlot);
+	return slotObject.readReferenceFromSlot();
+}
+
+#endif /* STANDARDREADBARRIER_HPP_ */
@@ -30,7 +30,13 @@
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SegregatedGC.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "SlotObject.hpp"
+#if defined(OMR_GC_VLHGC)
+#include "BalancedGC.hpp"
+#endif /* defined(OMR_GC_VLHGC) */
 
 struct OMR_VMThread;
 
@@ -41,6 +47,16 @@ struct OMR_VMThread;
  * To support OMR concurrent marking and/or generational collectors, this method calls the necessary
  * concurrent and generational write barriers.
  *
+ * The concurrent barrier dirties the parent's card through MM_CardTable::dirtyCard(), which also maintains the
+ * card table summary (if enabled). Inline equivalents which store to the card table directly must call
+ * MM_CardTable::setSummaryBitForCard() after changing a clean card.
+ *
+ * With the generational segregated collector, the barrier records old parents of young children in the
+ * collector's remembered set (see MM_SegregatedGC::generationalWriteBarrier()).
+ *
+ * With the balanced collector, the barrier records references from old regions in the remembered set of the
+ * child's region (see MM_BalancedGC::balancedWriteBarrier()).
+ *
  * @param omrThread The thread making the assignment of child reference into parent slot
  * @param parentObject the parent object
  * @param childObject THe child object reference
@@ -48,7 +64,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) || defined(OMR_GC_VLHGC)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -66,7 +82,17 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedGenerational) {
+		((MM_SegregatedGC *)extensions->getGlobalCollector())->generationalWriteBarrier(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_VLHGC)
+	if (extensions->isVLHGC()) {
+		((MM_BalancedGC *)extensions->getGlobalCollector())->balancedWriteBarrier(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_VLHGC) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) || defined(OMR_GC_VLHGC) */
 }
 
 /**
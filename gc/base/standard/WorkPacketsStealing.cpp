@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include <new>
+
+#include "WorkPacketsStealing.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "Packet.hpp"
+#include "Task.hpp"
+
+/* layout of _stealingState: termination epoch above the idle thread count */
+#define WORKPACKETS_STEALING_IDLE_BITS 16
+#define WORKPACKETS_STEALING_IDLE_MASK ((((uintptr_t)1) << WORKPACKETS_STEALING_IDLE_BITS) - 1)
+/* number of pause instructions between checks for work by an idle thread before it yields its processor */
+#define WORKPACKETS_STEALING_SPIN_COUNT 32
+
+/**
+ * Instantiate a MM_WorkPacketsStealing
+ * @return pointer to the new object
+ */
+MM_WorkPacketsStealing *
+MM_WorkPacketsStealing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsStealing *workPackets;
+
+	workPackets = (MM_WorkPacketsStealing *)env->getForge()->allocate(sizeof(MM_WorkPacketsStealing), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsStealing(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+bool
+MM_WorkPacketsStealing::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_WorkPacketsStandard::initialize(env)) {
+		return false;
+	}
+
+	/* one deque for each thread the dispatcher may start */
+	uintptr_t dequeCount = _extensions->gcThreadCount;
+	Assert_MM_true(dequeCount < WORKPACKETS_STEALING_IDLE_MASK);
+	_packetDeques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _packetDeques) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		new(&_packetDeques[i]) MM_PacketDeque((uintptr_t)0x9E3779B9 * (i + 1));
+	}
+	_packetDequeCount = dequeCount;
+
+	return true;
+}
+
+void
+MM_WorkPacketsStealing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _packetDeques) {
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+	}
+	_packetDequeCount = 0;
+
+	MM_WorkPacketsStandard::tearDown(env);
+}
+
+bool
+MM_WorkPacketsStealing::isDequeWorkAvailable()
+{
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		if (!_packetDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+MM_WorkPacketsStealing::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	return MM_WorkPacketsStandard::inputPacketAvailable(env) || isDequeWorkAvailable();
+}
+
+MM_Packet *
+MM_WorkPacketsStealing::getPacketFromDeques(MM_EnvironmentBase *env, MM_PacketDeque *deque)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t victim = 0;
+
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+			return packet;
+		}
+		victim = deque->nextStealSeed();
+	}
+
+	/* visit every other deque once, starting from a random victim */
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		MM_PacketDeque *victimDeque = &_packetDeques[(victim + i) % _packetDequeCount];
+		if (victimDeque != deque) {
+			packet = victimDeque->steal();
+			if (NULL != packet) {
+				packet->setOwner(env);
+				return packet;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacketNoWait(MM_EnvironmentBase *env)
+{
+	MM_PacketDeque *deque = getPacketDeque(env);
+	MM_Packet *packet = NULL;
+
+	/* the newest local packet is the most likely to still be in cache */
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+	}
+
+	/* packets that did not fit a deque, partially consumed input packets and overflow are on the shared lists */
+	if (MM_WorkPacketsStandard::inputPacketAvailable(env)) {
+		packet = MM_WorkPacketsStandard::getInputPacketNoWait(env);
+		if (NULL != packet) {
+			return packet;
+		}
+	}
+
+	packet = getPacketFromDeques(env, deque);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != packet) {
+		env->_workPacketStats.workPacketsAcquired += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return packet;
+}
+
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacket(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = (NULL == env->_currentTask) ? 1 : env->_currentTask->getThreadCount();
+	bool mustSyncThreadsAndExit = (NULL != env->_currentTask) && env->_currentTask->shouldYieldFromTask(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	for (;;) {
+		if (!mustSyncThreadsAndExit) {
+			MM_Packet *packet = getInputPacketNoWait(env);
+			if (NULL != packet) {
+				return packet;
+			}
+		}
+
+		/* Out of work: go idle until work shows up or every thread of the task is idle */
+		uintptr_t oldState = 0;
+		do {
+			oldState = _stealingState;
+			Assert_MM_true((oldState & WORKPACKETS_STEALING_IDLE_MASK) < threadCount);
+		} while (oldState != MM_AtomicOperations::lockCompareExchange(&_stealingState, oldState, oldState + 1));
+		uintptr_t epoch = oldState >> WORKPACKETS_STEALING_IDLE_BITS;
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t idleStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		bool done = false;
+		for (;;) {
+			uintptr_t state = _stealingState;
+			if (epoch != (state >> WORKPACKETS_STEALING_IDLE_BITS)) {
+				/* another thread detected termination */
+				done = true;
+				break;
+			}
+
+			if (!mustSyncThreadsAndExit && inputPacketAvailable(env)) {
+				/* leave the idle state to look for work; retry if the state changed under us */
+				if (state == MM_AtomicOperations::lockCompareExchange(&_stealingState, state, state - 1)) {
+					break;
+				}
+				continue;
+			}
+
+			if (threadCount == (state & WORKPACKETS_STEALING_IDLE_MASK)) {
+				/* every thread is idle and no work is visible (idle threads do not produce work): advance the epoch to release them */
+				if (state == MM_AtomicOperations::lockCompareExchange(&_stealingState, state, (epoch + 1) << WORKPACKETS_STEALING_IDLE_BITS)) {
+					done = true;
+					break;
+				}
+				continue;
+			}
+
+			for (uintptr_t spin = 0; spin < WORKPACKETS_STEALING_SPIN_COUNT; spin++) {
+				MM_AtomicOperations::yieldCPU();
+			}
+			omrthread_yield();
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t idleEndTime = omrtime_hires_clock();
+		if (done) {
+			env->_workPacketStats.addToCompleteStallTime(idleStartTime, idleEndTime);
+		} else {
+			env->_workPacketStats.addToWorkStallTime(idleStartTime, idleEndTime);
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		if (done) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+void
+MM_WorkPacketsStealing::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.workPacketsReleased += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	MM_PacketDeque *deque = getPacketDeque(env);
+	if ((NULL != deque) && !packet->isEmpty()) {
+		packet->resetOwner();
+		if (deque->push(packet)) {
+			return;
+		}
+	}
+
+	/* empty packets, threads without a deque and full deques use the shared lists */
+	putPacket(env, packet);
+}
+
+MM_Packet *
+MM_WorkPacketsStealing::getPacketByOverflowing(MM_EnvironmentBase *env)
+{
+	MM_PacketDeque *deque = getPacketDeque(env);
+	if (NULL != deque) {
+		MM_Packet *packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+			/* Move the contents of the packet to overflow, idle threads poll the overflow handler for work */
+			emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
+			return packet;
+		}
+	}
+
+	return MM_WorkPacketsStandard::getPacketByOverflowing(env);
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(WORKPACKETSSTEALING_HPP_)
+#define WORKPACKETSSTEALING_HPP_
+
+#include "omrcfg.h"
+
+#include "PacketDeque.hpp"
+#include "WorkPacketsStandard.hpp"
+
+/**
+ * Work packets for stop-the-world parallel marking in which output packets are distributed over per-thread
+ * work-stealing deques instead of the shared packet lists.
+ *
+ * A thread that fills an output packet pushes it on its own deque and takes its next input packet from the
+ * same deque, so in the common case packets never touch a shared list lock. A thread out of local work takes
+ * from the shared lists (which still receive packets that do not fit a full deque, partially consumed input
+ * packets and overflow), then steals the oldest packet from the deque of another thread, starting at a random
+ * victim.
+ *
+ * Threads out of work do not block on _inputListMonitor. They spin and yield on a single state word that holds
+ * the termination epoch and the idle thread count. The last thread to go idle while no work is visible ends
+ * the scan by advancing the epoch, which releases all idle threads.
+ *
+ * Only used when concurrent mark is disabled (see MM_MarkingScheme::createWorkPackets()): concurrent mark
+ * hands packets between mutator and GC threads and waits on the input list monitor directly.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_WorkPacketsStealing : public MM_WorkPacketsStandard
+{
+/*
+ * Data members
+ */
+private:
+	MM_PacketDeque *_packetDeques; /**< per-thread deques of non-empty packets (indexed by slave ID) */
+	uintptr_t _packetDequeCount; /**< number of entries in _packetDeques */
+	volatile uintptr_t _stealingState; /**< termination state: scan epoch in the high bits, idle thread count in the low bits */
+
+protected:
+
+public:
+	
+/*
+ * Function members
+ */
+private:
+	/**
+	 * @return the deque owned by the given thread or NULL if the thread has none
+	 */
+	MMINLINE MM_PacketDeque *
+	getPacketDeque(MM_EnvironmentBase *env)
+	{
+		MM_PacketDeque *deque = NULL;
+		uintptr_t slaveID = env->getSlaveID();
+		if (slaveID < _packetDequeCount) {
+			deque = &_packetDeques[slaveID];
+		}
+		return deque;
+	}
+
+	/**
+	 * @return true if any deque appeared non-empty
+	 */
+	bool isDequeWorkAvailable();
+
+	/**
+	 * Take a packet from the given thread deque or steal one from another thread deque.
+	 * @return a packet owned by the current thread, or NULL if none was found
+	 */
+	MM_Packet *getPacketFromDeques(MM_EnvironmentBase *env, MM_PacketDeque *deque);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Empty the newest packet of the thread deque to overflow before falling back to the shared full list,
+	 * since most full packets are on deques rather than on the shared lists.
+	 */
+	virtual MM_Packet *getPacketByOverflowing(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkPacketsStealing *newInstance(MM_EnvironmentBase *env);
+
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
+	virtual void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a WorkPackets object.
+	 */
+	MM_WorkPacketsStealing(MM_EnvironmentBase *env) :
+		MM_WorkPacketsStandard(env)
+		, _packetDeques(NULL)
+		, _packetDequeCount(0)
+		, _stealingState(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* WORKPACKETSSTEALING_HPP_ */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(BALANCEDCOPYFORWARDTASK_HPP_)
+#define BALANCEDCOPYFORWARDTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_BalancedGC;
+class MM_CycleState;
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+
+/**
+ * Copy-forward task of a balanced partial collection: evacuates the live objects of the collection set.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_BalancedCopyForwardTask : public MM_ParallelTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_BalancedGC *_collector;
+	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
+
+/* Methods */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; }
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void setup(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	MM_BalancedCopyForwardTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_BalancedGC *collector, MM_CycleState *cycleState)
+		: MM_ParallelTask(env, dispatcher)
+		, _collector(collector)
+		, _cycleState(cycleState)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* BALANCEDCOPYFORWARDTASK_HPP_ */
@@ -0,0 +1,1125 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "mmprivatehook.h"
+#include "mmprivatehook_internal.h"
+
+#include "AtomicOperations.hpp"
+#include "BalancedCopyForwardTask.hpp"
+#include "BalancedSweepTask.hpp"
+#include "CollectionStatisticsStandard.hpp"
+#include "CopyForwardRootScanner.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "ForwardedHeader.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapRegionIterator.hpp"
+#include "MarkMap.hpp"
+#include "MemoryPoolBalanced.hpp"
+#include "MemorySubSpace.hpp"
+#include "modronapicore.hpp"
+#include "ModronAssertions.h"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+#include "OMRVMInterface.hpp"
+#include "ParallelMarkTask.hpp"
+#include "ParallelRootScanner.hpp"
+#include "SlotObject.hpp"
+#include "SweepStats.hpp"
+#include "WorkPackets.hpp"
+
+#include "BalancedGC.hpp"
+
+/* OMRTODO temporary workaround to allow both ut_j9mm.h and ut_omrmm.h to be included.
+ *                 Dependency on ut_j9mm.h should be removed in the future.
+ */
+#undef UT_MODULE_LOADED
+#undef UT_MODULE_UNLOADED
+#include "ut_omrmm.h"
+
+#if defined(OMR_GC_VLHGC)
+
+/**
+ * Order old regions by decreasing reclaimable bytes per byte of copy-forward work.
+ */
+static int
+compareEvacuationBenefit(const void *element1, const void *element2)
+{
+	MM_HeapRegionDescriptorBalanced *region1 = *(MM_HeapRegionDescriptorBalanced **)element1;
+	MM_HeapRegionDescriptorBalanced *region2 = *(MM_HeapRegionDescriptorBalanced **)element2;
+	/* cross multiply (reclaimable1 / cost1) and (reclaimable2 / cost2) to avoid divisions; the costs are never 0 */
+	double benefit1 = (double)(region1->getSize() - region1->_liveBytes) * (double)(region2->_liveBytes + 1);
+	double benefit2 = (double)(region2->getSize() - region2->_liveBytes) * (double)(region1->_liveBytes + 1);
+
+	if (benefit1 > benefit2) {
+		return -1;
+	}
+	return (benefit1 < benefit2) ? 1 : 0;
+}
+
+/**
+ * Initialization
+ */
+MM_BalancedGC *
+MM_BalancedGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_BalancedGC *globalGC = (MM_BalancedGC *)env->getForge()->allocate(sizeof(MM_BalancedGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_BalancedGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+void
+MM_BalancedGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize the collector's internal structures and values.
+ * @return true if initialization completed, false otherwise
+ */
+bool
+MM_BalancedGC::initialize(MM_EnvironmentBase *env)
+{
+	_markingScheme = MM_MarkingScheme::newInstance(env);
+	if (NULL == _markingScheme) {
+		return false;
+	}
+
+	_delegate.initialize(env, this, _markingScheme);
+
+	/* the dispatcher never runs more threads than it was started with */
+	_survivorRegionsCount = _dispatcher->threadCountMaximum();
+	_survivorRegions = (MM_HeapRegionDescriptorBalanced **)env->getForge()->allocate(sizeof(MM_HeapRegionDescriptorBalanced *) * _survivorRegionsCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _survivorRegions) {
+		return false;
+	}
+	memset(_survivorRegions, 0, sizeof(MM_HeapRegionDescriptorBalanced *) * _survivorRegionsCount);
+
+	return true;
+}
+
+/**
+ * Free any internal structures associated to the receiver.
+ */
+void
+MM_BalancedGC::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _markingScheme) {
+		_markingScheme->kill(env);
+		_markingScheme = NULL;
+	}
+
+	if (NULL != _survivorRegions) {
+		env->getForge()->free(_survivorRegions);
+		_survivorRegions = NULL;
+	}
+
+	if (NULL != _candidateRegions) {
+		env->getForge()->free(_candidateRegions);
+		_candidateRegions = NULL;
+	}
+}
+
+bool
+MM_BalancedGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	return _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
+}
+
+bool
+MM_BalancedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	return _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+}
+
+void
+MM_BalancedGC::heapReconfigured(MM_EnvironmentBase* env)
+{
+}
+
+bool
+MM_BalancedGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	/* the region table is complete once the heap exists: size the collection set ranking array for it */
+	_candidateRegionsCount = extensions->heapRegionManager->getTableRegionCount();
+	_candidateRegions = (MM_HeapRegionDescriptorBalanced **)extensions->getForge()->allocate(sizeof(MM_HeapRegionDescriptorBalanced *) * _candidateRegionsCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	return NULL != _candidateRegions;
+}
+
+void
+MM_BalancedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+}
+
+void *
+MM_BalancedGC::createSweepPoolState(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool)
+{
+	/*
+	 *  This function does nothing and is designed to have implementation of abstract in GlobalCollector,
+	 *  but must return non-NULL value to pass initialization - so, return "this"
+	 */
+	return this;
+}
+
+void
+MM_BalancedGC::deleteSweepPoolState(MM_EnvironmentBase *env, void *sweepPoolState)
+{
+}
+
+void
+MM_BalancedGC::setupForGC(MM_EnvironmentBase *env)
+{
+}
+
+/*
+ * Copy-forward
+ */
+omrobjectptr_t
+MM_BalancedGC::copyObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_ForwardedHeader forwardedHeader(objectPtr);
+	/* an object a thread failed to evacuate is forwarded to itself */
+	omrobjectptr_t destinationObjectPtr = forwardedHeader.getNonStrictForwardedObject();
+	if (NULL != destinationObjectPtr) {
+		return destinationObjectPtr;
+	}
+
+	uintptr_t objectCopySizeInBytes = 0;
+	uintptr_t objectReserveSizeInBytes = 0;
+	uintptr_t hotFieldsDescriptor = 0;
+	_extensions->objectModel.calculateObjectDetailsForCopy(env, &forwardedHeader, &objectCopySizeInBytes, &objectReserveSizeInBytes, &hotFieldsDescriptor);
+
+	uintptr_t slaveID = env->getSlaveID();
+	MM_HeapRegionDescriptorBalanced *survivorRegion = _survivorRegions[slaveID];
+	if ((NULL == survivorRegion) || (objectReserveSizeInBytes > ((uintptr_t)survivorRegion->getHighAddress() - (uintptr_t)survivorRegion->_allocatePointer))) {
+		if (NULL != survivorRegion) {
+			retireSurvivorRegion(env, survivorRegion);
+			_survivorRegions[slaveID] = NULL;
+		}
+		/* the collection set is sized to leave enough free regions behind for all of its live objects, but the
+		 * live bytes of old regions are only upper bounds as of the last global collection
+		 */
+		if (!_survivorRegionsExhausted) {
+			survivorRegion = _memoryPool->acquireSurvivorRegion(env);
+			if (NULL == survivorRegion) {
+				_survivorRegionsExhausted = true;
+			}
+		}
+		if (_survivorRegionsExhausted) {
+			return selfForwardObject(env, &forwardedHeader);
+		}
+		_survivorRegions[slaveID] = survivorRegion;
+		env->_copyForwardStats._nonEdenSurvivorRegionCount += 1;
+	}
+
+	destinationObjectPtr = (omrobjectptr_t)survivorRegion->_allocatePointer;
+	omrobjectptr_t forwardedObjectPtr = forwardedHeader.setForwardedObject(destinationObjectPtr);
+	if (forwardedObjectPtr == destinationObjectPtr) {
+		/* this thread won the race to copy the object */
+		memcpy((void *)destinationObjectPtr, objectPtr, objectCopySizeInBytes);
+		forwardedHeader.fixupForwardedObject(destinationObjectPtr);
+		_extensions->objectModel.fixupForwardedObject(&forwardedHeader, destinationObjectPtr, _extensions->objectModel.getPreservedAge(&forwardedHeader));
+
+		survivorRegion->_allocatePointer = (void *)((uintptr_t)destinationObjectPtr + objectReserveSizeInBytes);
+		survivorRegion->_liveBytes += objectReserveSizeInBytes;
+
+		MM_CopyForwardStatsCore *stats = &env->_copyForwardStats;
+		stats->_copyObjectsTotal += 1;
+		stats->_copyBytesTotal += objectReserveSizeInBytes;
+		if (getRegion(objectPtr)->_isEden) {
+			stats->_copyObjectsEden += 1;
+			stats->_copyBytesEden += objectReserveSizeInBytes;
+		} else {
+			stats->_copyObjectsNonEden += 1;
+			stats->_copyBytesNonEden += objectReserveSizeInBytes;
+		}
+
+		env->_workStack.push(env, (void *)destinationObjectPtr);
+	} else if (NULL == forwardedObjectPtr) {
+		/* another thread failed to copy the object and left it in place */
+		forwardedObjectPtr = objectPtr;
+	}
+
+	return forwardedObjectPtr;
+}
+
+omrobjectptr_t
+MM_BalancedGC::selfForwardObject(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader)
+{
+	omrobjectptr_t objectPtr = forwardedHeader->getObject();
+	omrobjectptr_t forwardedObjectPtr = forwardedHeader->setSelfForwardedObject();
+	if (forwardedObjectPtr == objectPtr) {
+		/* the region keeps this object, so it can not be released. If another thread self-forwarded the object
+		 * first, both threads push it: scanning it twice only finds the same forwarded children again.
+		 */
+		MM_HeapRegionDescriptorBalanced *region = getRegion(objectPtr);
+		region->_evacuationFailed = true;
+
+		uintptr_t objectSizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		MM_CopyForwardStatsCore *stats = &env->_copyForwardStats;
+		stats->_aborted = true;
+		stats->_scanObjectsTotal += 1;
+		stats->_scanBytesTotal += objectSizeInBytes;
+		if (region->_isEden) {
+			stats->_scanObjectsEden += 1;
+			stats->_scanBytesEden += objectSizeInBytes;
+		} else {
+			stats->_scanObjectsNonEden += 1;
+			stats->_scanBytesNonEden += objectSizeInBytes;
+		}
+
+		env->_workStack.push(env, (void *)objectPtr);
+	}
+	return forwardedObjectPtr;
+}
+
+uintptr_t
+MM_BalancedGC::getCollectionSetEntrySize(omrobjectptr_t objectPtr)
+{
+	uintptr_t sizeInBytes = 0;
+	if (_extensions->objectModel.isDeadObject(objectPtr)) {
+		sizeInBytes = _extensions->objectModel.getSizeInBytesDeadObject(objectPtr);
+	} else {
+		/* the header of a copied object holds its forwarding pointer: read the size from the copy */
+		MM_ForwardedHeader forwardedHeader(objectPtr);
+		omrobjectptr_t forwardedObjectPtr = forwardedHeader.getNonStrictForwardedObject();
+		sizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader((NULL != forwardedObjectPtr) ? forwardedObjectPtr : objectPtr);
+	}
+	return sizeInBytes;
+}
+
+void
+MM_BalancedGC::scanSelfForwardedObjects(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region)
+{
+	omrobjectptr_t objectPtr = (omrobjectptr_t)region->getLowAddress();
+	while (objectPtr < (omrobjectptr_t)region->_allocatePointer) {
+		uintptr_t sizeInBytes = getCollectionSetEntrySize(objectPtr);
+		if (!_extensions->objectModel.isDeadObject(objectPtr) && MM_ForwardedHeader(objectPtr).isSelfForwardedPointer()) {
+			copyForwardScanObject(env, objectPtr, true);
+			env->_copyForwardStats._objectsScannedFromOverflowedRegion += 1;
+		}
+		objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr + sizeInBytes);
+	}
+}
+
+void
+MM_BalancedGC::restoreEvacuationFailedRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region)
+{
+	uintptr_t liveBytes = 0;
+	uintptr_t holeBase = (uintptr_t)region->getLowAddress();
+	uintptr_t entry = holeBase;
+	uintptr_t top = (uintptr_t)region->_allocatePointer;
+
+	/* keep the objects left in place and turn everything else (copied or dead objects) into holes */
+	while (entry < top) {
+		omrobjectptr_t objectPtr = (omrobjectptr_t)entry;
+		uintptr_t sizeInBytes = getCollectionSetEntrySize(objectPtr);
+		if (!_extensions->objectModel.isDeadObject(objectPtr)) {
+			MM_ForwardedHeader forwardedHeader(objectPtr);
+			if (forwardedHeader.isSelfForwardedPointer()) {
+				forwardedHeader.restoreSelfForwardedPointer();
+				if (holeBase < entry) {
+					MM_HeapLinkedFreeHeader::fillWithHoles((void *)holeBase, entry - holeBase);
+				}
+				holeBase = entry + sizeInBytes;
+				liveBytes += sizeInBytes;
+			}
+		}
+		entry += sizeInBytes;
+	}
+	if (holeBase < top) {
+		MM_HeapLinkedFreeHeader::fillWithHoles((void *)holeBase, top - holeBase);
+	}
+
+	/* references from copied objects to the objects left in place were not recorded: the region can not be
+	 * evacuated again until a global collection rebuilds its remembered set
+	 */
+	region->_rememberedSet.setOverflowed();
+	region->_liveBytes = liveBytes;
+	region->_isEden = false;
+	region->_inCollectionSet = false;
+	region->_evacuationFailed = false;
+	region->_nextInList = NULL;
+}
+
+void
+MM_BalancedGC::retireSurvivorRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region)
+{
+	uintptr_t tailSize = (uintptr_t)region->getHighAddress() - (uintptr_t)region->_allocatePointer;
+	if (0 != tailSize) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(region->_allocatePointer, tailSize);
+		env->_copyForwardStats._copyDiscardBytesTotal += tailSize;
+	}
+}
+
+void
+MM_BalancedGC::copyForwardObjectSlot(MM_EnvironmentBase *env, volatile omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	if ((NULL != objectPtr) && isObjectInCollectionSet(objectPtr)) {
+		*slotPtr = copyObject(env, objectPtr);
+		env->_copyForwardStats._objectsScannedFromRoot += 1;
+	}
+}
+
+void
+MM_BalancedGC::copyForwardScanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool isCopy)
+{
+	MM_HeapRegionDescriptorBalanced *sourceRegion = getRegion(objectPtr);
+	GC_ObjectScannerState objectScannerState;
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScanner *objectScanner = _markingScheme->getMarkingDelegate()->getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		GC_SlotObject *slotObject = NULL;
+#if defined(OMR_GC_LEAF_BITS)
+		bool isLeafSlot = false;
+		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			omrobjectptr_t childPtr = slotObject->readReferenceFromSlot();
+			if (NULL != childPtr) {
+				MM_HeapRegionDescriptorBalanced *childRegion = getRegion(childPtr);
+				bool moved = childRegion->_inCollectionSet;
+				if (moved) {
+					childPtr = copyObject(env, childPtr);
+					slotObject->writeReferenceToSlot(childPtr);
+					childRegion = getRegion(childPtr);
+				}
+				/* the remembered sets of the collection set are being scanned: a child left there by a failed
+				 * evacuation is not recorded, and its region loses its remembered set instead (see restoreEvacuationFailedRegion())
+				 */
+				if ((moved || isCopy) && (childRegion != sourceRegion) && !childRegion->_inCollectionSet) {
+					childRegion->_rememberedSet.add(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_BalancedGC::scanRememberedSets(MM_EnvironmentBase *env, MM_ParallelRootScanner *rootScanner)
+{
+	uintptr_t entriesPerUnit = rootScanner->getEntriesPerUnit();
+	for (MM_HeapRegionDescriptorBalanced *region = _collectionSet; NULL != region; region = region->_nextInList) {
+		/* sources are only added to regions outside of the collection set while it is evacuated */
+		MM_ObjectRememberedSet *rememberedSet = &region->_rememberedSet;
+		uintptr_t tableSize = rememberedSet->getTableSize();
+		for (uintptr_t unitBase = 0; unitBase < tableSize; unitBase += entriesPerUnit) {
+			if (rootScanner->scanUnitStarted(env, RootScannerEntity_RememberedSet)) {
+				uintptr_t unitTop = OMR_MIN(unitBase + entriesPerUnit, tableSize);
+				for (uintptr_t i = unitBase; i < unitTop; i++) {
+					omrobjectptr_t sourcePtr = rememberedSet->getEntry(i);
+					if ((NULL != sourcePtr) && !isObjectInCollectionSet(sourcePtr)) {
+						copyForwardScanObject(env, sourcePtr, false);
+						env->_copyForwardStats._objectsCardClean += 1;
+					}
+				}
+				rootScanner->scanUnitEnded(env);
+			}
+		}
+	}
+}
+
+void
+MM_BalancedGC::workerCopyForward(MM_EnvironmentBase *env)
+{
+	MM_WorkPackets *workPackets = _markingScheme->getWorkPackets();
+	env->_workStack.reset(env, workPackets);
+	env->_workStack.prepareForWork(env, workPackets);
+
+	MM_CopyForwardRootScanner rootScanner(env, this);
+	rootScanner.scanRoots(env);
+	scanRememberedSets(env, &rootScanner);
+
+	do {
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.pop(env))) {
+			copyForwardScanObject(env, objectPtr, true);
+			env->_copyForwardStats._objectsScannedFromWorkPackets += 1;
+		}
+	} while (workPackets->handleWorkPacketOverflow(env));
+
+	/* every live object of the collection set is copied: update or drop the clearable references to it */
+	rootScanner.scanClearable(env);
+
+	env->_workStack.flush(env);
+
+	uintptr_t slaveID = env->getSlaveID();
+	if (NULL != _survivorRegions[slaveID]) {
+		retireSurvivorRegion(env, _survivorRegions[slaveID]);
+		_survivorRegions[slaveID] = NULL;
+	}
+}
+
+void
+MM_BalancedGC::mergeCopyForwardStats(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_extensions->gcStatsMutex);
+	_copyForwardStats.merge(&env->_copyForwardStats);
+	/* survivor region counts and root counts are not per-thread statistics for MM_CopyForwardStatsCore::merge() */
+	_copyForwardStats._nonEdenSurvivorRegionCount += env->_copyForwardStats._nonEdenSurvivorRegionCount;
+	_copyForwardStats._objectsScannedFromRoot += env->_copyForwardStats._objectsScannedFromRoot;
+	_extensions->globalGCStats.workPacketStats.merge(&env->_workPacketStats);
+	omrthread_monitor_exit(_extensions->gcStatsMutex);
+}
+
+/*
+ * Collection set
+ */
+bool
+MM_BalancedGC::isEvacuationCandidate(MM_HeapRegionDescriptorBalanced *region)
+{
+	return !region->_isLargeObject
+		&& !region->_rememberedSet.isOverflowed()
+		&& ((region->_liveBytes * 100) <= (region->getSize() * (100 - MINIMUM_RECLAIMABLE_PERCENT)));
+}
+
+void
+MM_BalancedGC::addToCollectionSet(MM_HeapRegionDescriptorBalanced *region)
+{
+	region->_inCollectionSet = true;
+	region->_nextInList = _collectionSet;
+	_collectionSet = region;
+	_collectionSetSourceCount += region->_rememberedSet.getCount();
+}
+
+void
+MM_BalancedGC::selectCollectionSet(MM_EnvironmentBase *env)
+{
+	uintptr_t liveBytes = 0;
+	uintptr_t candidateCount = 0;
+
+	_collectionSet = NULL;
+	_collectionSetSourceCount = 0;
+
+	/* eden is always evacuated (the pool keeps enough free regions to do so) */
+	GC_HeapRegionIterator regionIterator(_extensions->heapRegionManager);
+	MM_HeapRegionDescriptorBalanced *region = NULL;
+	while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)regionIterator.nextRegion())) {
+		if (MM_HeapRegionDescriptor::FREE != region->getRegionType()) {
+			if (region->_isEden) {
+				addToCollectionSet(region);
+				liveBytes += region->getAllocatedBytes();
+				_copyForwardStats._edenEvacuateRegionCount += 1;
+			} else if (isEvacuationCandidate(region)) {
+				Assert_MM_true(candidateCount < _candidateRegionsCount);
+				_candidateRegions[candidateCount] = region;
+				candidateCount += 1;
+			} else {
+				_copyForwardStats._nonEvacuateRegionCount += 1;
+			}
+		}
+	}
+
+	if (_extensions->tarokEnableDynamicCollectionSetSelection && (0 < candidateCount)) {
+		/* add the old regions reclaiming the most per byte copied while the pause time and survivor space allow */
+		J9_SORT(_candidateRegions, candidateCount, sizeof(MM_HeapRegionDescriptorBalanced *), compareEvacuationBenefit);
+		double pauseTimeBudgetMicros = (double)_extensions->tarokTargetMaxPauseTime * 1000.0;
+		uintptr_t index = 0;
+		for (; index < candidateCount; index++) {
+			region = _candidateRegions[index];
+			uintptr_t nextLiveBytes = liveBytes + region->_liveBytes;
+			uintptr_t nextSourceCount = _collectionSetSourceCount + region->_rememberedSet.getCount();
+			if ((estimateCopyForwardMicros(nextLiveBytes, nextSourceCount) > pauseTimeBudgetMicros)
+				|| (_memoryPool->getSurvivorRegionsRequired(nextLiveBytes) > _memoryPool->getFreeRegionCount())
+			) {
+				break;
+			}
+			addToCollectionSet(region);
+			liveBytes = nextLiveBytes;
+			_copyForwardStats._nonEdenEvacuateRegionCount += 1;
+		}
+		_copyForwardStats._nonEvacuateRegionCount += candidateCount - index;
+	} else {
+		_copyForwardStats._nonEvacuateRegionCount += candidateCount;
+	}
+
+	Trc_MM_BalancedGC_collectionSetSelected(env->getLanguageVMThread(), _copyForwardStats._edenEvacuateRegionCount, _copyForwardStats._nonEdenEvacuateRegionCount, liveBytes, _collectionSetSourceCount);
+}
+
+void
+MM_BalancedGC::purgeRememberedSets(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
+	/* drop the sources which were evacuated (or were garbage): copies recorded their own references while being
+	 * scanned. Objects left in place by a failed evacuation stay recorded.
+	 */
+	GC_HeapRegionIterator regionIterator(_extensions->heapRegionManager);
+	MM_HeapRegionDescriptorBalanced *region = NULL;
+	while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)regionIterator.nextRegion())) {
+		if ((MM_HeapRegionDescriptor::FREE != region->getRegionType()) && !region->_inCollectionSet && (0 != region->_rememberedSet.getCount())) {
+			MM_ObjectRememberedSet *rememberedSet = &region->_rememberedSet;
+			uintptr_t tableSize = rememberedSet->getTableSize();
+			for (uintptr_t i = 0; i < tableSize; i++) {
+				omrobjectptr_t sourcePtr = rememberedSet->getEntry(i);
+				if (NULL != sourcePtr) {
+					_irrsStats._clearFromRegionReferencesCardsProcessed += 1;
+					if (isObjectEvacuated(sourcePtr)) {
+						rememberedSet->removeEntryAt(i);
+						_irrsStats._clearFromRegionReferencesCardsCleared += 1;
+					}
+				}
+			}
+		}
+	}
+
+	_irrsStats._clearFromRegionReferencesTimesus = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+void
+MM_BalancedGC::releaseCollectionSet(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionDescriptorBalanced *region = _collectionSet;
+	while (NULL != region) {
+		MM_HeapRegionDescriptorBalanced *next = region->_nextInList;
+		if (region->_evacuationFailed) {
+			restoreEvacuationFailedRegion(env, region);
+		} else {
+			_memoryPool->addFreeRegion(env, region);
+		}
+		region = next;
+	}
+	_collectionSet = NULL;
+	_memoryPool->resetEdenRegionCount();
+}
+
+void
+MM_BalancedGC::updateCopyForwardRate(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t workBytes = _copyForwardStats._copyBytesTotal + (_collectionSetSourceCount * REMEMBERED_SET_SOURCE_COST_BYTES);
+	/* the fixed costs of a collection (dispatch, root scanning) dominate the time of one copying less than a region,
+	 * which would inflate the rate until no old region fits in the pause time budget
+	 */
+	if (workBytes >= _memoryPool->getRegionSize()) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_copyForwardStats._startTime, _copyForwardStats._endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		double sample = (double)elapsedMicros / (double)workBytes;
+		_copyForwardMicrosPerByte = ((_copyForwardMicrosPerByte * COPY_RATE_HISTORY_WEIGHT_PERCENT) + (sample * (100 - COPY_RATE_HISTORY_WEIGHT_PERCENT))) / 100.0;
+	}
+}
+
+/*
+ * Garbage Collection
+ */
+bool
+MM_BalancedGC::shouldCollectGlobal(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	if (gcCode.isExplicitGC() || gcCode.isAggressiveGC()) {
+		return true;
+	}
+
+	/* an eden region must be evacuated, which is not possible if its remembered set is incomplete */
+	GC_HeapRegionIterator regionIterator(_extensions->heapRegionManager);
+	MM_HeapRegionDescriptorBalanced *region = NULL;
+	while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)regionIterator.nextRegion())) {
+		if ((MM_HeapRegionDescriptor::FREE != region->getRegionType()) && region->_isEden && region->_rememberedSet.isOverflowed()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+MM_BalancedGC::partialGarbageCollect(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	_copyForwardStats.clear();
+	_irrsStats.clear();
+	_copyForwardStats._gcCount = _extensions->globalVLHGCStats.gcCount;
+	_copyForwardStats._startTime = omrtime_hires_clock();
+	_copyForwardStats._freeMemoryBefore = _extensions->heap->getApproximateActiveFreeMemorySize();
+	_copyForwardStats._totalMemoryBefore = _extensions->heap->getActiveMemorySize();
+
+	selectCollectionSet(env);
+	reportCopyForwardStart(env);
+
+	_markingScheme->getWorkPackets()->reset(env);
+	_survivorRegionsExhausted = false;
+	_copyForwardInProgress = true;
+	MM_BalancedCopyForwardTask copyForwardTask(env, _dispatcher, this, env->_cycleState);
+	_dispatcher->run(env, &copyForwardTask);
+	_copyForwardInProgress = false;
+
+	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
+
+	purgeRememberedSets(env);
+	releaseCollectionSet(env);
+
+	_copyForwardStats._endTime = omrtime_hires_clock();
+	_copyForwardStats._freeMemoryAfter = _extensions->heap->getApproximateActiveFreeMemorySize();
+	_copyForwardStats._totalMemoryAfter = _extensions->heap->getActiveMemorySize();
+	updateCopyForwardRate(env);
+	reportCopyForwardEnd(env);
+}
+
+void
+MM_BalancedGC::globalGarbageCollect(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	reportGCStart(env);
+
+	/*
+	 * Marking
+	 */
+	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
+	reportMarkStart(env);
+	markStats->_startTime = omrtime_hires_clock();
+	_markingScheme->masterSetupForGC(env);
+
+	bool initMarkMap = true;
+	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	_dispatcher->run(env, &markTask);
+
+	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
+
+	_markingScheme->masterCleanupAfterGC(env);
+	markStats->_endTime = omrtime_hires_clock();
+	reportMarkEnd(env);
+
+	/*
+	 * Region sweeping
+	 */
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	reportSweepStart(env);
+	sweepStats->_startTime = omrtime_hires_clock();
+	sweepRegions(env);
+	sweepStats->_endTime = omrtime_hires_clock();
+	reportSweepEnd(env);
+
+	/*
+	 * Evacuation: the live bytes of every old region are now exact, so the regions with enough garbage
+	 * are copied forward to release the memory the sweep could not
+	 */
+	partialGarbageCollect(env);
+
+	reportGCEnd(env);
+}
+
+void
+MM_BalancedGC::rememberObjectReferences(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_HeapRegionDescriptorBalanced *sourceRegion = getRegion(objectPtr);
+	GC_ObjectScannerState objectScannerState;
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScanner *objectScanner = _markingScheme->getMarkingDelegate()->getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		GC_SlotObject *slotObject = NULL;
+#if defined(OMR_GC_LEAF_BITS)
+		bool isLeafSlot = false;
+		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			omrobjectptr_t childPtr = slotObject->readReferenceFromSlot();
+			if (NULL != childPtr) {
+				MM_HeapRegionDescriptorBalanced *childRegion = getRegion(childPtr);
+				if (childRegion != sourceRegion) {
+					childRegion->_rememberedSet.add(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_BalancedGC::workerSweepRegions(MM_EnvironmentBase *env)
+{
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	MM_HeapRegionDescriptorBalanced *region = NULL;
+
+	/* every remembered set is rebuilt from the marked objects: all of them must be empty before any is refilled.
+	 * Every thread claims a work unit for every region (free or not) so that all threads agree on the units.
+	 */
+	GC_HeapRegionIterator regionIterator(_extensions->heapRegionManager);
+	while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)regionIterator.nextRegion())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (MM_HeapRegionDescriptor::FREE != region->getRegionType()) {
+				region->_rememberedSet.clear(env);
+			}
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	GC_HeapRegionIterator sweepIterator(_extensions->heapRegionManager);
+	while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)sweepIterator.nextRegion())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (MM_HeapRegionDescriptor::FREE != region->getRegionType()) {
+				uintptr_t liveBytes = 0;
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)region->getLowAddress(), (omrobjectptr_t)region->_allocatePointer, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					if (markMap->isBitSet(objectPtr)) {
+						liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+						rememberObjectReferences(env, objectPtr);
+					}
+				}
+
+				if (0 == liveBytes) {
+					/* nothing marked references into the region, so no thread adds to its (empty) remembered set */
+					_memoryPool->addFreeRegion(env, region);
+				} else {
+					region->_liveBytes = liveBytes;
+					region->_isEden = false;
+				}
+			}
+		}
+	}
+}
+
+void
+MM_BalancedGC::sweepRegions(MM_EnvironmentBase *env)
+{
+	MM_BalancedSweepTask sweepTask(env, _dispatcher, this, env->_cycleState);
+	_dispatcher->run(env, &sweepTask);
+
+	_memoryPool->resetEdenRegionCount();
+}
+
+bool
+MM_BalancedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription)
+{
+	_extensions->globalGCStats.clear();
+	_extensions->globalGCStats.gcCount += 1;
+	_extensions->globalVLHGCStats.gcCount += 1;
+
+	if (OMR_GC_CYCLE_TYPE_VLHGC_PARTIAL_GARBAGE_COLLECT == env->_cycleState->_type) {
+		partialGarbageCollect(env);
+	} else {
+		globalGarbageCollect(env);
+	}
+
+	/* Heap size now fixed for next cycle so reset heap statistics */
+	_extensions->heap->resetHeapStatistics(true);
+
+	return true;
+}
+
+void
+MM_BalancedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	_cycleState = MM_CycleState();
+	env->_cycleState = &_cycleState;
+	env->_cycleState->_collectionStatistics = &_collectionStatistics;
+	env->_cycleState->_gcCode = MM_GCCode(gcCode);
+	env->_cycleState->_activeSubSpace = subSpace;
+	env->_cycleState->_type = shouldCollectGlobal(env) ? OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_GARBAGE_COLLECT : OMR_GC_CYCLE_TYPE_VLHGC_PARTIAL_GARBAGE_COLLECT;
+
+	_memoryPool = (MM_MemoryPoolBalanced *)env->getDefaultMemorySubSpace()->getMemoryPool();
+
+	/* Flush the caches for gc: abandoned TLH remainders become holes, then eden stops handing out memory */
+	GC_OMRVMInterface::flushCachesForGC(env);
+	_memoryPool->retireAllocationRegion();
+
+	reportGCCycleStart(env);
+	reportGCIncrementStart(env);
+}
+
+void
+MM_BalancedGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_GlobalCollector::internalPostCollect(env, subSpace);
+
+	reportGCCycleFinalIncrementEnding(env);
+	reportGCIncrementEnd(env);
+	reportGCCycleEnd(env);
+}
+
+/*
+ * Reporting
+ */
+void
+MM_BalancedGC::reportGCCycleFinalIncrementEnding(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	MM_CommonGCData commonData;
+	TRIGGER_J9HOOK_MM_OMR_GC_CYCLE_END(
+		_extensions->omrHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_OMR_GC_CYCLE_END,
+		_extensions->getHeap()->initializeCommonGCData(env, &commonData),
+		env->_cycleState->_type,
+		omrgc_condYieldFromGC
+	);
+}
+
+void
+MM_BalancedGC::reportGCCycleStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CommonGCData commonData;
+
+	TRIGGER_J9HOOK_MM_OMR_GC_CYCLE_START(
+		_extensions->omrHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_OMR_GC_CYCLE_START,
+		_extensions->getHeap()->initializeCommonGCData(env, &commonData),
+		env->_cycleState->_type
+	);
+}
+
+void
+MM_BalancedGC::reportGCCycleEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CommonGCData commonData;
+
+	TRIGGER_J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END,
+		_extensions->getHeap()->initializeCommonGCData(env, &commonData),
+		env->_cycleState->_type,
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowOccured(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowCount(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkpacketCountAtOverflow(),
+		_extensions->globalGCStats.fixHeapForWalkReason,
+		_extensions->globalGCStats.fixHeapForWalkTime
+	);
+}
+
+void
+MM_BalancedGC::reportMarkStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Trc_MM_MarkStart(env->getLanguageVMThread());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_MARK_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_MARK_START);
+}
+
+void
+MM_BalancedGC::reportMarkEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Trc_MM_MarkEnd(env->getLanguageVMThread());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_MARK_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_MARK_END);
+}
+
+void
+MM_BalancedGC::reportSweepStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Trc_MM_SweepStart(env->getLanguageVMThread());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_SWEEP_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_SWEEP_START);
+}
+
+void
+MM_BalancedGC::reportSweepEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	Trc_MM_SweepEnd(env->getLanguageVMThread());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_SWEEP_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_SWEEP_END);
+}
+
+void
+MM_BalancedGC::reportCopyForwardStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_COPY_FORWARD_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_COPY_FORWARD_START,
+		&_copyForwardStats);
+}
+
+void
+MM_BalancedGC::reportCopyForwardEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_COPY_FORWARD_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_COPY_FORWARD_END,
+		&_copyForwardStats,
+		&_extensions->globalGCStats.workPacketStats,
+		&_irrsStats);
+}
+
+void
+MM_BalancedGC::reportGCStart(MM_EnvironmentBase *env)
+{
+	uintptr_t scavengerCount = 0;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	Trc_MM_GlobalGCStart(env->getLanguageVMThread(), _extensions->globalGCStats.gcCount);
+	Trc_OMRMM_GlobalGCStart(env->getOmrVMThread(), _extensions->globalGCStats.gcCount);
+
+	TRIGGER_J9HOOK_MM_OMR_GLOBAL_GC_START(
+		_extensions->omrHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_OMR_GLOBAL_GC_START,
+		_extensions->globalGCStats.gcCount,
+		scavengerCount,
+		env->_cycleState->_gcCode.isExplicitGC() ? 1 : 0,
+		env->_cycleState->_gcCode.isAggressiveGC() ? 1: 0,
+		_bytesRequested);
+}
+
+void
+MM_BalancedGC::reportGCEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t approximateActiveFreeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+	uintptr_t activeMemorySize = _extensions->heap->getActiveMemorySize();
+
+	Trc_MM_GlobalGCEnd(env->getLanguageVMThread(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowOccured(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowCount(),
+		approximateActiveFreeMemorySize,
+		activeMemorySize
+	);
+
+	Trc_OMRMM_GlobalGCEnd(env->getOmrVMThread(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowOccured(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowCount(),
+		approximateActiveFreeMemorySize,
+		activeMemorySize
+	);
+
+	/* the balanced heap has a single (old) memory type and no LOA */
+	TRIGGER_J9HOOK_MM_OMR_GLOBAL_GC_END(
+		_extensions->omrHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_OMR_GLOBAL_GC_END,
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowOccured(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowCount(),
+		_extensions->globalGCStats.workPacketStats.getSTWWorkpacketCountAtOverflow(),
+		0,
+		0,
+		approximateActiveFreeMemorySize,
+		activeMemorySize,
+		0,
+		0,
+		0,
+		approximateActiveFreeMemorySize,
+		activeMemorySize,
+		_extensions->globalGCStats.fixHeapForWalkReason,
+		_extensions->globalGCStats.fixHeapForWalkTime
+	);
+}
+
+void
+MM_BalancedGC::reportGCIncrementStart(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CollectionStatisticsStandard *stats = (MM_CollectionStatisticsStandard *)env->_cycleState->_collectionStatistics;
+	stats->collectCollectionStatistics(env, stats);
+	stats->_startTime = omrtime_hires_clock();
+
+	intptr_t rc = omrthread_get_process_times(&stats->_startProcessTimes);
+	switch (rc){
+	case -1: /* Error: Function un-implemented on architecture */
+	case -2: /* Error: getrusage() or GetProcessTimes() returned error value */
+		stats->_startProcessTimes._userTime = I_64_MAX;
+		stats->_startProcessTimes._systemTime = I_64_MAX;
+		break;
+	case  0:
+		break; /* Success */
+	default:
+		Assert_MM_unreachable();
+	}
+
+	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_START(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		stats->_startTime,
+		J9HOOK_MM_PRIVATE_GC_INCREMENT_START,
+		stats);
+}
+
+void
+MM_BalancedGC::reportGCIncrementEnd(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CollectionStatisticsStandard *stats = (MM_CollectionStatisticsStandard *)env->_cycleState->_collectionStatistics;
+	stats->collectCollectionStatistics(env, stats);
+
+	intptr_t rc = omrthread_get_process_times(&stats->_endProcessTimes);
+	switch (rc){
+	case -1: /* Error: Function un-implemented on architecture */
+	case -2: /* Error: getrusage() or GetProcessTimes() returned error value */
+		stats->_endProcessTimes._userTime = 0;
+		stats->_endProcessTimes._systemTime = 0;
+		break;
+	case  0:
+		break; /* Success */
+	default:
+		Assert_MM_unreachable();
+	}
+
+	stats->_endTime = omrtime_hires_clock();
+
+	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_END(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		stats->_endTime,
+		J9HOOK_MM_PRIVATE_GC_INCREMENT_END,
+		stats);
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(BALANCEDGC_HPP_)
+#define BALANCEDGC_HPP_
+
+#include "omrcfg.h"
+
+#include "CollectionStatisticsStandard.hpp"
+#include "CopyForwardStatsCore.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "ForwardedHeader.hpp"
+#include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
+#include "HeapRegionDescriptorBalanced.hpp"
+#include "HeapRegionManager.hpp"
+#include "InterRegionRememberedSetStats.hpp"
+#include "MarkingScheme.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_Dispatcher;
+class MM_MemoryPoolBalanced;
+class MM_ParallelRootScanner;
+
+/**
+ * Global collector of the balanced (region based) policy.
+ *
+ * The heap is divided into regions of equal size. Mutators allocate into eden regions; most collections are
+ * partial: they copy-forward the live objects of a collection set (all of eden plus the old regions with
+ * the best reclaim benefit for the copy cost) into free survivor regions, and release the evacuated regions.
+ * Each region keeps a remembered set of the objects in other regions which reference it, maintained by
+ * balancedWriteBarrier() and by the collector, so a partial collection does not have to trace the old regions.
+ * The size of the collection set is bounded by tarokTargetMaxPauseTime, using the copy rate measured by
+ * earlier partial collections. Should the free regions still run out, the objects which can not be copied
+ * are forwarded to themselves and their regions are kept as old regions.
+ *
+ * Explicit and aggressive collections, and collections following a remembered set overflow in eden, are
+ * global: they mark the whole heap, release regions without live objects, measure the live bytes of the
+ * others (which drives the collection set selection) and rebuild all remembered sets. They then evacuate
+ * the old regions worth compacting, as a partial collection would, to reclaim the garbage of regions which
+ * still hold live objects.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_BalancedGC : public MM_GlobalCollector
+{
+	/*
+	 * Data members
+	 */
+private:
+	/* cost of scanning one remembered set source, in bytes of copied objects, used by the pause time model */
+	static const uintptr_t REMEMBERED_SET_SOURCE_COST_BYTES = 64;
+	/* weight given to the history when a new copy rate sample is folded into the moving average */
+	static const uintptr_t COPY_RATE_HISTORY_WEIGHT_PERCENT = 75;
+	/* an old region joins the collection set only if at least this percentage of it is reclaimable */
+	static const uintptr_t MINIMUM_RECLAIMABLE_PERCENT = 25;
+
+protected:
+	MM_GCExtensionsBase *_extensions;
+	OMRPortLibrary *_portLibrary;
+	MM_MarkingScheme *_markingScheme;
+	MM_Dispatcher *_dispatcher;
+	MM_MemoryPoolBalanced *_memoryPool; /**< the pool of the single (default) subspace, cached at the start of each collection */
+
+	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
+	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+	MM_CopyForwardStatsCore _copyForwardStats; /**< statistics of the last partial collection, merged from all GC threads */
+	MM_InterRegionRememberedSetStats _irrsStats; /**< remembered set maintenance statistics of the last partial collection */
+
+	MM_HeapRegionDescriptorBalanced **_survivorRegions; /**< survivor region being filled by each GC thread, indexed by slave ID */
+	uintptr_t _survivorRegionsCount; /**< number of entries in _survivorRegions */
+	MM_HeapRegionDescriptorBalanced **_candidateRegions; /**< scratch array used to rank old regions for the collection set */
+	uintptr_t _candidateRegionsCount; /**< number of entries in _candidateRegions */
+	MM_HeapRegionDescriptorBalanced *_collectionSet; /**< regions evacuated by the current partial collection, linked through _nextInList */
+	uintptr_t _collectionSetSourceCount; /**< remembered set sources of the regions in _collectionSet */
+	volatile bool _survivorRegionsExhausted; /**< true once a GC thread of the current partial collection found no free region to copy into */
+	volatile bool _copyForwardInProgress; /**< true while the copy-forward task runs, selects the work packet overflow handling */
+	double _copyForwardMicrosPerByte; /**< moving average of the copy-forward time per byte of work, in microseconds */
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE MM_HeapRegionDescriptorBalanced *
+	getRegion(void *address)
+	{
+		return (MM_HeapRegionDescriptorBalanced *)_extensions->heapRegionManager->tableDescriptorForAddress(address);
+	}
+
+	/**
+	 * Copy an object of the collection set into the survivor region of the calling thread, unless another
+	 * thread copied it first, and push the copy to the work stack.
+	 * @return the forwarded location of the object
+	 */
+	omrobjectptr_t copyObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Leave an object of the collection set in place, because no survivor region is left to copy it into:
+	 * forward it to itself, so no other thread copies it, and push it to the work stack to be scanned as a copy.
+	 * Its region is flagged so it is kept rather than released at the end of the collection.
+	 * @return the forwarded location of the object (itself, unless another thread copied it first)
+	 */
+	omrobjectptr_t selfForwardObject(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader);
+
+	/**
+	 * @return the size of an object or hole of a collection set region, whether or not the object was forwarded
+	 */
+	uintptr_t getCollectionSetEntrySize(omrobjectptr_t objectPtr);
+
+	/**
+	 * Make a collection set region whose evacuation failed an old region again, once the copy-forward completed:
+	 * restore the headers of the objects left in place and turn the rest of the region into holes.
+	 */
+	void restoreEvacuationFailedRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region);
+
+	/**
+	 * @return true if the object lies in the collection set and was not left in place by a failed evacuation,
+	 * so it was either copied or is garbage
+	 */
+	MMINLINE bool
+	isObjectEvacuated(omrobjectptr_t objectPtr)
+	{
+		MM_HeapRegionDescriptorBalanced *region = getRegion(objectPtr);
+		return region->_inCollectionSet && !(region->_evacuationFailed && MM_ForwardedHeader(objectPtr).isSelfForwardedPointer());
+	}
+
+	/**
+	 * Fill the unused tail of a survivor region with holes, so the region can be walked.
+	 */
+	void retireSurvivorRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region);
+
+	/**
+	 * Visit the remembered sets of the collection set regions, split into root scanning units shared by
+	 * the GC threads, and scan every source object which is not itself in the collection set.
+	 * @param rootScanner The root scanner of the calling thread, which hands out and times the units
+	 */
+	void scanRememberedSets(MM_EnvironmentBase *env, MM_ParallelRootScanner *rootScanner);
+
+	/**
+	 * Record every reference of an object into another region in the remembered set of that region.
+	 */
+	void rememberObjectReferences(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Decide if the current collection must be global. Explicit and aggressive collections are global,
+	 * as are collections where an eden region could not record all references into it.
+	 */
+	bool shouldCollectGlobal(MM_EnvironmentBase *env);
+
+	/**
+	 * Estimate the copy-forward time of a collection set, in microseconds.
+	 * @param liveBytes[in] upper bound of the live bytes of the collection set
+	 * @param sourceCount[in] remembered set sources of the collection set
+	 */
+	MMINLINE double
+	estimateCopyForwardMicros(uintptr_t liveBytes, uintptr_t sourceCount)
+	{
+		return _copyForwardMicrosPerByte * (double)(liveBytes + (sourceCount * REMEMBERED_SET_SOURCE_COST_BYTES));
+	}
+
+	bool isEvacuationCandidate(MM_HeapRegionDescriptorBalanced *region);
+	void addToCollectionSet(MM_HeapRegionDescriptorBalanced *region);
+	void selectCollectionSet(MM_EnvironmentBase *env);
+	void purgeRememberedSets(MM_EnvironmentBase *env);
+	void releaseCollectionSet(MM_EnvironmentBase *env);
+	void updateCopyForwardRate(MM_EnvironmentBase *env);
+
+	void partialGarbageCollect(MM_EnvironmentBase *env);
+	void globalGarbageCollect(MM_EnvironmentBase *env);
+
+	/**
+	 * Release the regions without marked objects after a global mark, measure the live bytes of the others
+	 * and rebuild all remembered sets from the marked objects, in a task shared by the GC threads.
+	 * Every surviving region becomes old.
+	 */
+	void sweepRegions(MM_EnvironmentBase *env);
+
+protected:
+	void reportGCIncrementStart(MM_EnvironmentBase *env);
+	void reportGCIncrementEnd(MM_EnvironmentBase *env);
+	void reportGCCycleStart(MM_EnvironmentBase *env);
+	void reportGCCycleEnd(MM_EnvironmentBase *env);
+	void reportGCCycleFinalIncrementEnding(MM_EnvironmentBase *env);
+
+	void reportGCStart(MM_EnvironmentBase *env);
+	void reportGCEnd(MM_EnvironmentBase *env);
+
+	void reportMarkStart(MM_EnvironmentBase *env);
+	void reportMarkEnd(MM_EnvironmentBase *env);
+	void reportSweepStart(MM_EnvironmentBase *env);
+	void reportSweepEnd(MM_EnvironmentBase *env);
+	void reportCopyForwardStart(MM_EnvironmentBase *env);
+	void reportCopyForwardEnd(MM_EnvironmentBase *env);
+
+public:
+	static MM_BalancedGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase* extensions);
+
+	virtual void setupForGC(MM_EnvironmentBase*);
+
+	virtual void* createSweepPoolState(MM_EnvironmentBase* env, MM_MemoryPool* memoryPool);
+	virtual void deleteSweepPoolState(MM_EnvironmentBase* env, void* sweepPoolState);
+
+	virtual bool internalGarbageCollect(MM_EnvironmentBase*, MM_MemorySubSpace*, MM_AllocateDescription*);
+	virtual void internalPreCollect(MM_EnvironmentBase*, MM_MemorySubSpace*, MM_AllocateDescription*, uint32_t);
+	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_COLLECTOR_GLOBALGC; }
+
+	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
+	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+	virtual void heapReconfigured(MM_EnvironmentBase* env);
+
+	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
+
+	/**
+	 * Balanced write barrier, called by the out-of-line write barrier. A reference stored into an object of
+	 * an old region is recorded in the remembered set of the region of the referenced object, unless both
+	 * objects share a region. Eden parents are not recorded: eden is part of every collection set, so its
+	 * live objects are traced (and their references recorded) when they are copied.
+	 *
+	 * @param env[in] the mutator thread
+	 * @param parentObject[in] the object the reference was stored into
+	 * @param childObject[in] the stored reference (may be NULL)
+	 */
+	MMINLINE void
+	balancedWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if (NULL != childObject) {
+			MM_HeapRegionDescriptorBalanced *parentRegion = getRegion(parentObject);
+			MM_HeapRegionDescriptorBalanced *childRegion = getRegion(childObject);
+			if ((parentRegion != childRegion) && !parentRegion->_isEden) {
+				childRegion->_rememberedSet.add(env, parentObject);
+			}
+		}
+	}
+
+	/**
+	 * @return true if the object lies in a region evacuated by the current partial collection
+	 */
+	MMINLINE bool isObjectInCollectionSet(omrobjectptr_t objectPtr) { return getRegion(objectPtr)->_inCollectionSet; }
+
+	/**
+	 * @return true while a partial collection is copying objects (as opposed to a global collection marking them)
+	 */
+	MMINLINE bool isCopyForwardInProgress() { return _copyForwardInProgress; }
+
+	/**
+	 * Copy-forward the object referenced by a root slot, if it is in the collection set, and update the slot.
+	 */
+	void copyForwardObjectSlot(MM_EnvironmentBase *env, volatile omrobjectptr_t *slotPtr);
+
+	/**
+	 * Copy-forward the collection set objects referenced by an object, update its slots and record its
+	 * references into other regions in their remembered sets.
+	 * @param env[in] the calling GC thread
+	 * @param objectPtr[in] the object to scan
+	 * @param isCopy[in] true if the object was copied by this collection, so none of its references are recorded
+	 * yet; false for remembered set sources, whose references to regions outside the collection set already are
+	 */
+	void copyForwardScanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool isCopy);
+
+	/**
+	 * Scan the objects a failed evacuation left in a collection set region, after work packets overflowed
+	 * some of them. Copied objects can not be walked as usual, their headers hold forwarding pointers.
+	 */
+	void scanSelfForwardedObjects(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region);
+
+	/**
+	 * The work of each GC thread of a partial collection: copy-forward the objects referenced by the roots
+	 * and the remembered sets of the collection set, then their transitive closure.
+	 */
+	void workerCopyForward(MM_EnvironmentBase *env);
+
+	/**
+	 * The work of each GC thread of the region sweep: clear the remembered sets of the regions it claims and,
+	 * once all are clear, sweep the regions it claims (see sweepRegions()).
+	 */
+	void workerSweepRegions(MM_EnvironmentBase *env);
+
+	/**
+	 * Fold the copy-forward statistics of a GC thread into the collection statistics.
+	 */
+	void mergeCopyForwardStats(MM_EnvironmentBase *env);
+
+	/**
+	 * Return reference to Marking Scheme
+	 */
+	MM_MarkingScheme *getMarkingScheme()
+	{
+		return _markingScheme;
+	}
+
+	MM_BalancedGC(MM_EnvironmentBase *env)
+		: MM_GlobalCollector()
+		, _extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
+		, _portLibrary(env->getPortLibrary())
+		, _markingScheme(NULL)
+		, _dispatcher(_extensions->dispatcher)
+		, _memoryPool(NULL)
+		, _survivorRegions(NULL)
+		, _survivorRegionsCount(0)
+		, _candidateRegions(NULL)
+		, _candidateRegionsCount(0)
+		, _collectionSet(NULL)
+		, _collectionSetSourceCount(0)
+		, _survivorRegionsExhausted(false)
+		, _copyForwardInProgress(false)
+		, _copyForwardMicrosPerByte(0.001)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* BALANCEDGC_HPP_ */
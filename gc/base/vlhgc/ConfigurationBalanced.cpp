@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#include "omrcfg.h"
+#include "MemorySpacesAPI.h"
+
+#include "BalancedGC.hpp"
+#include "ConfigurationBalanced.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorBalanced.hpp"
+#include "HeapRegionManagerTarok.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryPoolBalanced.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpaceBalanced.hpp"
+#include "ParallelDispatcher.hpp"
+#include "PhysicalArenaRegionBased.hpp"
+#include "PhysicalSubArenaRegionBased.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+MM_Configuration *
+MM_ConfigurationBalanced::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConfigurationBalanced *configuration;
+
+	configuration = (MM_ConfigurationBalanced *) env->getForge()->allocate(sizeof(MM_ConfigurationBalanced), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if(NULL != configuration) {
+		new(configuration) MM_ConfigurationBalanced(env);
+		if(!configuration->initialize(env)) {
+			configuration->kill(env);
+			configuration = NULL;
+		}
+	}
+	return configuration;
+}
+
+bool
+MM_ConfigurationBalanced::initialize(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	if (MM_Configuration::initialize(env)) {
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		extensions->setVLHGC(true);
+		extensions->setStandardGC(true);
+		success = true;
+	}
+	return success;
+}
+
+MM_Heap *
+MM_ConfigurationBalanced::createHeapWithManager(MM_EnvironmentBase *env, uintptr_t heapBytesRequested, MM_HeapRegionManager *regionManager)
+{
+	return MM_HeapVirtualMemory::newInstance(env, env->getExtensions()->heapAlignment, heapBytesRequested, regionManager);
+}
+
+MM_MemorySpace *
+MM_ConfigurationBalanced::createDefaultMemorySpace(MM_EnvironmentBase *env, MM_Heap *heap, MM_InitializationParameters *parameters)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryPoolBalanced *memoryPool = NULL;
+	MM_MemorySubSpaceBalanced *memorySubSpaceBalanced = NULL;
+	MM_PhysicalSubArenaRegionBased *physicalSubArena = NULL;
+	MM_PhysicalArenaRegionBased *physicalArena = NULL;
+
+	if(NULL == (memoryPool = MM_MemoryPoolBalanced::newInstance(env, extensions->heapRegionManager))) {
+		return NULL;
+	}
+
+	if(NULL == (physicalSubArena = MM_PhysicalSubArenaRegionBased::newInstance(env, heap))) {
+		memoryPool->kill(env);
+		return NULL;
+	}
+
+	memorySubSpaceBalanced = MM_MemorySubSpaceBalanced::newInstance(env, physicalSubArena, memoryPool, true, parameters->_minimumSpaceSize, parameters->_initialOldSpaceSize, parameters->_maximumSpaceSize);
+	if(NULL == memorySubSpaceBalanced) {
+		return NULL;
+	}
+
+	if(NULL == (physicalArena = MM_PhysicalArenaRegionBased::newInstance(env, heap))) {
+		memorySubSpaceBalanced->kill(env);
+		return NULL;
+	}
+
+	return MM_MemorySpace::newInstance(env, heap, physicalArena, memorySubSpaceBalanced, parameters, MEMORY_SPACE_NAME_BALANCED, MEMORY_SPACE_DESCRIPTION_BALANCED);
+}
+
+MM_EnvironmentBase *
+MM_ConfigurationBalanced::allocateNewEnvironment(MM_GCExtensionsBase *extensions, OMR_VMThread *omrVMThread)
+{
+	return MM_EnvironmentBase::newInstance(extensions, omrVMThread);
+}
+
+J9Pool *
+MM_ConfigurationBalanced::createEnvironmentPool(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uintptr_t numberOfElements = getConfigurationDelegate()->getInitialNumberOfPooledEnvironments(env);
+	/* number of elements, pool flags = 0, 0 selects default pool configuration (at least 1 element, puddle size rounded to OS page size) */
+	return pool_new(sizeof(MM_EnvironmentBase), numberOfElements, sizeof(uint64_t), 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(OMRPORTLIB));
+}
+
+MM_HeapRegionManager *
+MM_ConfigurationBalanced::createHeapRegionManager(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t descriptorSize = sizeof(MM_HeapRegionDescriptorBalanced);
+
+	MM_HeapRegionManagerTarok *heapRegionManager = MM_HeapRegionManagerTarok::newInstance(env, extensions->regionSize, descriptorSize, MM_HeapRegionDescriptorBalanced::initializer, MM_HeapRegionDescriptorBalanced::destructor);
+	return heapRegionManager;
+}
+
+/**
+ * Create the global collector for a Balanced configuration
+ */
+MM_GlobalCollector*
+MM_ConfigurationBalanced::createGlobalCollector(MM_EnvironmentBase* env)
+{
+	return MM_BalancedGC::newInstance(env);
+}
+
+MM_Dispatcher *
+MM_ConfigurationBalanced::createDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize)
+{
+	return MM_ParallelDispatcher::newInstance(env, handler, handler_arg, defaultOSStackSize);
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
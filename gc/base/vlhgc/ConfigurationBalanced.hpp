@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(CONFIGURATIONBALANCED_HPP_)
+#define CONFIGURATIONBALANCED_HPP_
+
+#include "omrcfg.h"
+
+#include "Configuration.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_EnvironmentBase;
+class MM_GlobalCollector;
+class MM_Heap;
+
+/**
+ * Configuration of the balanced (region-based) collector: the heap is split into fixed-size regions
+ * which are evacuated incrementally by partial collections.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_ConfigurationBalanced : public MM_Configuration
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	static const uintptr_t BALANCED_REGION_SIZE_BYTES = (64 * 1024);
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_Configuration *newInstance(MM_EnvironmentBase *env);
+
+	virtual MM_GlobalCollector *createGlobalCollector(MM_EnvironmentBase *env);
+	virtual MM_Heap *createHeapWithManager(MM_EnvironmentBase *env, uintptr_t heapBytesRequested, MM_HeapRegionManager *regionManager);
+	virtual MM_HeapRegionManager *createHeapRegionManager(MM_EnvironmentBase *env);
+	virtual MM_MemorySpace *createDefaultMemorySpace(MM_EnvironmentBase *env, MM_Heap *heap, MM_InitializationParameters *parameters);
+	virtual J9Pool *createEnvironmentPool(MM_EnvironmentBase *env);
+	virtual MM_Dispatcher *createDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize);
+
+	MM_ConfigurationBalanced(MM_EnvironmentBase *env)
+		: MM_Configuration(env, gc_policy_balanced, mm_regionAlignment, BALANCED_REGION_SIZE_BYTES, 0, gc_modron_wrtbar_none, gc_modron_allocation_type_tlh)
+	{
+		_typeId = __FUNCTION__;
+	};
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual MM_EnvironmentBase *allocateNewEnvironment(MM_GCExtensionsBase *extensions, OMR_VMThread *omrVMThread);
+
+private:
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* CONFIGURATIONBALANCED_HPP_ */
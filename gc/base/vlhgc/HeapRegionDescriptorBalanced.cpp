@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "HeapRegionDescriptorBalanced.hpp"
+
+#include "Bits.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+MM_HeapRegionDescriptorBalanced::MM_HeapRegionDescriptorBalanced(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+	: MM_HeapRegionDescriptor(env, lowAddress, highAddress)
+	, _allocatePointer(lowAddress)
+	, _liveBytes(0)
+	, _isEden(false)
+	, _isLargeObject(false)
+	, _inCollectionSet(false)
+	, _evacuationFailed(false)
+	, _overflowed(false)
+	, _nextInList(NULL)
+	, _rememberedSet()
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_HeapRegionDescriptorBalanced::initialize(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager)
+{
+	if (!MM_HeapRegionDescriptor::initialize(env, regionManager)) {
+		return false;
+	}
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	/* by default a remembered set may track up to one source for every other slot of its region */
+	uintptr_t maximumTableSize = extensions->regionSize / (2 * sizeof(uintptr_t));
+	if (0 != extensions->tarokRememberedSetCardListMaxSize) {
+		maximumTableSize = MM_Bits::highestSetBit(extensions->tarokRememberedSetCardListMaxSize);
+	}
+	return _rememberedSet.initialize(env, maximumTableSize);
+}
+
+void
+MM_HeapRegionDescriptorBalanced::tearDown(MM_EnvironmentBase *env)
+{
+	_rememberedSet.tearDown(env);
+
+	MM_HeapRegionDescriptor::tearDown(env);
+}
+
+void
+MM_HeapRegionDescriptorBalanced::resetToFree(MM_EnvironmentBase *env)
+{
+	setRegionType(MM_HeapRegionDescriptor::FREE);
+	_allocatePointer = getLowAddress();
+	_liveBytes = 0;
+	_isEden = false;
+	_isLargeObject = false;
+	_inCollectionSet = false;
+	_evacuationFailed = false;
+	_overflowed = false;
+	_nextInList = NULL;
+	_rememberedSet.clear(env);
+}
+
+bool
+MM_HeapRegionDescriptorBalanced::initializer(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionDescriptor *descriptor, void *lowAddress, void *highAddress)
+{
+	new((MM_HeapRegionDescriptorBalanced *)descriptor) MM_HeapRegionDescriptorBalanced(env, lowAddress, highAddress);
+	return ((MM_HeapRegionDescriptorBalanced *)descriptor)->initialize(env, regionManager);
+}
+
+void
+MM_HeapRegionDescriptorBalanced::destructor(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionDescriptor *descriptor)
+{
+	((MM_HeapRegionDescriptorBalanced *)descriptor)->tearDown(env);
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(HEAPREGIONDESCRIPTORBALANCED_HPP_)
+#define HEAPREGIONDESCRIPTORBALANCED_HPP_
+
+#include "omrcfg.h"
+
+#include "HeapRegionDescriptor.hpp"
+#include "ObjectRememberedSet.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_EnvironmentBase;
+class MM_HeapRegionManager;
+
+/**
+ * Region descriptor of the balanced collector.
+ *
+ * A region is either FREE or ADDRESS_ORDERED (holding objects). Regions holding objects are kept walkable
+ * from their low to their high address: the unused tail above the allocation pointer is always covered
+ * by a hole, except for survivor regions while a copy-forward is filling them, and for collection set regions
+ * (whose copied objects hold forwarding pointers) until the copy-forward completes.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_HeapRegionDescriptorBalanced : public MM_HeapRegionDescriptor
+{
+	/*
+	 * Data members
+	 */
+public:
+	void *_allocatePointer; /**< top of the allocated part of the region: objects lie in [low, _allocatePointer) */
+	uintptr_t _liveBytes; /**< upper bound of the live bytes in the region, as of the last collection that measured or filled it */
+	bool _isEden; /**< true if mutators allocated in the region since the last collection */
+	bool _isLargeObject; /**< true if the region holds a single object too large for eden allocation */
+	bool _inCollectionSet; /**< true while a partial collection evacuates the region */
+	volatile bool _evacuationFailed; /**< true if the survivor regions ran out while evacuating the region, so some of its objects were left in place */
+	volatile bool _overflowed; /**< true if copy-forward work packets overflowed objects of this region */
+	MM_HeapRegionDescriptorBalanced *_nextInList; /**< link used by the free region list and collection set */
+	MM_ObjectRememberedSet _rememberedSet; /**< objects in other regions which reference objects in this region */
+protected:
+private:
+
+	/*
+	 * Function members
+	 */
+public:
+	MM_HeapRegionDescriptorBalanced(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	bool initialize(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the region to the FREE state, dropping its remembered set and per-region data.
+	 * @param env[in] The calling thread
+	 */
+	void resetToFree(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of bytes between the low address and the allocation pointer
+	 */
+	MMINLINE uintptr_t getAllocatedBytes() { return (uintptr_t)_allocatePointer - (uintptr_t)getLowAddress(); }
+
+	static bool initializer(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionDescriptor *descriptor, void *lowAddress, void *highAddress);
+	static void destructor(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionDescriptor *descriptor);
+
+protected:
+private:
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* HEAPREGIONDESCRIPTORBALANCED_HPP_ */
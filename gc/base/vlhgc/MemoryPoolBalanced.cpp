@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "MemoryPoolBalanced.hpp"
+
+#include "AllocateDescription.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapRegionManager.hpp"
+#include "MemorySubSpace.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+MM_MemoryPoolBalanced::MM_MemoryPoolBalanced(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager)
+	: MM_MemoryPool(env, env->getExtensions()->minimumFreeEntrySize, "Balanced")
+	, _regionManager(regionManager)
+	, _regionSize(regionManager->getRegionSize())
+	, _largeObjectThreshold(regionManager->getRegionSize() / 4)
+	, _lock()
+	, _freeRegionList(NULL)
+	, _freeRegionCount(0)
+	, _allocationRegion(NULL)
+	, _edenRegionCount(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_MemoryPoolBalanced *
+MM_MemoryPoolBalanced::newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager)
+{
+	MM_MemoryPoolBalanced *memoryPool = (MM_MemoryPoolBalanced *)env->getForge()->allocate(sizeof(MM_MemoryPoolBalanced), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != memoryPool) {
+		memoryPool = new(memoryPool) MM_MemoryPoolBalanced(env, regionManager);
+		if (!memoryPool->initialize(env)) {
+			memoryPool->kill(env);
+			memoryPool = NULL;
+		}
+	}
+	return memoryPool;
+}
+
+bool
+MM_MemoryPoolBalanced::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_MemoryPool::initialize(env)) {
+		return false;
+	}
+	return _lock.initialize(env, &_extensions->lnrlOptions, "MM_MemoryPoolBalanced:_lock");
+}
+
+void
+MM_MemoryPoolBalanced::tearDown(MM_EnvironmentBase *env)
+{
+	_lock.tearDown();
+	MM_MemoryPool::tearDown(env);
+}
+
+MM_HeapRegionDescriptorBalanced *
+MM_MemoryPoolBalanced::popFreeRegion()
+{
+	MM_HeapRegionDescriptorBalanced *region = _freeRegionList;
+	if (NULL != region) {
+		_freeRegionList = region->_nextInList;
+		region->_nextInList = NULL;
+		_freeRegionCount -= 1;
+		Assert_MM_true(MM_HeapRegionDescriptor::FREE == region->getRegionType());
+		region->setRegionType(MM_HeapRegionDescriptor::ADDRESS_ORDERED);
+	}
+	return region;
+}
+
+bool
+MM_MemoryPoolBalanced::canAcquireRegion(uintptr_t edenRegionCount)
+{
+	/* the region handed out must leave enough free regions behind to evacuate all of eden */
+	return (0 < _freeRegionCount) && ((_freeRegionCount - 1) >= getSurvivorRegionsRequired(edenRegionCount * _regionSize));
+}
+
+void *
+MM_MemoryPoolBalanced::allocateFromEden(MM_EnvironmentBase *env, uintptr_t minimumSize, uintptr_t maximumSize, void **top)
+{
+	void *result = NULL;
+
+	_lock.acquire();
+	MM_HeapRegionDescriptorBalanced *region = _allocationRegion;
+	if ((NULL == region) || (minimumSize > ((uintptr_t)region->getHighAddress() - (uintptr_t)region->_allocatePointer))) {
+		/* the tail of the current eden region (if any) is already a hole; move on to a new region */
+		region = NULL;
+		uintptr_t idealEdenRegions = _extensions->tarokIdealEdenMaximumBytes / _regionSize;
+		bool edenAtIdealSize = (0 != idealEdenRegions) && (_edenRegionCount >= idealEdenRegions);
+		if (!edenAtIdealSize && canAcquireRegion(_edenRegionCount + 1)) {
+			region = popFreeRegion();
+			region->_isEden = true;
+			region->_allocatePointer = region->getLowAddress();
+			_edenRegionCount += 1;
+		}
+		_allocationRegion = region;
+	}
+
+	if (NULL != region) {
+		uintptr_t tailSize = (uintptr_t)region->getHighAddress() - (uintptr_t)region->_allocatePointer;
+		uintptr_t size = OMR_MIN(maximumSize, tailSize);
+		result = region->_allocatePointer;
+		region->_allocatePointer = (void *)((uintptr_t)result + size);
+		if (tailSize > size) {
+			/* keep the region walkable above the allocation pointer */
+			MM_HeapLinkedFreeHeader::fillWithHoles(region->_allocatePointer, tailSize - size);
+		}
+		*top = region->_allocatePointer;
+		_allocCount += 1;
+		_allocBytes += size;
+	}
+	_lock.release();
+
+	return result;
+}
+
+void *
+MM_MemoryPoolBalanced::allocateLargeObject(MM_EnvironmentBase *env, uintptr_t size)
+{
+	void *result = NULL;
+
+	_lock.acquire();
+	if (canAcquireRegion(_edenRegionCount)) {
+		MM_HeapRegionDescriptorBalanced *region = popFreeRegion();
+		region->_isLargeObject = true;
+		result = region->getLowAddress();
+		region->_allocatePointer = (void *)((uintptr_t)result + size);
+		region->_liveBytes = size;
+		if (region->_allocatePointer < region->getHighAddress()) {
+			MM_HeapLinkedFreeHeader::fillWithHoles(region->_allocatePointer, (uintptr_t)region->getHighAddress() - (uintptr_t)region->_allocatePointer);
+		}
+		_allocCount += 1;
+		_allocBytes += size;
+	}
+	_lock.release();
+
+	return result;
+}
+
+void *
+MM_MemoryPoolBalanced::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t size = allocDescription->getContiguousBytes();
+	void *addr = NULL;
+
+	if (size <= _largeObjectThreshold) {
+		void *top = NULL;
+		addr = allocateFromEden(env, size, size, &top);
+	} else {
+		/* MM_MemorySubSpaceBalanced refuses objects larger than a region */
+		Assert_MM_true(size <= _regionSize);
+		addr = allocateLargeObject(env, size);
+	}
+
+	if (NULL != addr) {
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if (env->getExtensions()->payAllocationTax) {
+			allocDescription->setAllocationTaxSize(allocDescription->getBytesRequested());
+		}
+#endif /* OMR_GC_ALLOCATION_TAX */
+		allocDescription->setTLHAllocation(false);
+		allocDescription->setNurseryAllocation(false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return addr;
+}
+
+void *
+MM_MemoryPoolBalanced::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	uintptr_t minimumSize = OMR_MAX(_minimumFreeEntrySize, _extensions->tlhMinimumSize);
+	uintptr_t maximumSize = OMR_MAX(maximumSizeInBytesRequired, minimumSize);
+	void *top = NULL;
+	void *tlhBase = allocateFromEden(env, minimumSize, maximumSize, &top);
+
+	if (NULL != tlhBase) {
+		addrBase = tlhBase;
+		addrTop = top;
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if (env->getExtensions()->payAllocationTax) {
+			allocDescription->setAllocationTaxSize((uint8_t *)addrTop - (uint8_t *)addrBase);
+		}
+#endif /* OMR_GC_ALLOCATION_TAX */
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation(false);
+		allocDescription->setMemoryPool(this);
+	}
+
+	return tlhBase;
+}
+
+void
+MM_MemoryPoolBalanced::expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce)
+{
+	/* committed regions are handed to the pool whole through addFreeRegion() */
+	Assert_MM_unreachable();
+}
+
+void *
+MM_MemoryPoolBalanced::contractWithRange(MM_EnvironmentBase *env, uintptr_t contractSize, void *lowAddress, void *highAddress)
+{
+	Assert_MM_unreachable();
+	return NULL;
+}
+
+bool
+MM_MemoryPoolBalanced::abandonHeapChunk(void *addrBase, void *addrTop)
+{
+	Assert_MM_true(addrTop >= addrBase);
+	if (addrTop > addrBase) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, (uintptr_t)addrTop - (uintptr_t)addrBase);
+	}
+	/* this memory pool doesn't maintain a free list, so always return false */
+	return false;
+}
+
+uintptr_t
+MM_MemoryPoolBalanced::getActualFreeMemorySize()
+{
+	uintptr_t freeBytes = _freeRegionCount * _regionSize;
+	MM_HeapRegionDescriptorBalanced *region = _allocationRegion;
+	if (NULL != region) {
+		freeBytes += (uintptr_t)region->getHighAddress() - (uintptr_t)region->_allocatePointer;
+	}
+	return freeBytes;
+}
+
+uintptr_t
+MM_MemoryPoolBalanced::getApproximateFreeMemorySize()
+{
+	return getActualFreeMemorySize();
+}
+
+void
+MM_MemoryPoolBalanced::addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region)
+{
+	region->resetToFree(env);
+	_lock.acquire();
+	region->_nextInList = _freeRegionList;
+	_freeRegionList = region;
+	_freeRegionCount += 1;
+	_lock.release();
+}
+
+MM_HeapRegionDescriptorBalanced *
+MM_MemoryPoolBalanced::acquireSurvivorRegion(MM_EnvironmentBase *env)
+{
+	_lock.acquire();
+	MM_HeapRegionDescriptorBalanced *region = popFreeRegion();
+	_lock.release();
+
+	if (NULL != region) {
+		region->_allocatePointer = region->getLowAddress();
+	}
+	return region;
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
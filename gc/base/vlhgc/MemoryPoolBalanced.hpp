@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(MEMORYPOOLBALANCED_HPP_)
+#define MEMORYPOOLBALANCED_HPP_
+
+#include "omrcfg.h"
+
+#include "HeapRegionDescriptorBalanced.hpp"
+#include "LightweightNonReentrantLock.hpp"
+#include "MemoryPool.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_AllocateDescription;
+class MM_EnvironmentBase;
+class MM_HeapRegionManager;
+
+/**
+ * Memory pool of the balanced collector. The pool owns the list of free regions of the heap.
+ *
+ * Mutators bump allocate TLHs and small objects from the current eden region, taking a new free region
+ * as eden when it is exhausted. Objects larger than a quarter of a region are given a region of their
+ * own, which is never evacuated. The pool refuses to grow eden (or to hand out a large object region)
+ * when that would leave too few free regions to evacuate all of eden, so that a partial collection rarely
+ * has to leave objects in place. Objects larger than a region are not supported.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_MemoryPoolBalanced : public MM_MemoryPool
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapRegionManager *_regionManager; /**< the region manager of the heap */
+	uintptr_t _regionSize; /**< the size of a region, in bytes */
+	uintptr_t _largeObjectThreshold; /**< objects larger than this are allocated in a region of their own */
+	MM_LightweightNonReentrantLock _lock; /**< serializes eden allocation and free list updates */
+	MM_HeapRegionDescriptorBalanced *_freeRegionList; /**< head of the list of FREE regions */
+	volatile uintptr_t _freeRegionCount; /**< number of regions on _freeRegionList */
+	MM_HeapRegionDescriptorBalanced *_allocationRegion; /**< the eden region mutators currently allocate from */
+	uintptr_t _edenRegionCount; /**< number of regions taken as eden since the last collection */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MM_HeapRegionDescriptorBalanced *popFreeRegion();
+	bool canAcquireRegion(uintptr_t edenRegionCount);
+	void *allocateFromEden(MM_EnvironmentBase *env, uintptr_t minimumSize, uintptr_t maximumSize, void **top);
+	void *allocateLargeObject(MM_EnvironmentBase *env, uintptr_t size);
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+public:
+	static MM_MemoryPoolBalanced *newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager);
+
+	virtual void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+
+	virtual void expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce);
+	virtual void *contractWithRange(MM_EnvironmentBase *env, uintptr_t contractSize, void *lowAddress, void *highAddress);
+	virtual bool abandonHeapChunk(void *addrBase, void *addrTop);
+
+	virtual uintptr_t getActualFreeMemorySize();
+	virtual uintptr_t getApproximateFreeMemorySize();
+
+	/**
+	 * Return a region to the free list, dropping its contents. Used for newly committed regions and by the
+	 * collector for regions it reclaimed.
+	 * @param env[in] The calling thread
+	 * @param region[in] The region to free
+	 */
+	void addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorBalanced *region);
+
+	/**
+	 * Take a free region for the collector to copy survivors into. Thread safe.
+	 * @param env[in] A GC thread
+	 * @return the region, or NULL if no region is free
+	 */
+	MM_HeapRegionDescriptorBalanced *acquireSurvivorRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by the collector when a collection starts: mutators will take a new eden region once it ends.
+	 * The caller must ensure that all TLHs were flushed.
+	 */
+	void retireAllocationRegion() { _allocationRegion = NULL; }
+
+	/**
+	 * Called by the collector once the eden regions were either evacuated or turned into old regions.
+	 */
+	void resetEdenRegionCount() { _edenRegionCount = 0; }
+
+	/**
+	 * @return an upper bound of the number of free regions a copy-forward needs to evacuate the given live bytes
+	 */
+	MMINLINE uintptr_t
+	getSurvivorRegionsRequired(uintptr_t liveBytes)
+	{
+		/* a survivor region is retired when an object does not fit in its tail, so at least three quarters of it
+		 * are used; each GC thread may also leave one partially filled region behind
+		 */
+		uintptr_t usableRegionBytes = _regionSize - _largeObjectThreshold;
+		return ((liveBytes + usableRegionBytes - 1) / usableRegionBytes) + _extensions->gcThreadCount;
+	}
+
+	MMINLINE uintptr_t getFreeRegionCount() { return _freeRegionCount; }
+	MMINLINE uintptr_t getEdenRegionCount() { return _edenRegionCount; }
+	MMINLINE uintptr_t getRegionSize() { return _regionSize; }
+	MMINLINE uintptr_t getLargeObjectThreshold() { return _largeObjectThreshold; }
+
+	MM_MemoryPoolBalanced(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager);
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* MEMORYPOOLBALANCED_HPP_ */
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "MemorySubSpaceBalanced.hpp"
+
+#include "AllocateDescription.hpp"
+#include "Collector.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorBalanced.hpp"
+#include "MemoryPoolBalanced.hpp"
+#include "ObjectAllocationInterface.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+/*
+ * Allocation
+ */
+
+void *
+MM_MemorySubSpaceBalanced::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace, bool shouldCollectOnFailure)
+{
+	void *result = NULL;
+
+	/* an object can not span regions, so no collection would satisfy a larger request */
+	if (allocDescription->getContiguousBytes() <= _memoryPoolBalanced->getRegionSize()) {
+		result = _memoryPoolBalanced->allocateObject(env, allocDescription);
+		if (NULL != result) {
+			allocDescription->setMemorySubSpace(this);
+			allocDescription->setObjectFlags(getObjectFlags());
+		} else if (shouldCollectOnFailure) {
+			result = allocationRequestFailed(env, allocDescription, ALLOCATION_TYPE_OBJECT, NULL, this, this);
+		}
+	}
+
+	return result;
+}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+void *
+MM_MemorySubSpaceBalanced::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace, bool shouldCollectOnFailure)
+{
+	void *result = NULL;
+
+	/* large objects fail the TLH refresh, falling back to allocateObject() which gives them a region of their own */
+	if (allocDescription->getContiguousBytes() <= _memoryPoolBalanced->getLargeObjectThreshold()) {
+		result = objectAllocationInterface->allocateTLH(env, allocDescription, this, _memoryPoolBalanced);
+
+		if ((NULL == result) && shouldCollectOnFailure && allocDescription->shouldCollectAndClimb()) {
+			result = allocationRequestFailed(env, allocDescription, ALLOCATION_TYPE_TLH, objectAllocationInterface, this, this);
+		}
+	}
+
+	return result;
+}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+void *
+MM_MemorySubSpaceBalanced::allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace)
+{
+	void *addr = NULL;
+
+	if (NULL != _collector) {
+		allocateDescription->saveObjects(env);
+		/* acquire exclusive access and, after we get it, see if we need to perform a collect or if someone else beat us to it */
+		if (!env->acquireExclusiveVMAccessForGC(_collector, true, true)) {
+			allocateDescription->restoreObjects(env);
+			/* Beaten to exclusive access for our collector by another thread - a GC must have occurred.  This thread
+			 * does NOT have exclusive access at this point.  Try and satisfy the allocate based on a GC having occurred.
+			 */
+			addr = allocateGeneric(env, allocateDescription, allocationType, objectAllocationInterface, this);
+			if (NULL != addr) {
+				return addr;
+			}
+
+			/* Failed to satisfy allocate - now really go for a GC */
+			allocateDescription->saveObjects(env);
+			/* acquire exclusive access and, after we get it, see if we need to perform a collect or if someone else beat us to it */
+			if (!env->acquireExclusiveVMAccessForGC(_collector)) {
+				/* we have exclusive access but another thread beat us to the GC so see if they collected enough to satisfy our request */
+				allocateDescription->restoreObjects(env);
+				addr = allocateGeneric(env, allocateDescription, allocationType, objectAllocationInterface, this);
+				if (NULL != addr) {
+					/* Satisfied the allocate after having grabbed exclusive access to perform a GC (without actually performing the GC).  Raise
+					 * an event for tracing / verbose to report the occurrence.
+					 */
+					reportAcquiredExclusiveToSatisfyAllocate(env, allocateDescription);
+					return addr;
+				}
+				allocateDescription->saveObjects(env);
+			}
+		}
+
+		/* we have exclusive and no other thread satisfied the allocate so we can now collect */
+		reportAllocationFailureStart(env, allocateDescription);
+
+		Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
+
+		/* run the collector in the default mode (ie:  not explicitly aggressive), which is a partial collection */
+		allocateDescription->setAllocationType(allocationType);
+		addr = _collector->garbageCollect(env, this, allocateDescription, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, objectAllocationInterface, this, NULL);
+		allocateDescription->restoreObjects(env);
+
+		if (NULL == addr) {
+			/* The partial collection wasn't good enough to satisfy the allocate so collect the whole heap */
+			allocateDescription->saveObjects(env);
+			addr = _collector->garbageCollect(env, this, allocateDescription, J9MMCONSTANT_IMPLICIT_GC_AGGRESSIVE, objectAllocationInterface, this, NULL);
+			allocateDescription->restoreObjects(env);
+		}
+
+		reportAllocationFailureEnd(env);
+	}
+
+	return addr;
+}
+
+void
+MM_MemorySubSpaceBalanced::abandonHeapChunk(void *addrBase, void *addrTop)
+{
+	_memoryPoolBalanced->abandonHeapChunk(addrBase, addrTop);
+}
+
+MM_MemorySubSpace *
+MM_MemorySubSpaceBalanced::getDefaultMemorySubSpace()
+{
+	return this;
+}
+
+MM_MemorySubSpace *
+MM_MemorySubSpaceBalanced::getTenureMemorySubSpace()
+{
+	return this;
+}
+
+MM_MemorySubSpaceBalanced *
+MM_MemorySubSpaceBalanced::newInstance(
+	MM_EnvironmentBase *env, MM_PhysicalSubArena *physicalSubArena, MM_MemoryPool *memoryPool,
+	bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize)
+{
+	MM_MemorySubSpaceBalanced *memorySubSpace;
+
+	memorySubSpace = (MM_MemorySubSpaceBalanced *)env->getForge()->allocate(sizeof(MM_MemorySubSpaceBalanced), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != memorySubSpace) {
+		new(memorySubSpace) MM_MemorySubSpaceBalanced(env, physicalSubArena, memoryPool, usesGlobalCollector, minimumSize, initialSize, maximumSize);
+		if (!memorySubSpace->initialize(env)) {
+			memorySubSpace->kill(env);
+			memorySubSpace = NULL;
+		}
+	}
+	return memorySubSpace;
+}
+
+bool
+MM_MemorySubSpaceBalanced::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_MemorySubSpaceUniSpace::initialize(env)) {
+		return false;
+	}
+	_memoryPoolBalanced->setSubSpace(this);
+
+	return true;
+}
+
+void
+MM_MemorySubSpaceBalanced::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _memoryPoolBalanced) {
+		_memoryPoolBalanced->kill(env);
+		_memoryPoolBalanced = NULL;
+	}
+
+	MM_MemorySubSpaceUniSpace::tearDown(env);
+}
+
+bool
+MM_MemorySubSpaceBalanced::expanded(
+	MM_EnvironmentBase *env,
+	MM_PhysicalSubArena *subArena,
+	MM_HeapRegionDescriptor *region,
+	bool canCoalesce)
+{
+	/* Inform the sub space hierarchy of the size change */
+	bool result = heapAddRange(env, this, region->getSize(), region->getLowAddress(), region->getHighAddress());
+
+	if (result) {
+		_memoryPoolBalanced->addFreeRegion(env, (MM_HeapRegionDescriptorBalanced *)region);
+	}
+
+	return result;
+}
+
+bool
+MM_MemorySubSpaceBalanced::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	Assert_MM_unreachable();
+	return MM_MemorySubSpaceUniSpace::heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getActualFreeMemorySize()
+{
+	return _memoryPoolBalanced->getActualFreeMemorySize();
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getApproximateFreeMemorySize()
+{
+	return _memoryPoolBalanced->getApproximateFreeMemorySize();
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getActiveMemorySize()
+{
+	return getActiveMemorySize(MEMORY_TYPE_OLD|MEMORY_TYPE_NEW);
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getActiveMemorySize(uintptr_t includeMemoryType)
+{
+	if (includeMemoryType & getTypeFlags()) {
+		return getCurrentSize();
+	}
+	return 0;
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getActualActiveFreeMemorySize()
+{
+	return getActualActiveFreeMemorySize(MEMORY_TYPE_OLD|MEMORY_TYPE_NEW);
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getActualActiveFreeMemorySize(uintptr_t includeMemoryType)
+{
+	if (includeMemoryType & getTypeFlags()) {
+		return _memoryPoolBalanced->getActualFreeMemorySize();
+	}
+	return 0;
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getApproximateActiveFreeMemorySize()
+{
+	return getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD|MEMORY_TYPE_NEW);
+}
+
+uintptr_t
+MM_MemorySubSpaceBalanced::getApproximateActiveFreeMemorySize(uintptr_t includeMemoryType)
+{
+	if (includeMemoryType & getTypeFlags()) {
+		return _memoryPoolBalanced->getApproximateFreeMemorySize();
+	}
+	return 0;
+}
+
+MM_MemoryPool *
+MM_MemorySubSpaceBalanced::getMemoryPool()
+{
+	return _memoryPoolBalanced;
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
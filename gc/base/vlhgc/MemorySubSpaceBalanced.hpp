@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(MEMORYSUBSPACEBALANCED_HPP_)
+#define MEMORYSUBSPACEBALANCED_HPP_
+
+#include "omrcfg.h"
+
+#include "MemorySubSpaceUniSpace.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_AllocateDescription;
+class MM_EnvironmentBase;
+class MM_MemoryPool;
+class MM_MemoryPoolBalanced;
+class MM_ObjectAllocationInterface;
+
+/**
+ * The single memory subspace of the balanced collector. It covers all regions of the heap and allocates
+ * through MM_MemoryPoolBalanced, collecting with the balanced global collector when the pool fails.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_MemorySubSpaceBalanced : public MM_MemorySubSpaceUniSpace
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MemoryPoolBalanced *_memoryPoolBalanced;
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
+
+public:
+	static MM_MemorySubSpaceBalanced *newInstance(
+		MM_EnvironmentBase *env, MM_PhysicalSubArena *physicalSubArena, MM_MemoryPool *memoryPool,
+		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize);
+
+	virtual const char *getName() { return MEMORY_SUBSPACE_NAME_UNDEFINED; }
+	virtual const char *getDescription() { return MEMORY_SUBSPACE_DESCRIPTION_UNDEFINED; }
+
+	virtual void *allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace, bool shouldCollectOnFailure);
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace, bool shouldCollectOnFailure);
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+	/* Calls for internal collection routines */
+	virtual void abandonHeapChunk(void *addrBase, void *addrTop);
+
+	virtual MM_MemorySubSpace *getDefaultMemorySubSpace();
+	virtual MM_MemorySubSpace *getTenureMemorySubSpace();
+
+	virtual uintptr_t getActualFreeMemorySize();
+	virtual uintptr_t getApproximateFreeMemorySize();
+	virtual uintptr_t getActiveMemorySize();
+	virtual uintptr_t getActualActiveFreeMemorySize();
+	virtual uintptr_t getApproximateActiveFreeMemorySize();
+	virtual uintptr_t getActiveMemorySize(uintptr_t includeMemoryType);
+	virtual uintptr_t getActualActiveFreeMemorySize(uintptr_t includeMemoryType);
+	virtual uintptr_t getApproximateActiveFreeMemorySize(uintptr_t includeMemoryType);
+	virtual uintptr_t getAvailableContractionSize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription) { return 0; }
+
+	virtual bool expanded(MM_EnvironmentBase *env, MM_PhysicalSubArena *subArena, MM_HeapRegionDescriptor *region, bool canCoalesce);
+	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	virtual MM_MemoryPool *getMemoryPool();
+
+	MM_MemorySubSpaceBalanced(
+		MM_EnvironmentBase *env, MM_PhysicalSubArena *physicalSubArena, MM_MemoryPool *memoryPool,
+		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize
+	)
+		: MM_MemorySubSpaceUniSpace(env, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, MEMORY_TYPE_OLD, 0)
+		, _memoryPoolBalanced((MM_MemoryPoolBalanced *)memoryPool)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* MEMORYSUBSPACEBALANCED_HPP_ */
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "ObjectRememberedSet.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_VLHGC)
+
+bool
+MM_ObjectRememberedSet::initialize(MM_EnvironmentBase *env, uintptr_t maximumTableSize)
+{
+	_maximumTableSize = OMR_MAX(maximumTableSize, INITIAL_TABLE_SIZE);
+	return _lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_ObjectRememberedSet:_lock");
+}
+
+void
+MM_ObjectRememberedSet::tearDown(MM_EnvironmentBase *env)
+{
+	clear(env);
+	_lock.tearDown();
+}
+
+bool
+MM_ObjectRememberedSet::insert(uintptr_t *table, uintptr_t tableSize, uintptr_t source)
+{
+	uintptr_t index = hashSlot(source, tableSize);
+	uintptr_t *reusableSlot = NULL;
+
+	while (EMPTY_ENTRY != table[index]) {
+		if (source == table[index]) {
+			/* already remembered */
+			return false;
+		}
+		if ((REMOVED_ENTRY == table[index]) && (NULL == reusableSlot)) {
+			reusableSlot = &table[index];
+		}
+		index = (index + 1) & (tableSize - 1);
+	}
+
+	if (NULL != reusableSlot) {
+		*reusableSlot = source;
+	} else {
+		table[index] = source;
+		_usedSlots += 1;
+	}
+	return true;
+}
+
+bool
+MM_ObjectRememberedSet::grow(MM_EnvironmentBase *env)
+{
+	/* rehash into a table twice as large, unless tombstones make up most of the used slots */
+	uintptr_t newTableSize = (0 == _tableSize) ? INITIAL_TABLE_SIZE : _tableSize;
+	if ((_count * 2) >= _usedSlots) {
+		newTableSize = OMR_MAX(INITIAL_TABLE_SIZE, _tableSize * 2);
+	}
+	if (newTableSize > _maximumTableSize) {
+		return false;
+	}
+
+	uintptr_t *newAllocation = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * (TABLE_HEADER_SLOTS + newTableSize), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == newAllocation) {
+		return false;
+	}
+	memset(newAllocation, 0, sizeof(uintptr_t) * (TABLE_HEADER_SLOTS + newTableSize));
+
+	uintptr_t *oldTable = _table;
+	uintptr_t oldTableSize = _tableSize;
+	uintptr_t *newTable = newAllocation + TABLE_HEADER_SLOTS;
+	/* readers may still be probing the old table, so it is only freed by clear() */
+	newTable[-2] = (uintptr_t)oldTable;
+	newTable[-1] = newTableSize;
+	_usedSlots = 0;
+	for (uintptr_t i = 0; i < oldTableSize; i++) {
+		if (REMOVED_ENTRY < oldTable[i]) {
+			insert(newTable, newTableSize, oldTable[i]);
+		}
+	}
+	/* publish the table only once its header and slots are visible */
+	MM_AtomicOperations::storeSync();
+	_table = newTable;
+	_tableSize = newTableSize;
+	return true;
+}
+
+void
+MM_ObjectRememberedSet::addLocked(MM_EnvironmentBase *env, omrobjectptr_t source)
+{
+	_lock.acquire();
+	if (!_overflowed) {
+		/* keep the load factor (sources and tombstones) at or below 3/4 */
+		if (((_usedSlots + 1) * 4) > (_tableSize * 3)) {
+			if (!grow(env)) {
+				_overflowed = true;
+			}
+		}
+		if (!_overflowed && insert(_table, _tableSize, (uintptr_t)source)) {
+			_count += 1;
+		}
+	}
+	_lock.release();
+}
+
+void
+MM_ObjectRememberedSet::clear(MM_EnvironmentBase *env)
+{
+	uintptr_t *table = _table;
+	while (NULL != table) {
+		uintptr_t *replacedTable = (uintptr_t *)table[-2];
+		env->getForge()->free(table - TABLE_HEADER_SLOTS);
+		table = replacedTable;
+	}
+	_table = NULL;
+	_tableSize = 0;
+	_count = 0;
+	_usedSlots = 0;
+	_overflowed = false;
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(OBJECTREMEMBEREDSET_HPP_)
+#define OBJECTREMEMBEREDSET_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "objectdescription.h"
+
+#include "BaseNonVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+class MM_EnvironmentBase;
+
+/**
+ * The inter-region remembered set of one region of the balanced collector: the set of objects, located
+ * in other regions, which hold a reference into the region.
+ *
+ * The set is an open addressing hash table of object addresses which grows as sources are added. Removed
+ * entries are left as tombstones until the table is next rebuilt. If the table reaches its size limit
+ * (or cannot grow) the set overflows: it stops recording sources, and the owning region may not be
+ * evacuated until a global collection has rebuilt the set.
+ *
+ * Sources already in the set are found without taking the lock, so repeated stores from the same object
+ * only lock the first time. For that, a table replaced by a larger one stays allocated (readers may still
+ * be probing it) until the set is cleared, and each table carries its own size in a header.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_ObjectRememberedSet : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	static const uintptr_t EMPTY_ENTRY = 0; /**< value of a never used slot */
+	static const uintptr_t REMOVED_ENTRY = 1; /**< value of a slot whose source was removed (tombstone) */
+	static const uintptr_t INITIAL_TABLE_SIZE = 64; /**< slots allocated for the first source */
+	static const uintptr_t TABLE_HEADER_SLOTS = 2; /**< words preceding the slots of a table: the table it replaced, then its size */
+
+	uintptr_t * volatile _table; /**< hash table of source objects (NULL until the first source is added) */
+	uintptr_t _tableSize; /**< number of slots in _table (a power of two) */
+	uintptr_t _count; /**< number of sources in the table */
+	uintptr_t _usedSlots; /**< number of slots that are not EMPTY_ENTRY (sources and tombstones) */
+	uintptr_t _maximumTableSize; /**< the table never grows beyond this number of slots */
+	volatile bool _overflowed; /**< true if a source could not be recorded */
+	MM_LightweightNonReentrantLock _lock; /**< serializes mutator and GC thread updates */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t hashSlot(uintptr_t source, uintptr_t tableSize)
+	{
+		/* object addresses are at least 8-byte aligned; mix the remaining bits with a multiplicative hash */
+		uintptr_t hash = (source >> 3) * (uintptr_t)0x9E3779B97F4A7C15ULL;
+		return (hash >> 7) & (tableSize - 1);
+	}
+
+	bool insert(uintptr_t *table, uintptr_t tableSize, uintptr_t source);
+	bool grow(MM_EnvironmentBase *env);
+
+	/**
+	 * Record a source object under the lock.
+	 */
+	void addLocked(MM_EnvironmentBase *env, omrobjectptr_t source);
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t maximumTableSize);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Look a source up without taking the lock. A source being added concurrently may be missed, so only a
+	 * true result is conclusive (sources are only removed while the mutators are stopped).
+	 * @param source[in] An object outside of the owning region
+	 * @return true if the source is recorded in the set
+	 */
+	MMINLINE bool
+	isRemembered(omrobjectptr_t source)
+	{
+		volatile uintptr_t *table = _table;
+		if (NULL != table) {
+			uintptr_t tableSize = table[-1];
+			uintptr_t index = hashSlot((uintptr_t)source, tableSize);
+			/* the load factor stays below 1, so the probe always ends on an empty slot */
+			while (EMPTY_ENTRY != table[index]) {
+				if ((uintptr_t)source == table[index]) {
+					return true;
+				}
+				index = (index + 1) & (tableSize - 1);
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Record a source object. Thread safe; only takes the lock if the source is not already recorded.
+	 * @param env[in] The calling thread
+	 * @param source[in] An object outside of the owning region which references an object inside of it
+	 */
+	MMINLINE void
+	add(MM_EnvironmentBase *env, omrobjectptr_t source)
+	{
+		if (!_overflowed && !isRemembered(source)) {
+			addLocked(env, source);
+		}
+	}
+
+	/**
+	 * Discard all sources, release the table memory and clear the overflow state.
+	 * @param env[in] The calling thread
+	 */
+	void clear(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of slots to visit with getEntry()
+	 */
+	MMINLINE uintptr_t getTableSize() { return _tableSize; }
+
+	/**
+	 * @param index[in] A slot index, less than getTableSize()
+	 * @return the source recorded in the slot, or NULL if the slot is unused
+	 */
+	MMINLINE omrobjectptr_t
+	getEntry(uintptr_t index)
+	{
+		uintptr_t entry = _table[index];
+		return (REMOVED_ENTRY < entry) ? (omrobjectptr_t)entry : NULL;
+	}
+
+	/**
+	 * Remove the source recorded in a slot. Must not run concurrently with add().
+	 * @param index[in] A slot index holding a source
+	 */
+	MMINLINE void
+	removeEntryAt(uintptr_t index)
+	{
+		_table[index] = REMOVED_ENTRY;
+		_count -= 1;
+	}
+
+	/**
+	 * @return the number of sources in the set
+	 */
+	MMINLINE uintptr_t getCount() { return _count; }
+
+	/**
+	 * @return true if the set lost sources and may not be relied on until it is rebuilt
+	 */
+	MMINLINE bool isOverflowed() { return _overflowed; }
+
+	/**
+	 * Stop relying on the set, as if it had overflowed, when some sources could not be recorded.
+	 */
+	MMINLINE void setOverflowed() { _overflowed = true; }
+
+	MM_ObjectRememberedSet()
+		: MM_BaseNonVirtual()
+		, _table(NULL)
+		, _tableSize(0)
+		, _count(0)
+		, _usedSlots(0)
+		, _maximumTableSize(0)
+		, _overflowed(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* OBJECTREMEMBEREDSET_HPP_ */
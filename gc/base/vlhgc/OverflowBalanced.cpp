@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+
+#include "BalancedGC.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptorBalanced.hpp"
+#include "HeapRegionIterator.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "Packet.hpp"
+#include "Task.hpp"
+#include "WorkPackets.hpp"
+
+#include "OverflowBalanced.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+/**
+ * Create a new MM_OverflowBalanced object
+ */
+MM_OverflowBalanced *
+MM_OverflowBalanced::newInstance(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
+{
+	Assert_MM_true(env->getExtensions()->isVLHGC());
+	MM_OverflowBalanced *overflow = (MM_OverflowBalanced *)env->getForge()->allocate(sizeof(MM_OverflowBalanced), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != overflow) {
+		new(overflow) MM_OverflowBalanced(env, workPackets);
+		if (!overflow->initialize(env)) {
+			overflow->kill(env);
+			overflow = NULL;
+		}
+	}
+	return overflow;
+}
+
+bool
+MM_OverflowBalanced::initialize(MM_EnvironmentBase *env)
+{
+	return MM_WorkPacketOverflow::initialize(env);
+}
+
+void
+MM_OverflowBalanced::tearDown(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketOverflow::tearDown(env);
+}
+
+void
+MM_OverflowBalanced::emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type)
+{
+	void *objectPtr;
+
+	_overflow = true;
+
+	_extensions->globalGCStats.workPacketStats.setSTWWorkStackOverflowOccured(true);
+	_extensions->globalGCStats.workPacketStats.incrementSTWWorkStackOverflowCount();
+	_extensions->globalGCStats.workPacketStats.setSTWWorkpacketCountAtOverflow(_workPackets->getActivePacketCount());
+
+	while(NULL != (objectPtr = packet->pop(env))) {
+		overflowItemInternal(env, objectPtr);
+	}
+
+	Assert_MM_true(packet->isEmpty());
+}
+
+void
+MM_OverflowBalanced::overflowItem(MM_EnvironmentBase *env, void *item, MM_OverflowType type)
+{
+	_overflow = true;
+
+	_extensions->globalGCStats.workPacketStats.setSTWWorkStackOverflowOccured(true);
+	_extensions->globalGCStats.workPacketStats.incrementSTWWorkStackOverflowCount();
+	_extensions->globalGCStats.workPacketStats.setSTWWorkpacketCountAtOverflow(_workPackets->getActivePacketCount());
+
+	overflowItemInternal(env, item);
+}
+
+void
+MM_OverflowBalanced::overflowItemInternal(MM_EnvironmentBase *env, void *item)
+{
+	void *heapBase = _extensions->heap->getHeapBase();
+	void *heapTop = _extensions->heap->getHeapTop();
+
+	if ((PACKET_ARRAY_SPLIT_TAG != ((uintptr_t)item & PACKET_ARRAY_SPLIT_TAG)) && (item >= heapBase) && (item < heapTop)) {
+		MM_BalancedGC *globalCollector = (MM_BalancedGC *)_extensions->getGlobalCollector();
+		if (globalCollector->isCopyForwardInProgress()) {
+			/* the object was copied to a survivor region (or left in place): flag the region for rescanning */
+			MM_HeapRegionDescriptorBalanced *region = (MM_HeapRegionDescriptorBalanced *)_extensions->heapRegionManager->tableDescriptorForAddress(item);
+			region->_overflowed = true;
+		} else {
+			MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
+			MM_MarkMap *markMap = markingScheme->getMarkMap();
+			omrobjectptr_t objectPtr = (omrobjectptr_t)item;
+
+			/* object has to be marked already */
+			Assert_MM_true(markMap->isBitSet(objectPtr));
+			Assert_MM_false(markMap->isBitSet((omrobjectptr_t)((uintptr_t)item + markMap->getObjectGrain())));
+
+			/* set overflow bit (double marking) */
+			markMap->atomicSetBit((omrobjectptr_t)((uintptr_t)item + markMap->getObjectGrain()));
+
+			/* Perform language specific actions */
+			markingScheme->getMarkingDelegate()->handleWorkPacketOverflowItem(env, objectPtr);
+		}
+	}
+}
+
+void
+MM_OverflowBalanced::fillFromOverflow(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	Assert_MM_unreachable();
+}
+
+void
+MM_OverflowBalanced::handleOverflow(MM_EnvironmentBase *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		_overflow = false;
+
+		GC_HeapRegionIterator regionIterator(_extensions->heapRegionManager);
+		MM_HeapRegionDescriptorBalanced *region = NULL;
+		MM_BalancedGC *globalCollector = (MM_BalancedGC *)_extensions->getGlobalCollector();
+		bool copyForward = globalCollector->isCopyForwardInProgress();
+		MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
+		MM_MarkMap *markMap = markingScheme->getMarkMap();
+
+		while (NULL != (region = (MM_HeapRegionDescriptorBalanced *)regionIterator.nextRegion())) {
+			if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+				continue;
+			}
+			if (copyForward) {
+				if (!region->_overflowed) {
+					continue;
+				}
+				region->_overflowed = false;
+				if (region->_inCollectionSet) {
+					/* the overflowed objects were left in place by a failed evacuation */
+					globalCollector->scanSelfForwardedObjects(env, region);
+					continue;
+				}
+			}
+
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, (omrobjectptr_t)region->getLowAddress(), (omrobjectptr_t)region->_allocatePointer, false);
+			omrobjectptr_t object = NULL;
+			while (NULL != (object = objectIterator.nextObject())) {
+				if (copyForward) {
+					globalCollector->copyForwardScanObject(env, object, true);
+					env->_copyForwardStats._objectsScannedFromOverflowedRegion += 1;
+				} else if ((markMap->isBitSet(object)) && (markMap->isBitSet((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain())))) {
+					/* clean overflow mark and scan the double marked (overflowed) object */
+					markMap->clearBit((omrobjectptr_t)((uintptr_t)object + markMap->getObjectGrain()));
+					markingScheme->scanObject(env, object, SCAN_REASON_OVERFLOWED_OBJECT);
+				}
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_OverflowBalanced::reset(MM_EnvironmentBase *env)
+{
+
+}
+
+bool
+MM_OverflowBalanced::isEmpty()
+{
+	return true;
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
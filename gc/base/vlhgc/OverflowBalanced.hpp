@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OVERFLOWBALANCED_HPP_)
+#define OVERFLOWBALANCED_HPP_
+
+#include "omr.h"
+
+#include "WorkPacketOverflow.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+/**
+ * Work packet overflow handler of the balanced collector.
+ *
+ * During a global mark an overflowed object is double marked, like with the segregated collector. During a
+ * copy-forward the region holding the (already copied) object is flagged instead, and every object of the
+ * flagged regions is rescanned; rescanning a copied object is harmless since its slots are already updated.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_OverflowBalanced : public MM_WorkPacketOverflow
+{
+/* Data members */
+public:
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+
+/* Methods */
+public:
+	static MM_OverflowBalanced *newInstance(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
+
+	virtual void reset(MM_EnvironmentBase *env);
+	virtual bool isEmpty();
+
+	/**
+	 * Empty a packet on overflow
+	 *
+	 * @param packet - Reference to packet to be emptied
+	 * @param type - ignored
+	 */
+	virtual void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
+
+	/**
+	 * Fill a packet from overflow list
+	 *
+	 * @param packet - Reference to packet to be filled.
+	 *
+	 * @note Never called, overflowed objects are recovered by handleOverflow().
+	 */
+	virtual void fillFromOverflow(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Overflow an item
+	 *
+	 * @param item - item to overflow
+	 * @param type - ignored
+	 */
+	virtual void overflowItem(MM_EnvironmentBase *env, void *item, MM_OverflowType type);
+
+	/**
+	 * Handle Overflow - rescan the overflowed objects
+	 * @param env current thread environment
+	 */
+	virtual void handleOverflow(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a MM_OverflowBalanced object.
+	 */
+	MM_OverflowBalanced(MM_EnvironmentBase *env, MM_WorkPackets *workPackets) :
+		MM_WorkPacketOverflow(env, workPackets),
+		_extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
+	{
+		_typeId = __FUNCTION__;
+	};
+
+protected:
+	/**
+	 * Initialize a MM_OverflowBalanced object.
+	 *
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env);
+
+	/**
+	 * Cleanup the resources for a MM_OverflowBalanced object
+	 */
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Overflow an item, by double marking it or by flagging its region
+	 *
+	 * @param item - item to overflow
+	 */
+	void overflowItemInternal(MM_EnvironmentBase *env, void *item);
+
+private:
+
+};
+
+#endif /* defined(OMR_GC_VLHGC) */
+
+#endif /* OVERFLOWBALANCED_HPP_ */
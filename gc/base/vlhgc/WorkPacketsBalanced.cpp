@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+
+#include "OverflowBalanced.hpp"
+
+#include "WorkPacketsBalanced.hpp"
+
+#if defined(OMR_GC_VLHGC)
+
+/**
+ * Instantiate a MM_WorkPacketsBalanced
+ * @return pointer to the new object
+ */
+MM_WorkPacketsBalanced *
+MM_WorkPacketsBalanced::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsBalanced *workPackets;
+
+	workPackets = (MM_WorkPacketsBalanced *)env->getForge()->allocate(sizeof(MM_WorkPacketsBalanced), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsBalanced(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+MM_WorkPacketOverflow *
+MM_WorkPacketsBalanced::createOverflowHandler(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
+{
+	return MM_OverflowBalanced::newInstance(env, this);
+}
+
+#endif /* defined(OMR_GC_VLHGC) */
@@ -49,6 +49,9 @@ extern "C" {
 #define MEMORY_SPACE_NAME_METRONOME "Metronome"
 #define MEMORY_SPACE_DESCRIPTION_METRONOME "Metronome MemorySpace Description"
 
+#define MEMORY_SPACE_NAME_BALANCED "Balanced"
+#define MEMORY_SPACE_DESCRIPTION_BALANCED "Balanced MemorySpace Description"
+
 /**
  * @}
  */
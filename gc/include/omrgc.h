@@ -42,6 +42,10 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Query the allocation sites ranked by the allocation sampling profiler, most sampled bytes first. Samples are
+ * merged at the start of each collection; the caller must hold VM access. Returns the number of sites written. */
+uintptr_t OMR_GC_GetAllocationSamplingSites(OMR_VMThread* omrVMThread, void **sites, uintptr_t *sampledBytes, uintptr_t maxSites);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -25,6 +25,7 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationSamplingStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -60,3 +61,19 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+uintptr_t
+OMR_GC_GetAllocationSamplingSites(OMR_VMThread* omrVMThread, void **sites, uintptr_t *sampledBytes, uintptr_t maxSites)
+{
+	uintptr_t count = 0;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_AllocationSamplingStats *samplingStats = env->getExtensions()->allocationSamplingStats;
+	if (NULL != samplingStats) {
+		count = OMR_MIN(maxSites, samplingStats->getSiteCount());
+		for (uintptr_t i = 0; i < count; i++) {
+			sites[i] = samplingStats->getSite(i + 1);
+			sampledBytes[i] = samplingStats->getSiteBytes(i + 1);
+		}
+	}
+	return count;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include "AllocationSamplingStats.hpp"
+
+#include <math.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+MM_AllocationSamplingStats *
+MM_AllocationSamplingStats::newInstance(MM_EnvironmentBase *env, uint32_t maxSites)
+{
+	MM_AllocationSamplingStats *allocationSamplingStats = (MM_AllocationSamplingStats *)env->getForge()->allocate(sizeof(MM_AllocationSamplingStats), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+
+	if (NULL != allocationSamplingStats) {
+		new(allocationSamplingStats) MM_AllocationSamplingStats();
+		if (!allocationSamplingStats->initialize(env, maxSites)) {
+			allocationSamplingStats->kill(env);
+			allocationSamplingStats = NULL;
+		}
+	}
+
+	return allocationSamplingStats;
+}
+
+bool
+MM_AllocationSamplingStats::initialize(MM_EnvironmentBase *env, uint32_t maxSites)
+{
+	_maxSites = maxSites;
+	/* as for the large object allocate stats, keep track of 2x more sites than reported to get the top ones right */
+	_sites = spaceSavingNew(env->getPortLibrary(), _maxSites * 2);
+	return (NULL != _sites);
+}
+
+void
+MM_AllocationSamplingStats::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sites) {
+		spaceSavingFree(_sites);
+		_sites = NULL;
+	}
+}
+
+void
+MM_AllocationSamplingStats::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_AllocationSamplingStats::clear()
+{
+	_sampleCount = 0;
+	_sampledBytes = 0;
+	_allocatedBytes = 0;
+	_sampleTime = 0;
+	spaceSavingClear(_sites);
+}
+
+void
+MM_AllocationSamplingStats::update(void *site, uintptr_t weight)
+{
+	_sampleCount += 1;
+	_sampledBytes += weight;
+	spaceSavingUpdate(_sites, site, weight);
+}
+
+void
+MM_AllocationSamplingStats::merge(MM_AllocationSamplingStats *statsToMerge)
+{
+	OMRSpaceSaving *sitesToMerge = statsToMerge->_sites;
+
+	_sampleCount += statsToMerge->_sampleCount;
+	_sampledBytes += statsToMerge->_sampledBytes;
+	_allocatedBytes += statsToMerge->_allocatedBytes;
+	_sampleTime += statsToMerge->_sampleTime;
+	for (uintptr_t rank = 1; rank <= spaceSavingGetCurSize(sitesToMerge); rank++) {
+		spaceSavingUpdate(_sites, spaceSavingGetKthMostFreq(sitesToMerge, rank), spaceSavingGetKthMostFreqCount(sitesToMerge, rank));
+	}
+}
+
+uintptr_t
+MM_AllocationSamplingStats::getSiteCount()
+{
+	return OMR_MIN(_maxSites, spaceSavingGetCurSize(_sites));
+}
+
+void *
+MM_AllocationSamplingStats::getSite(uintptr_t rank)
+{
+	return spaceSavingGetKthMostFreq(_sites, rank);
+}
+
+uintptr_t
+MM_AllocationSamplingStats::getSiteBytes(uintptr_t rank)
+{
+	return spaceSavingGetKthMostFreqCount(_sites, rank);
+}
+
+uintptr_t
+MM_AllocationSamplingStats::nextInterval(uint64_t *seed, uintptr_t meanInterval)
+{
+	/* xorshift64* */
+	uint64_t state = *seed;
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	*seed = state;
+
+	/* uniform in (0, 1] from the 53 high bits of the scrambled state */
+	double uniform = (double)(((state * J9CONST_U64(2685821657736338717)) >> 11) + 1) / 9007199254740992.0;
+	return (uintptr_t)(-log(uniform) * (double)meanInterval) + 1;
+}
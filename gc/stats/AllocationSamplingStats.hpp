@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(ALLOCATIONSAMPLINGSTATS_HPP_)
+#define ALLOCATIONSAMPLINGSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "spacesaving.h"
+
+#include "Base.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Allocation sites sampled by the allocation sampling profiler (see MM_GCExtensionsBase::allocationSamplingEnabled),
+ * ranked by the number of bytes their samples stand for. Each thread records its own samples, which are merged into
+ * MM_GCExtensionsBase::allocationSamplingStats at the start of each collection.
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSamplingStats : public MM_Base
+{
+/* Data Members */
+public:
+	uintptr_t _sampleCount; /**< Number of samples taken */
+	uintptr_t _sampledBytes; /**< Number of allocated bytes the samples stand for */
+	uintptr_t _allocatedBytes; /**< Number of allocated bytes seen by the sampler, sampled or not */
+	uint64_t _sampleTime; /**< Time spent recording samples (including the sample hook), in hi-res ticks */
+private:
+	OMRSpaceSaving *_sites; /**< Top-k-frequent allocation sites, weighted by sampled bytes */
+	uint32_t _maxSites; /**< Number of allocation sites reported accurately */
+
+/* Function Members */
+public:
+	static MM_AllocationSamplingStats *newInstance(MM_EnvironmentBase *env, uint32_t maxSites);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Reset the statistics to their initial state.
+	 */
+	void clear();
+
+	/**
+	 * Record a sample.
+	 * @param[in] site Language defined allocation site of the sampled allocation
+	 * @param[in] weight Number of allocated bytes the sample stands for
+	 */
+	void update(void *site, uintptr_t weight);
+
+	/**
+	 * Merges the samples of the input MM_AllocationSamplingStats into the instance.
+	 * @param[in] statsToMerge Allocation sampling statistics
+	 */
+	void merge(MM_AllocationSamplingStats *statsToMerge);
+
+	/**
+	 * @return the number of allocation sites currently ranked
+	 */
+	uintptr_t getSiteCount();
+
+	/**
+	 * @param[in] rank Rank of the site, starting at 1 for the site with the most sampled bytes
+	 * @return the allocation site at the given rank
+	 */
+	void *getSite(uintptr_t rank);
+
+	/**
+	 * @param[in] rank Rank of the site, starting at 1 for the site with the most sampled bytes
+	 * @return the (estimated) number of bytes allocated by the site at the given rank
+	 */
+	uintptr_t getSiteBytes(uintptr_t rank);
+
+	/**
+	 * Draw the number of bytes a thread allocates before its next sample. Intervals are exponentially distributed,
+	 * so periodic allocation patterns do not bias the samples.
+	 * @param[in,out] seed State of the thread's pseudo random generator, must not be 0
+	 * @param[in] meanInterval Mean of the intervals
+	 * @return the next sampling interval, in bytes
+	 */
+	static uintptr_t nextInterval(uint64_t *seed, uintptr_t meanInterval);
+
+	MM_AllocationSamplingStats() :
+		MM_Base()
+		,_sampleCount(0)
+		,_sampledBytes(0)
+		,_allocatedBytes(0)
+		,_sampleTime(0)
+		,_sites(NULL)
+		,_maxSites(0)
+	{};
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uint32_t maxSites);
+	void tearDown(MM_EnvironmentBase *env);
+};
+
+#endif /* ALLOCATIONSAMPLINGSTATS_HPP_ */
@@ -50,6 +50,8 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _windowSize; /**< bytes of heap selected by a partial compaction, 0 if the whole heap was compacted */
+	uintptr_t _slidingWindows; /**< windows slid in parallel when the compaction used sliding windows, 0 if sub areas were evacuated */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
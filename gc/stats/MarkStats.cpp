@@ -35,6 +35,10 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_minorCollections = 0;
+	_rememberedObjects = 0;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -48,6 +48,10 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t _minorCollections; /**< consecutive minor collections up to and including this one, 0 for a full collection (segregated generational mode) */
+	uintptr_t _rememberedObjects; /**< old objects a minor collection scanned from the remembered set */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -108,6 +112,10 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		,_minorCollections(0)
+		,_rememberedObjects(0)
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 		,_startTime(0)
 		,_endTime(0)
 	{
@@ -30,6 +30,44 @@
 
 #include "RootScannerStats.hpp"
 
+/* indexed by RootScannerEntity */
+static const char * const rootScannerEntityNames[] = {
+	"none",
+	"scavenge-remembered-set",
+	"classes",
+	"vm-class-slots",
+	"permanent-classes",
+	"class-loaders",
+	"threads",
+	"finalizable-objects",
+	"unfinalized-objects",
+	"ownable-synchronizer-objects",
+	"string-table",
+	"jni-global-references",
+	"jni-weak-global-references",
+	"double-mapped-objects",
+	"debugger-references",
+	"debugger-class-references",
+	"monitor-references",
+	"weak-reference-objects",
+	"soft-reference-objects",
+	"phantom-reference-objects",
+	"jvmti-object-tag-tables",
+	"non-collectable-objects",
+	"remembered-set",
+	"memory-area-objects",
+	"metronome-remembered-set",
+	"classes-complete",
+	"weak-reference-objects-complete",
+	"soft-reference-objects-complete",
+	"phantom-reference-objects-complete",
+	"unfinalized-objects-complete",
+	"ownable-synchronizer-objects-complete",
+	"monitor-lookup-caches",
+	"monitor-lookup-caches-complete",
+	"monitor-reference-objects-complete",
+};
+
 void
 MM_RootScannerStats::clear()
 {
@@ -48,3 +86,9 @@ MM_RootScannerStats::merge(MM_RootScannerStats *statsToMerge)
 		_entityScanTime[i] += statsToMerge->_entityScanTime[i];
 	}
 }
+
+const char *
+MM_RootScannerStats::getEntityName(RootScannerEntity entity)
+{
+	return (entity < RootScannerEntity_Count) ? rootScannerEntityNames[entity] : "unknown";
+}
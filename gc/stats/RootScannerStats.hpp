@@ -58,6 +58,12 @@ public:
 	 * @param[in] statsToMerge	Root scanner statistics
 	 */
 	void merge(MM_RootScannerStats *statsToMerge);
+
+	/**
+	 * @param[in] entity A root scanner entity
+	 * @return the name of the entity, as reported in verbose output
+	 */
+	static const char *getEntityName(RootScannerEntity entity);
 	
 	MM_RootScannerStats() :
 		MM_Base()
@@ -44,6 +44,10 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_failedFlipCount(0)
 	,_failedFlipBytes(0)
 	,_tenureAge(0)
+	,_tenureDecisionAge(0)
+	,_tenureDecisionCopyBytes(0)
+	,_tenureDecisionPrematureTenureBytes(0)
+	,_tenureDecisionSurvivorBytes(0)
 	,_startTime(0)
 	,_endTime(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -68,6 +72,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_avgInitialFree(0)
 	,_avgTenureBytes(0)
 	,_avgTenureBytesDeviation(0)
+	,_avgCopiedBytes(0)
 	,_tiltRatio(0)
 	,_nextScavengeWillPercolate(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
@@ -83,6 +88,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_semiSpaceAllocationCountSmall(0)
 	,_tenureSpaceAllocationCountLarge(0)
 	,_tenureSpaceAllocationCountSmall(0)
+	,_numaLocalChunkCount(0)
+	,_numaRemoteChunkCount(0)
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
@@ -152,6 +159,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_failedFlipCount = 0;
 	_failedFlipBytes = 0;
 	_tenureAge = 0;
+	_tenureDecisionAge = 0;
+	_tenureDecisionCopyBytes = 0;
+	_tenureDecisionPrematureTenureBytes = 0;
+	_tenureDecisionSurvivorBytes = 0;
 	_nextScavengeWillPercolate = false;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_releaseScanListCount = 0;
@@ -184,6 +195,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureSpaceAllocationCountLarge = 0;
 	_tenureSpaceAllocationCountSmall = 0;
 
+	_numaLocalChunkCount = 0;
+	_numaRemoteChunkCount = 0;
+
 	_tenureExpandedBytes = 0;
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
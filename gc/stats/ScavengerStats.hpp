@@ -75,6 +75,10 @@ public:
 	uintptr_t _failedFlipCount;
 	uintptr_t _failedFlipBytes;
 	uintptr_t _tenureAge;
+	uintptr_t _tenureDecisionAge; /**< Tenure age chosen for the next scavenge by the copy cost tenure strategy (0 if no decision was made this cycle) */
+	uintptr_t _tenureDecisionCopyBytes; /**< Bytes per scavenge predicted to be copied (flipped and tenured) at the chosen tenure age */
+	uintptr_t _tenureDecisionPrematureTenureBytes; /**< Bytes per scavenge predicted to be tenured at the chosen tenure age but to die before the maximum age */
+	uintptr_t _tenureDecisionSurvivorBytes; /**< Bytes per scavenge predicted to be flipped at the chosen tenure age, used to size survivor space */
 	uint64_t _startTime;
 	uint64_t _endTime;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -104,6 +108,7 @@ public:
 	uintptr_t _avgInitialFree;
 	uintptr_t _avgTenureBytes;
 	uintptr_t _avgTenureBytesDeviation; /**< The average, weighted deviation of the tenureBytes*/
+	uintptr_t _avgCopiedBytes; /**< The average, weighted number of bytes copied (flipped and tenured) by a collection */
 	
 	uintptr_t _tiltRatio;	/**< use to pass tiltRatio to verbose */
 
@@ -127,6 +132,9 @@ public:
 	uintptr_t _tenureSpaceAllocationCountLarge;
 	uintptr_t _tenureSpaceAllocationCountSmall;
 
+	uintptr_t _numaLocalChunkCount; /**< Copy cache chunks taken from memory striped to the copying thread's NUMA node (NUMA-aware scavenge only) */
+	uintptr_t _numaRemoteChunkCount; /**< Copy cache chunks that had to be taken from another node's memory (NUMA-aware scavenge only) */
+
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
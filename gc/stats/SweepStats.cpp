@@ -39,6 +39,11 @@ MM_SweepStats::clear()
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_lazySweepAllocationRegions = 0;
+	_lazySweepLeftoverRegions = 0;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
@@ -53,6 +58,11 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_lazySweepAllocationRegions += statsToMerge->_lazySweepAllocationRegions;
+	_lazySweepLeftoverRegions += statsToMerge->_lazySweepLeftoverRegions;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	idleTime += statsToMerge->idleTime;
@@ -44,6 +44,11 @@ public:
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t _lazySweepAllocationRegions; /**< small regions swept by allocating threads since the previous collection (segregated lazy sweep) */
+	uintptr_t _lazySweepLeftoverRegions; /**< small regions left for the GC threads to sweep at the start of this collection */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uint64_t idleTime;
 	uint64_t mergeTime;
@@ -66,6 +71,10 @@ public:
 	MM_SweepStats() :
 		MM_Base()
 		,_gcCount(UDATA_MAX)
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		,_lazySweepAllocationRegions(0)
+		,_lazySweepLeftoverRegions(0)
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 		,_startTime(0)
 		,_endTime(0)
 	{
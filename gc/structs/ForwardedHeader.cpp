@@ -97,9 +97,12 @@ MM_ForwardedHeader::getForwardedObject()
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uintptr_t forwardedTag = _forwardedTag | _beingCopiedHint;
-	if (isStrictlyForwardedPointer()) {
 #else
 	uintptr_t forwardedTag = _forwardedTag;
+#endif
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
+	if (isStrictlyForwardedPointer()) {
+#else
 	if (isForwardedPointer()) {
 #endif
 #if defined (OMR_GC_COMPRESSED_POINTERS) && !defined(OMR_ENV_LITTLE_ENDIAN)
@@ -126,11 +129,14 @@ MM_ForwardedHeader::getNonStrictForwardedObject()
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uintptr_t forwardedTag = _forwardedTag | _beingCopiedHint;
-	if (isStrictlyForwardedPointer()) {
 #else
 	uintptr_t forwardedTag = _forwardedTag;
-	if (isForwardedPointer()) {
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
+	if (isStrictlyForwardedPointer()) {
+#else
+	if (isForwardedPointer()) {
+#endif /* FORWARDEDHEADER_SELF_FORWARDING */
 #if defined (OMR_GC_COMPRESSED_POINTERS) && !defined(OMR_ENV_LITTLE_ENDIAN)
 		/* Compressed big endian - read two halves separately */
 		uint32_t hi = (uint32_t)_preserved.overlap;
@@ -143,11 +149,11 @@ MM_ForwardedHeader::getNonStrictForwardedObject()
 
 		forwardedObject = (omrobjectptr_t)(restoredForwardingSlotValue);
 	}
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
 	else if (isSelfForwardedPointer()) {
 		forwardedObject = _objectPtr;
 	}
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#endif /* FORWARDEDHEADER_SELF_FORWARDING */
 
 	return forwardedObject;
 }
@@ -199,7 +205,7 @@ MM_ForwardedHeader::copySection(omrobjectptr_t destinationObjectPtr, uintptr_t r
 	memcpy(dstStartAddress, srcStartAddress, sizeToCopy);
 }
 
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
 omrobjectptr_t
 MM_ForwardedHeader::setSelfForwardedObject()
 {
@@ -232,7 +238,9 @@ MM_ForwardedHeader::restoreSelfForwardedPointer()
 
 	objectHeader->slot = newValue;
 }
+#endif /* defined(FORWARDEDHEADER_SELF_FORWARDING) */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
 
 uintptr_t
 MM_ForwardedHeader::winObjectSectionToCopy(volatile fomrobject_t *copyProgressSlot, fomrobject_t oldValue, uintptr_t *remainingSizeToCopy, uintptr_t outstandingCopies)
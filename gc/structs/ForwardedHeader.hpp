@@ -43,6 +43,11 @@
 #define OMR_BEING_COPIED_HINT 2
 #define OMR_SELF_FORWARDED_TAG J9_GC_MULTI_SLOT_HOLE
 
+/* Objects which can not be copied are forwarded to themselves, by Concurrent Scavenger and by the balanced copy-forward */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) || defined(OMR_GC_VLHGC)
+#define FORWARDEDHEADER_SELF_FORWARDING
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) || defined(OMR_GC_VLHGC) */
+
 
 /* Destination object header bits, masks, consts... */
 /* Master being-copied bit is the destination header. If set, object is still being copied,
@@ -103,8 +108,10 @@ private:
 	MutableHeaderFields _preserved; 			/**< a backup copy of the header fields which may be modified by this class */
 	const uintptr_t _forwardingSlotOffset;		/**< fomrobject_t offset from _objectPtr to fomrobject_t slot that will hold the forwarding pointer */
 	static const uintptr_t _forwardedTag = OMR_FORWARDED_TAG;	/**< bit mask used to mark forwarding slot value as forwarding pointer */
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
+	static const fomrobject_t _selfForwardedTag = (fomrobject_t)(_forwardedTag | OMR_SELF_FORWARDED_TAG);
+#endif /* defined(FORWARDEDHEADER_SELF_FORWARDING) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	static const fomrobject_t _selfForwardedTag = (fomrobject_t)(_forwardedTag | OMR_SELF_FORWARDED_TAG);	
 	static const fomrobject_t _beingCopiedHint = (fomrobject_t)OMR_BEING_COPIED_HINT; /**< used in source object f/w pointer to hint that object might still be being copied */
 	static const fomrobject_t _beingCopiedTag = (fomrobject_t)OMR_BEING_COPIED_TAG; /**< used in destination object, but using the same bit as _forwardedTag in source object */
 	static const fomrobject_t _remainingSizeMask = (fomrobject_t)REMAINING_SIZE_MASK; 
@@ -215,7 +222,7 @@ public:
 		return _forwardedTag == ((uintptr_t)_preserved.slot & _forwardedTag);
 	}
 	
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#if defined(FORWARDEDHEADER_SELF_FORWARDING)
 	/**
 	 * If object is forwarded (isForwardedPointer() returns true) the object can be either
 	 * - strictly forwarded (to a remote object, with explicit forwarding pointer)
@@ -237,7 +244,9 @@ public:
 	omrobjectptr_t setSelfForwardedObject();
 	
 	void restoreSelfForwardedPointer();
-	
+#endif /* defined(FORWARDEDHEADER_SELF_FORWARDING) */
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/**
 	 * Initial step for destination object fixup - restore object flags and overlap, while still maintaining progess info and being copied bit.
 	 */
@@ -0,0 +1,513 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/*
+ * This header is shared by the asynchronous verbose writer and the offline decoder (tools/vgcdecode),
+ * so it must only depend on the C runtime.
+ */
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_BYTE_ORDER_MARK 0x01020304
+#define VERBOSE_BINARY_MAX_FORMATS 1024
+#define VERBOSE_BINARY_INDENT_SPACER "  "
+#define VERBOSE_BINARY_ENCODING_FAILED ((uintptr_t)-1)
+
+/**
+ * Header at the start of a binary verbose log. Records follow immediately.
+ * Multi-byte values in the file use the byte order of the writing platform; byteOrderMark lets the
+ * decoder detect a mismatch.
+ */
+typedef struct MM_VerboseBinaryFileHeader {
+	char magic[8]; /**< VERBOSE_BINARY_MAGIC, NUL terminated */
+	uint32_t version; /**< VERBOSE_BINARY_VERSION */
+	uint32_t byteOrderMark; /**< VERBOSE_BINARY_BYTE_ORDER_MARK */
+	uint32_t pointerSize; /**< sizeof(uintptr_t) of the writing process, used to format %p */
+	uint32_t reserved;
+} MM_VerboseBinaryFileHeader;
+
+/**
+ * Header of every record, both in the in-memory ring and in binary log files.
+ * Records are padded to a multiple of 8 bytes; size includes the header and padding.
+ */
+typedef struct MM_VerboseBinaryRecordHeader {
+	uint32_t size; /**< total size of the record in bytes */
+	uint16_t type; /**< one of MM_VerboseBinaryRecordType */
+	uint16_t indent; /**< indentation level of a line record */
+} MM_VerboseBinaryRecordHeader;
+
+typedef enum MM_VerboseBinaryRecordType {
+	VERBOSE_RECORD_PADDING = 0, /**< filler up to the end of the ring, never written to a file */
+	VERBOSE_RECORD_LINE = 1, /**< uint64_t format (address in the ring, format id in a file) followed by the encoded arguments */
+	VERBOSE_RECORD_TEXT = 2, /**< NUL terminated text written as is */
+	VERBOSE_RECORD_END_OF_CYCLE = 3, /**< end of a GC cycle, drives file rotation, never written to a file */
+	VERBOSE_RECORD_FORMAT = 4, /**< uint64_t format id followed by the NUL terminated format string */
+	VERBOSE_RECORD_DROPPED = 5 /**< uint64_t count of records dropped because the ring was full */
+} MM_VerboseBinaryRecordType;
+
+/**
+ * Encoding and decoding of verbose output lines as a format string plus the raw values of its arguments.
+ *
+ * Recording a line only walks the format string and copies the arguments, which is much cheaper than
+ * formatting it. The grammar accepted is the one of omrstr_vprintf: an optional single flag, width and
+ * precision (digits or '*'), the z, l and ll modifiers and the c, d, i, u, x, X, p, s, e, E, f, F, g and G
+ * conversions. Scalars are stored as 8 bytes, strings as a uint32_t length (including the NUL) followed
+ * by their characters.
+ */
+class MM_VerboseBinaryFormat
+{
+public:
+	typedef enum ArgumentType {
+		ARGUMENT_INT32,
+		ARGUMENT_UINT32,
+		ARGUMENT_UINT64,
+		ARGUMENT_CHAR,
+		ARGUMENT_POINTER,
+		ARGUMENT_STRING,
+		ARGUMENT_DOUBLE
+	} ArgumentType;
+
+	/**
+	 * A single conversion specification of a format string.
+	 */
+	typedef struct Conversion {
+		char flag; /**< flag character, or NUL */
+		const char *width; /**< width digits (widthLength characters) */
+		uintptr_t widthLength;
+		bool widthArgument; /**< width is taken from an argument ('*') */
+		bool hasPrecision;
+		const char *precision; /**< precision digits (precisionLength characters) */
+		uintptr_t precisionLength;
+		bool precisionArgument; /**< precision is taken from an argument ('*') */
+		char conversion; /**< conversion character */
+		ArgumentType type;
+	} Conversion;
+
+	/**
+	 * Output callbacks used while decoding. The write function receives literal text, the format
+	 * function a format string with a single conversion and its argument (like snprintf).
+	 */
+	typedef void (*WriteFunction)(void *userData, const char *text, uintptr_t length);
+	typedef uintptr_t (*FormatFunction)(void *userData, char *buffer, uintptr_t length, const char *format, ...);
+
+	/**
+	 * Round a record size up to the record alignment.
+	 */
+	static uintptr_t
+	alignRecordSize(uintptr_t size)
+	{
+		return (size + 7) & ~(uintptr_t)7;
+	}
+
+	/**
+	 * Parse the conversion specification following a '%'.
+	 * @param cursor[in] the character after the '%' ("%%" must be handled by the caller)
+	 * @param conversion[out] the parsed specification
+	 * @return the character following the specification, or NULL if the specification is not supported
+	 */
+	static const char *
+	parseConversion(const char *cursor, Conversion *conversion)
+	{
+		memset(conversion, 0, sizeof(Conversion));
+
+		switch (*cursor) {
+		case '0':
+		case ' ':
+		case '-':
+		case '+':
+		case '#':
+			conversion->flag = *cursor;
+			cursor += 1;
+			break;
+		}
+
+		if ('*' == *cursor) {
+			conversion->widthArgument = true;
+			cursor += 1;
+		} else {
+			conversion->width = cursor;
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+			conversion->widthLength = cursor - conversion->width;
+		}
+
+		if ('.' == *cursor) {
+			cursor += 1;
+			conversion->hasPrecision = true;
+			if ('*' == *cursor) {
+				conversion->precisionArgument = true;
+				cursor += 1;
+			} else {
+				conversion->precision = cursor;
+				while (('0' <= *cursor) && ('9' >= *cursor)) {
+					cursor += 1;
+				}
+				conversion->precisionLength = cursor - conversion->precision;
+			}
+		}
+
+		bool longLong = false;
+		bool isLong = false;
+		if ('z' == *cursor) {
+			longLong = (8 == sizeof(size_t));
+			cursor += 1;
+		} else if ('l' == *cursor) {
+			cursor += 1;
+			if ('l' == *cursor) {
+				longLong = true;
+				cursor += 1;
+			} else {
+				/* long is as wide as long long on LP64 platforms */
+				longLong = (8 == sizeof(long));
+				isLong = true;
+			}
+		}
+
+		conversion->conversion = *cursor;
+		switch (*cursor) {
+		case 'c':
+			if (isLong) {
+				/* wide characters are not supported */
+				return NULL;
+			}
+			conversion->type = ARGUMENT_CHAR;
+			break;
+		case 'd':
+		case 'i':
+			conversion->type = longLong ? ARGUMENT_UINT64 : ARGUMENT_INT32;
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+			conversion->type = longLong ? ARGUMENT_UINT64 : ARGUMENT_UINT32;
+			break;
+		case 'p':
+			conversion->type = ARGUMENT_POINTER;
+			break;
+		case 's':
+			if (isLong) {
+				/* wide strings are not supported */
+				return NULL;
+			}
+			conversion->type = ARGUMENT_STRING;
+			break;
+		case 'e':
+		case 'E':
+		case 'f':
+		case 'F':
+		case 'g':
+		case 'G':
+			conversion->type = ARGUMENT_DOUBLE;
+			break;
+		default:
+			/* includes positional arguments, which are not supported */
+			return NULL;
+		}
+
+		return cursor + 1;
+	}
+
+	/**
+	 * Encode the arguments of a line.
+	 * @param format[in] the format string
+	 * @param args[in] the arguments
+	 * @param buffer[out] where to store the encoded arguments
+	 * @param capacity[in] size of buffer in bytes
+	 * @return the number of bytes used, or VERBOSE_BINARY_ENCODING_FAILED if the format is not supported or buffer is too small
+	 */
+	static uintptr_t
+	encodeArguments(const char *format, va_list args, uint8_t *buffer, uintptr_t capacity)
+	{
+		uintptr_t used = 0;
+		const char *cursor = format;
+
+		while ('\0' != *cursor) {
+			if ('%' != *cursor) {
+				cursor += 1;
+				continue;
+			}
+			cursor += 1;
+			if ('%' == *cursor) {
+				cursor += 1;
+				continue;
+			}
+
+			Conversion conversion;
+			cursor = parseConversion(cursor, &conversion);
+			if (NULL == cursor) {
+				return VERBOSE_BINARY_ENCODING_FAILED;
+			}
+
+			if (conversion.widthArgument && !putScalar(buffer, capacity, &used, (uint64_t)(int64_t)va_arg(args, int))) {
+				return VERBOSE_BINARY_ENCODING_FAILED;
+			}
+			if (conversion.precisionArgument && !putScalar(buffer, capacity, &used, (uint64_t)(int64_t)va_arg(args, int))) {
+				return VERBOSE_BINARY_ENCODING_FAILED;
+			}
+
+			bool fits = true;
+			switch (conversion.type) {
+			case ARGUMENT_INT32:
+				fits = putScalar(buffer, capacity, &used, (uint64_t)(int64_t)va_arg(args, int32_t));
+				break;
+			case ARGUMENT_UINT32:
+			case ARGUMENT_CHAR:
+				fits = putScalar(buffer, capacity, &used, (uint64_t)va_arg(args, uint32_t));
+				break;
+			case ARGUMENT_UINT64:
+				fits = putScalar(buffer, capacity, &used, va_arg(args, uint64_t));
+				break;
+			case ARGUMENT_POINTER:
+				fits = putScalar(buffer, capacity, &used, (uint64_t)(uintptr_t)va_arg(args, void *));
+				break;
+			case ARGUMENT_DOUBLE:
+			{
+				double value = va_arg(args, double);
+				uint64_t bits = 0;
+				memcpy(&bits, &value, sizeof(bits));
+				fits = putScalar(buffer, capacity, &used, bits);
+				break;
+			}
+			case ARGUMENT_STRING:
+			{
+				const char *string = va_arg(args, const char *);
+				if (NULL == string) {
+					/* matches the output of omrstr_vprintf */
+					string = "<NULL>";
+				}
+				uint32_t length = (uint32_t)strlen(string) + 1;
+				if ((capacity - used) < (sizeof(length) + length)) {
+					return VERBOSE_BINARY_ENCODING_FAILED;
+				}
+				memcpy(buffer + used, &length, sizeof(length));
+				memcpy(buffer + used + sizeof(length), string, length);
+				used += sizeof(length) + length;
+				break;
+			}
+			}
+			if (!fits) {
+				return VERBOSE_BINARY_ENCODING_FAILED;
+			}
+		}
+
+		return used;
+	}
+
+	/**
+	 * Format a line from its format string and encoded arguments (without indentation or line end).
+	 * @param format[in] the format string the arguments were encoded with
+	 * @param arguments[in] the encoded arguments
+	 * @param length[in] size of the encoded arguments in bytes (records may add padding after them)
+	 * @param pointerSize[in] pointer size of the process that encoded the line
+	 * @return false if the encoded arguments are too short for the format
+	 */
+	static bool
+	decodeLine(const char *format, const uint8_t *arguments, uintptr_t length, uintptr_t pointerSize, WriteFunction writeFunction, FormatFunction formatFunction, void *userData)
+	{
+		uintptr_t consumed = 0;
+		const char *cursor = format;
+		const char *literal = format;
+		char specification[64];
+		char formatted[512];
+
+		while ('\0' != *cursor) {
+			if ('%' != *cursor) {
+				cursor += 1;
+				continue;
+			}
+			writeFunction(userData, literal, cursor - literal);
+			cursor += 1;
+			if ('%' == *cursor) {
+				cursor += 1;
+				literal = cursor - 1;
+				continue;
+			}
+
+			Conversion conversion;
+			cursor = parseConversion(cursor, &conversion);
+			if ((NULL == cursor) || (conversion.widthLength > 20) || (conversion.precisionLength > 20)) {
+				return false;
+			}
+			literal = cursor;
+
+			uint64_t width = 0;
+			uint64_t precision = 0;
+			if (conversion.widthArgument && !getScalar(arguments, length, &consumed, &width)) {
+				return false;
+			}
+			if (conversion.precisionArgument && !getScalar(arguments, length, &consumed, &precision)) {
+				return false;
+			}
+
+			/* rebuild the specification with the '*' values substituted and the size modifier normalized */
+			char *spec = specification;
+			*spec++ = '%';
+			if ('\0' != conversion.flag) {
+				*spec++ = conversion.flag;
+			}
+			if (conversion.widthArgument) {
+				spec += writeDecimal(spec, (int64_t)width);
+			} else {
+				memcpy(spec, conversion.width, conversion.widthLength);
+				spec += conversion.widthLength;
+			}
+			if (conversion.hasPrecision && !(conversion.precisionArgument && ((int64_t)precision < 0))) {
+				*spec++ = '.';
+				if (conversion.precisionArgument) {
+					spec += writeDecimal(spec, (int64_t)precision);
+				} else {
+					memcpy(spec, conversion.precision, conversion.precisionLength);
+					spec += conversion.precisionLength;
+				}
+			}
+
+			uintptr_t formattedLength = 0;
+			if (ARGUMENT_STRING == conversion.type) {
+				uint32_t stringLength = 0;
+				if (((length - consumed) < sizeof(stringLength))) {
+					return false;
+				}
+				memcpy(&stringLength, arguments + consumed, sizeof(stringLength));
+				consumed += sizeof(stringLength);
+				if (((length - consumed) < stringLength) || (0 == stringLength)) {
+					return false;
+				}
+				const char *string = (const char *)(arguments + consumed);
+				consumed += stringLength;
+				if ((spec - specification) == 1) {
+					/* plain %s, no need to copy */
+					writeFunction(userData, string, stringLength - 1);
+					continue;
+				}
+				*spec++ = 's';
+				*spec = '\0';
+				formattedLength = formatFunction(userData, formatted, sizeof(formatted), specification, string);
+			} else {
+				uint64_t value = 0;
+				if (!getScalar(arguments, length, &consumed, &value)) {
+					return false;
+				}
+				switch (conversion.type) {
+				case ARGUMENT_CHAR:
+					*spec++ = 'c';
+					*spec = '\0';
+					formattedLength = formatFunction(userData, formatted, sizeof(formatted), specification, (int)value);
+					break;
+				case ARGUMENT_POINTER:
+					/* omrstr_vprintf prints pointers as zero padded upper case hex digits */
+					spec = specification;
+					*spec++ = '%';
+					*spec++ = '.';
+					spec += writeDecimal(spec, (int64_t)(pointerSize * 2));
+					*spec++ = 'l';
+					*spec++ = 'l';
+					*spec++ = 'X';
+					*spec = '\0';
+					formattedLength = formatFunction(userData, formatted, sizeof(formatted), specification, (unsigned long long)value);
+					break;
+				case ARGUMENT_DOUBLE:
+				{
+					double doubleValue = 0.0;
+					memcpy(&doubleValue, &value, sizeof(doubleValue));
+					*spec++ = conversion.conversion;
+					*spec = '\0';
+					formattedLength = formatFunction(userData, formatted, sizeof(formatted), specification, doubleValue);
+					break;
+				}
+				default:
+					/* integers were widened to 64 bits when they were encoded */
+					*spec++ = 'l';
+					*spec++ = 'l';
+					*spec++ = conversion.conversion;
+					*spec = '\0';
+					formattedLength = formatFunction(userData, formatted, sizeof(formatted), specification, (unsigned long long)value);
+					break;
+				}
+			}
+			if (formattedLength >= sizeof(formatted)) {
+				formattedLength = sizeof(formatted) - 1;
+			}
+			writeFunction(userData, formatted, formattedLength);
+		}
+		writeFunction(userData, literal, cursor - literal);
+
+		return true;
+	}
+
+private:
+	static bool
+	putScalar(uint8_t *buffer, uintptr_t capacity, uintptr_t *used, uint64_t value)
+	{
+		if ((capacity - *used) < sizeof(value)) {
+			return false;
+		}
+		memcpy(buffer + *used, &value, sizeof(value));
+		*used += sizeof(value);
+		return true;
+	}
+
+	static bool
+	getScalar(const uint8_t *buffer, uintptr_t length, uintptr_t *consumed, uint64_t *value)
+	{
+		if ((length - *consumed) < sizeof(*value)) {
+			return false;
+		}
+		memcpy(value, buffer + *consumed, sizeof(*value));
+		*consumed += sizeof(*value);
+		return true;
+	}
+
+	/**
+	 * Write a decimal number without a terminating NUL.
+	 * @return the number of characters written (at most 20)
+	 */
+	static uintptr_t
+	writeDecimal(char *buffer, int64_t value)
+	{
+		char digits[24];
+		uintptr_t count = 0;
+		uintptr_t written = 0;
+		uint64_t magnitude = (uint64_t)value;
+		if (value < 0) {
+			buffer[written++] = '-';
+			magnitude = (uint64_t)0 - magnitude;
+		}
+		do {
+			digits[count++] = (char)('0' + (magnitude % 10));
+			magnitude /= 10;
+		} while (0 != magnitude);
+		while (0 != count) {
+			buffer[written++] = digits[--count];
+		}
+		return written;
+	}
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
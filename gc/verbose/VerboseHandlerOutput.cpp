@@ -29,6 +29,9 @@
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "ParallelDispatcher.hpp"
+#include "RootScannerStats.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -282,6 +285,11 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", event->heapPageType);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", event->heapRequestedPageSize);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", event->heapRequestedPageType);
+	if (_extensions->_hugePageManager.isReportingEnabled()) {
+		writer->formatAndOutput(env, 1, "<attribute name=\"hugePagePolicy\" value=\"%s\" />", MM_HugePageManager::getPolicyName(_extensions->hugePagePolicy));
+		writer->formatAndOutput(env, 1, "<attribute name=\"effectiveHugePagePolicy\" value=\"%s\" />", MM_HugePageManager::getPolicyName(_extensions->_hugePageManager.getEffectivePolicy()));
+		writer->formatAndOutput(env, 1, "<attribute name=\"hugePageSize\" value=\"0x%zx\" />", _extensions->_hugePageManager.getHugePageSize());
+	}
 	writer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", event->gcThreads);
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -299,6 +307,9 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
 	writer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 	writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
+	if (0 != _extensions->splitFreeListSplitAmountMaximum) {
+		writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmountMaximum\" value=\"%zu\" />", _extensions->splitFreeListSplitAmountMaximum);
+	}
 	writer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", event->numaNodes);
 
 	handleInitializedInnerStanzas(hook, eventNum, eventData);
@@ -413,10 +424,18 @@ MM_VerboseHandlerOutput::handleCycleEnd(J9HookInterface** hook, uintptr_t eventN
 	char tagTemplate[200];
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), cycleType, env->_cycleState->_verboseContextID, omrtime_current_time_millis());
 
+	bool reportHugePages = _extensions->_hugePageManager.isReportingEnabled();
+	if (reportHugePages) {
+		/* sampling reads the process mappings, so do it before other threads are blocked from reporting */
+		_extensions->_hugePageManager.sampleUsage(env);
+	}
 	enterAtomicReportingBlock();
-	if(hasCycleEndInnerStanzas()) {
+	if(hasCycleEndInnerStanzas() || reportHugePages) {
 		writer->formatAndOutput(env, 0, "<cycle-end %s>", tagTemplate);
 		handleCycleEndInnerStanzas(hook, eventNum, eventData, 1);
+		if (reportHugePages) {
+			outputHugePageUsage(env, 1);
+		}
 		writer->formatAndOutput(env, 0, "</cycle-end>");
 	} else {
 		writer->formatAndOutput(env, 0, "<cycle-end %s />", tagTemplate);
@@ -744,6 +763,111 @@ MM_VerboseHandlerOutput::outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, ui
 {
 }
 
+void
+MM_VerboseHandlerOutput::outputHugePageUsage(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_HugePageManager *hugePageManager = &_extensions->_hugePageManager;
+	const MM_HugePageManager::Usage *usage = hugePageManager->getSampledUsage();
+
+	writer->formatAndOutput(env, indent, "<huge-pages policy=\"%s\" hugePageSize=\"%zu\" sampleAge=\"%zu\">",
+			MM_HugePageManager::getPolicyName(hugePageManager->getEffectivePolicy()), hugePageManager->getHugePageSize(), hugePageManager->getCyclesSinceSample());
+	for (uintptr_t structure = 0; structure < MM_HugePageManager::STRUCTURE_COUNT; structure++) {
+		if (0 != usage[structure].reservedBytes) {
+			writer->formatAndOutput(env, indent + 1, "<huge-page-usage structure=\"%s\" pageSize=\"%zu\" reserved=\"%zu\" resident=\"%zu\" hugePageBacked=\"%zu\" />",
+					MM_HugePageManager::getStructureName((MM_HugePageManager::Structure)structure), usage[structure].pageSize,
+					usage[structure].reservedBytes, usage[structure].residentBytes, usage[structure].hugePageBytes);
+		}
+	}
+	writer->formatAndOutput(env, indent, "</huge-pages>");
+}
+
+void
+MM_VerboseHandlerOutput::outputRootScannerStats(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uint64_t totalTime[RootScannerEntity_Count];
+	uint64_t maxThreadTime[RootScannerEntity_Count];
+	uintptr_t threadCount[RootScannerEntity_Count];
+	uint64_t maxIncrementTime = 0;
+	RootScannerEntity maxIncrementEntity = RootScannerEntity_None;
+
+	for (uintptr_t entity = 0; entity < RootScannerEntity_Count; entity++) {
+		totalTime[entity] = 0;
+		maxThreadTime[entity] = 0;
+		threadCount[entity] = 0;
+	}
+
+	/* the GC threads are idle, so their statistics can be read from here. Reported statistics are cleared, so threads
+	 * which did not scan roots (e.g. mutators which paid concurrent mark tax) are not reported again by the next collection.
+	 */
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_RootScannerStats *stats = &MM_EnvironmentBase::getEnvironment(walkThread)->_rootScannerStats;
+		if (stats->_statsUsed) {
+			for (uintptr_t entity = 0; entity < RootScannerEntity_Count; entity++) {
+				uint64_t entityTime = stats->_entityScanTime[entity];
+				if (0 != entityTime) {
+					totalTime[entity] += entityTime;
+					maxThreadTime[entity] = OMR_MAX(maxThreadTime[entity], entityTime);
+					threadCount[entity] += 1;
+				}
+			}
+			if (stats->_maxIncrementTime > maxIncrementTime) {
+				maxIncrementTime = stats->_maxIncrementTime;
+				maxIncrementEntity = stats->_maxIncrementEntity;
+			}
+			stats->clear();
+		}
+	}
+
+	uint64_t maxIncrementMicros = omrtime_hires_delta(0, maxIncrementTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	writer->formatAndOutput(env, indent, "<root-scan longestunitentity=\"%s\" longestunitms=\"%llu.%03.3llu\">",
+			MM_RootScannerStats::getEntityName(maxIncrementEntity), maxIncrementMicros / 1000, maxIncrementMicros % 1000);
+	for (uintptr_t entity = 0; entity < RootScannerEntity_Count; entity++) {
+		if (0 != threadCount[entity]) {
+			uint64_t totalMicros = omrtime_hires_delta(0, totalTime[entity], OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t maxThreadMicros = omrtime_hires_delta(0, maxThreadTime[entity], OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(env, indent + 1, "<root-entity name=\"%s\" threads=\"%zu\" totalms=\"%llu.%03.3llu\" maxthreadms=\"%llu.%03.3llu\" />",
+					MM_RootScannerStats::getEntityName((RootScannerEntity)entity), threadCount[entity],
+					totalMicros / 1000, totalMicros % 1000, maxThreadMicros / 1000, maxThreadMicros % 1000);
+		}
+	}
+	writer->formatAndOutput(env, indent, "</root-scan>");
+}
+
+void
+MM_VerboseHandlerOutput::outputAdaptiveThreading(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t vmStateID)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_ParallelDispatcher::AdaptiveTaskHistory *history = ((MM_ParallelDispatcher *)_extensions->dispatcher)->getAdaptiveTaskHistory(vmStateID);
+
+	if (NULL != history) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		uint64_t targetMicros = _extensions->adaptiveGCThreadingTargetTime;
+		/* tasks which ignore the work unit size do not report one */
+		char workUnit[32] = "";
+		if (0 != history->workUnitSize) {
+			omrstr_printf(workUnit, sizeof(workUnit), " workunit=\"%zu\"", history->workUnitSize);
+		}
+		if (0 != history->predictedTime) {
+			writer->formatAndOutput(env, indent, "<gc-threads available=\"%zu\" chosen=\"%zu\" workestimate=\"%zu\"%s targetms=\"%llu.%03.3llu\" predictedms=\"%llu.%03.3llu\" actualms=\"%llu.%03.3llu\" />",
+					history->threadCountAvailable, history->threadCount, history->workEstimate, workUnit,
+					targetMicros / 1000, targetMicros % 1000,
+					history->predictedTime / 1000, history->predictedTime % 1000,
+					history->actualTime / 1000, history->actualTime % 1000);
+		} else {
+			/* the first adapted dispatch only measures the work rate */
+			writer->formatAndOutput(env, indent, "<gc-threads available=\"%zu\" chosen=\"%zu\" workestimate=\"%zu\"%s targetms=\"%llu.%03.3llu\" actualms=\"%llu.%03.3llu\" />",
+					history->threadCountAvailable, history->threadCount, history->workEstimate, workUnit,
+					targetMicros / 1000, targetMicros % 1000,
+					history->actualTime / 1000, history->actualTime % 1000);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 {
@@ -764,6 +888,9 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (_extensions->tlhSizeClassCache) {
+			writer->formatAndOutput(env, 1, "<size-class-cache refills=\"%zu\" allocations=\"%zu\" />", systemStats->_sizeClassCacheRefillCount, systemStats->_sizeClassCacheAllocationCount);
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -962,7 +1089,7 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
 	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
 		resizeTypeName = "release free pages";
-		reasonString = "idle";
+		reasonString = getReleaseFreePagesReasonAsString((ReleaseFreePagesReason)reason);
 	} else {
 		resizeTypeName = "unknown";
 		reasonString = "unknown";
@@ -200,6 +200,33 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output a stanza on how much of the heap, card table and mark map is backed by huge pages.
+	 * Only called when a huge page policy is in effect (see MM_HugePageManager::isReportingEnabled()).
+	 * Reports the usage as of the last sample (see MM_HugePageManager::sampleUsage()), which is not taken here.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the stanza.
+	 */
+	void outputHugePageUsage(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stanza on the root scanning time of the GC threads, per root scanner entity.
+	 * Only called when root scanner statistics are enabled (see MM_GCExtensionsBase::rootScannerStatsEnabled).
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the stanza.
+	 */
+	void outputRootScannerStats(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stanza on the thread count and work unit size adaptive GC threading chose for the last dispatch of
+	 * a type of task, and on its outcome (see MM_GCExtensionsBase::adaptiveGCThreading). Nothing is output if
+	 * the type of task was never adapted.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the stanza.
+	 * @param vmStateID VM state ID of the type of task.
+	 */
+	void outputAdaptiveThreading(MM_EnvironmentBase *env, uintptr_t indent, uintptr_t vmStateID);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
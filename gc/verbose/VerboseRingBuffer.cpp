@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseRingBuffer.hpp"
+
+#include "GCExtensionsBase.hpp"
+
+MM_VerboseRingBuffer *
+MM_VerboseRingBuffer::newInstance(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	MM_VerboseRingBuffer *ring = (MM_VerboseRingBuffer *)extensions->getForge()->allocate(sizeof(MM_VerboseRingBuffer), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != ring) {
+		new(ring) MM_VerboseRingBuffer();
+		if (!ring->initialize(env, size)) {
+			ring->kill(env);
+			ring = NULL;
+		}
+	}
+	return ring;
+}
+
+void
+MM_VerboseRingBuffer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getExtensions()->getForge()->free(this);
+}
+
+bool
+MM_VerboseRingBuffer::initialize(MM_EnvironmentBase *env, uintptr_t size)
+{
+	/* round up to a power of two so positions can be masked */
+	_size = 4096;
+	while (_size < size) {
+		_size <<= 1;
+	}
+
+	_buffer = (uint8_t *)env->getExtensions()->getForge()->allocate(_size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	return NULL != _buffer;
+}
+
+void
+MM_VerboseRingBuffer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getExtensions()->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+}
+
+void *
+MM_VerboseRingBuffer::reserve(uintptr_t size)
+{
+	uintptr_t tail = _tail;
+	uintptr_t offset = tail & (_size - 1);
+	uintptr_t contiguous = _size - offset;
+	uintptr_t padding = (contiguous < size) ? contiguous : 0;
+
+	if ((_size - (tail - _head)) < (padding + size)) {
+		return NULL;
+	}
+
+	if (0 != padding) {
+		/* published together with the record by commit() */
+		MM_VerboseBinaryRecordHeader *paddingRecord = (MM_VerboseBinaryRecordHeader *)(_buffer + offset);
+		paddingRecord->size = (uint32_t)padding;
+		paddingRecord->type = VERBOSE_RECORD_PADDING;
+		paddingRecord->indent = 0;
+		offset = 0;
+	}
+	_reservedPadding = padding;
+
+	return _buffer + offset;
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSERINGBUFFER_HPP_)
+#define VERBOSERINGBUFFER_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Lock-free single producer, single consumer ring of verbose records (see MM_VerboseBinaryRecordHeader).
+ *
+ * The producer reserves contiguous space for a record, fills it in and commits it; the consumer walks the
+ * records between its head and the committed tail and then releases them. Positions are byte counts which
+ * only grow, so the buffer is full when tail - head reaches its size. A record which does not fit before
+ * the end of the buffer is preceded by a padding record up to the end of the buffer.
+ */
+class MM_VerboseRingBuffer : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	uint8_t *_buffer; /**< the ring storage */
+	uintptr_t _size; /**< size of the ring in bytes, a power of two */
+	volatile uintptr_t _head; /**< position of the first record not yet released by the consumer */
+	volatile uintptr_t _tail; /**< position following the last record committed by the producer */
+	uintptr_t _reservedPadding; /**< size of the padding record inserted by the pending reservation */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseRingBuffer *newInstance(MM_EnvironmentBase *env, uintptr_t size);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Reserve space for a record. Producer only.
+	 * @param size[in] size of the record, a multiple of 8 and at most a quarter of the ring size
+	 * @return storage for the record, or NULL if the ring is too full
+	 */
+	void *reserve(uintptr_t size);
+
+	/**
+	 * Publish the record of the given size written to the last reservation. Producer only.
+	 */
+	MMINLINE void
+	commit(uintptr_t size)
+	{
+		/* the record must be visible before the tail which publishes it */
+		MM_AtomicOperations::writeBarrier();
+		_tail = _tail + _reservedPadding + size;
+		_reservedPadding = 0;
+	}
+
+	/**
+	 * @return the position following the last committed record. Consumer only.
+	 */
+	MMINLINE uintptr_t
+	getCommittedTail()
+	{
+		uintptr_t tail = _tail;
+		/* records up to tail must not be read before tail itself */
+		MM_AtomicOperations::readBarrier();
+		return tail;
+	}
+
+	MMINLINE uintptr_t getHead() { return _head; }
+
+	MMINLINE MM_VerboseBinaryRecordHeader *
+	getRecord(uintptr_t position)
+	{
+		return (MM_VerboseBinaryRecordHeader *)(_buffer + (position & (_size - 1)));
+	}
+
+	/**
+	 * Hand the space of all records before the given position back to the producer. Consumer only.
+	 */
+	MMINLINE void
+	release(uintptr_t position)
+	{
+		/* finish reading the records before the producer may overwrite them */
+		MM_AtomicOperations::readWriteBarrier();
+		_head = position;
+	}
+
+	MMINLINE uintptr_t getSize() { return _size; }
+	MMINLINE uintptr_t getUsed() { return _tail - _head; }
+	MMINLINE bool isEmpty() { return _tail == _head; }
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t size);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_VerboseRingBuffer()
+		: MM_Base()
+		, _buffer(NULL)
+		, _size(0)
+		, _head(0)
+		, _tail(0)
+		, _reservedPadding(0)
+	{}
+private:
+};
+
+#endif /* VERBOSERINGBUFFER_HPP_ */
@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -75,6 +77,27 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Writers which answer true are handed each line as a format string and its arguments through
+	 * recordLineV() instead of receiving the formatted output through outputString().
+	 */
+	virtual bool recordsLines() { return false; }
+
+	/**
+	 * Record one line of output (see recordsLines()).
+	 * @param env[in] the current thread
+	 * @param indent[in] indentation level of the line
+	 * @param format[in] format string, which must remain valid for the lifetime of the writer
+	 * @param args[in] the arguments of the format string
+	 */
+	virtual void recordLineV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
+	/**
+	 * Wait until all output handed to the writer so far has been written out.
+	 * @param env[in] the current thread
+	 */
+	virtual void waitForPendingOutput(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
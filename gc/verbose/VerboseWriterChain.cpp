@@ -62,12 +62,29 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
-	for (uintptr_t i = 0; i < indent; ++i) {
-		_buffer->add(env, INDENT_SPACER);
+	/* writers which record lines get the arguments as is, the others share the formatted buffer */
+	bool formatRequired = false;
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (!writer->recordsLines()) {
+			formatRequired = true;
+		} else if (writer->isActive()) {
+			va_list argsCopy;
+			COPY_VA_LIST(argsCopy, args);
+			writer->recordLineV(env, indent, format, argsCopy);
+			END_VA_LIST_COPY(argsCopy);
+		}
+		writer = writer->getNextWriter();
+	}
+
+	if (formatRequired) {
+		for (uintptr_t i = 0; i < indent; ++i) {
+			_buffer->add(env, INDENT_SPACER);
+		}
+
+		_buffer->vprintf(env, format, args);
+		_buffer->add(env, "\n");
 	}
-	
-	_buffer->vprintf(env, format, args);
-	_buffer->add(env, "\n");
 }
 
 void
@@ -85,7 +102,9 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (!writer->recordsLines()) {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
@@ -143,4 +162,12 @@ MM_VerboseWriterChain::endOfCycle(MM_EnvironmentBase *env)
 	}
 }
 
-
+void
+MM_VerboseWriterChain::waitForPendingOutput(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		writer->waitForPendingOutput(env);
+		writer = writer->getNextWriter();
+	}
+}
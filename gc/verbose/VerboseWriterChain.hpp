@@ -72,6 +72,12 @@ public:
 	 * @param env[in] the current thread 
 	 */
 	void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until each of the writers in the chain has written out the output it was handed.
+	 * @param env[in] the current thread
+	 */
+	void waitForPendingOutput(MM_EnvironmentBase *env);
 	
 protected:
 	MM_VerboseWriterChain();
@@ -0,0 +1,652 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrutil.h"
+
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseRingBuffer.hpp"
+
+#undef _UTE_MODULE_HEADER_
+#undef UT_MODULE_LOADED
+#undef UT_MODULE_UNLOADED
+#include "ut_j9vgc.h"
+
+#include <string.h>
+
+/* size of the scratch buffer a line is encoded into, which bounds the size of a record */
+#define RECORD_BUFFER_SIZE 4096
+/* how often the drain thread wakes up when nobody asks it to */
+#define DRAIN_INTERVAL_MILLIS 100
+#define DROPPED_RECORDS_COMMENT "<!-- %zu verbose records dropped -->\n"
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileStream(NULL)
+	,_outputStream(NULL)
+	,_binary(env->getExtensions()->binaryLogging)
+	,_ring(NULL)
+	,_recordBuffer(NULL)
+	,_producerMonitor(NULL)
+	,_formats(NULL)
+	,_droppedRecords(0)
+	,_reportedDroppedRecords(0)
+	,_drainRequested(false)
+	,_drainMonitor(NULL)
+	,_drainThreadState(STATE_NOT_STARTED)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance and starts the drain thread.
+ * Also called when the writer is reconfigured, once the drain thread has been stopped.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _drainMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_drainMonitor")) {
+			_drainMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (NULL == _producerMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_producerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_producerMonitor")) {
+			_producerMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (NULL == _ring) {
+		_ring = MM_VerboseRingBuffer::newInstance(env, extensions->asynchronousLoggingBufferSize);
+		if (NULL == _ring) {
+			return false;
+		}
+	}
+
+	if (NULL == _recordBuffer) {
+		_recordBuffer = (uint8_t *)extensions->getForge()->allocate(RECORD_BUFFER_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _recordBuffer) {
+			return false;
+		}
+	}
+
+	if (_binary && (NULL == _formats)) {
+		_formats = (const char **)extensions->getForge()->allocate(sizeof(const char *) * VERBOSE_BINARY_MAX_FORMATS, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _formats) {
+			return false;
+		}
+		memset((void *)_formats, 0, sizeof(const char *) * VERBOSE_BINARY_MAX_FORMATS);
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startDrainThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the drain thread if it is still running.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	stopDrainThread(env);
+
+	if (NULL != _drainMonitor) {
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+	if (NULL != _producerMonitor) {
+		omrthread_monitor_destroy(_producerMonitor);
+		_producerMonitor = NULL;
+	}
+	if (NULL != _ring) {
+		_ring->kill(env);
+		_ring = NULL;
+	}
+	extensions->getForge()->free(_recordBuffer);
+	_recordBuffer = NULL;
+	extensions->getForge()->free((void *)_formats);
+	_formats = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the header.
+ * Called on the drain thread, or before it is started.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (_binary) {
+		MM_VerboseBinaryFileHeader fileHeader;
+		memset(&fileHeader, 0, sizeof(fileHeader));
+		strcpy(fileHeader.magic, VERBOSE_BINARY_MAGIC);
+		fileHeader.version = VERBOSE_BINARY_VERSION;
+		fileHeader.byteOrderMark = VERBOSE_BINARY_BYTE_ORDER_MARK;
+		fileHeader.pointerSize = sizeof(uintptr_t);
+		omrfilestream_write(_logFileStream, &fileHeader, sizeof(fileHeader));
+
+		/* every file defines the formats it uses, so each of the rotating files can be decoded on its own */
+		memset((void *)_formats, 0, sizeof(const char *) * VERBOSE_BINARY_MAX_FORMATS);
+
+		const char *header = getHeader(env);
+		writeFileRecord(env, VERBOSE_RECORD_TEXT, header, strlen(header) + 1, NULL, 0);
+	} else {
+		const char *header = getHeader(env);
+		omrfilestream_write_text(_logFileStream, header, strlen(header), J9STR_CODE_PLATFORM_RAW);
+	}
+
+	return true;
+}
+
+/**
+ * Writes the footer and closes the file being logged to.
+ * Called on the drain thread, or once it has stopped.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		const char *footer = getFooter(env);
+		if (_binary) {
+			writeFileRecord(env, VERBOSE_RECORD_TEXT, footer, strlen(footer), "\n", sizeof("\n"));
+		} else {
+			omrfilestream_write_text(_logFileStream, footer, strlen(footer), J9STR_CODE_PLATFORM_RAW);
+			omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		}
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	omrthread_monitor_enter(_producerMonitor);
+	publishRecord(env, VERBOSE_RECORD_TEXT, 0, string, strlen(string) + 1);
+	omrthread_monitor_exit(_producerMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::recordLineV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	uint64_t formatAddress = (uint64_t)(uintptr_t)format;
+	uintptr_t argumentsOffset = sizeof(MM_VerboseBinaryRecordHeader) + sizeof(formatAddress);
+	va_list argsCopy;
+
+	omrthread_monitor_enter(_producerMonitor);
+
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t argumentsSize = MM_VerboseBinaryFormat::encodeArguments(format, argsCopy, _recordBuffer + argumentsOffset, RECORD_BUFFER_SIZE - argumentsOffset);
+	END_VA_LIST_COPY(argsCopy);
+
+	if (VERBOSE_BINARY_ENCODING_FAILED != argumentsSize) {
+		memcpy(_recordBuffer + sizeof(MM_VerboseBinaryRecordHeader), &formatAddress, sizeof(formatAddress));
+		publishRecord(env, VERBOSE_RECORD_LINE, indent, NULL, argumentsOffset + argumentsSize - sizeof(MM_VerboseBinaryRecordHeader));
+	} else {
+		/* the format is not supported by the encoding (or the line is very long): format it now */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		char *text = (char *)(_recordBuffer + sizeof(MM_VerboseBinaryRecordHeader));
+		uintptr_t capacity = RECORD_BUFFER_SIZE - sizeof(MM_VerboseBinaryRecordHeader) - 1;
+		uintptr_t length = 0;
+		for (uintptr_t i = 0; (i < indent) && ((length + 2) < capacity); i++) {
+			text[length++] = ' ';
+			text[length++] = ' ';
+		}
+		COPY_VA_LIST(argsCopy, args);
+		length += omrstr_vprintf(text + length, capacity - length, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+		if (length > (capacity - 1)) {
+			length = capacity - 1;
+		}
+		text[length++] = '\n';
+		text[length++] = '\0';
+		publishRecord(env, VERBOSE_RECORD_TEXT, 0, NULL, length);
+	}
+
+	omrthread_monitor_exit(_producerMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::publishRecord(MM_EnvironmentBase *env, uintptr_t type, uintptr_t indent, const void *payload, uintptr_t payloadSize)
+{
+	uintptr_t size = MM_VerboseBinaryFormat::alignRecordSize(sizeof(MM_VerboseBinaryRecordHeader) + payloadSize);
+	void *record = NULL;
+
+	if (size <= (_ring->getSize() / 4)) {
+		record = _ring->reserve(size);
+	}
+
+	if (NULL == record) {
+		_droppedRecords += 1;
+		requestDrain(env);
+	} else {
+		MM_VerboseBinaryRecordHeader header;
+		header.size = (uint32_t)size;
+		header.type = (uint16_t)type;
+		header.indent = (uint16_t)indent;
+		memcpy(record, &header, sizeof(header));
+		uint8_t *recordPayload = (uint8_t *)record + sizeof(header);
+		if (NULL == payload) {
+			/* the payload was encoded in the scratch buffer */
+			payload = _recordBuffer + sizeof(header);
+		}
+		memcpy(recordPayload, payload, payloadSize);
+		memset(recordPayload + payloadSize, 0, size - sizeof(header) - payloadSize);
+		_ring->commit(size);
+
+		if (_ring->getUsed() > (_ring->getSize() / 2)) {
+			/* do not wait for the drain interval if the ring is filling up */
+			requestDrain(env);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::requestDrain(MM_EnvironmentBase *env)
+{
+	if (!_drainRequested) {
+		_drainRequested = true;
+		omrthread_monitor_enter(_drainMonitor);
+		omrthread_monitor_notify_all(_drainMonitor);
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+/**
+ * Queue the end of a cycle, which makes the drain thread rotate files, and wake the drain thread
+ * up since the collection is over.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_producerMonitor);
+	publishRecord(env, VERBOSE_RECORD_END_OF_CYCLE, 0, NULL, 0);
+	omrthread_monitor_exit(_producerMonitor);
+	requestDrain(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForPendingOutput(MM_EnvironmentBase *env)
+{
+	uintptr_t tail = _ring->getCommittedTail();
+
+	omrthread_monitor_enter(_drainMonitor);
+	while ((STATE_RUNNING == _drainThreadState) && ((intptr_t)(tail - _ring->getHead()) > 0)) {
+		_drainRequested = true;
+		omrthread_monitor_notify_all(_drainMonitor);
+		omrthread_monitor_wait(_drainMonitor);
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+/**
+ * Stops the drain thread once it has written out everything recorded, and closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	stopDrainThread(env);
+	/* nothing is left to write unless the drain thread failed to start */
+	drain(env);
+	closeFile(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations)
+{
+	/* output recorded so far goes to the old file, initialize() restarts the drain thread */
+	stopDrainThread(env);
+	drain(env);
+	return MM_VerboseWriterFileLogging::reconfigure(env, filename, fileCount, iterations);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startDrainThread(MM_EnvironmentBase *env)
+{
+	/* hold the monitor over start-up of the thread so it cannot notify us of its state before we wait */
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		drain_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _drainThreadState) {
+			omrthread_monitor_wait(_drainMonitor);
+		}
+	} else {
+		_drainThreadState = STATE_ERROR;
+	}
+	bool result = (STATE_RUNNING == _drainThreadState);
+	omrthread_monitor_exit(_drainMonitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopDrainThread(MM_EnvironmentBase *env)
+{
+	if (NULL != _drainMonitor) {
+		/* tell the drain thread to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_drainMonitor);
+		if (STATE_RUNNING == _drainThreadState) {
+			_drainThreadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_drainMonitor);
+			while (STATE_TERMINATED != _drainThreadState) {
+				omrthread_monitor_wait(_drainMonitor);
+			}
+		}
+		omrthread_monitor_exit(_drainMonitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::drain_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->drainThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainThreadEntryPoint()
+{
+	/* the drain thread is not attached to the VM, it only needs the port library and the forge */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_drainMonitor);
+	while (STATE_TERMINATION_REQUESTED != _drainThreadState) {
+		omrthread_monitor_exit(_drainMonitor);
+		drain(&env);
+		omrthread_monitor_enter(_drainMonitor);
+		/* wake up threads waiting for pending output */
+		omrthread_monitor_notify_all(_drainMonitor);
+		if ((STATE_TERMINATION_REQUESTED != _drainThreadState) && !_drainRequested) {
+			omrthread_monitor_wait_timed(_drainMonitor, DRAIN_INTERVAL_MILLIS, 0);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	/* write out whatever was recorded before the termination request */
+	drain(&env);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t position = _ring->getHead();
+	uintptr_t tail = _ring->getCommittedTail();
+	bool written = false;
+
+	_drainRequested = false;
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _reportedDroppedRecords) {
+		writeDroppedRecords(env, droppedRecords - _reportedDroppedRecords);
+		_reportedDroppedRecords = droppedRecords;
+		written = true;
+	}
+
+	while (position != tail) {
+		MM_VerboseBinaryRecordHeader *record = _ring->getRecord(position);
+		switch (record->type) {
+		case VERBOSE_RECORD_END_OF_CYCLE:
+			if (written && (NULL != _logFileStream)) {
+				omrfilestream_sync(_logFileStream);
+			}
+			written = false;
+			/* rotates to the next file if required, which is then opened by the next write */
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+			break;
+		case VERBOSE_RECORD_LINE:
+		case VERBOSE_RECORD_TEXT:
+			writeRecord(env, record);
+			written = true;
+			break;
+		default:
+			/* padding */
+			break;
+		}
+		position += record->size;
+	}
+	_ring->release(position);
+
+	if (written && (NULL != _logFileStream)) {
+		omrfilestream_sync(_logFileStream);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeRecord(MM_EnvironmentBase *env, MM_VerboseBinaryRecordHeader *record)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		/* we open the file when output arrives so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	uint8_t *payload = (uint8_t *)(record + 1);
+	uintptr_t payloadSize = record->size - sizeof(MM_VerboseBinaryRecordHeader);
+
+	if (_binary) {
+		if (NULL != _logFileStream) {
+			if (VERBOSE_RECORD_LINE == record->type) {
+				/* replace the address of the format with its id in this file */
+				uint64_t formatAddress = 0;
+				memcpy(&formatAddress, payload, sizeof(formatAddress));
+				uint64_t formatId = defineFormat(env, (const char *)(uintptr_t)formatAddress);
+				if (VERBOSE_BINARY_MAX_FORMATS == formatId) {
+					writeDroppedRecords(env, 1);
+					return;
+				}
+				memcpy(payload, &formatId, sizeof(formatId));
+			}
+			omrfilestream_write(_logFileStream, record, record->size);
+		}
+	} else {
+		_outputStream = (NULL != _logFileStream) ? _logFileStream : OMRPORT_STREAM_ERR;
+		if (VERBOSE_RECORD_TEXT == record->type) {
+			writeText(this, (const char *)payload, strlen((const char *)payload));
+		} else {
+			uint64_t formatAddress = 0;
+			memcpy(&formatAddress, payload, sizeof(formatAddress));
+			for (uintptr_t i = 0; i < record->indent; i++) {
+				writeText(this, VERBOSE_BINARY_INDENT_SPACER, strlen(VERBOSE_BINARY_INDENT_SPACER));
+			}
+			MM_VerboseBinaryFormat::decodeLine((const char *)(uintptr_t)formatAddress, payload + sizeof(formatAddress), payloadSize - sizeof(formatAddress), sizeof(uintptr_t), writeText, formatText, this);
+			writeText(this, "\n", 1);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeDroppedRecords(MM_EnvironmentBase *env, uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		openFile(env);
+	}
+
+	if (NULL != _logFileStream) {
+		if (_binary) {
+			uint64_t droppedCount = count;
+			writeFileRecord(env, VERBOSE_RECORD_DROPPED, &droppedCount, sizeof(droppedCount), NULL, 0);
+		} else {
+			omrfilestream_printf(_logFileStream, DROPPED_RECORDS_COMMENT, count);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeFileRecord(MM_EnvironmentBase *env, uintptr_t type, const void *payload, uintptr_t payloadSize, const void *trailer, uintptr_t trailerSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t unpaddedSize = sizeof(MM_VerboseBinaryRecordHeader) + payloadSize + trailerSize;
+	uintptr_t size = MM_VerboseBinaryFormat::alignRecordSize(unpaddedSize);
+	const uint64_t padding = 0;
+
+	MM_VerboseBinaryRecordHeader header;
+	header.size = (uint32_t)size;
+	header.type = (uint16_t)type;
+	header.indent = 0;
+
+	omrfilestream_write(_logFileStream, &header, sizeof(header));
+	omrfilestream_write(_logFileStream, payload, payloadSize);
+	if (0 != trailerSize) {
+		omrfilestream_write(_logFileStream, trailer, trailerSize);
+	}
+	if (size != unpaddedSize) {
+		omrfilestream_write(_logFileStream, &padding, size - unpaddedSize);
+	}
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::defineFormat(MM_EnvironmentBase *env, const char *format)
+{
+	/* open addressing on the format address, the slot index is the format id */
+	uintptr_t slot = (((uintptr_t)format >> 3) * 31) & (VERBOSE_BINARY_MAX_FORMATS - 1);
+	for (uintptr_t probes = 0; probes < VERBOSE_BINARY_MAX_FORMATS; probes++) {
+		if (format == _formats[slot]) {
+			return slot;
+		}
+		if (NULL == _formats[slot]) {
+			_formats[slot] = format;
+			uint64_t formatId = slot;
+			writeFileRecord(env, VERBOSE_RECORD_FORMAT, &formatId, sizeof(formatId), format, strlen(format) + 1);
+			return slot;
+		}
+		slot = (slot + 1) & (VERBOSE_BINARY_MAX_FORMATS - 1);
+	}
+	return VERBOSE_BINARY_MAX_FORMATS;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(void *userData, const char *text, uintptr_t length)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)userData;
+	OMRPORT_ACCESS_FROM_OMRVM(writer->_omrVM);
+
+	if (0 != length) {
+		omrfilestream_write_text(writer->_outputStream, text, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::formatText(void *userData, char *buffer, uintptr_t length, const char *format, ...)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)userData;
+	OMRPORT_ACCESS_FROM_OMRVM(writer->_omrVM);
+	va_list args;
+
+	va_start(args, format);
+	uintptr_t result = omrstr_vprintf(buffer, length, format, args);
+	va_end(args);
+
+	return result;
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseRingBuffer;
+struct MM_VerboseBinaryRecordHeader;
+
+/**
+ * Output agent which directs verbosegc output to file without doing any formatting or I/O on the
+ * thread producing the output.
+ *
+ * Each line is recorded as its format string and the raw values of its arguments (see MM_VerboseBinaryFormat)
+ * into a ring buffer. A background thread drains the ring, either formatting the lines into the usual XML
+ * log or writing the records as they are into a binary log which tools/vgcdecode turns back into XML.
+ *
+ * Lines may be output by any thread (GC threads, or mutators reporting concurrent events), so producers are
+ * serialized by _producerMonitor: the ring has a single producer at a time and the producers share one scratch
+ * buffer. When the ring is full records are dropped and the number of dropped records is reported in the log.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum {
+		STATE_NOT_STARTED = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+		STATE_ERROR
+	} DrainThreadState;
+
+	OMR_VM *_omrVM; /**< the VM the drain thread creates its environment for */
+	OMRFileStream *_logFileStream; /**< the filestream being written to */
+	OMRFileStream *_outputStream; /**< stream lines are decoded to (the log, or stderr if it could not be opened) */
+	bool _binary; /**< write binary records instead of XML */
+	MM_VerboseRingBuffer *_ring; /**< records waiting to be written */
+	uint8_t *_recordBuffer; /**< scratch space the producer encodes a line into */
+	omrthread_monitor_t _producerMonitor; /**< serializes the producers of the ring, which share _recordBuffer */
+	const char **_formats; /**< format strings already defined in the current binary log, indexed by format id */
+	volatile uintptr_t _droppedRecords; /**< records the producer could not fit in the ring */
+	uintptr_t _reportedDroppedRecords; /**< dropped records the drain thread has reported in the log */
+	volatile bool _drainRequested; /**< the producer asked the drain thread to run early */
+	omrthread_monitor_t _drainMonitor; /**< protects the drain thread state and wakes up the drain thread */
+	volatile DrainThreadState _drainThreadState; /**< state of the drain thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual bool recordsLines() { return true; }
+	virtual void recordLineV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+	virtual void waitForPendingOutput(MM_EnvironmentBase *env);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void closeStream(MM_EnvironmentBase *env);
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations);
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy a record from the scratch buffer (or the given text) into the ring, counting it as dropped if it does not fit.
+	 */
+	void publishRecord(MM_EnvironmentBase *env, uintptr_t type, uintptr_t indent, const void *payload, uintptr_t payloadSize);
+	void requestDrain(MM_EnvironmentBase *env);
+
+	bool startDrainThread(MM_EnvironmentBase *env);
+	void stopDrainThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC drain_thread_proc(void *info);
+	void drainThreadEntryPoint();
+
+	/**
+	 * Write out all records committed to the ring. Drain thread only (or once the drain thread has stopped).
+	 */
+	void drain(MM_EnvironmentBase *env);
+	void writeRecord(MM_EnvironmentBase *env, MM_VerboseBinaryRecordHeader *record);
+	void writeDroppedRecords(MM_EnvironmentBase *env, uintptr_t count);
+	void writeFileRecord(MM_EnvironmentBase *env, uintptr_t type, const void *payload, uintptr_t payloadSize, const void *trailer, uintptr_t trailerSize);
+
+	/**
+	 * Find the id of a format string in the current binary log, defining it if it is new.
+	 * @return the format id, or VERBOSE_BINARY_MAX_FORMATS if the format table is full
+	 */
+	uintptr_t defineFormat(MM_EnvironmentBase *env, const char *format);
+
+	static void writeText(void *userData, const char *text, uintptr_t length);
+	static uintptr_t formatText(void *userData, char *buffer, uintptr_t length, const char *format, ...);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -23,10 +23,14 @@
 #include "omrcfg.h"
 
 #include "omrgcconsts.h"
+#include "omrmodroncore.h"
 #include "gcutils.h"
 
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
+#if defined(OMR_GC_VLHGC)
+#include "CopyForwardStatsCore.hpp"
+#endif /* defined(OMR_GC_VLHGC) */
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
@@ -55,6 +59,10 @@ static void verboseHandlerCompactStart(J9HookInterface** hook, uintptr_t eventNu
 static void verboseHandlerCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
+#if defined(OMR_GC_VLHGC)
+static void verboseHandlerCopyForwardEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_VLHGC) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 static void verboseHandlerScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerScavengePercolate(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
@@ -137,6 +145,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseHandlerCompactEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_VLHGC)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerScavengeEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_PERCOLATE_COLLECT, verboseHandlerScavengePercolate, OMR_GET_CALLSITE(), (void *)this);
@@ -195,6 +206,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseHandlerCompactEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_VLHGC)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, NULL);
+#endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerScavengeEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_PERCOLATE_COLLECT, verboseHandlerScavengePercolate, NULL);
@@ -238,6 +252,15 @@ MM_VerboseHandlerOutputStandard::getCycleType(uintptr_t type)
 	case OMR_GC_CYCLE_TYPE_EPSILON:
 		cycleType = "epsilon";
 		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_PARTIAL_GARBAGE_COLLECT:
+		cycleType = "partial gc";
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_MARK_PHASE:
+		cycleType = "global mark phase";
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_GARBAGE_COLLECT:
+		cycleType = "global garbage collect";
+		break;
 	default:
 		cycleType = "unknown";
 		break;
@@ -304,6 +327,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (0 != markStats->_minorCollections) {
+		writer->formatAndOutput(env, 1, "<minor-collection count=\"%zu\" rememberedobjects=\"%zu\" />",
+				markStats->_minorCollections, markStats->_rememberedObjects);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+	if (extensions->rootScannerStatsEnabled) {
+		outputRootScannerStats(env, 1);
+	}
+	if (extensions->adaptiveGCThreading) {
+		outputAdaptiveThreading(env, 1, OMRVMSTATE_GC_MARK);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -328,10 +363,26 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
-	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	bool reportLazySweep = false;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	reportLazySweep = (0 != sweepStats->_lazySweepAllocationRegions) || (0 != sweepStats->_lazySweepLeftoverRegions);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
-	handleSweepEndInternal(env, eventData);
+	enterAtomicReportingBlock();
+	if (reportLazySweep) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		writer->formatAndOutput(env, 1, "<lazy-sweep allocationregions=\"%zu\" leftoverregions=\"%zu\" />",
+				sweepStats->_lazySweepAllocationRegions, sweepStats->_lazySweepLeftoverRegions);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -379,6 +430,12 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_windowSize) {
+			writer->formatAndOutput(env, 1, "<partial-compact windowbytes=\"%zu\" movebudget=\"%zu\" />", compactStats->_windowSize, MM_GCExtensionsBase::getExtensions(env->getOmrVM())->partialCompactMoveBudget);
+		}
+		if (0 != compactStats->_slidingWindows) {
+			writer->formatAndOutput(env, 1, "<compact-sliding windows=\"%zu\" />", compactStats->_slidingWindows);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -399,6 +456,53 @@ MM_VerboseHandlerOutputStandard::handleCompactEndInternal(MM_EnvironmentBase* en
 
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
+#if defined(OMR_GC_VLHGC)
+void
+MM_VerboseHandlerOutputStandard::handleCopyForwardEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CopyForwardStatsCore *copyForwardStats = (MM_CopyForwardStatsCore *)event->copyForwardStats;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, copyForwardStats->_startTime, copyForwardStats->_endTime);
+
+	enterAtomicReportingBlock();
+	handleGCOPOuterStanzaStart(env, "copy forward", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+
+	writer->formatAndOutput(env, 1, "<memory-copied type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
+			copyForwardStats->_copyObjectsEden, copyForwardStats->_copyBytesEden);
+	writer->formatAndOutput(env, 1, "<memory-copied type=\"other\" objects=\"%zu\" bytes=\"%zu\" />",
+			copyForwardStats->_copyObjectsNonEden, copyForwardStats->_copyBytesNonEden);
+	writer->formatAndOutput(env, 1, "<regions eden=\"%zu\" other=\"%zu\" survivor=\"%zu\" />",
+			copyForwardStats->_edenEvacuateRegionCount, copyForwardStats->_nonEdenEvacuateRegionCount, copyForwardStats->_nonEdenSurvivorRegionCount);
+	if (copyForwardStats->_aborted) {
+		/* objects left in place because the survivor regions ran out */
+		writer->formatAndOutput(env, 1, "<memory-traced type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
+				copyForwardStats->_scanObjectsEden, copyForwardStats->_scanBytesEden);
+		writer->formatAndOutput(env, 1, "<memory-traced type=\"other\" objects=\"%zu\" bytes=\"%zu\" />",
+				copyForwardStats->_scanObjectsNonEden, copyForwardStats->_scanBytesNonEden);
+	}
+
+	if (_extensions->rootScannerStatsEnabled) {
+		outputRootScannerStats(env, 1);
+	}
+
+	handleCopyForwardEndInternal(env, eventData);
+
+	handleGCOPOuterStanzaEnd(env);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleCopyForwardEndInternal(MM_EnvironmentBase* env, void* eventData)
+{
+	/* Empty stub */
+}
+#endif /* defined(OMR_GC_VLHGC) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
@@ -419,6 +523,11 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		if (0 != cycleScavengerStats->_tenureDecisionAge) {
+			writer->formatAndOutput(env, 1, "<tenure-decision tenureage=\"%zu\" copybytes=\"%zu\" prematuretenurebytes=\"%zu\" survivorbytes=\"%zu\" />",
+					cycleScavengerStats->_tenureDecisionAge, cycleScavengerStats->_tenureDecisionCopyBytes,
+					cycleScavengerStats->_tenureDecisionPrematureTenureBytes, cycleScavengerStats->_tenureDecisionSurvivorBytes);
+		}
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -429,6 +538,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if ((0 != scavengerStats->_numaLocalChunkCount) || (0 != scavengerStats->_numaRemoteChunkCount)) {
+		writer->formatAndOutput(env, 1, "<numa-copy-chunks local=\"%zu\" remote=\"%zu\" />",
+				scavengerStats->_numaLocalChunkCount, scavengerStats->_numaRemoteChunkCount);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -438,6 +551,13 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
 
+	if (_extensions->rootScannerStatsEnabled) {
+		outputRootScannerStats(env, 1);
+	}
+	if (_extensions->adaptiveGCThreading) {
+		outputAdaptiveThreading(env, 1, OMRVMSTATE_GC_SCAVENGE);
+	}
+
 	handleScavengeEndInternal(env, eventData);
 	
 	if(0 != scavengerStats->_tenureExpandedCount) {
@@ -865,7 +985,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -909,7 +1029,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
@@ -1043,6 +1163,14 @@ verboseHandlerCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* event
 }
 #endif /*OMR_GC_MODRON_COMPACTION*/
 
+#if defined(OMR_GC_VLHGC)
+void
+verboseHandlerCopyForwardEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleCopyForwardEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_VLHGC) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 verboseHandlerScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
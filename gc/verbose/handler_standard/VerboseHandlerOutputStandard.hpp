@@ -67,6 +67,9 @@ protected:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	virtual void handleCompactEndInternal(MM_EnvironmentBase* env, void* eventData);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_VLHGC)
+	virtual void handleCopyForwardEndInternal(MM_EnvironmentBase* env, void* eventData);
+#endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	virtual void handleScavengeEndInternal(MM_EnvironmentBase* env, void* eventData);
 	virtual void handleScavengePercolateInternal(MM_EnvironmentBase* env, void* eventData);
@@ -121,6 +124,16 @@ public:
 	void handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
+#if defined(OMR_GC_VLHGC)
+	/**
+	 * Write verbose stanza for a copy forward end event.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleCopyForwardEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_VLHGC) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/**
 	 * Write verbose stanza for a scavenge end event.
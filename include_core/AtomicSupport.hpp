@@ -156,6 +156,24 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
 	}
 
+	/**
+	 * If the CPU supports it, emit an instruction to prefetch the cache line containing
+	 * the given address in anticipation of a read. This is only a hint and never faults.
+	 *
+	 * @param address The address to prefetch
+	 */
+	VMINLINE static void
+	prefetch(const void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(__GNUC__)
+		__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(J9X86) || defined(J9HAMMER)) /* defined(__GNUC__) */
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#endif /* defined(__GNUC__) */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
 	/**
 	 * Prevents compiler reordering of reads and writes across the barrier.
 	 * This does not prevent processor reordering.
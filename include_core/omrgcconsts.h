@@ -257,8 +257,12 @@ struct ModronLnrlOptions {
 #define MINIMUM_TLHSIZE_MULTIPLIER				2
 #define MINIMUM_CONTRACTION_RATIO_DIVISOR		100
 #define MINIMUM_CONTRACTION_RATIO_MULTIPLIER	10
+#define SPLIT_FREE_LIST_THREADS_PER_LIST		2 /* allocating threads per list an adaptive split free list aims for */
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define COMPACT_INITIAL_MOVE_RATE	((uintptr_t)256) /* bytes per microsecond assumed by a partial compaction until one has been measured */
+#define COMPACT_SLIDING_BLOCK_SIZE	((uintptr_t)(64*1024)) /* unit of work of a sliding compaction, a multiple of the compact table page */
+#define COMPACT_SLIDING_WINDOW_SIZE	DESIRED_SUBAREA_SIZE /* each window of a sliding compaction is compacted towards its own base */
 
 typedef enum {
 	COMPACT_NONE = 0,
@@ -393,6 +397,11 @@ typedef enum {
 	HEAP_RELEASE_FREE_PAGES
 } HeapResizeType;
 
+typedef enum {
+	RELEASE_FREE_PAGES_IDLE = 1,
+	RELEASE_FREE_PAGES_AFTER_GLOBAL_GC
+} ReleaseFreePagesReason;
+
 typedef enum {
 	NO_CONTRACT = 1,
 	GC_RATIO_TOO_LOW,
@@ -439,6 +439,7 @@ typedef struct OMRCgroupMetricIteratorState {
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
+#define OMRPORT_VMEM_NO_ADVISE_HUGEPAGE 256
 
 /**
  * @name Virtual Memory Address
@@ -0,0 +1,416 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "omrthread.h"
+
+#include "verboseGCLogAnalyzer.hpp"
+
+/**
+ * Rotated verbose GC logs are analyzed in parallel, one file per worker at a time.
+ */
+struct AnalysisTask {
+	OMRPortLibrary *portLibrary;
+	std::vector<std::string> *files;
+	std::vector<VerboseGCLogAnalysis> *results;
+	uintptr_t nextFile; /**< index of the next file to analyze, protected by monitor */
+	omrthread_monitor_t monitor;
+};
+
+static const char *
+findAttribute(const VerboseGCLogAttribute *attributes, uintptr_t attributeCount, const char *name)
+{
+	for (uintptr_t i = 0; i < attributeCount; i++) {
+		if (0 == strcmp(attributes[i].name, name)) {
+			return attributes[i].value;
+		}
+	}
+	return NULL;
+}
+
+static double
+getDoubleAttribute(const VerboseGCLogAttribute *attributes, uintptr_t attributeCount, const char *name)
+{
+	const char *value = findAttribute(attributes, attributeCount, name);
+	return (NULL == value) ? 0.0 : strtod(value, NULL);
+}
+
+static uint64_t
+getUnsignedAttribute(const VerboseGCLogAttribute *attributes, uintptr_t attributeCount, const char *name)
+{
+	const char *value = findAttribute(attributes, attributeCount, name);
+	return (NULL == value) ? 0 : strtoull(value, NULL, 10);
+}
+
+static bool
+compareAllocationSamples(const VerboseGCLogAllocationSample &left, const VerboseGCLogAllocationSample &right)
+{
+	return left.timestamp < right.timestamp;
+}
+
+/**
+ * Nearest-rank percentile of sorted values.
+ */
+static double
+percentile(const std::vector<double> *values, double fraction)
+{
+	uintptr_t count = values->size();
+	uintptr_t rank = (uintptr_t)(fraction * count);
+	if (((double)rank) < (fraction * count)) {
+		rank += 1;
+	}
+	return (*values)[(0 == rank) ? 0 : (OMR_MIN(rank, count) - 1)];
+}
+
+VerboseGCLogSummary
+VerboseGCLogSummary::summarize(std::vector<double> *values)
+{
+	VerboseGCLogSummary summary;
+	memset(&summary, 0, sizeof(summary));
+
+	if (!values->empty()) {
+		std::sort(values->begin(), values->end());
+		summary.count = values->size();
+		for (std::vector<double>::const_iterator it = values->begin(); it != values->end(); ++it) {
+			summary.total += *it;
+		}
+		summary.mean = summary.total / summary.count;
+		summary.p50 = percentile(values, 0.50);
+		summary.p99 = percentile(values, 0.99);
+		summary.p999 = percentile(values, 0.999);
+		summary.max = values->back();
+	}
+
+	return summary;
+}
+
+void
+VerboseGCLogAnalyzer::startElement(const char *name, const VerboseGCLogAttribute *attributes, uintptr_t attributeCount)
+{
+	if (0 == strcmp(name, "exclusive-end")) {
+		_analysis->pauses.push_back(getDoubleAttribute(attributes, attributeCount, "durationms"));
+	} else if (0 == strcmp(name, "gc-end")) {
+		const char *type = findAttribute(attributes, attributeCount, "type");
+		if (NULL != type) {
+			_analysis->collections[type].push_back(getDoubleAttribute(attributes, attributeCount, "durationms"));
+		}
+	} else if (0 == strcmp(name, "gc-op")) {
+		const char *type = findAttribute(attributes, attributeCount, "type");
+		if (NULL != type) {
+			_phaseType = type;
+			_phaseTimeMs = getDoubleAttribute(attributes, attributeCount, "timems");
+			_phaseBytes = 0;
+			_analysis->phases[type].push_back(_phaseTimeMs);
+		}
+	} else if (0 == strcmp(name, "trace-info")) {
+		_phaseBytes += getUnsignedAttribute(attributes, attributeCount, "scanbytes");
+	} else if (0 == strcmp(name, "memory-copied")) {
+		_phaseBytes += getUnsignedAttribute(attributes, attributeCount, "bytes");
+	} else if (0 == strcmp(name, "compact-info")) {
+		_phaseBytes += getUnsignedAttribute(attributes, attributeCount, "movebytes");
+	} else if (0 == strcmp(name, "gc-start")) {
+		_expectHeapInfo = true;
+	} else if (0 == strcmp(name, "mem-info")) {
+		if (_expectHeapInfo) {
+			_heapTotalBytes = getUnsignedAttribute(attributes, attributeCount, "total");
+			_expectHeapInfo = false;
+		}
+	} else if (0 == strcmp(name, "cycle-start")) {
+		const char *timestamp = findAttribute(attributes, attributeCount, "timestamp");
+		_cycleTimestamp = (NULL == timestamp) ? "" : timestamp;
+		_cycleIntervalMs = getDoubleAttribute(attributes, attributeCount, "intervalms");
+	} else if (0 == strcmp(name, "allocation-stats")) {
+		const char *totalBytes = findAttribute(attributes, attributeCount, "totalBytes");
+		if (NULL != totalBytes) {
+			VerboseGCLogAllocationSample sample;
+			sample.timestamp = _cycleTimestamp;
+			sample.intervalMs = _cycleIntervalMs;
+			sample.allocatedBytes = strtoull(totalBytes, NULL, 10);
+			_analysis->allocations.push_back(sample);
+		}
+	}
+}
+
+void
+VerboseGCLogAnalyzer::endElement(const char *name)
+{
+	if ((0 == strcmp(name, "gc-op")) && !_phaseType.empty()) {
+		if (0 == strcmp(_phaseType.c_str(), "sweep")) {
+			_phaseBytes = _heapTotalBytes;
+		}
+		if ((0 != _phaseBytes) && (0 < _phaseTimeMs)) {
+			VerboseGCLogThroughput *throughput = &_analysis->throughput[_phaseType];
+			throughput->rates.push_back((_phaseBytes / (1024.0 * 1024.0)) / (_phaseTimeMs / 1000.0));
+			throughput->bytes += (double)_phaseBytes;
+			throughput->timeMs += _phaseTimeMs;
+		}
+		_phaseType.clear();
+	}
+}
+
+static void
+appendDurations(VerboseGCLogAnalysis::DurationsByType *target, VerboseGCLogAnalysis::DurationsByType *source)
+{
+	for (VerboseGCLogAnalysis::DurationsByType::iterator it = source->begin(); it != source->end(); ++it) {
+		std::vector<double> *values = &(*target)[it->first];
+		values->insert(values->end(), it->second.begin(), it->second.end());
+	}
+}
+
+void
+VerboseGCLogAnalysis::merge(VerboseGCLogAnalysis *other)
+{
+	pauses.insert(pauses.end(), other->pauses.begin(), other->pauses.end());
+	appendDurations(&collections, &other->collections);
+	appendDurations(&phases, &other->phases);
+	for (ThroughputByType::iterator it = other->throughput.begin(); it != other->throughput.end(); ++it) {
+		VerboseGCLogThroughput *target = &throughput[it->first];
+		target->rates.insert(target->rates.end(), it->second.rates.begin(), it->second.rates.end());
+		target->bytes += it->second.bytes;
+		target->timeMs += it->second.timeMs;
+	}
+	allocations.insert(allocations.end(), other->allocations.begin(), other->allocations.end());
+	fileCount += other->fileCount;
+	incompleteFileCount += other->incompleteFileCount;
+}
+
+static int J9THREAD_PROC
+analyzeFiles(void *entryArg)
+{
+	AnalysisTask *task = (AnalysisTask *)entryArg;
+	OMRPORT_ACCESS_FROM_OMRPORT(task->portLibrary);
+	VerboseGCLogReader reader(task->portLibrary);
+
+	while (true) {
+		omrthread_monitor_enter(task->monitor);
+		uintptr_t index = task->nextFile;
+		task->nextFile += 1;
+		omrthread_monitor_exit(task->monitor);
+
+		if (index >= task->files->size()) {
+			break;
+		}
+
+		const char *fileName = (*task->files)[index].c_str();
+		VerboseGCLogAnalysis *analysis = &(*task->results)[index];
+		VerboseGCLogAnalyzer analyzer(analysis);
+		analysis->fileCount = 1;
+		switch (reader.parseFile(fileName, &analyzer)) {
+		case VERBOSEGCLOG_READ_COMPLETE:
+			break;
+		case VERBOSEGCLOG_READ_TRUNCATED:
+			/* the last record was not written completely, the results include the records before it */
+			analysis->incompleteFileCount = 1;
+			break;
+		default:
+			/* keep whatever was read before the error */
+			omrtty_err_printf("Error reading %s, the results include the data up to the error\n", fileName);
+			analysis->incompleteFileCount = 1;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+bool
+VerboseGCLogAnalysis::analyzeFiles(OMRPortLibrary *portLibrary, std::vector<std::string> *files, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	std::vector<VerboseGCLogAnalysis> results(files->size());
+	std::vector<omrthread_t> threads;
+	AnalysisTask task;
+	bool result = true;
+
+	task.portLibrary = portLibrary;
+	task.files = files;
+	task.results = &results;
+	task.nextFile = 0;
+	if (0 != omrthread_monitor_init_with_name(&task.monitor, 0, "AnalysisTask::monitor")) {
+		omrtty_err_printf("Failed to create the analysis monitor\n");
+		return false;
+	}
+
+	omrthread_attr_t attr = NULL;
+	if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+		|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+	) {
+		omrtty_err_printf("Failed to initialize the worker thread attributes\n");
+		result = false;
+	}
+
+	/* the current thread analyzes files as well */
+	for (uintptr_t i = 1; result && (i < threadCount); i++) {
+		omrthread_t thread = NULL;
+		if (J9THREAD_SUCCESS != omrthread_create_ex(&thread, &attr, 0, ::analyzeFiles, &task)) {
+			/* continue with the threads created so far */
+			break;
+		}
+		threads.push_back(thread);
+	}
+	if (NULL != attr) {
+		omrthread_attr_destroy(&attr);
+	}
+
+	if (result) {
+		::analyzeFiles(&task);
+	}
+	for (std::vector<omrthread_t>::iterator it = threads.begin(); it != threads.end(); ++it) {
+		omrthread_join(*it);
+	}
+	omrthread_monitor_destroy(task.monitor);
+
+	/* the results are merged in the order of files, so the rotated logs of a set are merged in order */
+	for (std::vector<VerboseGCLogAnalysis>::iterator it = results.begin(); it != results.end(); ++it) {
+		merge(&*it);
+	}
+	sortAllocations();
+
+	return result;
+}
+
+void
+VerboseGCLogAnalysis::sortAllocations()
+{
+	/* stable, so samples with equal (millisecond) timestamps keep their log order */
+	std::stable_sort(allocations.begin(), allocations.end(), compareAllocationSamples);
+}
+
+static void
+writeSummaryEntry(OMRPortLibrary *portLibrary, intptr_t fd, const char *format, const char *metric, const char *type, const char *unit, VerboseGCLogSummary *summary, bool first)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	if (0 == strcmp(format, "csv")) {
+		omrfile_printf(fd, "%s,%s,%s,%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+				metric, type, unit, summary->count, summary->total, summary->mean, summary->p50, summary->p99, summary->p999, summary->max);
+	} else if (0 == strcmp(format, "json")) {
+		omrfile_printf(fd, "%s\"%s\": {\"unit\": \"%s\", \"count\": %zu, \"total\": %.3f, \"mean\": %.3f, \"p50\": %.3f, \"p99\": %.3f, \"p999\": %.3f, \"max\": %.3f}",
+				first ? "" : ", ", type, unit, summary->count, summary->total, summary->mean, summary->p50, summary->p99, summary->p999, summary->max);
+	} else {
+		omrfile_printf(fd, "%-10s %-20s %10zu %12.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+				metric, type, summary->count, summary->total, summary->mean, summary->p50, summary->p99, summary->p999, summary->max);
+	}
+}
+
+static void
+writeDurations(OMRPortLibrary *portLibrary, intptr_t fd, const char *format, const char *metric, VerboseGCLogAnalysis::DurationsByType *durations)
+{
+	bool first = true;
+	for (VerboseGCLogAnalysis::DurationsByType::iterator it = durations->begin(); it != durations->end(); ++it) {
+		VerboseGCLogSummary summary = VerboseGCLogSummary::summarize(&it->second);
+		writeSummaryEntry(portLibrary, fd, format, metric, it->first.c_str(), "ms", &summary, first);
+		first = false;
+	}
+}
+
+static void
+writeThroughput(OMRPortLibrary *portLibrary, intptr_t fd, const char *format, const char *metric, VerboseGCLogAnalysis::ThroughputByType *throughput)
+{
+	bool first = true;
+	for (VerboseGCLogAnalysis::ThroughputByType::iterator it = throughput->begin(); it != throughput->end(); ++it) {
+		VerboseGCLogSummary summary = VerboseGCLogSummary::summarize(&it->second.rates);
+		/* the overall rate, rather than a sum of rates */
+		summary.total = (0 < it->second.timeMs) ? ((it->second.bytes / (1024.0 * 1024.0)) / (it->second.timeMs / 1000.0)) : 0.0;
+		writeSummaryEntry(portLibrary, fd, format, metric, it->first.c_str(), "MB/s", &summary, first);
+		first = false;
+	}
+}
+
+void
+VerboseGCLogAnalysis::writeSummary(OMRPortLibrary *portLibrary, intptr_t fd, const char *format)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	VerboseGCLogSummary pauseSummary = VerboseGCLogSummary::summarize(&pauses);
+
+	if (0 == strcmp(format, "csv")) {
+		omrfile_printf(fd, "metric,type,unit,count,total,mean,p50,p99,p999,max\n");
+		writeSummaryEntry(portLibrary, fd, format, "pause", "all", "ms", &pauseSummary, true);
+		writeDurations(portLibrary, fd, format, "collection", &collections);
+		writeDurations(portLibrary, fd, format, "phase", &phases);
+		writeThroughput(portLibrary, fd, format, "throughput", &throughput);
+	} else if (0 == strcmp(format, "json")) {
+		omrfile_printf(fd, "{\"files\": %zu, \"incompleteFiles\": %zu,\n", fileCount, incompleteFileCount);
+		omrfile_printf(fd, " \"pause\": {");
+		writeSummaryEntry(portLibrary, fd, format, "pause", "all", "ms", &pauseSummary, true);
+		omrfile_printf(fd, "},\n \"collections\": {");
+		writeDurations(portLibrary, fd, format, "collection", &collections);
+		omrfile_printf(fd, "},\n \"phases\": {");
+		writeDurations(portLibrary, fd, format, "phase", &phases);
+		omrfile_printf(fd, "},\n \"throughput\": {");
+		writeThroughput(portLibrary, fd, format, "throughput", &throughput);
+		omrfile_printf(fd, "}}\n");
+	} else {
+		omrfile_printf(fd, "Results for %zu verbose GC file(s) (times in ms)\n", fileCount);
+		if (0 != incompleteFileCount) {
+			omrfile_printf(fd, "%zu file(s) ended within a record, the results include the records before it\n", incompleteFileCount);
+		}
+		omrfile_printf(fd, "\n");
+		omrfile_printf(fd, "%-10s %-20s %10s %12s %10s %10s %10s %10s %10s\n", "", "Type", "Count", "Total", "Mean", "p50", "p99", "p99.9", "Max");
+		omrfile_printf(fd, "---------------------------------------------------------------------------------------------------------\n");
+		writeSummaryEntry(portLibrary, fd, format, "Pause", "all", "ms", &pauseSummary, true);
+		writeDurations(portLibrary, fd, format, "Collection", &collections);
+		writeDurations(portLibrary, fd, format, "Phase", &phases);
+		if (!throughput.empty()) {
+			omrfile_printf(fd, "\nThroughput (MB/s)\n\n");
+			omrfile_printf(fd, "%-10s %-20s %10s %12s %10s %10s %10s %10s %10s\n", "", "Type", "Count", "Overall", "Mean", "p50", "p99", "p99.9", "Max");
+			omrfile_printf(fd, "---------------------------------------------------------------------------------------------------------\n");
+			writeThroughput(portLibrary, fd, format, "Phase", &throughput);
+		}
+		omrfile_printf(fd, "\n");
+	}
+}
+
+void
+VerboseGCLogAnalysis::writeAllocations(OMRPortLibrary *portLibrary, intptr_t fd, const char *format)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool json = (0 == strcmp(format, "json"));
+	bool csv = (0 == strcmp(format, "csv"));
+
+	if (csv) {
+		omrfile_printf(fd, "timestamp,interval_ms,allocated_bytes,rate_mb_per_s\n");
+	} else if (json) {
+		omrfile_printf(fd, "[");
+	} else {
+		omrfile_printf(fd, "%-24s %12s %16s %14s\n", "Timestamp", "Interval", "Allocated", "MB/s");
+	}
+
+	for (std::vector<VerboseGCLogAllocationSample>::const_iterator it = allocations.begin(); it != allocations.end(); ++it) {
+		double rate = (0 < it->intervalMs) ? ((it->allocatedBytes / (1024.0 * 1024.0)) / (it->intervalMs / 1000.0)) : 0.0;
+		if (csv) {
+			omrfile_printf(fd, "%s,%.3f,%llu,%.3f\n", it->timestamp.c_str(), it->intervalMs, (unsigned long long)it->allocatedBytes, rate);
+		} else if (json) {
+			omrfile_printf(fd, "%s\n {\"timestamp\": \"%s\", \"intervalms\": %.3f, \"allocatedBytes\": %llu, \"rateMBPerSecond\": %.3f}",
+					(it == allocations.begin()) ? "" : ",", it->timestamp.c_str(), it->intervalMs, (unsigned long long)it->allocatedBytes, rate);
+		} else {
+			omrfile_printf(fd, "%-24s %12.3f %16llu %14.3f\n", it->timestamp.c_str(), it->intervalMs, (unsigned long long)it->allocatedBytes, rate);
+		}
+	}
+
+	if (json) {
+		omrfile_printf(fd, "\n]\n");
+	}
+}
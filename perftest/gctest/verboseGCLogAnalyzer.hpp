@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCLOGANALYZER_HPP_)
+#define VERBOSEGCLOGANALYZER_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "omrport.h"
+
+#include "verboseGCLogReader.hpp"
+
+/**
+ * Amount allocated between two collections.
+ */
+struct VerboseGCLogAllocationSample {
+	std::string timestamp; /**< timestamp of the cycle which reported the allocation */
+	double intervalMs; /**< time since the previous cycle started */
+	uint64_t allocatedBytes; /**< bytes allocated since the previous collection */
+};
+
+/**
+ * Distribution of a set of durations (in milliseconds).
+ */
+struct VerboseGCLogSummary {
+	uintptr_t count;
+	double total;
+	double mean;
+	double p50;
+	double p99;
+	double p999;
+	double max;
+
+	/**
+	 * Summarize the given values (which are sorted in place). Percentiles use the nearest-rank method.
+	 */
+	static VerboseGCLogSummary summarize(std::vector<double> *values);
+};
+
+/**
+ * Rate at which a collection phase processed memory.
+ */
+struct VerboseGCLogThroughput {
+	std::vector<double> rates; /**< MB/s of each phase */
+	double bytes; /**< bytes processed by all phases */
+	double timeMs; /**< time taken by all phases */
+
+	VerboseGCLogThroughput()
+		: bytes(0)
+		, timeMs(0)
+	{
+	}
+};
+
+/**
+ * Data collected from one or more verbose GC logs.
+ */
+class VerboseGCLogAnalysis {
+public:
+	typedef std::map<std::string, std::vector<double> > DurationsByType;
+	typedef std::map<std::string, VerboseGCLogThroughput> ThroughputByType;
+
+	std::vector<double> pauses; /**< durations of the exclusive access (stop-the-world) periods */
+	DurationsByType collections; /**< durations of the collections (gc-start to gc-end) by collection type */
+	DurationsByType phases; /**< durations of the collection phases (gc-op) by phase type */
+	ThroughputByType throughput; /**< processing rate of the collection phases by phase type */
+	std::vector<VerboseGCLogAllocationSample> allocations;
+	uintptr_t fileCount;
+	uintptr_t incompleteFileCount; /**< files which were truncated or could not be read to the end */
+
+	/**
+	 * Analyze the given files with threadCount threads (including the current thread) and merge the results
+	 * in the order of files, which must list the logs of a rotated set in rotation order.
+	 * @return false if the analysis could not be started
+	 */
+	bool analyzeFiles(OMRPortLibrary *portLibrary, std::vector<std::string> *files, uintptr_t threadCount);
+
+	/**
+	 * Append the data of other. Analyses of rotated logs must be merged in file order.
+	 */
+	void merge(VerboseGCLogAnalysis *other);
+
+	/**
+	 * Order the allocation samples by time (after merging).
+	 */
+	void sortAllocations();
+
+	/**
+	 * Write the summary in the given format ("text", "csv" or "json") to fd. Durations are reported in ms,
+	 * with total being their sum. Throughput is reported in MB/s, with total being the overall rate of all
+	 * phases of a type.
+	 */
+	void writeSummary(OMRPortLibrary *portLibrary, intptr_t fd, const char *format);
+
+	/**
+	 * Write the allocation rate time series in the given format ("text", "csv" or "json") to fd.
+	 */
+	void writeAllocations(OMRPortLibrary *portLibrary, intptr_t fd, const char *format);
+
+	VerboseGCLogAnalysis()
+		: fileCount(0)
+		, incompleteFileCount(0)
+	{
+	}
+};
+
+/**
+ * Handler which collects pause times, phase times and allocation samples from a verbose GC log.
+ *
+ * Phase throughput is measured in the bytes each phase reports: scanned bytes for mark, copied bytes
+ * for scavenge and moved bytes for compact. Sweep does not report a byte count and is measured
+ * against the size of the heap.
+ */
+class VerboseGCLogAnalyzer : public VerboseGCLogHandler {
+private:
+	VerboseGCLogAnalysis *_analysis;
+	std::string _cycleTimestamp; /**< timestamp of the most recent cycle-start */
+	double _cycleIntervalMs; /**< intervalms of the most recent cycle-start */
+	uint64_t _heapTotalBytes; /**< heap size reported by the most recent gc-start */
+	bool _expectHeapInfo; /**< true between gc-start and its mem-info */
+	std::string _phaseType; /**< type of the enclosing gc-op, empty outside of gc-op */
+	double _phaseTimeMs;
+	uint64_t _phaseBytes; /**< bytes processed by the enclosing gc-op */
+
+public:
+	virtual void startElement(const char *name, const VerboseGCLogAttribute *attributes, uintptr_t attributeCount);
+	virtual void endElement(const char *name);
+
+	VerboseGCLogAnalyzer(VerboseGCLogAnalysis *analysis)
+		: VerboseGCLogHandler()
+		, _analysis(analysis)
+		, _cycleIntervalMs(0)
+		, _heapTotalBytes(0)
+		, _expectHeapInfo(false)
+		, _phaseTimeMs(0)
+		, _phaseBytes(0)
+	{
+	}
+};
+
+#endif /* VERBOSEGCLOGANALYZER_HPP_ */
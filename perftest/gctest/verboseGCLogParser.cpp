@@ -20,37 +20,112 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 #include <algorithm>
+#include <string>
 #include <vector>
-#include <iterator>
-#include <numeric>
 #include <stdio.h>
 
-#include "pugixml.hpp"
-
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
 
-const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
-const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
-const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
-const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+#include "verboseGCLogAnalyzer.hpp"
+
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
+/**
+ * Pause time limits (in ms) used to fail the run on GC regressions. Negative values disable the limit.
+ */
+struct PauseLimits {
+	double p50;
+	double p99;
+	double p999;
+	double max;
+};
+
+static void
+printUsage(OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrtty_printf("Usage: omrperfgctest [options] [verbose GC log ...]\n\n");
+	omrtty_printf("Analyzes the given verbose GC logs (a rotated set is treated as one log). With no logs given, the\n");
+	omrtty_printf("%s* files in the current directory are analyzed and then deleted.\n\n", VERBOSE_GC_FILE_PREFIX);
+	omrtty_printf("  -format=<text|csv|json>  format of the reports (default text)\n");
+	omrtty_printf("  -output=<file>           write the pause/phase summary to file instead of stdout\n");
+	omrtty_printf("  -series=<file>           write the allocation rate time series to file\n");
+	omrtty_printf("  -threads=<n>             number of files to analyze in parallel (default: number of CPUs)\n");
+	omrtty_printf("  -maxPauseP50=<ms>        fail if the median pause exceeds the limit\n");
+	omrtty_printf("  -maxPauseP99=<ms>        fail if the 99th percentile pause exceeds the limit\n");
+	omrtty_printf("  -maxPauseP999=<ms>       fail if the 99.9th percentile pause exceeds the limit\n");
+	omrtty_printf("  -maxPause=<ms>           fail if the longest pause exceeds the limit\n");
+	omrtty_printf("  -keepVerboseLog          do not delete the logs found in the current directory\n");
+}
+
+/**
+ * Open the report file, or return the tty if no file name is given.
+ */
+static intptr_t
+openReport(OMRPortLibrary *portLibrary, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	if (NULL == fileName) {
+		return OMRPORT_TTY_OUT;
+	}
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		omrtty_err_printf("Failed to open %s\n", fileName);
+	}
+	return fd;
+}
+
+static void
+closeReport(OMRPortLibrary *portLibrary, intptr_t fd)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	if ((OMRPORT_TTY_OUT != fd) && (-1 != fd)) {
+		omrfile_close(fd);
+	}
+}
 
-int main(void)
+static bool
+checkPauseLimit(OMRPortLibrary *portLibrary, const char *name, double value, double limit)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	if ((0 <= limit) && (value > limit)) {
+		omrtty_err_printf("GC regression: %s pause %.3fms exceeds the limit of %.3fms\n", name, value, limit);
+		return false;
+	}
+	return true;
+}
+
+static bool
+parseLimit(const char *arg, const char *option, double *limit)
+{
+	uintptr_t length = strlen(option);
+	if (0 == strncmp(arg, option, length)) {
+		*limit = strtod(arg + length, NULL);
+		return true;
+	}
+	return false;
+}
+
+int main(int argc, char **argv)
 {
-	int32_t totalFiles = 0;
 	intptr_t rc = 0;
 	char resultBuffer[128];
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	std::vector<std::string> files;
+	const char *format = "text";
+	const char *outputFileName = NULL;
+	const char *seriesFileName = NULL;
+	uintptr_t threadCount = 0;
+	bool keepVerboseLog = false;
+	PauseLimits limits = { -1, -1, -1, -1 };
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -66,142 +141,110 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
-	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
-
-	if(rcFile == (uintptr_t)-1) {
-		fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
-		return -1;
-	}
-
-	while ((uintptr_t)-1 != rcFile) {
-		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
-			totalFiles++;
-			/* Clean up verbose log file */
-			omrfile_unlink(resultBuffer);
+	for (int i = 1; (0 == rc) && (i < argc); i++) {
+		const char *arg = argv[i];
+		if (0 == strncmp(arg, "-format=", 8)) {
+			format = arg + 8;
+			if ((0 != strcmp(format, "text")) && (0 != strcmp(format, "csv")) && (0 != strcmp(format, "json"))) {
+				rc = -1;
+			}
+		} else if (0 == strncmp(arg, "-output=", 8)) {
+			outputFileName = arg + 8;
+		} else if (0 == strncmp(arg, "-series=", 8)) {
+			seriesFileName = arg + 8;
+		} else if (0 == strncmp(arg, "-threads=", 9)) {
+			threadCount = (uintptr_t)atoi(arg + 9);
+		} else if (0 == strcmp(arg, "-keepVerboseLog")) {
+			keepVerboseLog = true;
+		} else if (parseLimit(arg, "-maxPauseP50=", &limits.p50)
+			|| parseLimit(arg, "-maxPauseP999=", &limits.p999)
+			|| parseLimit(arg, "-maxPauseP99=", &limits.p99)
+			|| parseLimit(arg, "-maxPause=", &limits.max)
+		) {
+			/* limit parsed */
+		} else if ('-' == arg[0]) {
+			rc = -1;
+		} else {
+			files.push_back(arg);
 		}
-		rcFile = omrfile_findnext(handle, resultBuffer);
 	}
-	if (handle != (uintptr_t)-1) {
-		omrfile_findclose(handle);
-	}
-
-	if(totalFiles < 1) {
-		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
-	}
-
-	portLibrary.port_shutdown_library(&portLibrary);
-	omrthread_detach(NULL);
-}
-
-double
-getAvg(std::vector<double> v)
-{
-	double sum = std::accumulate(v.begin(), v.end(), 0.0);
-	double avg = sum / v.size();
-	return avg;
-}
-
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
-{
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
-
-	pugi::xpath_node_set markTimes;
-	pugi::xpath_node_set sweepTimes;
-	pugi::xpath_node_set expandTimes;
-	pugi::xpath_node_set gcTimes;
-
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
-
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
-
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
-
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
-
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
-
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
-		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
-	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
-	}
-
-	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
-	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
-	}
-
-	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
-	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
-	}
-
-	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
-	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
+	if (0 != rc) {
+		printUsage(&portLibrary);
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return -1;
 	}
 
-	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
-	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
-	}
+	bool deleteFiles = files.empty() && !keepVerboseLog;
+	if (files.empty()) {
+		rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
-	if (!mark_values.empty()) {
-		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
-		minMark = *std::min_element(mark_values.begin(), mark_values.end());
-		avgMark = getAvg(mark_values);
-	}
+		if(rcFile == (uintptr_t)-1) {
+			fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
+			return -1;
+		}
 
-	if (!sweep_values.empty()) {
-		maxSweep = *std::max_element(sweep_values.begin(), sweep_values.end());
-		minSweep = *std::min_element(sweep_values.begin(), sweep_values.end());
-		avgSweep = getAvg(sweep_values);
+		while ((uintptr_t)-1 != rcFile) {
+			if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
+				files.push_back(resultBuffer);
+			}
+			rcFile = omrfile_findnext(handle, resultBuffer);
+		}
+		if (handle != (uintptr_t)-1) {
+			omrfile_findclose(handle);
+		}
 	}
+	std::sort(files.begin(), files.end());
 
-	if (!expand_values.empty()) {
-		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
-		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
-		avgExpand = getAvg(expand_values);
-	}
+	if(files.empty()) {
+		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
+	} else {
+		VerboseGCLogAnalysis analysis;
+		if (0 == threadCount) {
+			threadCount = (uintptr_t)omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+		}
+		threadCount = OMR_MAX(1, OMR_MIN(threadCount, files.size()));
+
+		if (!analysis.analyzeFiles(&portLibrary, &files, threadCount)) {
+			rc = -1;
+		} else {
+			intptr_t fd = openReport(&portLibrary, outputFileName);
+			if (-1 == fd) {
+				rc = -1;
+			} else {
+				analysis.writeSummary(&portLibrary, fd, format);
+				closeReport(&portLibrary, fd);
+			}
+			if (NULL != seriesFileName) {
+				fd = openReport(&portLibrary, seriesFileName);
+				if (-1 == fd) {
+					rc = -1;
+				} else {
+					analysis.writeAllocations(&portLibrary, fd, format);
+					closeReport(&portLibrary, fd);
+				}
+			}
+
+			VerboseGCLogSummary pauses = VerboseGCLogSummary::summarize(&analysis.pauses);
+			bool withinLimits = checkPauseLimit(&portLibrary, "p50", pauses.p50, limits.p50);
+			withinLimits = checkPauseLimit(&portLibrary, "p99", pauses.p99, limits.p99) && withinLimits;
+			withinLimits = checkPauseLimit(&portLibrary, "p99.9", pauses.p999, limits.p999) && withinLimits;
+			withinLimits = checkPauseLimit(&portLibrary, "max", pauses.max, limits.max) && withinLimits;
+			if ((0 == rc) && !withinLimits) {
+				rc = 1;
+			}
+		}
 
-	if (!gcduration_values.empty()) {
-		maxGCDuration = *std::max_element(gcduration_values.begin(), gcduration_values.end());
-		minGCDuration = *std::min_element(gcduration_values.begin(), gcduration_values.end());
-		avgGCDuration = getAvg(gcduration_values);
+		if (deleteFiles) {
+			/* Clean up verbose log files */
+			for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it) {
+				omrfile_unlink(it->c_str());
+			}
+		}
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
-
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	return (int)rc;
 }
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "verboseGCLogReader.hpp"
+
+static bool
+isSpace(char c)
+{
+	return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+
+/**
+ * Replace the predefined entity references in value (in place).
+ */
+static void
+decodeEntities(char *value)
+{
+	static const struct {
+		const char *reference;
+		char character;
+	} entities[] = {
+		{ "&lt;", '<' }, { "&gt;", '>' }, { "&amp;", '&' }, { "&quot;", '"' }, { "&apos;", '\'' }
+	};
+	char *read = strchr(value, '&');
+	char *write = read;
+
+	while ((NULL != read) && ('\0' != *read)) {
+		char c = *read;
+		uintptr_t length = 1;
+		if ('&' == c) {
+			for (uintptr_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+				uintptr_t referenceLength = strlen(entities[i].reference);
+				if (0 == strncmp(read, entities[i].reference, referenceLength)) {
+					c = entities[i].character;
+					length = referenceLength;
+					break;
+				}
+			}
+		}
+		*write++ = c;
+		read += length;
+	}
+	if (NULL != write) {
+		*write = '\0';
+	}
+}
+
+char *
+VerboseGCLogReader::findMarkupEnd(char *cursor, char *end)
+{
+	uintptr_t available = end - cursor;
+
+	if ((available >= 4) && (0 == strncmp(cursor, "<!--", 4))) {
+		for (char *scan = cursor + 4; (scan + 3) <= end; scan++) {
+			if (('-' == scan[0]) && ('-' == scan[1]) && ('>' == scan[2])) {
+				return scan + 3;
+			}
+		}
+		return NULL;
+	}
+
+	char quote = '\0';
+	for (char *scan = cursor + 1; scan < end; scan++) {
+		char c = *scan;
+		if ('\0' != quote) {
+			if (c == quote) {
+				quote = '\0';
+			}
+		} else if (('"' == c) || ('\'' == c)) {
+			quote = c;
+		} else if ('>' == c) {
+			return scan + 1;
+		}
+	}
+	return NULL;
+}
+
+bool
+VerboseGCLogReader::parseTag(char *cursor, char *end, VerboseGCLogHandler *handler)
+{
+	/* cursor points after '<' and end at the closing '>' */
+	char first = *cursor;
+	if (('?' == first) || ('!' == first)) {
+		/* XML declaration, comment or DOCTYPE */
+		return true;
+	}
+
+	bool isEndTag = ('/' == first);
+	if (isEndTag) {
+		cursor += 1;
+	}
+	bool isEmptyElement = !isEndTag && (end > cursor) && ('/' == end[-1]);
+	if (isEmptyElement) {
+		end -= 1;
+	}
+	*end = '\0';
+
+	char *name = cursor;
+	while ((cursor < end) && !isSpace(*cursor)) {
+		cursor += 1;
+	}
+	if (name == cursor) {
+		return false;
+	}
+	if (cursor < end) {
+		*cursor++ = '\0';
+	}
+
+	if (isEndTag) {
+		if (0 == _depth) {
+			/* no matching start tag */
+			return false;
+		}
+		_depth -= 1;
+		handler->endElement(name);
+		return true;
+	}
+
+	uintptr_t attributeCount = 0;
+	while (cursor < end) {
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if (cursor == end) {
+			break;
+		}
+		char *attributeName = cursor;
+		while ((cursor < end) && ('=' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		char *attributeNameEnd = cursor;
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ((cursor == end) || ('=' != *cursor)) {
+			return false;
+		}
+		cursor += 1;
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ((cursor == end) || (('"' != *cursor) && ('\'' != *cursor))) {
+			return false;
+		}
+		char quote = *cursor++;
+		char *value = cursor;
+		while ((cursor < end) && (quote != *cursor)) {
+			cursor += 1;
+		}
+		if (cursor == end) {
+			return false;
+		}
+		*attributeNameEnd = '\0';
+		*cursor++ = '\0';
+		decodeEntities(value);
+
+		/* attributes beyond the limit are ignored; verbose GC tags have far fewer */
+		if (attributeCount < VERBOSEGCLOG_MAX_ATTRIBUTES) {
+			_attributes[attributeCount].name = attributeName;
+			_attributes[attributeCount].value = value;
+			attributeCount += 1;
+		}
+	}
+
+	handler->startElement(name, _attributes, attributeCount);
+	if (isEmptyElement) {
+		handler->endElement(name);
+	} else {
+		_depth += 1;
+	}
+	return true;
+}
+
+VerboseGCLogReadResult
+VerboseGCLogReader::parseFile(const char *fileName, VerboseGCLogHandler *handler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return VERBOSEGCLOG_READ_FAILED;
+	}
+
+	/* omrfile_read() fails at the end of the file, so read no more than the length of the file */
+	int64_t remaining = omrfile_flength(fd);
+	bool result = (0 <= remaining);
+	bool endOfFile = false;
+	uintptr_t used = 0;
+	_buffer.resize(VERBOSEGCLOG_READ_SIZE);
+	_depth = 0;
+
+	while (result && !endOfFile) {
+		if ((_buffer.size() - used) < (VERBOSEGCLOG_READ_SIZE / 2)) {
+			/* a single tag filled the buffer */
+			_buffer.resize(_buffer.size() * 2);
+		}
+		intptr_t bytesRead = 0;
+		if (0 < remaining) {
+			bytesRead = omrfile_read(fd, &_buffer[used], (intptr_t)OMR_MIN((int64_t)(_buffer.size() - used), remaining));
+			if (bytesRead <= 0) {
+				result = false;
+				break;
+			}
+			remaining -= bytesRead;
+		}
+		endOfFile = (0 == remaining);
+		used += bytesRead;
+
+		char *cursor = &_buffer[0];
+		char *end = cursor + used;
+		while (cursor < end) {
+			char *markup = (char *)memchr(cursor, '<', end - cursor);
+			if (NULL == markup) {
+				/* character data only */
+				cursor = end;
+				break;
+			}
+			char *markupEnd = findMarkupEnd(markup, end);
+			if (NULL == markupEnd) {
+				/* incomplete, keep the tag for the next read */
+				cursor = markup;
+				break;
+			}
+			if (!parseTag(markup + 1, markupEnd - 1, handler)) {
+				result = false;
+				break;
+			}
+			cursor = markupEnd;
+		}
+
+		used = end - cursor;
+		memmove(&_buffer[0], cursor, used);
+	}
+
+	omrfile_close(fd);
+	if (!result) {
+		return VERBOSEGCLOG_READ_FAILED;
+	}
+	/* a trailing partial tag or unclosed element is left by a process which did not shut down */
+	return ((0 != used) || (0 != _depth)) ? VERBOSEGCLOG_READ_TRUNCATED : VERBOSEGCLOG_READ_COMPLETE;
+}
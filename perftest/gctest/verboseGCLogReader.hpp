@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCLOGREADER_HPP_)
+#define VERBOSEGCLOGREADER_HPP_
+
+#include <vector>
+
+#include "omrport.h"
+
+#define VERBOSEGCLOG_READ_SIZE (1024 * 1024)
+#define VERBOSEGCLOG_MAX_ATTRIBUTES 32
+
+/**
+ * Result of reading a verbose GC log.
+ */
+typedef enum VerboseGCLogReadResult {
+	VERBOSEGCLOG_READ_COMPLETE = 0,
+	VERBOSEGCLOG_READ_TRUNCATED, /**< the log ends within a tag or element (e.g. the process did not shut down) */
+	VERBOSEGCLOG_READ_FAILED /**< the file could not be read or is not well formed */
+} VerboseGCLogReadResult;
+
+/**
+ * An attribute of an element reported by VerboseGCLogReader. The strings are only valid
+ * for the duration of the callback.
+ */
+struct VerboseGCLogAttribute {
+	const char *name;
+	const char *value;
+};
+
+/**
+ * Receives the elements of a verbose GC log in document order.
+ */
+class VerboseGCLogHandler {
+public:
+	/**
+	 * Called for every start tag (and for every empty element tag, followed by endElement()).
+	 */
+	virtual void startElement(const char *name, const VerboseGCLogAttribute *attributes, uintptr_t attributeCount) = 0;
+	virtual void endElement(const char *name) = 0;
+
+	virtual ~VerboseGCLogHandler() {}
+};
+
+/**
+ * Streaming (SAX-style) reader for verbose GC logs.
+ *
+ * The file is read in fixed size chunks and each tag is reported to the handler as soon as it has been
+ * read, so memory use does not depend on the size of the log. Only the subset of XML written by the
+ * verbose GC writers is understood: elements, attributes, comments and processing instructions.
+ * Character data is skipped.
+ */
+class VerboseGCLogReader {
+private:
+	OMRPortLibrary *_portLibrary;
+	std::vector<char> _buffer; /**< holds the unparsed tail of the file */
+	VerboseGCLogAttribute _attributes[VERBOSEGCLOG_MAX_ATTRIBUTES];
+	uintptr_t _depth; /**< number of elements which have been started but not ended */
+
+	/**
+	 * Find the end of the markup starting at cursor (which points at '<').
+	 * @return the character following the markup, or NULL if the markup is not complete
+	 */
+	char *findMarkupEnd(char *cursor, char *end);
+	/**
+	 * Parse a tag in place and report it to the handler.
+	 * @return false if the tag is malformed
+	 */
+	bool parseTag(char *cursor, char *end, VerboseGCLogHandler *handler);
+
+public:
+	/**
+	 * Read the given log and report its elements to handler. The elements of a truncated log are reported
+	 * up to the last complete tag.
+	 * @return whether the log was read to its end, was truncated or could not be read
+	 */
+	VerboseGCLogReadResult parseFile(const char *fileName, VerboseGCLogHandler *handler);
+
+	VerboseGCLogReader(OMRPortLibrary *portLibrary)
+		: _portLibrary(portLibrary)
+		, _depth(0)
+	{
+	}
+};
+
+#endif /* VERBOSEGCLOGREADER_HPP_ */
@@ -46,4 +46,12 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+# Run the GC benchmark configurations and write a CSV summary (pause distributions and phase throughput) per configuration
+omr_gcbenchmark:
+	./omrgctest --gtest_filter="perfBenchmark*" -keepVerboseLog
+	for log in VerboseGC-benchmark_*.xml; do \
+		./omrperfgctest -format=csv -output=$${log%.xml}.csv $$log || exit 1; \
+		rm -f $$log; \
+	done
+
+.PHONY: all test omr_perfgctest omr_gcbenchmark 
@@ -1565,7 +1565,7 @@ allocAnywhere:
 		Trc_PRT_vmem_omrvmem_reserve_memory_ex_UnableToAllocateWithinSpecifiedRange(byteAmount, startAddress, endAddress);
 
 		memoryPointer = NULL;
-	} else {
+	} else if (OMR_ARE_NO_BITS_SET(vmemOptions, OMRPORT_VMEM_NO_ADVISE_HUGEPAGE)) {
 		adviseHugepage(portLibrary, memoryPointer, byteAmount);
 	}
 
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * vgcdecode: convert a binary verbose GC log (written with -Xgc:binaryLogging) to the XML verbose GC format.
+ *
+ * usage: vgcdecode <binary log> [<xml output>]
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "VerboseBinaryFormat.hpp"
+
+#define DROPPED_RECORDS_COMMENT "<!-- %llu verbose records dropped -->\n"
+
+static void
+writeText(void *userData, const char *text, uintptr_t length)
+{
+	fwrite(text, 1, length, (FILE *)userData);
+}
+
+static uintptr_t
+formatText(void *userData, char *buffer, uintptr_t length, const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	int result = vsnprintf(buffer, length, format, args);
+	va_end(args);
+
+	return (result < 0) ? 0 : (uintptr_t)result;
+}
+
+static int
+decode(FILE *input, FILE *output, const char *inputName)
+{
+	MM_VerboseBinaryFileHeader fileHeader;
+	const char *formats[VERBOSE_BINARY_MAX_FORMATS];
+	uint8_t *payload = NULL;
+	uint32_t payloadCapacity = 0;
+	int rc = 0;
+
+	memset((void *)formats, 0, sizeof(formats));
+
+	if ((1 != fread(&fileHeader, sizeof(fileHeader), 1, input))
+		|| (0 != memcmp(fileHeader.magic, VERBOSE_BINARY_MAGIC, sizeof(VERBOSE_BINARY_MAGIC)))
+	) {
+		fprintf(stderr, "%s is not a binary verbose GC log\n", inputName);
+		return 1;
+	}
+	if (VERBOSE_BINARY_BYTE_ORDER_MARK != fileHeader.byteOrderMark) {
+		fprintf(stderr, "%s was written on a platform with a different byte order\n", inputName);
+		return 1;
+	}
+	if (VERBOSE_BINARY_VERSION != fileHeader.version) {
+		fprintf(stderr, "%s has unsupported version %u\n", inputName, (unsigned int)fileHeader.version);
+		return 1;
+	}
+
+	MM_VerboseBinaryRecordHeader record;
+	while (1 == fread(&record, sizeof(record), 1, input)) {
+		if ((record.size < sizeof(record)) || (0 != (record.size & 7))) {
+			fprintf(stderr, "%s: corrupt record\n", inputName);
+			rc = 1;
+			break;
+		}
+		uint32_t payloadSize = record.size - (uint32_t)sizeof(record);
+		if (payloadSize > payloadCapacity) {
+			free(payload);
+			payloadCapacity = payloadSize * 2;
+			payload = (uint8_t *)malloc(payloadCapacity);
+			if (NULL == payload) {
+				fprintf(stderr, "out of memory\n");
+				rc = 1;
+				break;
+			}
+		}
+		if ((0 != payloadSize) && (1 != fread(payload, payloadSize, 1, input))) {
+			fprintf(stderr, "%s: truncated record\n", inputName);
+			rc = 1;
+			break;
+		}
+
+		uint64_t value = 0;
+		if ((VERBOSE_RECORD_LINE == record.type) || (VERBOSE_RECORD_FORMAT == record.type) || (VERBOSE_RECORD_DROPPED == record.type)) {
+			if (payloadSize < sizeof(value)) {
+				fprintf(stderr, "%s: corrupt record\n", inputName);
+				rc = 1;
+				break;
+			}
+			memcpy(&value, payload, sizeof(value));
+		}
+
+		switch (record.type) {
+		case VERBOSE_RECORD_FORMAT:
+			if ((value >= VERBOSE_BINARY_MAX_FORMATS) || ('\0' != payload[payloadSize - 1])) {
+				fprintf(stderr, "%s: corrupt format record\n", inputName);
+				rc = 1;
+			} else {
+				free((void *)formats[value]);
+				formats[value] = strdup((const char *)(payload + sizeof(value)));
+			}
+			break;
+		case VERBOSE_RECORD_LINE:
+			if ((value >= VERBOSE_BINARY_MAX_FORMATS) || (NULL == formats[value])) {
+				fprintf(stderr, "%s: line uses undefined format %llu\n", inputName, (unsigned long long)value);
+				rc = 1;
+			} else {
+				for (uint32_t i = 0; i < record.indent; i++) {
+					fputs(VERBOSE_BINARY_INDENT_SPACER, output);
+				}
+				if (!MM_VerboseBinaryFormat::decodeLine(formats[value], payload + sizeof(value), payloadSize - sizeof(value), fileHeader.pointerSize, writeText, formatText, output)) {
+					fprintf(stderr, "%s: line does not match its format \"%s\"\n", inputName, formats[value]);
+					rc = 1;
+				}
+				fputc('\n', output);
+			}
+			break;
+		case VERBOSE_RECORD_TEXT:
+			/* the text is NUL terminated and may be followed by padding */
+			fwrite(payload, 1, strnlen((const char *)payload, payloadSize), output);
+			break;
+		case VERBOSE_RECORD_DROPPED:
+			fprintf(output, DROPPED_RECORDS_COMMENT, (unsigned long long)value);
+			break;
+		default:
+			/* padding and end of cycle records are not written to files, skip anything else */
+			break;
+		}
+		if (0 != rc) {
+			break;
+		}
+	}
+
+	for (uintptr_t i = 0; i < VERBOSE_BINARY_MAX_FORMATS; i++) {
+		free((void *)formats[i]);
+	}
+	free(payload);
+
+	return rc;
+}
+
+int
+main(int argc, char **argv)
+{
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "usage: %s <binary verbose GC log> [<xml output>]\n", argv[0]);
+		return 2;
+	}
+
+	FILE *input = fopen(argv[1], "rb");
+	if (NULL == input) {
+		fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	FILE *output = stdout;
+	if (3 == argc) {
+		output = fopen(argv[2], "w");
+		if (NULL == output) {
+			fprintf(stderr, "cannot open %s\n", argv[2]);
+			fclose(input);
+			return 1;
+		}
+	}
+
+	int rc = decode(input, output, argv[1]);
+
+	fclose(input);
+	if (stdout != output) {
+		fclose(output);
+	}
+
+	return rc;
+}